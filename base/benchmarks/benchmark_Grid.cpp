@@ -0,0 +1,130 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/tools/Benchmark.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using sgpp::base::BenchmarkState;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::GridType;
+using sgpp::base::HashGridPoint;
+
+namespace {
+
+Grid* createGrid(GridType gridType, int64_t dim) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.type_ = gridType;
+  gridConfig.dim_ = static_cast<size_t>(dim);
+  gridConfig.maxDegree_ = 3;
+  gridConfig.boundaryLevel_ = 1;
+  return Grid::createGrid(gridConfig);
+}
+
+void benchmarkRegularGridGeneration(BenchmarkState& state, GridType gridType) {
+  size_t gridSize = 0;
+
+  while (state.keepRunning()) {
+    std::unique_ptr<Grid> grid(createGrid(gridType, state.range(0)));
+    grid->getGenerator().regular(static_cast<size_t>(state.range(1)));
+    gridSize = grid->getSize();
+  }
+
+  state.setItemsProcessed(gridSize * state.getMaxIterations());
+  state.setLabel("N=" + std::to_string(gridSize));
+}
+
+void benchmarkHashGridLookup(BenchmarkState& state, GridType gridType) {
+  std::unique_ptr<Grid> grid(createGrid(gridType, state.range(0)));
+  grid->getGenerator().regular(static_cast<size_t>(state.range(1)));
+  sgpp::base::GridStorage& storage = grid->getStorage();
+
+  // look up all grid points in random order (half of them are not contained in the grid)
+  std::vector<HashGridPoint> points;
+  std::mt19937 generator(42);
+
+  for (size_t i = 0; i < storage.getSize(); i++) {
+    points.push_back(storage[i]);
+    HashGridPoint point(storage[i]);
+    point.set(generator() % point.getDimension(), 30, 1);
+    points.push_back(point);
+  }
+
+  std::shuffle(points.begin(), points.end(), generator);
+
+  while (state.keepRunning()) {
+    for (HashGridPoint& point : points) {
+      sgpp::base::doNotOptimize(storage.getSequenceNumber(point));
+    }
+  }
+
+  state.setItemsProcessed(points.size() * state.getMaxIterations());
+  state.setLabel("N=" + std::to_string(storage.getSize()));
+}
+
+void benchmarkSurplusRefinement(BenchmarkState& state, GridType gridType) {
+  const size_t refinements = 100;
+  size_t gridSize = 0;
+
+  while (state.keepRunning()) {
+    state.pauseTiming();
+    std::unique_ptr<Grid> grid(createGrid(gridType, state.range(0)));
+    grid->getGenerator().regular(static_cast<size_t>(state.range(1)));
+    DataVector alpha(grid->getSize());
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] = distribution(generator);
+    }
+
+    sgpp::base::SurplusRefinementFunctor functor(alpha, refinements);
+    state.resumeTiming();
+
+    grid->getGenerator().refine(functor);
+    gridSize = grid->getSize();
+  }
+
+  state.setItemsProcessed(refinements * state.getMaxIterations());
+  state.setLabel("N=" + std::to_string(gridSize));
+}
+
+}  // namespace
+
+SGPP_BENCHMARK_CAPTURE(benchmarkRegularGridGeneration, linear, GridType::Linear)
+    ->argNames({"dim", "level"})
+    ->args({2, 10})
+    ->args({5, 7})
+    ->args({10, 5});
+SGPP_BENCHMARK_CAPTURE(benchmarkRegularGridGeneration, linearBoundary, GridType::LinearBoundary)
+    ->argNames({"dim", "level"})
+    ->args({2, 10})
+    ->args({5, 6});
+
+SGPP_BENCHMARK_CAPTURE(benchmarkHashGridLookup, linear, GridType::Linear)
+    ->argNames({"dim", "level"})
+    ->args({2, 10})
+    ->args({5, 7})
+    ->args({10, 5});
+
+SGPP_BENCHMARK_CAPTURE(benchmarkSurplusRefinement, linear, GridType::Linear)
+    ->argNames({"dim", "level"})
+    ->args({2, 8})
+    ->args({5, 5})
+    ->args({10, 4});
+SGPP_BENCHMARK_CAPTURE(benchmarkSurplusRefinement, linearBoundary, GridType::LinearBoundary)
+    ->argNames({"dim", "level"})
+    ->args({2, 8})
+    ->args({5, 4});
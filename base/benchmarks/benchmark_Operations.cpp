@@ -0,0 +1,168 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/operation/hash/OperationHierarchisation.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/Benchmark.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <random>
+#include <string>
+
+using sgpp::base::BenchmarkState;
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::GridType;
+
+namespace {
+
+Grid* createRegularGrid(GridType gridType, int64_t dim, int64_t level) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.type_ = gridType;
+  gridConfig.dim_ = static_cast<size_t>(dim);
+  gridConfig.maxDegree_ = 3;
+  gridConfig.boundaryLevel_ = 1;
+  Grid* grid = Grid::createGrid(gridConfig);
+  grid->getGenerator().regular(static_cast<size_t>(level));
+  return grid;
+}
+
+DataVector randomVector(size_t size) {
+  DataVector vector(size);
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  for (size_t i = 0; i < size; i++) {
+    vector[i] = distribution(generator);
+  }
+
+  return vector;
+}
+
+DataMatrix randomPoints(size_t numberOfPoints, size_t dim) {
+  DataMatrix points(numberOfPoints, dim);
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      points(i, t) = distribution(generator);
+    }
+  }
+
+  return points;
+}
+
+void benchmarkHierarchisation(BenchmarkState& state, GridType gridType) {
+  std::unique_ptr<Grid> grid(createRegularGrid(gridType, state.range(0), state.range(1)));
+  std::unique_ptr<sgpp::base::OperationHierarchisation> opHierarchisation(
+      sgpp::op_factory::createOperationHierarchisation(*grid));
+  DataVector alpha = randomVector(grid->getSize());
+
+  // hierarchisation and dehierarchisation in turns to keep the values bounded
+  while (state.keepRunning()) {
+    opHierarchisation->doHierarchisation(alpha);
+    opHierarchisation->doDehierarchisation(alpha);
+  }
+
+  state.setItemsProcessed(2 * grid->getSize() * state.getMaxIterations());
+  state.setLabel("N=" + std::to_string(grid->getSize()));
+}
+
+void benchmarkEvalNaive(BenchmarkState& state, GridType gridType) {
+  std::unique_ptr<Grid> grid(createRegularGrid(gridType, state.range(0), state.range(1)));
+  std::unique_ptr<sgpp::base::OperationEval> opEval(
+      sgpp::op_factory::createOperationEvalNaive(*grid));
+  const size_t numberOfPoints = 100;
+  const DataVector alpha = randomVector(grid->getSize());
+  const DataMatrix points = randomPoints(numberOfPoints, grid->getDimension());
+  DataVector point(grid->getDimension());
+
+  while (state.keepRunning()) {
+    for (size_t i = 0; i < numberOfPoints; i++) {
+      points.getRow(i, point);
+      sgpp::base::doNotOptimize(opEval->eval(alpha, point));
+    }
+  }
+
+  state.setItemsProcessed(numberOfPoints * state.getMaxIterations());
+  state.setLabel("N=" + std::to_string(grid->getSize()));
+}
+
+void benchmarkMultipleEval(BenchmarkState& state, GridType gridType, bool naive) {
+  std::unique_ptr<Grid> grid(createRegularGrid(gridType, state.range(0), state.range(1)));
+  DataMatrix points = randomPoints(static_cast<size_t>(state.range(2)), grid->getDimension());
+  std::unique_ptr<sgpp::base::OperationMultipleEval> opMultipleEval(
+      naive ? sgpp::op_factory::createOperationMultipleEvalNaive(*grid, points)
+            : sgpp::op_factory::createOperationMultipleEval(*grid, points));
+  DataVector alpha = randomVector(grid->getSize());
+  DataVector result(points.getNrows());
+  DataVector source = randomVector(points.getNrows());
+  DataVector resultTransposed(grid->getSize());
+
+  // one evaluation (B * alpha) and one transposed evaluation (B^T * source) per iteration,
+  // as needed in each CG iteration of regression
+  while (state.keepRunning()) {
+    opMultipleEval->mult(alpha, result);
+    opMultipleEval->multTranspose(source, resultTransposed);
+  }
+
+  state.setItemsProcessed(2 * points.getNrows() * state.getMaxIterations());
+  state.setLabel("N=" + std::to_string(grid->getSize()));
+}
+
+}  // namespace
+
+SGPP_BENCHMARK_CAPTURE(benchmarkHierarchisation, linear, GridType::Linear)
+    ->argNames({"dim", "level"})
+    ->args({2, 10})
+    ->args({5, 6})
+    ->args({10, 4});
+SGPP_BENCHMARK_CAPTURE(benchmarkHierarchisation, modLinear, GridType::ModLinear)
+    ->argNames({"dim", "level"})
+    ->args({2, 10})
+    ->args({5, 6});
+SGPP_BENCHMARK_CAPTURE(benchmarkHierarchisation, linearBoundary, GridType::LinearBoundary)
+    ->argNames({"dim", "level"})
+    ->args({2, 10})
+    ->args({5, 5});
+
+SGPP_BENCHMARK_CAPTURE(benchmarkEvalNaive, linear, GridType::Linear)
+    ->argNames({"dim", "level"})
+    ->args({2, 8})
+    ->args({5, 5});
+SGPP_BENCHMARK_CAPTURE(benchmarkEvalNaive, modLinear, GridType::ModLinear)
+    ->argNames({"dim", "level"})
+    ->args({2, 8})
+    ->args({5, 5});
+SGPP_BENCHMARK_CAPTURE(benchmarkEvalNaive, poly, GridType::Poly)
+    ->argNames({"dim", "level"})
+    ->args({2, 8})
+    ->args({5, 5});
+SGPP_BENCHMARK_CAPTURE(benchmarkEvalNaive, bspline, GridType::Bspline)
+    ->argNames({"dim", "level"})
+    ->args({2, 8})
+    ->args({5, 5});
+
+SGPP_BENCHMARK_CAPTURE(benchmarkMultipleEval, linear, GridType::Linear, false)
+    ->argNames({"dim", "level", "points"})
+    ->argsProduct({{2, 5}, {5}, {1000, 10000}});
+SGPP_BENCHMARK_CAPTURE(benchmarkMultipleEval, modLinear, GridType::ModLinear, false)
+    ->argNames({"dim", "level", "points"})
+    ->argsProduct({{2, 5}, {5}, {1000, 10000}});
+SGPP_BENCHMARK_CAPTURE(benchmarkMultipleEval, linearNaive, GridType::Linear, true)
+    ->argNames({"dim", "level", "points"})
+    ->argsProduct({{2, 5}, {5}, {1000}});
+SGPP_BENCHMARK_CAPTURE(benchmarkMultipleEval, bsplineNaive, GridType::Bspline, true)
+    ->argNames({"dim", "level", "points"})
+    ->argsProduct({{2, 5}, {5}, {1000}});
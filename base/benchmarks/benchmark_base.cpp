@@ -0,0 +1,8 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/Benchmark.hpp>
+
+int main(int argc, char* argv[]) { return sgpp::base::runBenchmarks(argc, argv); }
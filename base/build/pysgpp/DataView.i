@@ -0,0 +1,140 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+// Typemaps that pass numpy arrays of float64 to functions expecting a DataVectorView or a
+// DataMatrixView without copying. The arrays have to be aligned and contiguous (two-dimensional
+// arrays may be in C or Fortran order), other arrays are rejected instead of being copied
+// silently. DataVector, DataMatrix and the view classes themselves are accepted as well. As in
+// C++, the viewed memory is not owned by the view: the numpy array has to be kept alive as long
+// as it is used by C++, e.g., as long as an OperationMultipleEval created from it exists.
+
+%{
+/*
+ * Creates a view of a numpy array or a wrapped DataVector(View).
+ * Returns nullptr on success, otherwise the reason why obj cannot be viewed.
+ */
+static const char* sgpp_asDataVectorView(PyObject* obj, sgpp::base::DataVectorView& view,
+                                         swig_type_info* vectorType,
+                                         swig_type_info* viewType) {
+  void* ptr = nullptr;
+
+  if (PyArray_Check(obj)) {
+    PyArrayObject* array = reinterpret_cast<PyArrayObject*>(obj);
+
+    if ((PyArray_TYPE(array) != NPY_DOUBLE) || !PyArray_ISNOTSWAPPED(array) ||
+        (PyArray_NDIM(array) != 1)) {
+      return "expected a one-dimensional numpy array of float64";
+    }
+
+    if (!PyArray_ISALIGNED(array) || !PyArray_IS_C_CONTIGUOUS(array)) {
+      return "the numpy array has to be aligned and contiguous";
+    }
+
+    view = sgpp::base::DataVectorView(static_cast<double*>(PyArray_DATA(array)),
+                                      static_cast<size_t>(PyArray_DIM(array, 0)));
+    return nullptr;
+  } else if (SWIG_IsOK(SWIG_ConvertPtr(obj, &ptr, vectorType, 0)) && (ptr != nullptr)) {
+    view = sgpp::base::DataVectorView(*static_cast<sgpp::base::DataVector*>(ptr));
+    return nullptr;
+  } else if (SWIG_IsOK(SWIG_ConvertPtr(obj, &ptr, viewType, 0)) && (ptr != nullptr)) {
+    view = *static_cast<sgpp::base::DataVectorView*>(ptr);
+    return nullptr;
+  } else {
+    return "expected a numpy array, a DataVector or a DataVectorView";
+  }
+}
+
+/*
+ * Creates a view of a numpy array or a wrapped DataMatrix(View).
+ * Returns nullptr on success, otherwise the reason why obj cannot be viewed.
+ */
+static const char* sgpp_asDataMatrixView(PyObject* obj, sgpp::base::DataMatrixView& view,
+                                         swig_type_info* matrixType,
+                                         swig_type_info* viewType) {
+  void* ptr = nullptr;
+
+  if (PyArray_Check(obj)) {
+    PyArrayObject* array = reinterpret_cast<PyArrayObject*>(obj);
+
+    if ((PyArray_TYPE(array) != NPY_DOUBLE) || !PyArray_ISNOTSWAPPED(array) ||
+        (PyArray_NDIM(array) != 2)) {
+      return "expected a two-dimensional numpy array of float64";
+    }
+
+    if (!PyArray_ISALIGNED(array) ||
+        !(PyArray_IS_C_CONTIGUOUS(array) || PyArray_IS_F_CONTIGUOUS(array))) {
+      return "the numpy array has to be aligned and contiguous (C or Fortran order)";
+    }
+
+    const size_t nrows = static_cast<size_t>(PyArray_DIM(array, 0));
+    const size_t ncols = static_cast<size_t>(PyArray_DIM(array, 1));
+
+    if (PyArray_IS_C_CONTIGUOUS(array)) {
+      view = sgpp::base::DataMatrixView(static_cast<double*>(PyArray_DATA(array)), nrows, ncols);
+    } else {
+      view = sgpp::base::DataMatrixView(static_cast<double*>(PyArray_DATA(array)), nrows, ncols,
+                                        1, nrows);
+    }
+    return nullptr;
+  } else if (SWIG_IsOK(SWIG_ConvertPtr(obj, &ptr, matrixType, 0)) && (ptr != nullptr)) {
+    view = sgpp::base::DataMatrixView(*static_cast<sgpp::base::DataMatrix*>(ptr));
+    return nullptr;
+  } else if (SWIG_IsOK(SWIG_ConvertPtr(obj, &ptr, viewType, 0)) && (ptr != nullptr)) {
+    view = *static_cast<sgpp::base::DataMatrixView*>(ptr);
+    return nullptr;
+  } else {
+    return "expected a numpy array, a DataMatrix or a DataMatrixView";
+  }
+}
+%}
+
+%typemap(in) sgpp::base::DataVectorView {
+  const char* error = sgpp_asDataVectorView($input, $1, $descriptor(sgpp::base::DataVector*),
+                                            $descriptor(sgpp::base::DataVectorView*));
+  if (error != nullptr) {
+    SWIG_exception_fail(SWIG_TypeError, error);
+  }
+}
+
+%typemap(in) const sgpp::base::DataVectorView& (sgpp::base::DataVectorView view) {
+  const char* error = sgpp_asDataVectorView($input, view, $descriptor(sgpp::base::DataVector*),
+                                            $descriptor(sgpp::base::DataVectorView*));
+  if (error != nullptr) {
+    SWIG_exception_fail(SWIG_TypeError, error);
+  }
+  $1 = &view;
+}
+
+// lower precedence than pointers, so that DataVectors still go to the DataVector overloads
+%typecheck(SWIG_TYPECHECK_DOUBLE_ARRAY)
+    sgpp::base::DataVectorView, const sgpp::base::DataVectorView& {
+  sgpp::base::DataVectorView view;
+  $1 = (sgpp_asDataVectorView($input, view, $descriptor(sgpp::base::DataVector*),
+                              $descriptor(sgpp::base::DataVectorView*)) == nullptr) ? 1 : 0;
+}
+
+%typemap(in) const sgpp::base::DataMatrixView& (sgpp::base::DataMatrixView view) {
+  const char* error = sgpp_asDataMatrixView($input, view, $descriptor(sgpp::base::DataMatrix*),
+                                            $descriptor(sgpp::base::DataMatrixView*));
+  if (error != nullptr) {
+    SWIG_exception_fail(SWIG_TypeError, error);
+  }
+  $1 = &view;
+}
+
+%typecheck(SWIG_TYPECHECK_DOUBLE_ARRAY) const sgpp::base::DataMatrixView& {
+  sgpp::base::DataMatrixView view;
+  $1 = (sgpp_asDataMatrixView($input, view, $descriptor(sgpp::base::DataMatrix*),
+                              $descriptor(sgpp::base::DataMatrixView*)) == nullptr) ? 1 : 0;
+}
+
+// views of numpy arrays can be created in Python via the copy constructors, e.g.,
+// DataMatrixView(array), and share the memory of the array
+%copyctor sgpp::base::DataVectorView;
+%copyctor sgpp::base::DataMatrixView;
+
+%ignore sgpp::base::DataVectorView::operator[];
+%include "base/src/sgpp/base/datatypes/DataVectorView.hpp"
+%include "base/src/sgpp/base/datatypes/DataMatrixView.hpp"
@@ -90,6 +90,7 @@ namespace std {
 %template(SBasis) sgpp::base::Basis<unsigned int, unsigned int>;
 %include "DataVector.i"
 %include "DataMatrix.i"
+%include "DataView.i"
 %include "GridFactory.i"
 %include "OpFactory.i"
 
@@ -121,6 +122,7 @@ namespace std {
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridStorage.hpp"
 %include "base/src/sgpp/base/grid/storage/hashmap/HashGridIterator.hpp"
 %include "base/src/sgpp/base/grid/GridStorage.hpp"
+%include "base/src/sgpp/base/grid/storage/regular/RegularGridStorage.hpp"
 
 %include "base/src/sgpp/base/grid/generation/functors/RefinementFunctor.hpp"
 %include "base/src/sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp"
@@ -174,6 +176,8 @@ namespace std {
 %include "base/src/sgpp/base/grid/generation/PeriodicGridGenerator.hpp"
 
 %include "base/src/sgpp/base/grid/GridDataBase.hpp"
+%newobject sgpp::base::GridModelFile::createGrid;
+%include "base/src/sgpp/base/grid/GridModelFile.hpp"
 %include "base/src/sgpp/base/grid/GridTypeParser.hpp"
 %include "base/src/sgpp/base/grid/GeneralGridTypeParser.hpp"
 %include "base/src/sgpp/base/grid/RefinementConfiguration.hpp"
@@ -239,6 +243,7 @@ namespace std {
 %include "base/src/sgpp/base/tools/QuadRule1D.hpp"
 %include "base/src/sgpp/base/tools/GaussLegendreQuadRule1D.hpp"
 %include "base/src/sgpp/base/tools/GaussHermiteQuadRule1D.hpp"
+%include "base/src/sgpp/base/tools/TensorProductQuadrature.hpp"
 
 %include "base/src/sgpp/base/operation/hash/OperationFirstMoment.hpp"
 %include "base/src/sgpp/base/operation/hash/OperationSecondMoment.hpp"
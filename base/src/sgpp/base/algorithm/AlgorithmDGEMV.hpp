@@ -9,8 +9,10 @@
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixView.hpp>
 
 #include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
+#include <sgpp/base/tools/ScatterReduction.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -40,19 +42,21 @@ class AlgorithmDGEMV {
    * @param storage GridStorage object that contains the grid's points information
    * @param basis a reference to a class that implements a specific basis
    * @param source the coefficients of the grid points
-   * @param x the d-dimensional vector with data points (row-wise)
+   * @param x the d-dimensional vector with data points (row-wise), not copied
    * @param result the result vector of the matrix vector multiplication
    */
   void mult_transposed(GridStorage& storage, BASIS& basis,
-                       const DataVector& source, DataMatrix& x, DataVector& result) {
+                       const DataVector& source, const DataMatrixView& x, DataVector& result) {
     typedef std::vector<std::pair<size_t, double> > IndexValVector;
 
     result.setAll(0.0);
 
+    ScatterReduction reduction(result);
+
     #pragma omp parallel
     {
       size_t source_size = source.getSize();
-      DataVector privateResult(result);
+      ScatterReduction::Buffer privateResult(reduction);
       DataVector line(x.getNcols());
       IndexValVector vec;
       GetAffectedBasisFunctions<BASIS> ga(storage);
@@ -67,14 +71,9 @@ class AlgorithmDGEMV {
         ga(basis, line, vec);
 
         for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
-          privateResult[iter->first] += iter->second * source[i];
+          privateResult.add(iter->first, iter->second * source[i]);
         }
       }
-
-      #pragma omp critical
-      {
-        result.add(privateResult);
-      }
     }
   }
   // implementation requires OpenMP 4.0 support
@@ -122,11 +121,11 @@ class AlgorithmDGEMV {
    * @param storage GridStorage object that contains the grid's points information
    * @param basis a reference to a class that implements a specific basis
    * @param source the coefficients of the grid points
-   * @param x the d-dimensional vector with data points (row-wise)
+   * @param x the d-dimensional vector with data points (row-wise), not copied
    * @param result the result vector of the matrix vector multiplication
    */
   void mult(GridStorage& storage, BASIS& basis, const DataVector& source,
-            DataMatrix& x, DataVector& result) {
+            const DataMatrixView& x, DataVector& result) {
     typedef std::vector<std::pair<size_t, double> > IndexValVector;
 
     result.setAll(0.0);
@@ -9,6 +9,7 @@
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBoundaryBasis.hpp>
+#include <sgpp/base/tools/ScatterReduction.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -44,8 +45,10 @@ class AlgorithmEvaluationTransposed {
    * @param point evaluation point within the domain
    * @param alpha the coefficient of the regarded ansatzfunction
    * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
+   *        (DataVector or ScatterReduction::Buffer)
    */
-  void operator()(BASIS& basis, const DataVector& point, double alpha, DataVector& result) {
+  template <class RESULT>
+  void operator()(BASIS& basis, const DataVector& point, double alpha, RESULT& result) {
     GridStorage::grid_iterator working(storage);
 
     const size_t bits = sizeof(index_t) * 8;  // how many levels can we store in a index_type?
@@ -83,6 +86,12 @@ class AlgorithmEvaluationTransposed {
  protected:
   GridStorage& storage;
 
+  static void add(DataVector& result, size_t seq, double value) { result[seq] += value; }
+
+  static void add(ScatterReduction::Buffer& result, size_t seq, double value) {
+    result.add(seq, value);
+  }
+
   /**
    * Recursive traversal of the "tree" of basis functions for evaluation, used in operator().
    * For a given evaluation point \f$x\f$, it stores tuples (std::pair) of
@@ -97,10 +106,11 @@ class AlgorithmEvaluationTransposed {
    * @param alpha the coefficient of current ansatzfunction
    * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
    */
+  template <class RESULT>
   void rec(BASIS& basis, DataVector& point, size_t current_dim,
            double value, GridStorage::grid_iterator& working,
            index_t* source, double alpha,
-           DataVector& result) {
+           RESULT& result) {
     const unsigned int BITS_IN_BYTE = 8;
     // maximum possible level for the index type
     const level_t max_level = static_cast<level_t>(sizeof(index_t) * BITS_IN_BYTE - 1);
@@ -125,7 +135,7 @@ class AlgorithmEvaluationTransposed {
         const double new_value = basis.eval(work_level, work_index, point[current_dim]) * value;
 
         if (current_dim == storage.getDimension() - 1) {
-          result[seq] += alpha * new_value;
+          add(result, seq, alpha * new_value);
         } else {
           rec(basis, point, current_dim + 1, new_value, working, source, alpha, result);
           if (!hint) working.resetToLevelOne(current_dim+1);
@@ -7,11 +7,13 @@
 #define ALGORITHMMULTIPLEEVALUATION_HPP
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixView.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 
 #include <sgpp/base/algorithm/AlgorithmEvaluation.hpp>
 #include <sgpp/base/algorithm/AlgorithmEvaluationTransposed.hpp>
+#include <sgpp/base/tools/ScatterReduction.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -41,17 +43,19 @@ class AlgorithmMultipleEvaluation {
    * @param storage GridStorage object that contains the grid's points information
    * @param basis a reference to a class that implements a specific basis
    * @param source the coefficients of the grid points
-   * @param x the d-dimensional vector with data points (row-wise)
+   * @param x the d-dimensional vector with data points (row-wise), not copied
    * @param result the result vector of the matrix vector multiplication
    */
-  void mult_transpose(GridStorage& storage, BASIS& basis, DataVector& source, DataMatrix& x,
-                      DataVector& result) {
+  void mult_transpose(GridStorage& storage, BASIS& basis, DataVector& source,
+                      const DataMatrixView& x, DataVector& result) {
     result.setAll(0.0);
     size_t source_size = source.getSize();
 
+    ScatterReduction reduction(result);
+
 #pragma omp parallel
     {
-      DataVector privateResult(result.getSize());
+      ScatterReduction::Buffer privateResult(reduction);
 
       DataVector line(x.getNcols());
       AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
@@ -63,9 +67,6 @@ class AlgorithmMultipleEvaluation {
 
         AlgoEvalTrans(basis, line, source[i], privateResult);
       }
-
-#pragma omp critical
-      { result.add(privateResult); }
     }
   }
   // implementation requires OpenMP 4.0 support
@@ -99,10 +100,10 @@ class AlgorithmMultipleEvaluation {
    * @param storage GridStorage object that contains the grid's points information
    * @param basis a reference to a class that implements a specific basis
    * @param source the coefficients of the grid points
-   * @param x the d-dimensional vector with data points (row-wise)
+   * @param x the d-dimensional vector with data points (row-wise), not copied
    * @param result the result vector of the matrix vector multiplication
    */
-  void mult(GridStorage& storage, BASIS& basis, DataVector& source, DataMatrix& x,
+  void mult(GridStorage& storage, BASIS& basis, DataVector& source, const DataMatrixView& x,
             DataVector& result) {
     result.setAll(0.0);
     size_t result_size = result.getSize();
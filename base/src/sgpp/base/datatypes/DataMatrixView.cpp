@@ -0,0 +1,57 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrixView.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace base {
+
+void DataMatrixView::getRow(size_t row, DataVector& vec) const {
+  if (vec.getSize() != ncols) {
+    throw sgpp::base::data_exception("DataMatrixView::getRow : Dimensions do not match");
+  }
+
+  const double* rowData = data + row * rowStride;
+
+  for (size_t j = 0; j < ncols; j++) {
+    vec[j] = rowData[j * colStride];
+  }
+}
+
+void DataMatrixView::getColumn(size_t col, DataVector& vec) const {
+  if (vec.getSize() != nrows) {
+    throw sgpp::base::data_exception("DataMatrixView::getColumn : Dimensions do not match");
+  }
+
+  const double* colData = data + col * colStride;
+
+  for (size_t i = 0; i < nrows; i++) {
+    vec[i] = colData[i * rowStride];
+  }
+}
+
+DataMatrixView DataMatrixView::getRows(size_t first, size_t count) const {
+  if (first + count > nrows) {
+    throw sgpp::base::data_exception("DataMatrixView::getRows : rows out of bounds");
+  }
+
+  return DataMatrixView(data + first * rowStride, count, ncols, rowStride, colStride);
+}
+
+void DataMatrixView::copyTo(DataMatrix& matrix) const {
+  matrix.resize(nrows, ncols);
+
+  for (size_t i = 0; i < nrows; i++) {
+    for (size_t j = 0; j < ncols; j++) {
+      matrix.set(i, j, data[i * rowStride + j * colStride]);
+    }
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
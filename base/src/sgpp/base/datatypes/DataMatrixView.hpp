@@ -0,0 +1,185 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef DATAMATRIXVIEW_HPP
+#define DATAMATRIXVIEW_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataVectorView.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Non-owning, strided view of two-dimensional data.
+ *
+ * A DataMatrixView refers to memory owned by someone else (a DataMatrix, a block of rows of a
+ * larger matrix, a numpy array, a memory-mapped file) without copying it. The referenced memory
+ * has to outlive the view. Element (row, col) is located at
+ * getPointer()[row * getRowStride() + col * getColStride()], so row-major (C) and column-major
+ * (Fortran) layouts as well as slices of both can be viewed.
+ */
+class DataMatrixView {
+ public:
+  /**
+   * Create an empty view.
+   */
+  DataMatrixView() : data(nullptr), nrows(0), ncols(0), rowStride(0), colStride(1) {}
+
+  /**
+   * Create a view of a contiguous row-major nrows x ncols matrix at data.
+   *
+   * @param data  pointer to the element (0, 0)
+   * @param nrows number of rows
+   * @param ncols number of columns
+   */
+  DataMatrixView(double* data, size_t nrows, size_t ncols)
+      : data(data), nrows(nrows), ncols(ncols), rowStride(ncols), colStride(1) {}
+
+  /**
+   * Create a strided view of an nrows x ncols matrix at data.
+   *
+   * @param data      pointer to the element (0, 0)
+   * @param nrows     number of rows
+   * @param ncols     number of columns
+   * @param rowStride distance between two consecutive rows (in elements, not bytes)
+   * @param colStride distance between two consecutive columns (in elements, not bytes)
+   */
+  DataMatrixView(double* data, size_t nrows, size_t ncols, size_t rowStride, size_t colStride)
+      : data(data), nrows(nrows), ncols(ncols), rowStride(rowStride), colStride(colStride) {}
+
+  /**
+   * Create a view of a DataMatrix (implicit, so that DataMatrices can be passed wherever a view
+   * is expected). Resizing the DataMatrix invalidates the view.
+   *
+   * @param matrix  matrix to view
+   */
+  DataMatrixView(DataMatrix& matrix)  // NOLINT(runtime/explicit)
+      : data(matrix.getPointer()),
+        nrows(matrix.getNrows()),
+        ncols(matrix.getNcols()),
+        rowStride(matrix.getNcols()),
+        colStride(1) {}
+
+  /**
+   * @param row row index
+   * @param col column index
+   * @return value of the element (row, col)
+   */
+  double get(size_t row, size_t col) const { return data[row * rowStride + col * colStride]; }
+
+  /**
+   * @param row   row index
+   * @param col   column index
+   * @param value new value of the element (row, col)
+   */
+  void set(size_t row, size_t col, double value) const {
+    data[row * rowStride + col * colStride] = value;
+  }
+
+  /**
+   * @param row row index
+   * @return view of the row, without copying
+   */
+  DataVectorView getRowView(size_t row) const {
+    return DataVectorView(data + row * rowStride, ncols, colStride);
+  }
+
+  /**
+   * @param col column index
+   * @return view of the column, without copying
+   */
+  DataVectorView getColumnView(size_t col) const {
+    return DataVectorView(data + col * colStride, nrows, rowStride);
+  }
+
+  /**
+   * Copies a row into vec, same as DataMatrix::getRow.
+   * Throws a data_exception if the size of vec does not match the number of columns.
+   *
+   * @param row      row index
+   * @param[out] vec DataVector with getNcols() elements
+   */
+  void getRow(size_t row, DataVector& vec) const;
+
+  /**
+   * Copies a column into vec, same as DataMatrix::getColumn.
+   * Throws a data_exception if the size of vec does not match the number of rows.
+   *
+   * @param col      column index
+   * @param[out] vec DataVector with getNrows() elements
+   */
+  void getColumn(size_t col, DataVector& vec) const;
+
+  /**
+   * Throws a data_exception if the rows are out of range.
+   *
+   * @param first first row
+   * @param count number of rows
+   * @return view of the rows [first, first + count), without copying
+   */
+  DataMatrixView getRows(size_t first, size_t count) const;
+
+  /**
+   * Copies the elements into matrix, resizing it if necessary.
+   *
+   * @param[out] matrix copy of the viewed elements
+   */
+  void copyTo(DataMatrix& matrix) const;
+
+  /**
+   * @return number of rows
+   */
+  size_t getNrows() const { return nrows; }
+
+  /**
+   * @return number of columns
+   */
+  size_t getNcols() const { return ncols; }
+
+  /**
+   * @return distance between two consecutive rows (in elements)
+   */
+  size_t getRowStride() const { return rowStride; }
+
+  /**
+   * @return distance between two consecutive columns (in elements)
+   */
+  size_t getColStride() const { return colStride; }
+
+  /**
+   * @return pointer to the element (0, 0)
+   */
+  double* getPointer() const { return data; }
+
+  /**
+   * @return whether the view has the memory layout of a DataMatrix (contiguous, row-major)
+   */
+  bool isContiguous() const {
+    return ((colStride == 1) || (ncols <= 1)) && ((rowStride == ncols) || (nrows <= 1));
+  }
+
+ private:
+  /// pointer to the element (0, 0)
+  double* data;
+  /// number of rows
+  size_t nrows;
+  /// number of columns
+  size_t ncols;
+  /// distance between two consecutive rows
+  size_t rowStride;
+  /// distance between two consecutive columns
+  size_t colStride;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* DATAMATRIXVIEW_HPP */
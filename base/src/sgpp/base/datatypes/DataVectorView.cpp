@@ -0,0 +1,53 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataVectorView.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace base {
+
+void DataVectorView::setAll(double value) const {
+  for (size_t i = 0; i < size; i++) {
+    data[i * stride] = value;
+  }
+}
+
+void DataVectorView::copyTo(DataVector& vector) const {
+  vector.resize(size);
+
+  for (size_t i = 0; i < size; i++) {
+    vector[i] = data[i * stride];
+  }
+}
+
+void DataVectorView::copyFrom(const DataVector& vector) const {
+  if (vector.getSize() != size) {
+    throw sgpp::base::data_exception("DataVectorView::copyFrom : Dimensions do not match");
+  }
+
+  for (size_t i = 0; i < size; i++) {
+    data[i * stride] = vector[i];
+  }
+}
+
+double DataVectorView::dotProduct(const DataVector& vector) const {
+  if (vector.getSize() != size) {
+    throw sgpp::base::data_exception("DataVectorView::dotProduct : Dimensions do not match");
+  }
+
+  double result = 0.0;
+
+  for (size_t i = 0; i < size; i++) {
+    result += data[i * stride] * vector[i];
+  }
+
+  return result;
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,130 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef DATAVECTORVIEW_HPP
+#define DATAVECTORVIEW_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Non-owning, strided view of one-dimensional data.
+ *
+ * In contrast to DataVector, a DataVectorView does not own its memory, so it can refer to
+ * memory owned by someone else (a DataVector, a row or column of a DataMatrix(View), a numpy
+ * array, a memory-mapped file) without copying. The referenced memory has to outlive the view.
+ * Element i is located at getPointer()[i * getStride()].
+ */
+class DataVectorView {
+ public:
+  /**
+   * Create an empty view.
+   */
+  DataVectorView() : data(nullptr), size(0), stride(1) {}
+
+  /**
+   * Create a view of size elements at data.
+   *
+   * @param data    pointer to the first element
+   * @param size    number of elements
+   * @param stride  distance between two consecutive elements (in elements, not bytes)
+   */
+  DataVectorView(double* data, size_t size, size_t stride = 1)
+      : data(data), size(size), stride(stride) {}
+
+  /**
+   * Create a view of a DataVector (implicit, so that DataVectors can be passed wherever a view
+   * is expected). Resizing the DataVector invalidates the view.
+   *
+   * @param vector  vector to view
+   */
+  DataVectorView(DataVector& vector)  // NOLINT(runtime/explicit)
+      : data(vector.getPointer()), size(vector.getSize()), stride(1) {}
+
+  /**
+   * @param i index of the element
+   * @return reference to the i-th element
+   */
+  double& operator[](size_t i) const { return data[i * stride]; }
+
+  /**
+   * @param i index of the element
+   * @return value of the i-th element
+   */
+  double get(size_t i) const { return data[i * stride]; }
+
+  /**
+   * @param i     index of the element
+   * @param value new value of the i-th element
+   */
+  void set(size_t i, double value) const { data[i * stride] = value; }
+
+  /**
+   * Sets all elements to value.
+   *
+   * @param value new value of all elements
+   */
+  void setAll(double value) const;
+
+  /**
+   * Copies the elements into vector, resizing it if necessary.
+   *
+   * @param[out] vector copy of the viewed elements
+   */
+  void copyTo(DataVector& vector) const;
+
+  /**
+   * Copies the elements of vector into the viewed memory.
+   * Throws a data_exception if the sizes do not match.
+   *
+   * @param vector vector with getSize() elements
+   */
+  void copyFrom(const DataVector& vector) const;
+
+  /**
+   * @param vector vector with getSize() elements
+   * @return scalar product of the viewed elements and vector
+   */
+  double dotProduct(const DataVector& vector) const;
+
+  /**
+   * @return number of elements
+   */
+  size_t getSize() const { return size; }
+
+  /**
+   * @return distance between two consecutive elements (in elements)
+   */
+  size_t getStride() const { return stride; }
+
+  /**
+   * @return pointer to the first element
+   */
+  double* getPointer() const { return data; }
+
+  /**
+   * @return whether the elements are stored consecutively (stride one)
+   */
+  bool isContiguous() const { return (stride == 1) || (size <= 1); }
+
+ private:
+  /// pointer to the first element
+  double* data;
+  /// number of elements
+  size_t size;
+  /// distance between two consecutive elements
+  size_t stride;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* DATAVECTORVIEW_HPP */
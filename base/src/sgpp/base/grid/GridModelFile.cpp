@@ -0,0 +1,284 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/grid/GridModelFile.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SGPP_GRIDMODELFILE_MMAP
+#endif
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+/// magic string at the beginning of every model file
+const char MAGIC[8] = {'S', 'G', 'P', 'P', 'M', 'D', 'L', '\0'};
+/// written in native byte order, reads as 0x04030201 with the other byte order
+const uint32_t ENDIANNESS_TAG = 0x01020304;
+
+/// fixed-size header of a model file
+struct Header {
+  char magic[8];
+  uint32_t endianness;
+  uint32_t version;
+  uint64_t dimension;
+  uint64_t numPoints;
+  uint64_t numColumns;
+  uint64_t descriptionLength;
+};
+
+static_assert(sizeof(Header) == 48, "unexpected padding in the model file header");
+
+/// rounds a section size up to the next multiple of eight bytes
+size_t padded(size_t bytes) { return (bytes + 7) / 8 * 8; }
+
+/// writes a section followed by zero padding up to the next multiple of eight bytes
+void writeSection(std::ofstream& fout, const void* section, size_t bytes) {
+  const char zeros[8] = {};
+  fout.write(static_cast<const char*>(section), bytes);
+  fout.write(zeros, padded(bytes) - bytes);
+}
+
+}  // namespace
+
+void GridModelFile::write(const std::string& filename, Grid& grid,
+                          const DataMatrix& coefficients) {
+  write(filename, grid, coefficients.getPointer(), coefficients.getNrows(),
+        coefficients.getNcols());
+}
+
+void GridModelFile::write(const std::string& filename, Grid& grid,
+                          const DataVector& coefficients) {
+  write(filename, grid, coefficients.getPointer(), coefficients.getSize(), 1);
+}
+
+void GridModelFile::write(const std::string& filename, Grid& grid, const double* coefficients,
+                          size_t numRows, size_t numColumns) {
+  GridStorage& storage = grid.getStorage();
+  const size_t dim = storage.getDimension();
+  const size_t numPoints = storage.getSize();
+
+  if (numRows != numPoints) {
+    throw data_exception(
+        "GridModelFile::write : number of coefficients does not match number of grid points");
+  }
+
+  // the description contains everything except the grid points
+  std::unique_ptr<Grid> emptyGrid(grid.createGridOfEquivalentType(dim));
+
+  if (emptyGrid == nullptr) {
+    throw factory_exception("GridModelFile::write : grid type not supported");
+  }
+
+  if (storage.isUsingStretching()) {
+    emptyGrid->getStorage().setStretching(*storage.getStretching());
+  } else {
+    emptyGrid->getStorage().setBoundingBox(*storage.getBoundingBox());
+  }
+
+  const std::string description = emptyGrid->serialize();
+
+  std::vector<GridPoint::level_type> levels(numPoints * dim);
+  std::vector<GridPoint::index_type> indices(numPoints * dim);
+  std::vector<uint8_t> leaves(numPoints);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    GridPoint& point = storage.getPoint(i);
+
+    for (size_t d = 0; d < dim; d++) {
+      point.get(d, levels[i * dim + d], indices[i * dim + d]);
+    }
+
+    leaves[i] = point.isLeaf() ? 1 : 0;
+  }
+
+  Header header;
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.endianness = ENDIANNESS_TAG;
+  header.version = FORMAT_VERSION;
+  header.dimension = dim;
+  header.numPoints = numPoints;
+  header.numColumns = numColumns;
+  header.descriptionLength = description.size();
+
+  std::ofstream fout(filename, std::ios::binary);
+
+  if (!fout.is_open()) {
+    throw file_exception("GridModelFile::write : unable to open file for write access");
+  }
+
+  writeSection(fout, &header, sizeof(header));
+  writeSection(fout, description.data(), description.size());
+  writeSection(fout, levels.data(), levels.size() * sizeof(GridPoint::level_type));
+  writeSection(fout, indices.data(), indices.size() * sizeof(GridPoint::index_type));
+  writeSection(fout, leaves.data(), leaves.size());
+  writeSection(fout, coefficients, numPoints * numColumns * sizeof(double));
+
+  if (!fout) {
+    throw file_exception("GridModelFile::write : error while writing file");
+  }
+}
+
+GridModelFile::GridModelFile(const std::string& filename, bool useMemoryMapping)
+    : data(nullptr), size(0), mapped(false) {
+#ifdef SGPP_GRIDMODELFILE_MMAP
+  if (useMemoryMapping) {
+    const int fd = open(filename.c_str(), O_RDONLY);
+
+    if (fd < 0) {
+      throw file_exception("GridModelFile : unable to open file for read access");
+    }
+
+    struct stat fileStatus;
+
+    if (fstat(fd, &fileStatus) == 0) {
+      size = static_cast<size_t>(fileStatus.st_size);
+    }
+
+    if (size > 0) {
+      // private mapping, so that writes to views of the coefficients do not reach the file
+      void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+      if (mapping != MAP_FAILED) {
+        data = static_cast<char*>(mapping);
+        mapped = true;
+      }
+    }
+
+    close(fd);
+  }
+#endif
+
+  if (!mapped) {
+    // single bulk read of the whole file
+    std::ifstream fin(filename, std::ios::binary | std::ios::ate);
+
+    if (!fin.is_open()) {
+      throw file_exception("GridModelFile : unable to open file for read access");
+    }
+
+    size = static_cast<size_t>(fin.tellg());
+    buffer.resize((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    data = reinterpret_cast<char*>(buffer.data());
+    fin.seekg(0);
+    fin.read(data, size);
+
+    if (!fin) {
+      throw file_exception("GridModelFile : error while reading file");
+    }
+  }
+
+  try {
+    parseHeader();
+  } catch (...) {
+#ifdef SGPP_GRIDMODELFILE_MMAP
+    if (mapped) {
+      munmap(data, size);
+    }
+#endif
+    throw;
+  }
+}
+
+GridModelFile::~GridModelFile() {
+#ifdef SGPP_GRIDMODELFILE_MMAP
+  if (mapped) {
+    munmap(data, size);
+  }
+#endif
+}
+
+void GridModelFile::parseHeader() {
+  if (size < sizeof(Header)) {
+    throw file_exception("GridModelFile : file is too short for a model file");
+  }
+
+  Header header;
+  std::memcpy(&header, data, sizeof(header));
+
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    throw file_exception("GridModelFile : file is not a model file");
+  }
+
+  if (header.endianness != ENDIANNESS_TAG) {
+    throw file_exception("GridModelFile : model file was written with a different byte order");
+  }
+
+  if (header.version > FORMAT_VERSION) {
+    throw file_exception("GridModelFile : version of the model file is too new");
+  }
+
+  // reject sizes that cannot fit into the file before computing offsets from them
+  if ((header.descriptionLength > size) || (header.numPoints > size) ||
+      (header.dimension > size) || (header.numColumns > size)) {
+    throw file_exception("GridModelFile : model file is corrupt or truncated");
+  }
+
+  dimension = static_cast<size_t>(header.dimension);
+  numPoints = static_cast<size_t>(header.numPoints);
+  numColumns = static_cast<size_t>(header.numColumns);
+  description.assign(data + sizeof(Header), static_cast<size_t>(header.descriptionLength));
+
+  levelOffset = sizeof(Header) + padded(description.size());
+  indexOffset = levelOffset + padded(numPoints * dimension * sizeof(GridPoint::level_type));
+  leafOffset = indexOffset + padded(numPoints * dimension * sizeof(GridPoint::index_type));
+  coefficientOffset = leafOffset + padded(numPoints);
+
+  if (coefficientOffset + numPoints * numColumns * sizeof(double) > size) {
+    throw file_exception("GridModelFile : model file is corrupt or truncated");
+  }
+}
+
+Grid* GridModelFile::createGrid() const {
+  std::unique_ptr<Grid> grid(Grid::unserialize(description));
+
+  if (grid->getDimension() != dimension) {
+    throw file_exception("GridModelFile : grid description does not match the header");
+  }
+
+  grid->getStorage().insertPoints(
+      numPoints, reinterpret_cast<const GridPoint::level_type*>(data + levelOffset),
+      reinterpret_cast<const GridPoint::index_type*>(data + indexOffset),
+      reinterpret_cast<const uint8_t*>(data + leafOffset));
+  return grid.release();
+}
+
+DataMatrixView GridModelFile::getCoefficients() const {
+  return DataMatrixView(reinterpret_cast<double*>(data + coefficientOffset), numPoints,
+                        numColumns);
+}
+
+void GridModelFile::getCoefficients(DataMatrix& coefficients) const {
+  getCoefficients().copyTo(coefficients);
+}
+
+void GridModelFile::getCoefficients(DataVector& coefficients) const {
+  if (numColumns != 1) {
+    throw data_exception("GridModelFile::getCoefficients : model has not exactly one column");
+  }
+
+  coefficients.resize(numPoints);
+  std::memcpy(coefficients.getPointer(), data + coefficientOffset, numPoints * sizeof(double));
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,171 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixView.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Binary container for a sparse grid model, i.e., a grid together with its coefficient
+ * vector(s), as an alternative to the text format of Grid::serialize and DataVector::toFile.
+ *
+ * The file consists of
+ * - a fixed-size header (magic string, endianness tag, format version, dimension,
+ *   number of grid points, number of coefficient columns, length of the description),
+ * - the description, i.e., the text serialization of an empty grid of the same type
+ *   (grid type, bounding box or stretching, degree, boundary level),
+ * - the packed levels and indices of all grid points (uint32, row-major),
+ * - the leaf property of all grid points (uint8),
+ * - the coefficients (double, numPoints x numColumns, row-major).
+ *
+ * Every section starts at a multiple of eight bytes. Hence the file can be memory-mapped
+ * (if available) and the coefficients can be used in place via getCoefficients(), while
+ * the grid points are bulk-inserted into the storage by createGrid() without parsing.
+ * Files written on a machine with a different byte order are rejected.
+ */
+class GridModelFile {
+ public:
+  /// version of the binary format, increased whenever the layout changes
+  static const uint32_t FORMAT_VERSION = 1;
+
+  /**
+   * Writes a grid and its coefficient matrix (one column per coefficient vector).
+   *
+   * @param filename      name of the file
+   * @param grid          grid, must support Grid::createGridOfEquivalentType
+   * @param coefficients  coefficients, one row per grid point
+   */
+  static void write(const std::string& filename, Grid& grid, const DataMatrix& coefficients);
+
+  /**
+   * Writes a grid and its coefficient vector.
+   *
+   * @param filename      name of the file
+   * @param grid          grid, must support Grid::createGridOfEquivalentType
+   * @param coefficients  coefficients, one entry per grid point
+   */
+  static void write(const std::string& filename, Grid& grid, const DataVector& coefficients);
+
+  /**
+   * Opens a model file and checks its header.
+   *
+   * @param filename          name of the file
+   * @param useMemoryMapping  map the file into memory if supported by the platform,
+   *                          otherwise (or if false) the file is read with a single bulk read
+   */
+  explicit GridModelFile(const std::string& filename, bool useMemoryMapping = true);
+
+  /**
+   * Destructor, unmaps or frees the file contents.
+   */
+  ~GridModelFile();
+
+  GridModelFile(const GridModelFile&) = delete;
+  GridModelFile& operator=(const GridModelFile&) = delete;
+
+  /**
+   * Creates the stored grid.
+   *
+   * @return new grid, has to be deleted by the caller
+   */
+  Grid* createGrid() const;
+
+  /**
+   * @return view of the stored coefficients (one row per grid point) without copying;
+   *         valid as long as this object exists
+   */
+  DataMatrixView getCoefficients() const;
+
+  /**
+   * @param[out] coefficients copy of the stored coefficients (one row per grid point)
+   */
+  void getCoefficients(DataMatrix& coefficients) const;
+
+  /**
+   * @param[out] coefficients copy of the stored coefficient vector, only if the file
+   *                          contains exactly one coefficient column
+   */
+  void getCoefficients(DataVector& coefficients) const;
+
+  /**
+   * @return dimension of the grid
+   */
+  size_t getDimension() const { return dimension; }
+
+  /**
+   * @return number of grid points
+   */
+  size_t getNumberOfPoints() const { return numPoints; }
+
+  /**
+   * @return number of coefficient columns
+   */
+  size_t getNumberOfColumns() const { return numColumns; }
+
+  /**
+   * @return whether the file contents are memory-mapped
+   */
+  bool isMemoryMapped() const { return mapped; }
+
+ private:
+  /// contents of the file (mapped copy-on-write, so views of it may be modified)
+  char* data;
+  /// size of the file in bytes
+  size_t size;
+  /// whether data points to a memory mapping
+  bool mapped;
+  /// contents of the file if not memory-mapped (uint64_t for the alignment of doubles)
+  std::vector<uint64_t> buffer;
+
+  /// dimension of the grid
+  size_t dimension;
+  /// number of grid points
+  size_t numPoints;
+  /// number of coefficient columns
+  size_t numColumns;
+  /// text serialization of the empty grid
+  std::string description;
+  /// byte offset of the levels
+  size_t levelOffset;
+  /// byte offset of the indices
+  size_t indexOffset;
+  /// byte offset of the leaf properties
+  size_t leafOffset;
+  /// byte offset of the coefficients
+  size_t coefficientOffset;
+
+  /**
+   * Writes a grid and its coefficients.
+   *
+   * @param filename      name of the file
+   * @param grid          grid
+   * @param coefficients  coefficients, numPoints x numColumns (row-major)
+   * @param numRows       number of rows of the coefficients
+   * @param numColumns    number of columns of the coefficients
+   */
+  static void write(const std::string& filename, Grid& grid, const double* coefficients,
+                    size_t numRows, size_t numColumns);
+
+  /**
+   * Parses the header and computes the offsets of the sections.
+   */
+  void parseHeader();
+};
+
+}  // namespace base
+}  // namespace sgpp
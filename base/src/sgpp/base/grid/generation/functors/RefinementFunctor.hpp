@@ -34,6 +34,10 @@ class RefinementFunctor {
   /**
    * This should be returning a refinement value for every grid point.
    * The point with the highest value will be refined first.
+   * The refinement classes call this method from one thread at a time, so
+   * implementations do not have to be thread-safe. Code that calls it from
+   * several threads concurrently has to make sure that the functor supports
+   * this (e.g., does not modify mutable state).
    *
    * @param storage reference to the grids storage object
    * @param seq sequence number in the coefficients array
@@ -25,5 +25,12 @@ void ANOVAHashRefinement::refineGridpoint(GridStorage& storage, size_t refine_in
     }
   }
 }
+
+void ANOVAHashRefinement::refineGridpoints(GridStorage& storage,
+                                           const std::vector<size_t>& refine_indices) {
+  for (size_t refine_index : refine_indices) {
+    refineGridpoint(storage, refine_index);
+  }
+}
 }  // namespace base
 }  // namespace sgpp
@@ -28,6 +28,15 @@ class ANOVAHashRefinement : public HashRefinement {
      * @param refine_index The index in the hashmap of the point that should be refined
      */
   virtual void refineGridpoint(GridStorage& storage, size_t refine_index);
+
+  /**
+     * Refines the grid points one after another by calling refineGridpoint().
+     *
+     * @param storage hashmap that stores the gridpoints
+     * @param refine_indices The indices in the hashmap of the points that should be refined
+     */
+  void refineGridpoints(GridStorage& storage,
+                        const std::vector<size_t>& refine_indices) override;
 };
 }  // namespace base
 }  // namespace sgpp
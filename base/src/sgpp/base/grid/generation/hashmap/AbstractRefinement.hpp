@@ -204,6 +204,9 @@ class AbstractRefinement {
   /**
    * This method refines a grid point by generating the children in every dimension
    * of the grid and all their missing ancestors by calling create_gridpoint().
+   * HashRefinement::refineGridpoints() refines several points without calling
+   * this method, so subclasses of HashRefinement which override
+   * refineGridpoint() have to override refineGridpoints() as well.
    *
    * @param storage hashmap that stores the gridpoints
    * @param refine_index The index in the hashmap of the point that should be refined
@@ -5,19 +5,22 @@
 
 #include <sgpp/base/grid/generation/hashmap/HashRefinement.hpp>
 #include <sgpp/base/exception/generation_exception.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
 
 #include <sgpp/globaldef.hpp>
 
 #include <vector>
 #include <algorithm>
 #include <memory>
+#include <unordered_set>
+#include <utility>
 
 
 namespace sgpp {
 namespace base {
 
 void HashRefinement::addElementToCollection(
-  const GridStorage::grid_map_iterator& iter,
+  const GridStorage::grid_map_iterator& /*iter*/,
   AbstractRefinement::refinement_list_type current_value_list,
   size_t refinements_num,
   AbstractRefinement::refinement_container_type& collection) {
@@ -43,56 +46,82 @@ void HashRefinement::collectRefinablePoints(GridStorage& storage,
     RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
   size_t refinements_num = functor.getRefinementsNum();
+  size_t size = storage.getSize();
+  size_t dim = storage.getDimension();
 
-  // max value equals min value
-
-  GridPoint point;
-  GridStorage::grid_map_iterator end_iter = storage.end();
-
-  // start iterating over whole grid
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    point = *(iter->first);
-
-    GridStorage::grid_map_iterator child_iter;
-
-    // check for each grid point whether it can be refined
-    // (i.e., whether not all kids exist yet)
-    // if yes, check whether it belongs to the refinements_num largest ones
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
-
-      // test existence of left child
-      point.set(d, source_level + 1, 2 * source_index - 1);
-      child_iter = storage.find(&point);
+  if (refinements_num == 0) {
+    return;
+  }
 
-      // if there no more grid points --> test if we should refine the grid
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
+  // check for each grid point in parallel whether it can be refined
+  // (i.e., whether not all kids exist yet)
+  std::vector<char> refinable(size, 0);
+
+  #pragma omp parallel
+  {
+    GridPoint point(dim);
+
+    #pragma omp for schedule(static)
+    for (size_t seq = 0; seq < size; seq++) {
+      point = storage.getPoint(seq);
+
+      for (size_t d = 0; d < dim && !refinable[seq]; d++) {
+        index_t source_index;
+        level_t source_level;
+        point.get(d, source_level, source_index);
+
+        // test existence of left and right child
+        point.set(d, source_level + 1, 2 * source_index - 1);
+        refinable[seq] = !storage.isContaining(point);
+        if (!refinable[seq]) {
+          point.set(d, source_level + 1, 2 * source_index + 1);
+          refinable[seq] = !storage.isContaining(point);
+        }
+
+        // reset current grid point in dimension d
+        point.set(d, source_level, source_index);
       }
+    }
+  }
 
-      // test existence of right child
-      point.set(d, source_level + 1, 2 * source_index + 1);
-      child_iter = storage.find(&point);
+  // the indicators are evaluated serially, as neither the functor nor
+  // overrides of getIndicator() have to be thread-safe;
+  // candidates are ordered by descending indicator value and ascending
+  // sequence number for equal values, which makes the selection independent
+  // of the number of threads and of the hash map layout
+  auto isBetter = [](const AbstractRefinement::refinement_pair_type& lhs,
+                     const AbstractRefinement::refinement_pair_type& rhs) {
+    return (lhs.second > rhs.second) ||
+           (lhs.second == rhs.second && lhs.first->getSeq() < rhs.first->getSeq());
+  };
+  // heap of the refinements_num best candidates, the worst candidate is on top
+  AbstractRefinement::refinement_container_type heap;
+  size_t numberOfRefinablePoints = 0;
+
+  for (size_t seq = 0; seq < size; seq++) {
+    if (!refinable[seq]) {
+      continue;
+    }
 
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
+    numberOfRefinablePoints++;
+    AbstractRefinement::refinement_list_type current_value_list =
+      getIndicator(storage, storage.find(&storage.getPoint(seq)), functor);
+
+    for (AbstractRefinement::refinement_pair_type& pair : current_value_list) {
+      heap.push_back(pair);
+      std::push_heap(heap.begin(), heap.end(), isBetter);
+      if (heap.size() > refinements_num) {
+        // remove the worst element
+        std::pop_heap(heap.begin(), heap.end(), isBetter);
+        heap.pop_back();
       }
-
-      // reset current grid point in dimension d
-      point.set(d, source_level, source_index);
     }
   }
+
+  SGPP_TRACE_COUNT(RefinementCandidates, numberOfRefinablePoints);
+
+  std::sort(heap.begin(), heap.end(), isBetter);
+  collection.insert(collection.end(), heap.begin(), heap.end());
 }
 
 AbstractRefinement::refinement_list_type HashRefinement::getIndicator(
@@ -113,10 +142,67 @@ void HashRefinement::refineGridpointsCollection(GridStorage& storage,
     AbstractRefinement::refinement_container_type& collection) {
 
   double threshold = functor.getRefinementThreshold();
+  std::vector<size_t> refine_indices;
+  refine_indices.reserve(collection.size());
 
   for (AbstractRefinement::refinement_pair_type& pair : collection) {
     if (pair.second >= threshold) {
-      refineGridpoint(storage, pair.first->getSeq());
+      refine_indices.push_back(pair.first->getSeq());
+    }
+  }
+
+  refineGridpoints(storage, refine_indices);
+}
+
+void HashRefinement::refineGridpoints(GridStorage& storage,
+                                      const std::vector<size_t>& refine_indices) {
+  size_t dim = storage.getDimension();
+  size_t childrenPerPoint = 2 * dim;
+
+  // generate all children in the order in which refining the points one
+  // after another would create them and check their existence in parallel
+  std::vector<GridPoint> children(refine_indices.size() * childrenPerPoint,
+                                  GridPoint(dim));
+  std::vector<char> missing(children.size(), 0);
+
+  #pragma omp parallel for schedule(static)
+  for (size_t p = 0; p < refine_indices.size(); p++) {
+    GridPoint point(storage[refine_indices[p]]);
+    for (size_t d = 0; d < dim; d++) {
+      index_t source_index;
+      level_t source_level;
+      point.get(d, source_level, source_index);
+
+      for (size_t side = 0; side < 2; side++) {
+        size_t child = p * childrenPerPoint + 2 * d + side;
+        point.set(d, source_level + 1,
+                  (side == 0) ? 2 * source_index - 1 : 2 * source_index + 1);
+        if (!storage.isContaining(point)) {
+          children[child] = point;
+          children[child].setLeaf(true);
+          missing[child] = 1;
+        }
+      }
+
+      point.set(d, source_level, source_index);
+    }
+  }
+
+  // Sets leaf property of the refined points to false
+  for (size_t seq : refine_indices) {
+    storage[seq].setLeaf(false);
+  }
+
+  // insert every missing child once; children may also have been created
+  // as ancestors of previously inserted children in the meantime
+  std::unordered_set<const GridPoint*, HashGridPointPointerHashFunctor,
+                     HashGridPointPointerEqualityFunctor> inserted;
+  for (size_t child = 0; child < children.size(); child++) {
+    if (!missing[child] || !inserted.insert(&children[child]).second) {
+      continue;
+    }
+    if (!storage.isContaining(children[child])) {
+      createGridpoint(storage, children[child]);
     }
   }
 }
@@ -132,6 +218,7 @@ void HashRefinement::free_refine(GridStorage& storage,
    * to the storage is the following:
    * New (if any) gridpoints are appended (to the end) of the storage
    */
+  SGPP_TRACE_SCOPE("HashRefinement::free_refine");
   size_t sizeBeforeRefine = storage.getSize();
 
   AbstractRefinement::refinement_container_type collection;
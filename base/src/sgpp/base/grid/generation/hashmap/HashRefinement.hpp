@@ -71,6 +71,19 @@ class HashRefinement: public AbstractRefinement {
    */
   void refineGridpoint(GridStorage& storage, size_t refine_index) override;
 
+  /**
+   * Refines several grid points at once. The result equals refining the
+   * points one after another with refineGridpoint(), but the existence of
+   * all children is checked in parallel and children shared by several
+   * points are only inserted once.
+   * Subclasses which change refineGridpoint() have to override this method.
+   *
+   * @param storage hashmap that stores the gridpoints
+   * @param refine_indices The indices in the hashmap of the points that should be refined
+   */
+  virtual void refineGridpoints(GridStorage& storage,
+                                const std::vector<size_t>& refine_indices);
+
   /**
    * This method creates a new point on the grid. It checks if some parents or
    * children are needed in other dimensions.
@@ -82,7 +95,10 @@ class HashRefinement: public AbstractRefinement {
 
   /**
   * Examines the grid points and stores the indices those that can be refined
-  * and have maximal indicator values.
+  * and have maximal indicator values. Whether a grid point can be refined is
+  * checked in parallel, the indicators are computed serially by
+  * getIndicator(). The collection is sorted by descending indicator value
+  * (ties by ascending sequence number).
   *
   * @param storage hashmap that stores the grid points
   * @param functor a PredictiveRefinementIndicator specifying the refinement criteria
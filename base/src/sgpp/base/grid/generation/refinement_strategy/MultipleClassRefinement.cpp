@@ -123,6 +123,13 @@ void MultipleClassRefinement::addGridpoint(GridStorage& storage, GridPoint& poin
     }
 }
 
+void MultipleClassRefinement::refineGridpoints(GridStorage& storage,
+        const std::vector<size_t>& refine_indices) {
+    for (size_t refine_index : refine_indices) {
+        refineGridpoint(storage, refine_index);
+    }
+}
+
 void MultipleClassRefinement::collectRefinablePoints(GridStorage& storage,
     RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
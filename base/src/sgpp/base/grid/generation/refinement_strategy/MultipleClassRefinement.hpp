@@ -46,6 +46,8 @@ class MultipleClassRefinement : public HashRefinement {
 
  protected:
   void refineGridpoint(GridStorage& storage, size_t refine_index) override;
+  void refineGridpoints(GridStorage& storage,
+        const std::vector<size_t>& refine_indices) override;
   void collectRefinablePoints(GridStorage& storage,
         RefinementFunctor& functor,
         AbstractRefinement::refinement_container_type& collection) override;
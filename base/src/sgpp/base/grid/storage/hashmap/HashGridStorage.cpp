@@ -6,6 +6,7 @@
 #include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
 
 #include <sgpp/base/exception/generation_exception.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
 
 #include <exception>
 #include <list>
@@ -322,6 +323,31 @@ void HashGridStorage::insert(point_type& index, std::vector<size_t>& insertedPoi
   }
 }
 
+void HashGridStorage::insertPoints(size_t numPoints, const point_type::level_type* levels,
+                                   const point_type::index_type* indices,
+                                   const uint8_t* leaves) {
+  list.reserve(list.size() + numPoints);
+  map.reserve(map.size() + numPoints);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    point_pointer point = new HashGridPoint(dimension);
+
+    for (size_t d = 0; d < dimension; d++) {
+      point->push(d, levels[i * dimension + d], indices[i * dimension + d]);
+    }
+
+    point->setLeaf(leaves[i] != 0);
+    point->rehash();
+
+    if (!map.emplace(point, list.size()).second) {
+      delete point;
+      throw generation_exception("HashGridStorage::insertPoints : duplicate grid point");
+    }
+
+    list.push_back(point);
+  }
+}
+
 void HashGridStorage::update(point_type& index, size_t pos) {
   if (pos < list.size()) {
     // Remove old element at pos
@@ -700,5 +726,28 @@ DataVector HashGridStorage::getCoordinates(const HashGridPoint& point) const {
   return coordinates;
 }
 
+// the lookups are defined here and not inline in the header, so that the counting only depends
+// on whether the library was compiled with SGPP_TRACING, not on the flags of the including code
+HashGridStorage::grid_map_iterator HashGridStorage::find(point_pointer index) {
+  SGPP_TRACE_COUNT(HashLookups, 1);
+  return map.find(index);
+}
+
+bool HashGridStorage::isContaining(HashGridPoint& index) const {
+  SGPP_TRACE_COUNT(HashLookups, 1);
+  return map.find(&index) != map.end();
+}
+
+size_t HashGridStorage::getSequenceNumber(HashGridPoint& index) const {
+  SGPP_TRACE_COUNT(HashLookups, 1);
+  grid_map_const_iterator iter = map.find(&index);
+
+  if (iter != map.end()) {
+    return iter->second;
+  } else {
+    return map.size() + 1;
+  }
+}
+
 }  // namespace base
 }  // namespace sgpp
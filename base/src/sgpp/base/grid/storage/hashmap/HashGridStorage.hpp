@@ -266,6 +266,18 @@ class HashGridStorage {
    */
   void insert(point_type& index, std::vector<size_t>& insertedPoints);
 
+  /**
+   * appends grid points given as packed level and index arrays, e.g., read from a binary
+   * model file; list and map are reserved only once for all points
+   *
+   * @param numPoints number of grid points to insert
+   * @param levels    levels of the points (numPoints x dimension, row-major)
+   * @param indices   indices of the points (numPoints x dimension, row-major)
+   * @param leaves    leaf property of the points (numPoints entries, nonzero means leaf)
+   */
+  void insertPoints(size_t numPoints, const point_type::level_type* levels,
+                    const point_type::index_type* indices, const uint8_t* leaves);
+
   /**
    * updates an already stored index
    *
@@ -391,6 +403,11 @@ class HashGridStorage {
    */
   Stretching* getStretching();
 
+  /**
+   * @return whether the grid uses a stretching instead of a bounding box
+   */
+  bool isUsingStretching() const { return bUseStretching; }
+
   /**
    * sets the bounding box of the current grid
    *
@@ -629,28 +646,10 @@ unsigned int inline HashGridStorage::store(point_pointer index) {
   return static_cast<unsigned int>(map[index] = static_cast<unsigned int>(list.size() - 1));
 }
 
-HashGridStorage::grid_map_iterator inline HashGridStorage::find(point_pointer index) {
-  return map.find(index);
-}
-
 HashGridStorage::grid_map_iterator inline HashGridStorage::begin() { return map.begin(); }
 
 HashGridStorage::grid_map_iterator inline HashGridStorage::end() { return map.end(); }
 
-bool inline HashGridStorage::isContaining(HashGridPoint& index) const {
-  return map.find(&index) != map.end();
-}
-
-size_t inline HashGridStorage::getSequenceNumber(HashGridPoint& index) const {
-  grid_map_const_iterator iter = map.find(&index);
-
-  if (iter != map.end()) {
-    return iter->second;
-  } else {
-    return map.size() + 1;
-  }
-}
-
 bool inline HashGridStorage::isInvalidSequenceNumber(size_t s) { return s > map.size(); }
 
 std::vector<size_t> inline HashGridStorage::getAlgorithmicDimensions() { return algoDims; }
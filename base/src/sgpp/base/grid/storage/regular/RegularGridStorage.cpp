@@ -0,0 +1,318 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/generation_exception.hpp>
+#include <sgpp/base/grid/storage/regular/RegularGridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+RegularGridStorage::RegularGridStorage(size_t dimension, level_t level)
+    : dimension(dimension), level(level), maxSum((level > 0) ? (level - 1) : 0), size(0) {
+  const size_t numSums = maxSum + 1;
+  offsets.assign((dimension + 1) * numSums * (maxSum + 2), 0);
+
+  // numPoints[m]: number of points of the (k - 1)-dimensional grid with level sum at most m,
+  // the zero-dimensional grid consists of a single point
+  std::vector<size_t> numPoints(numSums, 1);
+
+  for (size_t k = 1; k <= dimension; k++) {
+    for (size_t m = 0; m < numSums; m++) {
+      size_t* offset = &offsets[(k * numSums + m) * (maxSum + 2)];
+
+      for (size_t j = 0; j <= m; j++) {
+        offset[j + 1] = offset[j] + (static_cast<size_t>(1) << j) * numPoints[m - j];
+      }
+    }
+
+    for (size_t m = 0; m < numSums; m++) {
+      numPoints[m] = getOffset(k, m, m + 1);
+    }
+  }
+
+  if ((level > 0) && (dimension > 0)) {
+    size = numPoints[maxSum];
+  }
+}
+
+size_t RegularGridStorage::getSequenceNumber(const level_type* levels,
+                                             const index_type* indices) const {
+  size_t seq = 0;
+  size_t sum = 0;
+  size_t indexRank = 0;
+
+  if (size == 0) {
+    return size;
+  }
+
+  for (size_t t = 0; t < dimension; t++) {
+    if ((levels[t] < 1) || (sum + levels[t] - 1 > maxSum) || (indices[t] % 2 == 0) ||
+        (indices[t] >= (static_cast<index_type>(1) << levels[t]))) {
+      return size;
+    }
+
+    const size_t j = levels[t] - 1;
+    seq += getOffset(dimension - t, maxSum - sum, j) << sum;
+    sum += j;
+    indexRank = (indexRank << j) | (indices[t] >> 1);
+  }
+
+  return seq + indexRank;
+}
+
+size_t RegularGridStorage::getSequenceNumber(const GridPoint& point) const {
+  size_t seq = 0;
+  size_t sum = 0;
+  size_t indexRank = 0;
+
+  if ((size == 0) || (point.getDimension() != dimension)) {
+    return size;
+  }
+
+  for (size_t t = 0; t < dimension; t++) {
+    level_type l;
+    index_type i;
+    point.get(t, l, i);
+
+    if ((l < 1) || (sum + l - 1 > maxSum) || (i % 2 == 0) ||
+        (i >= (static_cast<index_type>(1) << l))) {
+      return size;
+    }
+
+    const size_t j = l - 1;
+    seq += getOffset(dimension - t, maxSum - sum, j) << sum;
+    sum += j;
+    indexRank = (indexRank << j) | (i >> 1);
+  }
+
+  return seq + indexRank;
+}
+
+size_t RegularGridStorage::getLevelRank(size_t t, size_t sum, size_t seq, size_t& j) const {
+  const size_t k = dimension - t;
+  const size_t m = maxSum - sum;
+
+  // the offsets are increasing in j, so the level is found by bisection
+  size_t lower = 0;
+  size_t upper = m;
+
+  while (lower < upper) {
+    const size_t middle = (lower + upper + 1) / 2;
+
+    if ((getOffset(k, m, middle) << sum) <= seq) {
+      lower = middle;
+    } else {
+      upper = middle - 1;
+    }
+  }
+
+  j = lower;
+  return seq - (getOffset(k, m, j) << sum);
+}
+
+void RegularGridStorage::getPoint(size_t seq, level_type* levels, index_type* indices) const {
+  size_t sum = 0;
+
+  // levels, from the first to the last dimension
+  for (size_t t = 0; t < dimension; t++) {
+    size_t j;
+    seq = getLevelRank(t, sum, seq, j);
+    levels[t] = static_cast<level_type>(j + 1);
+    sum += j;
+  }
+
+  // the remainder is the rank of the index vector in the subspace
+  for (size_t t = dimension; t-- > 0;) {
+    const size_t j = levels[t] - 1;
+    indices[t] = static_cast<index_type>(2 * (seq & ((static_cast<size_t>(1) << j) - 1)) + 1);
+    seq >>= j;
+  }
+}
+
+void RegularGridStorage::getPoint(size_t seq, GridPoint& point) const {
+  size_t sum = 0;
+
+  for (size_t t = 0; t < dimension; t++) {
+    size_t j;
+    seq = getLevelRank(t, sum, seq, j);
+    point.push(t, static_cast<level_type>(j + 1), 1);
+    sum += j;
+  }
+
+  for (size_t t = dimension; t-- > 0;) {
+    const level_type l = point.getLevel(t);
+    const size_t j = l - 1;
+    point.push(t, l,
+               static_cast<index_type>(2 * (seq & ((static_cast<size_t>(1) << j) - 1)) + 1));
+    seq >>= j;
+  }
+
+  point.setLeaf(sum == maxSum);
+  point.rehash();
+}
+
+bool RegularGridStorage::isContaining(const GridPoint& point) const {
+  return getSequenceNumber(point) < size;
+}
+
+bool RegularGridStorage::isLeaf(size_t seq) const {
+  size_t sum = 0;
+
+  for (size_t t = 0; t < dimension; t++) {
+    size_t j;
+    seq = getLevelRank(t, sum, seq, j);
+    sum += j;
+  }
+
+  return (sum == maxSum);
+}
+
+bool RegularGridStorage::isLeaf(const level_type* levels) const {
+  size_t sum = 0;
+
+  for (size_t t = 0; t < dimension; t++) {
+    sum += levels[t] - 1;
+  }
+
+  return (sum == maxSum);
+}
+
+size_t RegularGridStorage::getNeighbor(level_type* levels, index_type* indices, size_t d,
+                                       level_type level, index_type index) const {
+  const level_type oldLevel = levels[d];
+  const index_type oldIndex = indices[d];
+  levels[d] = level;
+  indices[d] = index;
+  const size_t seq = getSequenceNumber(levels, indices);
+  levels[d] = oldLevel;
+  indices[d] = oldIndex;
+  return seq;
+}
+
+size_t RegularGridStorage::getLeftChild(level_type* levels, index_type* indices,
+                                        size_t d) const {
+  return getNeighbor(levels, indices, d, levels[d] + 1, 2 * indices[d] - 1);
+}
+
+size_t RegularGridStorage::getRightChild(level_type* levels, index_type* indices,
+                                         size_t d) const {
+  return getNeighbor(levels, indices, d, levels[d] + 1, 2 * indices[d] + 1);
+}
+
+size_t RegularGridStorage::getParent(level_type* levels, index_type* indices, size_t d) const {
+  if (levels[d] == 1) {
+    return size;
+  }
+
+  return getNeighbor(levels, indices, d, levels[d] - 1, (indices[d] >> 1) | 1);
+}
+
+size_t RegularGridStorage::getLeftAncestor(level_type* levels, index_type* indices,
+                                           size_t d) const {
+  level_type l = levels[d];
+  index_type i = indices[d] - 1;
+
+  if (i == 0) {
+    return size;
+  }
+
+  // the left end of the support is a point of a coarser level
+  while (i % 2 == 0) {
+    i >>= 1;
+    l--;
+  }
+
+  return getNeighbor(levels, indices, d, l, i);
+}
+
+size_t RegularGridStorage::getRightAncestor(level_type* levels, index_type* indices,
+                                            size_t d) const {
+  level_type l = levels[d];
+  index_type i = indices[d] + 1;
+
+  if (i == (static_cast<index_type>(1) << l)) {
+    return size;
+  }
+
+  while (i % 2 == 0) {
+    i >>= 1;
+    l--;
+  }
+
+  return getNeighbor(levels, indices, d, l, i);
+}
+
+bool RegularGridStorage::isRankOrdered(const GridStorage& storage) const {
+  if ((storage.getDimension() != dimension) || (storage.getSize() != size)) {
+    return false;
+  }
+
+  bool ordered = true;
+
+#pragma omp parallel for schedule(static) reduction(&& : ordered)
+  for (size_t seq = 0; seq < size; seq++) {
+    ordered = ordered && (getSequenceNumber(storage.getPoint(seq)) == seq);
+  }
+
+  return ordered;
+}
+
+void RegularGridStorage::getLevelIndexArraysForEval(DataMatrix& level, DataMatrix& index) const {
+  level.resize(size, dimension);
+  index.resize(size, dimension);
+
+#pragma omp parallel
+  {
+    std::vector<level_type> levels(dimension);
+    std::vector<index_type> indices(dimension);
+
+#pragma omp for schedule(static)
+    for (size_t seq = 0; seq < size; seq++) {
+      getPoint(seq, levels.data(), indices.data());
+
+      for (size_t t = 0; t < dimension; t++) {
+        level.set(seq, t, static_cast<double>(static_cast<size_t>(1) << levels[t]));
+        index.set(seq, t, static_cast<double>(indices[t]));
+      }
+    }
+  }
+}
+
+void RegularGridStorage::generate(GridStorage& storage) const {
+  if (storage.getSize() > 0) {
+    throw generation_exception("RegularGridStorage::generate : storage not empty");
+  }
+
+  if (storage.getDimension() != dimension) {
+    throw generation_exception("RegularGridStorage::generate : dimensions do not match");
+  }
+
+  std::vector<level_type> levels(size * dimension);
+  std::vector<index_type> indices(size * dimension);
+  std::vector<uint8_t> leaves(size);
+
+#pragma omp parallel for schedule(static)
+  for (size_t seq = 0; seq < size; seq++) {
+    level_type* pointLevels = &levels[seq * dimension];
+    size_t sum = 0;
+
+    getPoint(seq, pointLevels, &indices[seq * dimension]);
+
+    for (size_t t = 0; t < dimension; t++) {
+      sum += pointLevels[t] - 1;
+    }
+
+    leaves[seq] = (sum == maxSum) ? 1 : 0;
+  }
+
+  storage.insertPoints(size, levels.data(), indices.data(), leaves.data());
+}
+
+}  // namespace base
+}  // namespace sgpp
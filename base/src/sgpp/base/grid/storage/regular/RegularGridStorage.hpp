@@ -0,0 +1,227 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/LevelIndexTypes.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Implicit storage of a regular sparse grid without boundary points, i.e., of all points with
+ * levels \f$\ell_t \ge 1\f$ and \f$|\vec{\ell}|_1 \le n + d - 1\f$ (as generated by
+ * HashGenerator::regular with T = 0).
+ *
+ * The grid points are not stored. Instead, the sequence number of a point is computed in
+ * closed form (rank) and vice versa (unrank): the points are ordered by their level vectors
+ * (lexicographically), and within a subspace by their indices (mixed radix).
+ * With tables of the number of points per remaining level sum, ranking costs O(d) and
+ * unranking O(d log n). Parents and children are found by ranking the modified level-index pair,
+ * i.e., without hash lookups.
+ *
+ * To use existing operations, generate() fills a GridStorage in rank order. Afterwards, the
+ * sequence numbers of both storages coincide, so the closed-form navigation may replace hash
+ * lookups in the storage. OperationHierarchisationLinear does so for storages in rank order.
+ */
+class RegularGridStorage {
+ public:
+  /// type of levels
+  typedef GridPoint::level_type level_type;
+  /// type of indices
+  typedef GridPoint::index_type index_type;
+
+  /**
+   * @param dimension dimension of the grid
+   * @param level     level n of the regular sparse grid
+   */
+  RegularGridStorage(size_t dimension, level_t level);
+
+  /**
+   * @return dimension of the grid
+   */
+  size_t getDimension() const { return dimension; }
+
+  /**
+   * @return level of the grid
+   */
+  level_t getLevel() const { return level; }
+
+  /**
+   * @return number of grid points
+   */
+  size_t getSize() const { return size; }
+
+  /**
+   * Computes the sequence number of a level-index pair (rank).
+   *
+   * @param levels  levels of the point (dimension entries)
+   * @param indices indices of the point (dimension entries)
+   * @return sequence number or getSize() if the point is not contained in the grid
+   */
+  size_t getSequenceNumber(const level_type* levels, const index_type* indices) const;
+
+  /**
+   * Computes the sequence number of a grid point (rank).
+   *
+   * @param point grid point
+   * @return sequence number or getSize() if the point is not contained in the grid
+   */
+  size_t getSequenceNumber(const GridPoint& point) const;
+
+  /**
+   * Computes the level-index pair of a sequence number (unrank).
+   *
+   * @param      seq     sequence number (less than getSize())
+   * @param[out] levels  levels of the point (dimension entries)
+   * @param[out] indices indices of the point (dimension entries)
+   */
+  void getPoint(size_t seq, level_type* levels, index_type* indices) const;
+
+  /**
+   * Computes the grid point of a sequence number (unrank), including its leaf property.
+   *
+   * @param      seq   sequence number (less than getSize())
+   * @param[out] point grid point of the grid's dimension
+   */
+  void getPoint(size_t seq, GridPoint& point) const;
+
+  /**
+   * @param point grid point
+   * @return whether the point is contained in the grid
+   */
+  bool isContaining(const GridPoint& point) const;
+
+  /**
+   * @param seq sequence number
+   * @return whether the point has no children in the grid
+   */
+  bool isLeaf(size_t seq) const;
+
+  /**
+   * @param levels levels of a grid point (dimension entries)
+   * @return whether the point has no children in the grid
+   */
+  bool isLeaf(const level_type* levels) const;
+
+  /**
+   * The navigation functions take the level-index pair of a grid point, e.g., from getPoint with
+   * arrays owned by the caller, and rank the modified pair in O(d). The arrays are modified
+   * temporarily, but restored on return.
+   *
+   * @param levels  levels of the grid point (dimension entries)
+   * @param indices indices of the grid point (dimension entries)
+   * @param d       dimension
+   * @return sequence number of the left child in dimension d or getSize() if it does not exist
+   */
+  size_t getLeftChild(level_type* levels, index_type* indices, size_t d) const;
+
+  /**
+   * @param levels  levels of the grid point (dimension entries)
+   * @param indices indices of the grid point (dimension entries)
+   * @param d       dimension
+   * @return sequence number of the right child in dimension d or getSize() if it does not exist
+   */
+  size_t getRightChild(level_type* levels, index_type* indices, size_t d) const;
+
+  /**
+   * @param levels  levels of the grid point (dimension entries)
+   * @param indices indices of the grid point (dimension entries)
+   * @param d       dimension
+   * @return sequence number of the parent in dimension d or getSize() if it does not exist
+   */
+  size_t getParent(level_type* levels, index_type* indices, size_t d) const;
+
+  /**
+   * @param levels  levels of the grid point (dimension entries)
+   * @param indices indices of the grid point (dimension entries)
+   * @param d       dimension
+   * @return sequence number of the grid point at the left end of the support in dimension d
+   *         or getSize() if it lies on the boundary
+   */
+  size_t getLeftAncestor(level_type* levels, index_type* indices, size_t d) const;
+
+  /**
+   * @param levels  levels of the grid point (dimension entries)
+   * @param indices indices of the grid point (dimension entries)
+   * @param d       dimension
+   * @return sequence number of the grid point at the right end of the support in dimension d
+   *         or getSize() if it lies on the boundary
+   */
+  size_t getRightAncestor(level_type* levels, index_type* indices, size_t d) const;
+
+  /**
+   * @param storage storage to check
+   * @return whether storage contains exactly the points of this grid in rank order
+   *         (e.g., after generate()), i.e., whether the sequence numbers of both coincide
+   */
+  bool isRankOrdered(const GridStorage& storage) const;
+
+  /**
+   * Same as HashGridStorage::getLevelIndexArraysForEval, computed in parallel.
+   *
+   * @param[out] level matrix of \f$2^{\ell}\f$ (getSize() x dimension, resized)
+   * @param[out] index matrix of indices (getSize() x dimension, resized)
+   */
+  void getLevelIndexArraysForEval(DataMatrix& level, DataMatrix& index) const;
+
+  /**
+   * Inserts all grid points in rank order into an empty storage of the same dimension.
+   * The level-index pairs are computed in parallel and inserted in bulk.
+   *
+   * @param storage empty storage
+   */
+  void generate(GridStorage& storage) const;
+
+ private:
+  /// dimension of the grid
+  size_t dimension;
+  /// level n of the grid
+  level_t level;
+  /// maximal sum of \f$\ell_t - 1\f$, i.e., n - 1
+  size_t maxSum;
+  /// number of grid points
+  size_t size;
+  /**
+   * offsets[(k * (maxSum + 1) + m) * (maxSum + 2) + j]: number of points of a k-dimensional
+   * grid with \f$\sum_t (\ell_t - 1) \le m\f$ whose first level is at most j,
+   * i.e., the rank of the first point with first level j + 1
+   */
+  std::vector<size_t> offsets;
+
+  /**
+   * @return entry of offsets for k remaining dimensions, remaining level sum m and first
+   *         level j + 1
+   */
+  size_t getOffset(size_t k, size_t m, size_t j) const {
+    return offsets[(k * (maxSum + 1) + m) * (maxSum + 2) + j];
+  }
+
+  /**
+   * Finds the level of dimension t by bisection of the offsets.
+   *
+   * @param      t   dimension
+   * @param      sum sum of \f$\ell_s - 1\f$ of the dimensions s < t
+   * @param      seq remaining rank of the point
+   * @param[out] j   level minus one
+   * @return remaining rank of the point without dimension t
+   */
+  size_t getLevelRank(size_t t, size_t sum, size_t seq, size_t& j) const;
+
+  /**
+   * @return sequence number of the point with level and index in dimension d replaced
+   */
+  size_t getNeighbor(level_type* levels, index_type* indices, size_t d, level_type level,
+                     index_type index) const;
+};
+
+}  // namespace base
+}  // namespace sgpp
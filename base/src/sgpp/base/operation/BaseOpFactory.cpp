@@ -6,6 +6,7 @@
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
 #include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
 
 #include <sgpp/base/grid/type/BsplineBoundaryGrid.hpp>
 #include <sgpp/base/grid/type/BsplineClenshawCurtisGrid.hpp>
@@ -594,6 +595,7 @@ base::OperationEval* createOperationEval(base::Grid& grid) {
 
 base::OperationMultipleEval* createOperationMultipleEval(base::Grid& grid,
                                                          base::DataMatrix& dataset) {
+  SGPP_TRACE_SCOPE("op_factory::createOperationMultipleEval");
   if (grid.getType() == base::GridType::Linear) {
     return new base::OperationMultipleEvalLinear(grid, dataset);
   } else if (grid.getType() == base::GridType::LinearL0Boundary ||
@@ -624,6 +626,20 @@ base::OperationMultipleEval* createOperationMultipleEval(base::Grid& grid,
   }
 }
 
+base::OperationMultipleEval* createOperationMultipleEval(base::Grid& grid,
+                                                         const base::DataMatrixView& dataset) {
+  SGPP_TRACE_SCOPE("op_factory::createOperationMultipleEval");
+  if (grid.getType() == base::GridType::Linear) {
+    return new base::OperationMultipleEvalLinear(grid, dataset);
+  } else if (grid.getType() == base::GridType::ModLinear) {
+    return new base::OperationMultipleEvalModLinear(grid, dataset);
+  } else {
+    throw base::factory_exception(
+        "createOperationMultipleEval is not implemented for this grid type and a dataset "
+        "view, use a DataMatrix instead.");
+  }
+}
+
 base::OperationMultipleEval* createOperationMultipleEvalInter(
     base::Grid& grid, base::DataMatrix& dataset, std::set<std::set<size_t>> interactions) {
   if (grid.getType() == base::GridType::ModLinear) {
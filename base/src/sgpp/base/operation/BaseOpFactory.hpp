@@ -144,6 +144,21 @@ base::OperationEval* createOperationEval(base::Grid& grid);
 
 base::OperationMultipleEval* createOperationMultipleEval(base::Grid& grid,
                                                          base::DataMatrix& dataset);
+
+/**
+ * Factory method, returning an OperationMultipleEval that works on a view of the dataset
+ * instead of a DataMatrix, e.g., on a numpy array or on a block of rows of a larger matrix.
+ * The data points are not copied and have to outlive the operation.
+ * Supported for Linear and ModLinear grids.
+ * Note: object has to be freed after use.
+ *
+ * @param grid Grid which is to be used
+ * @param dataset View of the dataset (one datapoint per row) that is to be evaluated for
+ * the sparse grid function
+ * @return Pointer to the new OperationMultipleEval object for the Grid grid
+ */
+base::OperationMultipleEval* createOperationMultipleEval(base::Grid& grid,
+                                                         const base::DataMatrixView& dataset);
 /**
  * Similar to createOperationMultipleEval, but makes use of interaction terms during evaluation
  *
@@ -7,6 +7,7 @@
 #define OPERATIONEVAL_HPP
 
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataVectorView.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -41,6 +42,20 @@ class OperationEval {
   virtual double eval(const DataVector& alpha,
                        const DataVector& point) = 0;
 
+  /**
+   * Evaluates the sparse grid function at a point that is not stored in a DataVector,
+   * e.g., a row of a DataMatrixView. By default, the coordinates are copied.
+   *
+   * @param alpha The coefficients of the sparse grid's basis functions
+   * @param point The coordinates of the evaluation point
+   */
+  virtual double eval(const DataVector& alpha,
+                      const DataVectorView& point) {
+    DataVector pointCopy(point.getSize());
+    point.copyTo(pointCopy);
+    return eval(alpha, pointCopy);
+  }
+
   /**
    * @param      alpha  coefficient matrix (each column is a coefficient vector)
    * @param      point  evaluation point
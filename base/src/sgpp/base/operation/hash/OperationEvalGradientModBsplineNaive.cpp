@@ -34,9 +34,10 @@ double OperationEvalGradientModBsplineNaive::evalGradient(const DataVector& alph
     curGradient.setAll(alpha[i]);
 
     for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
-      const double dx1d = base.evalDx(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]) *
-          innerDerivative[t];
+      double val1d, dx1d, dxdx1d;
+      base.evalWithDerivatives(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t], val1d, dx1d,
+                               dxdx1d);
+      dx1d *= innerDerivative[t];
 
       curValue *= val1d;
 
@@ -85,9 +86,10 @@ void OperationEvalGradientModBsplineNaive::evalGradient(const DataMatrix& alpha,
     curGradient.setAll(1.0);
 
     for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
-      const double dx1d = base.evalDx(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]) *
-          innerDerivative[t];
+      double val1d, dx1d, dxdx1d;
+      base.evalWithDerivatives(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t], val1d, dx1d,
+                               dxdx1d);
+      dx1d *= innerDerivative[t];
 
       curValue *= val1d;
 
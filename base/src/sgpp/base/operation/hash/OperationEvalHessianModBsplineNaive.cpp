@@ -41,11 +41,11 @@ double OperationEvalHessianModBsplineNaive::evalHessian(const DataVector& alpha,
     curHessian.setAll(alpha[i]);
 
     for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
-      const double dx1d = base.evalDx(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]) *
-          innerDerivative[t];
-      const double dxdx1d = base.evalDxDx(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]) *
-          innerDerivative[t] * innerDerivative[t];
+      double val1d, dx1d, dxdx1d;
+      base.evalWithDerivatives(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t], val1d, dx1d,
+                               dxdx1d);
+      dx1d *= innerDerivative[t];
+      dxdx1d *= innerDerivative[t] * innerDerivative[t];
 
       curValue *= val1d;
 
@@ -123,11 +123,11 @@ void OperationEvalHessianModBsplineNaive::evalHessian(const DataMatrix& alpha,
     curHessian.setAll(1.0);
 
     for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
-      const double dx1d = base.evalDx(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]) *
-          innerDerivative[t];
-      const double dxdx1d = base.evalDxDx(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]) *
-          innerDerivative[t] * innerDerivative[t];
+      double val1d, dx1d, dxdx1d;
+      base.evalWithDerivatives(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t], val1d, dx1d,
+                               dxdx1d);
+      dx1d *= innerDerivative[t];
+      dxdx1d *= innerDerivative[t] * innerDerivative[t];
 
       curValue *= val1d;
 
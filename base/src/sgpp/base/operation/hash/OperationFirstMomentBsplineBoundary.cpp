@@ -7,6 +7,7 @@
 #include <sgpp/base/grid/type/BsplineBoundaryGrid.hpp>
 #include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
+#include <sgpp/base/tools/TensorProductQuadrature.hpp>
 
 #include <sgpp/globaldef.hpp>
 #include <algorithm>
@@ -27,13 +28,6 @@ double OperationFirstMomentBsplineBoundary::doQuadrature(const DataVector& alpha
   }
   size_t p = dynamic_cast<sgpp::base::BsplineBoundaryGrid*>(grid)->getDegree();
   double pDbl = static_cast<double>(p);
-  double res = 0;
-  double tmpres = 1;
-  base::index_t index;
-  double indexDbl;
-  base::level_t level;
-  double xlower = 0.0;
-  double xupper = 0.0;
   const size_t pp1h = (p + 1) >> 1;  // (p + 1) / 2
   const double pp1hDbl = static_cast<double>(pp1h);
   const size_t quadOrder = static_cast<size_t>(ceil(pDbl / 2.)) + 1;
@@ -43,38 +37,30 @@ double OperationFirstMomentBsplineBoundary::doQuadrature(const DataVector& alpha
   base::GaussLegendreQuadRule1D gauss;
   gauss.getLevelPointsAndWeightsNormalized(quadOrder, coordinates, weights);
 
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != storage.end(); iter++) {
-    tmpres = 1.;
-
-    for (size_t dim = 0; dim < storage.getDimension(); dim++) {
-      index = iter->first->getIndex(dim);
-      indexDbl = static_cast<double>(index);
-      level = iter->first->getLevel(dim);
-      double hInv = static_cast<double>(1 << level);
-      xlower = bounds == nullptr ? 0.0 : bounds->get(dim, 0);
-      xupper = bounds == nullptr ? 1.0 : bounds->get(dim, 1);
-      double width = xupper - xlower;
-
-      size_t start = ((index > pp1h) ? 0 : (pp1h - index));
-      size_t stop = static_cast<size_t>(std::min(pDbl, hInv + pp1hDbl - indexDbl - 1));
-      double scaling = 1./hInv;  // for a single BsplineBoundary section
-      double sum_1d = 0.;
-      for (size_t n = start; n <= stop; n++) {
-        double offset = scaling * static_cast<double>(n + index - pp1h);
-        for (size_t c = 0; c < quadOrder; c++) {
-          const double x = offset + scaling * coordinates[c];
-          sum_1d += weights[c] * x * basis.eval(level, index, x);
+  TensorProductQuadrature quadrature(
+      storage,
+      [&](level_t level, index_t index, double* moments) {
+        const double indexDbl = static_cast<double>(index);
+        const double hInv = static_cast<double>(1 << level);
+        size_t start = ((index > pp1h) ? 0 : (pp1h - index));
+        size_t stop = static_cast<size_t>(std::min(pDbl, hInv + pp1hDbl - indexDbl - 1));
+        double scaling = 1./hInv;  // for a single BsplineBoundary section
+        double sum_1d = 0.;
+        for (size_t n = start; n <= stop; n++) {
+          double offset = scaling * static_cast<double>(n + index - pp1h);
+          for (size_t c = 0; c < quadOrder; c++) {
+            const double x = offset + scaling * coordinates[c];
+            sum_1d += weights[c] * x * basis.eval(level, index, x);
+          }
         }
-      }
-      sum_1d *= scaling;
-      tmpres *=
-        width * sum_1d + xlower * basis.getIntegral(level, index);
-    }
+        sum_1d *= scaling;
 
-    res += alpha.get(iter->second) * tmpres;
-  }
+        moments[0] = basis.getIntegral(level, index);
+        moments[1] = sum_1d;
+      },
+      2);
 
-  return res;
+  return quadrature.firstMoment(alpha, bounds);
 }
 
 }  // namespace base
@@ -7,6 +7,7 @@
 #include <sgpp/base/grid/type/ModPolyGrid.hpp>
 #include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
+#include <sgpp/base/tools/TensorProductQuadrature.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -24,14 +25,6 @@ double OperationFirstMomentModPoly::doQuadrature(const DataVector& alpha, DataMa
         "OperationFirstMomentModPoly::doQuadrature - bounds matrix has the wrong shape");
   }
 
-  double res = 0;
-  double tmpres = 1;
-  base::index_t index;
-  double indexDbl;
-  base::level_t level;
-  double xlower = 0.0;
-  double xupper = 0.0;
-
   const size_t quadOrder =  static_cast<size_t>(
     ceil(static_cast<double>(dynamic_cast<sgpp::base::ModPolyGrid*>(grid)->getDegree()) / 2.))
     + 1;
@@ -41,34 +34,26 @@ double OperationFirstMomentModPoly::doQuadrature(const DataVector& alpha, DataMa
   base::GaussLegendreQuadRule1D gauss;
   gauss.getLevelPointsAndWeightsNormalized(quadOrder, coordinates, weights);
 
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != storage.end(); iter++) {
-    tmpres = 1.;
-
-    for (size_t dim = 0; dim < storage.getDimension(); dim++) {
-      index = iter->first->getIndex(dim);
-      indexDbl = static_cast<double>(index);
-      level = iter->first->getLevel(dim);
-      double hInv = static_cast<double>(1 << level);
-      xlower = bounds == nullptr ? 0.0 : bounds->get(dim, 0);
-      xupper = bounds == nullptr ? 1.0 : bounds->get(dim, 1);
-      double width = xupper - xlower;
-      double scaling = (index != 0 && indexDbl != hInv) ? 2./hInv : 1./hInv;
-      double left = (indexDbl - 1) * (1./hInv);
-
-      double gaussQuadSum = 0.;
-      for (size_t c = 0; c < quadOrder; c++) {
-        const double x = left + scaling * coordinates[c];
-        gaussQuadSum += weights[c] * x * basis.eval(level, index, x);
-      }
-
-      tmpres *=
-        width * scaling * gaussQuadSum + xlower * basis.getIntegral(level, index);
-    }
-
-    res += alpha.get(iter->second) * tmpres;
-  }
-
-  return res;
+  TensorProductQuadrature quadrature(
+      storage,
+      [&](level_t level, index_t index, double* moments) {
+        const double indexDbl = static_cast<double>(index);
+        const double hInv = static_cast<double>(1 << level);
+        double scaling = (index != 0 && indexDbl != hInv) ? 2./hInv : 1./hInv;
+        double left = (indexDbl - 1) * (1./hInv);
+
+        double gaussQuadSum = 0.;
+        for (size_t c = 0; c < quadOrder; c++) {
+          const double x = left + scaling * coordinates[c];
+          gaussQuadSum += weights[c] * x * basis.eval(level, index, x);
+        }
+
+        moments[0] = basis.getIntegral(level, index);
+        moments[1] = scaling * gaussQuadSum;
+      },
+      2);
+
+  return quadrature.firstMoment(alpha, bounds);
 }
 
 }  // namespace base
@@ -8,16 +8,64 @@
 #include <sgpp/base/operation/hash/common/algorithm_sweep/DehierarchisationLinear.hpp>
 
 #include <sgpp/base/algorithm/sweep.hpp>
+#include <sgpp/base/grid/storage/regular/RegularGridStorage.hpp>
 
 
 #include <sgpp/globaldef.hpp>
 
+#include <vector>
 
 namespace sgpp {
 namespace base {
 
+namespace {
+
+/**
+ * Hierarchisation of a storage whose points are in the rank order of a regular sparse grid.
+ * In every dimension, the surplus is the nodal value minus the mean of the nodal values at the
+ * ends of the support, whose sequence numbers are computed instead of looked up.
+ */
+void hierarchiseRegular(const RegularGridStorage& regularStorage, DataVector& node_values) {
+  typedef RegularGridStorage::level_type level_type;
+  typedef RegularGridStorage::index_type index_type;
+  const size_t dim = regularStorage.getDimension();
+  const size_t size = regularStorage.getSize();
+  DataVector nodal(size);
+
+  for (size_t d = 0; d < dim; d++) {
+    nodal.copyFrom(node_values);
+
+#pragma omp parallel
+    {
+      std::vector<level_type> levels(dim);
+      std::vector<index_type> indices(dim);
+
+#pragma omp for schedule(static)
+      for (size_t seq = 0; seq < size; seq++) {
+        regularStorage.getPoint(seq, levels.data(), indices.data());
+        const size_t left = regularStorage.getLeftAncestor(levels.data(), indices.data(), d);
+        const size_t right = regularStorage.getRightAncestor(levels.data(), indices.data(), d);
+        const double fl = (left < size) ? nodal[left] : 0.0;
+        const double fr = (right < size) ? nodal[right] : 0.0;
+        node_values[seq] = nodal[seq] - 0.5 * (fl + fr);
+      }
+    }
+  }
+}
+
+}  // namespace
+
 void OperationHierarchisationLinear::doHierarchisation(DataVector&
     node_values) {
+  // regular grids generated by RegularGridStorage::generate need no hash lookups
+  RegularGridStorage regularStorage(storage.getDimension(),
+                                    static_cast<level_t>(storage.getMaxLevel()));
+
+  if ((storage.getSize() > 0) && regularStorage.isRankOrdered(storage)) {
+    hierarchiseRegular(regularStorage, node_values);
+    return;
+  }
+
   HierarchisationLinear func(storage);
   sweep<HierarchisationLinear> s(func, storage);
 
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixView.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/exception/not_implemented_exception.hpp>
 #include <sgpp/base/exception/operation_exception.hpp>
@@ -25,11 +26,25 @@ namespace base {
  * points
  */
 class OperationMultipleEval {
+ private:
+  /// what dataset refers to if the operation was created from a DataMatrixView
+  DataMatrix noDataset;
+
  protected:
   Grid& grid;
   DataMatrix& dataset;
+  /// data points if the operation was created from a DataMatrixView, empty otherwise
+  DataMatrixView datasetView;
   bool isPrepared;
 
+  /**
+   * @return view of the data points, i.e., of dataset (taken now, as the dataset may have been
+   * resized since the construction) or the view the operation was created from
+   */
+  DataMatrixView getDatasetView() {
+    return (&dataset == &noDataset) ? datasetView : DataMatrixView(dataset);
+  }
+
  public:
   /**
    * Constructor
@@ -39,7 +54,32 @@ class OperationMultipleEval {
    * copy of the dataset
    */
   OperationMultipleEval(sgpp::base::Grid& grid, DataMatrix& dataset)
-      : grid(grid), dataset(dataset), isPrepared(false) {}
+      : grid(grid), dataset(dataset), datasetView(), isPrepared(false) {}
+
+  /**
+   * Constructor for data points that are not stored in a DataMatrix, e.g., numpy arrays or
+   * blocks of rows of a larger matrix. The data points are not copied, so they have to outlive
+   * the operation. Only operations that work on getDatasetView() offer this constructor, for those
+   * dataset is empty.
+   *
+   * @param grid the sparse grid used for this operation
+   * @param dataset view of the data set that should be evaluated on the sparse grid
+   */
+  OperationMultipleEval(sgpp::base::Grid& grid, const DataMatrixView& dataset)
+      : grid(grid), dataset(noDataset), datasetView(dataset), isPrepared(false) {}
+
+  /**
+   * Copy constructor. If other was created from a DataMatrixView, the copy's dataset refers to
+   * its own empty noDataset, otherwise to the same DataMatrix as other's.
+   *
+   * @param other operation to copy
+   */
+  OperationMultipleEval(const OperationMultipleEval& other)
+      : noDataset(),
+        grid(other.grid),
+        dataset((&other.dataset == &other.noDataset) ? noDataset : other.dataset),
+        datasetView(other.datasetView),
+        isPrepared(other.isPrepared) {}
 
   /**
    * Destructor
@@ -7,6 +7,7 @@
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalInterModLinear.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
+#include <sgpp/base/tools/ScatterReduction.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -127,12 +128,12 @@ void OperationMultipleEvalInterModLinear::mult(DataVector& alpha, DataVector& re
 
 void OperationMultipleEvalInterModLinear::multTranspose(DataVector& source, DataVector& result) {
   result.setAll(0.0);
+  ScatterReduction reduction(result);
 
   #pragma omp parallel
   {
     DataVector line(dataset.getNcols());
-    DataVector privateResult(result.getSize());
-    privateResult.setAll(0.0);
+    ScatterReduction::Buffer privateResult(reduction);
 
     GridStorage::grid_iterator working(storage);
     LinearModifiedBasis<unsigned int, unsigned int> basis;
@@ -184,7 +185,7 @@ void OperationMultipleEvalInterModLinear::multTranspose(DataVector& source, Data
               working.get(i, work_level, work_index);
               value *= basis.eval(work_level, work_index, line[i]);
             }
-            privateResult[seq] += value;
+            privateResult.add(seq, value);
             pointComputed = true;
           }
 
@@ -219,10 +220,6 @@ void OperationMultipleEvalInterModLinear::multTranspose(DataVector& source, Data
         delete[] level;
       }
     }
-    #pragma omp critical
-    {
-      result.add(privateResult);
-    }
   }
 }
 
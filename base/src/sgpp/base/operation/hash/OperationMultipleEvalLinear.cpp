@@ -16,14 +16,14 @@ void OperationMultipleEvalLinear::mult(DataVector& alpha, DataVector& result) {
   AlgorithmMultipleEvaluation<SLinearBase> op;
   LinearBasis<unsigned int, unsigned int> base;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  op.mult(storage, base, alpha, this->getDatasetView(), result);
 }
 
 void OperationMultipleEvalLinear::multTranspose(DataVector& alpha, DataVector& result) {
   AlgorithmMultipleEvaluation<SLinearBase> op;
   LinearBasis<unsigned int, unsigned int> base;
 
-  op.mult_transpose(storage, base, alpha, this->dataset, result);
+  op.mult_transpose(storage, base, alpha, this->getDatasetView(), result);
 }
 
 double OperationMultipleEvalLinear::getDuration() { return 0.0; }
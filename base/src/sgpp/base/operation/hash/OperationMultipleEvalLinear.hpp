@@ -28,6 +28,15 @@ class OperationMultipleEvalLinear : public OperationMultipleEval {
   OperationMultipleEvalLinear(Grid& grid, DataMatrix& dataset)
       : OperationMultipleEval(grid, dataset), storage(grid.getStorage()) {}
 
+  /**
+   * Constructor for a dataset that is only viewed, not copied
+   *
+   * @param grid grid
+   * @param dataset view of the dataset that should be evaluated, has to outlive the operation
+   */
+  OperationMultipleEvalLinear(Grid& grid, const DataMatrixView& dataset)
+      : OperationMultipleEval(grid, dataset), storage(grid.getStorage()) {}
+
   /**
    * Destructor
    */
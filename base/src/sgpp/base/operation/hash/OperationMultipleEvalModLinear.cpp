@@ -17,14 +17,14 @@ void OperationMultipleEvalModLinear::mult(DataVector& alpha, DataVector& result)
   AlgorithmDGEMV<SLinearModifiedBase> op;
   LinearModifiedBasis<unsigned int, unsigned int> base;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  op.mult(storage, base, alpha, this->getDatasetView(), result);
 }
 
 void OperationMultipleEvalModLinear::multTranspose(DataVector& source, DataVector& result) {
   AlgorithmDGEMV<SLinearModifiedBase> op;
   LinearModifiedBasis<unsigned int, unsigned int> base;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  op.mult_transposed(storage, base, source, this->getDatasetView(), result);
 }
 
 double OperationMultipleEvalModLinear::getDuration() { return 0.0; }
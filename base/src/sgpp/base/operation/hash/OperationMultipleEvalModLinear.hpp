@@ -29,6 +29,15 @@ class OperationMultipleEvalModLinear : public OperationMultipleEval {
   OperationMultipleEvalModLinear(Grid& grid, DataMatrix& dataset)
       : OperationMultipleEval(grid, dataset), storage(grid.getStorage()) {}
 
+  /**
+   * Constructor for a dataset that is only viewed, not copied
+   *
+   * @param grid grid
+   * @param dataset view of the dataset that should be evaluated, has to outlive the operation
+   */
+  OperationMultipleEvalModLinear(Grid& grid, const DataMatrixView& dataset)
+      : OperationMultipleEval(grid, dataset), storage(grid.getStorage()) {}
+
   /**
    * Destructor
    */
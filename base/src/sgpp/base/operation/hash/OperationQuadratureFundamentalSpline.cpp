@@ -4,24 +4,15 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/base/operation/hash/OperationQuadratureFundamentalSpline.hpp>
+#include <sgpp/base/tools/TensorProductQuadrature.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
 namespace base {
 
 double OperationQuadratureFundamentalSpline::doQuadrature(DataVector& alpha) {
-  double res = 0;
-  double tmpres = 0;
+  double res = TensorProductQuadrature(storage, base).quadrature(alpha);
 
-  for (size_t i = 0; i < alpha.getSize(); i++) {
-    GridPoint& gp = storage.getPoint(i);
-    tmpres = 1.;
-
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      tmpres *= base.getIntegral(gp.getLevel(d), gp.getIndex(d));
-    }
-    res += alpha[i] * tmpres;
-  }
   // multiply with determinant of "unit cube -> BoundingBox" transformation
   for (size_t d = 0; d < storage.getDimension(); d++) {
     res *= storage.getBoundingBox()->getIntervalWidth(d);
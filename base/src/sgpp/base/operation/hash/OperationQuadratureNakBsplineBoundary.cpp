@@ -5,24 +5,13 @@
 
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/hash/OperationQuadratureNakBsplineBoundary.hpp>
+#include <sgpp/base/tools/TensorProductQuadrature.hpp>
 
 namespace sgpp {
 namespace base {
 
 double OperationQuadratureNakBsplineBoundary::doQuadrature(DataVector& alpha) {
-  double res = 0;
-  double tmpres = 0;
-
-  for (size_t i = 0; i < alpha.getSize(); i++) {
-    GridPoint& gp = storage.getPoint(i);
-    tmpres = 1.;
-
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      tmpres *= base.getIntegral(gp.getLevel(d), gp.getIndex(d));
-    }
-
-    res += alpha[i] * tmpres;
-  }
+  double res = TensorProductQuadrature(storage, base).quadrature(alpha);
 
   // multiply with determinant of "unit cube -> BoundingBox" transformation
   for (size_t d = 0; d < storage.getDimension(); d++) {
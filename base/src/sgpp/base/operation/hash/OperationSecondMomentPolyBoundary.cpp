@@ -7,6 +7,7 @@
 #include <sgpp/base/grid/type/PolyBoundaryGrid.hpp>
 #include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
+#include <sgpp/base/tools/TensorProductQuadrature.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -24,13 +25,6 @@ double OperationSecondMomentPolyBoundary::doQuadrature(DataVector& alpha, DataMa
         "OperationSecondMomentPolyBoundary::doQuadrature - bounds matrix has the wrong shape");
   }
 
-  double res = 0;
-  double tmpres = 1;
-  base::index_t index;
-  double indexDbl;
-  base::level_t level;
-  double xlower = 0.0;
-  double xupper = 0.0;
   const size_t quadOrder =  static_cast<size_t>(
     ceil(static_cast<double>(dynamic_cast<sgpp::base::PolyBoundaryGrid*>(grid)->getDegree()) / 2.))
     + 2;
@@ -40,40 +34,32 @@ double OperationSecondMomentPolyBoundary::doQuadrature(DataVector& alpha, DataMa
   base::GaussLegendreQuadRule1D gauss;
   gauss.getLevelPointsAndWeightsNormalized(quadOrder, coordinates, weights);
 
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != storage.end(); iter++) {
-    tmpres = 1.;
+  TensorProductQuadrature quadrature(
+      storage,
+      [&](level_t level, index_t index, double* moments) {
+        const double indexDbl = static_cast<double>(index);
+        const double hInv = static_cast<double>(1 << level);
+        double scaling = (index != 0 && indexDbl != hInv) ? 2./hInv : 1./hInv;
+        double left = (index != 0) ? (indexDbl - 1) * (1./hInv) : 0.0;
 
-    for (size_t dim = 0; dim < storage.getDimension(); dim++) {
-      index = iter->first->getIndex(dim);
-      indexDbl = static_cast<double>(index);
-      level = iter->first->getLevel(dim);
-      double hInv = static_cast<double>(1 << level);
-      xlower = bounds == nullptr ? 0.0 : bounds->get(dim, 0);
-      xupper = bounds == nullptr ? 1.0 : bounds->get(dim, 1);
-      double width = xupper - xlower;
-      double scaling = (index != 0 && indexDbl != hInv) ? 2./hInv : 1./hInv;
-      double left = (index != 0) ? (indexDbl - 1) * (1./hInv) : 0.0;
+        double gaussQuadSumSecondMoment = 0.;
+        double gaussQuadSumFirstMoment = 0.;
+        for (size_t c = 0; c < quadOrder; c++) {
+          const double x = left + scaling * coordinates[c];
+          gaussQuadSumSecondMoment += weights[c] * x * x * basis.eval(level, index, x);
+          gaussQuadSumFirstMoment += weights[c] * x * basis.eval(level, index, x);
+        }
 
-      double gaussQuadSumSecondMoment = 0.;
-      double gaussQuadSumFirstMoment = 0.;
-      for (size_t c = 0; c < quadOrder; c++) {
-        const double x = left + scaling * coordinates[c];
-        gaussQuadSumSecondMoment += weights[c] * x * x * basis.eval(level, index, x);
-        gaussQuadSumFirstMoment += weights[c] * x * basis.eval(level, index, x);
-      }
+        gaussQuadSumSecondMoment *= scaling;
+        gaussQuadSumFirstMoment *= scaling;
 
-      gaussQuadSumSecondMoment *= scaling;
-      gaussQuadSumFirstMoment *= scaling;
-      tmpres *=
-        width * width * gaussQuadSumSecondMoment
-        + 2 * width * xlower * gaussQuadSumFirstMoment
-        + xlower * xlower * basis.getIntegral(level, index);
-    }
+        moments[0] = basis.getIntegral(level, index);
+        moments[1] = gaussQuadSumFirstMoment;
+        moments[2] = gaussQuadSumSecondMoment;
+      },
+      3);
 
-    res += alpha.get(iter->second) * tmpres;
-  }
-
-  return res;
+  return quadrature.secondMoment(alpha, bounds);
 }
 
 }  // namespace base
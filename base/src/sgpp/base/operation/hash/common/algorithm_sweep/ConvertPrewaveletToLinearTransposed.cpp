@@ -0,0 +1,90 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/operation/hash/common/algorithm_sweep/ConvertPrewaveletToLinearTransposed.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+ConvertPrewaveletToLinearTransposed::ConvertPrewaveletToLinearTransposed(GridStorage& storage)
+    : storage(storage) {}
+
+ConvertPrewaveletToLinearTransposed::~ConvertPrewaveletToLinearTransposed() {}
+
+void ConvertPrewaveletToLinearTransposed::operator()(DataVector& source, DataVector& result,
+                                                     grid_iterator& index, size_t dim) {
+  level_type max_level = index.getGridDepth(dim);
+  level_type init_level;
+  index_type init_index;
+  size_t _seq;
+
+  index.get(dim, init_level, init_index);
+
+  // scalar products with the nodal hat functions of the previous and the current level
+  std::vector<double> nodal_old(3, 0.0);
+  std::vector<double> nodal_current;
+  // source values of the current level (odd indices, zero for missing points)
+  std::vector<double> source_current;
+
+  for (level_type level = 1; level <= max_level; level++) {
+    const index_type last = (1 << level) - 1;
+    source_current.assign(last + 2, 0.0);
+    nodal_current.assign(last + 2, 0.0);
+
+    for (index_type i = 1; i <= last; i += 2) {
+      index.set(dim, level, i);
+      _seq = index.seq();
+
+      if (!storage.isInvalidSequenceNumber(_seq)) {
+        source_current[i] = source[_seq];
+      }
+
+      nodal_current[i] = source_current[i];
+    }
+
+    for (index_type i = 2; i < last; i += 2) {
+      nodal_current[i] =
+          nodal_old[i / 2] - 0.5 * (source_current[i - 1] + source_current[i + 1]);
+    }
+
+    // apply the prewavelet stamp to the nodal values
+    for (index_type i = 1; i <= last; i += 2) {
+      index.set(dim, level, i);
+      _seq = index.seq();
+
+      if (storage.isInvalidSequenceNumber(_seq)) {
+        continue;
+      }
+
+      if (level == 1) {
+        result[_seq] = source_current[i];
+        continue;
+      }
+
+      double value = ((i == 1) || (i == last)) ? 0.9 * source_current[i] : source_current[i];
+
+      if (i > 1) {
+        value += 0.1 * source_current[i - 2];
+      }
+
+      if (i < last) {
+        value += 0.1 * source_current[i + 2];
+      }
+
+      result[_seq] = value - 0.6 * (nodal_current[i - 1] + nodal_current[i + 1]);
+    }
+
+    nodal_old.swap(nodal_current);
+  }
+
+  index.set(dim, init_level, init_index);
+}
+
+}  // namespace base
+}  // namespace sgpp
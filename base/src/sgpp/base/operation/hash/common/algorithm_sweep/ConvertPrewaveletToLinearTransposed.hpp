@@ -0,0 +1,70 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Class that implements the transposed transformation of ConvertPrewaveletToLinear, i.e.,
+ * if \f$P\f$ maps prewavelet coefficients to the coefficients of the hierarchical linear basis,
+ * this class applies \f$P^T\f$. Applied to a vector of scalar products
+ * \f$r_{l,i} = \langle f, \phi_{l,i} \rangle\f$ with the hierarchical hat functions,
+ * the result are the scalar products \f$\langle f, \psi_{l,i} \rangle\f$ with the prewavelets.
+ * This is needed, e.g., to precondition systems in the linear basis with the prewavelet basis.
+ *
+ * The prewavelets are combinations of nodal hat functions of their level. The scalar products
+ * \f$n_{l,i}\f$ with the nodal hat functions are calculated level by level from the coarsest
+ * level:
+ * \f[
+ * n_{l,i} = r_{l,i}\; (i \text{ odd}),\qquad
+ * n_{l,i} = n_{l-1,i/2} - \frac{1}{2}(r_{l,i-1} + r_{l,i+1})\; (i \text{ even}),
+ * \f]
+ * where \f$n_{l,0} = n_{l,2^l} = 0\f$ (no boundary). With these, the prewavelet stamp
+ * (see PrewaveletBasis) is applied to the nodal values. Missing grid points are treated as
+ * zero, such that the result is the exact transpose of ConvertPrewaveletToLinear on
+ * adaptive grids, too.
+ */
+class ConvertPrewaveletToLinearTransposed {
+ protected:
+  typedef GridStorage::grid_iterator grid_iterator;
+  typedef level_t level_type;
+  typedef index_t index_type;
+
+  /// the grid object
+  GridStorage& storage;
+
+ public:
+  /**
+   * Constructor
+   *
+   * @param storage the grid storage object of the grid
+   */
+  explicit ConvertPrewaveletToLinearTransposed(GridStorage& storage);
+
+  /**
+   * Destructor
+   */
+  ~ConvertPrewaveletToLinearTransposed();
+
+  /**
+   * Applies the transposed conversion on the current 1D pole (may be done in-place).
+   *
+   * @param source vector with the scalar products with the hierarchical hat functions
+   * @param result vector into which the scalar products with the prewavelets are written
+   * @param index current grid position (root of the pole)
+   * @param dim current dimension
+   */
+  void operator()(DataVector& source, DataVector& result, grid_iterator& index, size_t dim);
+};
+
+}  // namespace base
+}  // namespace sgpp
@@ -1240,6 +1240,42 @@ class BsplineModifiedBasis : public Basis<LT, IT> {
     }
   }
 
+  /**
+   * Evaluate the modified B-spline basis function and its first two derivatives at once.
+   *
+   * @param       l       level of basis function
+   * @param       i       index of basis function
+   * @param       x       evaluation point
+   * @param[out]  value   value of modified B-spline basis function
+   * @param[out]  dx      value of derivative of modified B-spline basis function
+   * @param[out]  dxdx    value of 2nd derivative of modified B-spline basis function
+   */
+  inline void evalWithDerivatives(LT l, IT i, double x, double& value, double& dx,
+                                  double& dxdx) {
+    if (l == 1) {
+      value = 1.0;
+      dx = 0.0;
+      dxdx = 0.0;
+      return;
+    }
+
+    const IT hInv = static_cast<IT>(1) << l;
+    const double hInvDbl = static_cast<double>(hInv);
+
+    if ((i == 1) || (i == hInv - 1)) {
+      value = eval(l, i, x);
+      dx = evalDx(l, i, x);
+      dxdx = evalDxDx(l, i, x);
+    } else {
+      bsplineBasis.uniformBSplineWithDerivatives(
+          x * hInvDbl - static_cast<double>(i) +
+              static_cast<double>(bsplineBasis.getDegree() + 1) / 2.0,
+          bsplineBasis.getDegree(), value, dx, dxdx);
+      dx *= hInvDbl;
+      dxdx *= hInvDbl * hInvDbl;
+    }
+  }
+
   /**
    * @return      B-spline degree
    */
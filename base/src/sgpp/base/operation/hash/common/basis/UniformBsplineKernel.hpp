@@ -0,0 +1,480 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+
+// GCC only if-converts (and thus vectorizes) loops over evaluation points if the short loops over
+// the polynomial coefficients are unrolled completely, which it doesn't do by default for p > 3
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER)
+#define SGPP_UNIFORM_BSPLINE_UNROLL _Pragma("GCC unroll 8")
+#else
+#define SGPP_UNIFORM_BSPLINE_UNROLL
+#endif
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Uniform B-spline of fixed degree p with knots \f$\{0, 1, ..., p+1\}\f$.
+ *
+ * On the knot interval \f$[k, k+1)\f$, the B-spline is a polynomial in the local coordinate
+ * \f$t = x - k\f$, whose coefficients (scaled by p!) are tabulated and which is evaluated with
+ * Horner's scheme. Points outside of the support are masked out by multiplication, so the
+ * evaluation contains no data-dependent branches. Value, first and second derivative share the
+ * piece lookup and the Horner recurrence, so evalWithDerivatives returns all three for little
+ * more than the cost of the value alone.
+ *
+ * For loops over many evaluation points (see evalBlock), the *Simd variants compute the
+ * coefficients of the piece from the Newton form \f$c_k = \sum_{m=0}^p \binom{k}{m} \Delta^m c_0\f$
+ * over the piece index k instead of looking them up, where \f$\Delta^m c_0\f$ are the forward
+ * differences of the coefficients of the pieces. This needs neither branches nor gather
+ * instructions, so these loops are vectorized by the compiler. As all quantities are small
+ * integers, the coefficients are exact, i.e., identical to the tabulated ones.
+ *
+ * Coefficients are tabulated for degrees 0 to 7.
+ *
+ * @tparam p    B-spline degree
+ */
+template <size_t p>
+class UniformBsplineKernel {
+ public:
+  /**
+   * @param x     evaluation point
+   * @return      value of the uniform B-spline
+   */
+  static inline double eval(double x) {
+    double t;
+    const double* coefficients = lookUpPiece(x, t);
+    return getMask(x) * evalPolynomial(coefficients, t);
+  }
+
+  /**
+   * @param x     evaluation point
+   * @return      value of the derivative of the uniform B-spline
+   */
+  static inline double evalDx(double x) {
+    double value, dx, dxdx;
+    evalWithDerivatives(x, value, dx, dxdx);
+    return dx;
+  }
+
+  /**
+   * @param x     evaluation point
+   * @return      value of the 2nd derivative of the uniform B-spline
+   */
+  static inline double evalDxDx(double x) {
+    double value, dx, dxdx;
+    evalWithDerivatives(x, value, dx, dxdx);
+    return dxdx;
+  }
+
+  /**
+   * Evaluate the uniform B-spline and its first two derivatives at once.
+   *
+   * @param       x       evaluation point
+   * @param[out]  value   value of the uniform B-spline
+   * @param[out]  dx      value of the derivative
+   * @param[out]  dxdx    value of the 2nd derivative
+   */
+  static inline void evalWithDerivatives(double x, double& value, double& dx, double& dxdx) {
+    double t;
+    const double* coefficients = lookUpPiece(x, t);
+    evalPolynomialWithDerivatives(coefficients, t, getMask(x), value, dx, dxdx);
+  }
+
+  /**
+   * Variant of eval for loops over evaluation points vectorized with <tt>omp simd</tt>.
+   *
+   * @param x     evaluation point
+   * @return      value of the uniform B-spline
+   */
+  static inline double evalSimd(double x) {
+    double t;
+    double coefficients[p + 1];
+    computePiece(x, t, coefficients);
+    return getMask(x) * evalPolynomial(coefficients, t);
+  }
+
+  /**
+   * Variant of evalWithDerivatives for loops over evaluation points vectorized with
+   * <tt>omp simd</tt>.
+   *
+   * @param       x       evaluation point
+   * @param[out]  value   value of the uniform B-spline
+   * @param[out]  dx      value of the derivative
+   * @param[out]  dxdx    value of the 2nd derivative
+   */
+  static inline void evalWithDerivativesSimd(double x, double& value, double& dx,
+                                             double& dxdx) {
+    double t;
+    double coefficients[p + 1];
+    computePiece(x, t, coefficients);
+    evalPolynomialWithDerivatives(coefficients, t, getMask(x), value, dx, dxdx);
+  }
+
+  /**
+   * Evaluate the uniform B-spline at many points.
+   *
+   * @param       x       evaluation points
+   * @param[out]  value   values of the uniform B-spline
+   * @param       n       number of evaluation points
+   */
+  static inline void evalBlock(const double* x, double* value, size_t n) {
+#pragma omp simd
+    for (size_t k = 0; k < n; k++) {
+      value[k] = evalSimd(x[k]);
+    }
+  }
+
+  /**
+   * Evaluate the uniform B-spline and its first two derivatives at many points.
+   *
+   * @param       x       evaluation points
+   * @param[out]  value   values of the uniform B-spline
+   * @param[out]  dx      values of the derivative
+   * @param[out]  dxdx    values of the 2nd derivative
+   * @param       n       number of evaluation points
+   */
+  static inline void evalBlock(const double* x, double* value, double* dx, double* dxdx,
+                               size_t n) {
+#pragma omp simd
+    for (size_t k = 0; k < n; k++) {
+      evalWithDerivativesSimd(x[k], value[k], dx[k], dxdx[k]);
+    }
+  }
+
+ protected:
+  /**
+   * @return      coefficients of the pieces (scaled by p!), row-major with p+1 rows (one per
+   *              knot interval) of p+1 coefficients (from the highest to the lowest power of t)
+   */
+  static inline const double* getCoefficients();
+
+  /**
+   * @return      forward differences of the coefficients of the pieces (scaled by p!),
+   *              row-major with p+1 rows (m-th row: m-th difference) of p+1 coefficients
+   *              (from the highest to the lowest power of t)
+   */
+  static inline const double* getDifferences();
+
+  /**
+   * @param x     evaluation point
+   * @return      1/p! if x lies in the support \f$[0, p+1)\f$, 0 otherwise
+   */
+  static inline double getMask(double x) {
+    return static_cast<double>((x >= 0.0) & (x < static_cast<double>(p + 1))) /
+           getFactorial(p);
+  }
+
+  /**
+   * @param x     evaluation point
+   * @return      x clamped to \f$[0, p+1]\f$ (NaN is mapped to 0), such that the local
+   *              coordinate stays bounded outside of the support
+   */
+  static inline double clamp(double x) {
+    const double xMax = static_cast<double>(p + 1);
+    return (x > xMax) ? xMax : ((x > 0.0) ? x : 0.0);
+  }
+
+  /**
+   * @param       x   evaluation point
+   * @param[out]  t   local coordinate of x in its knot interval
+   * @return          coefficients of the piece containing x (or of the nearest piece if x lies
+   *                  outside of the support)
+   */
+  static inline const double* lookUpPiece(double x, double& t) {
+    x = clamp(x);
+    size_t k = static_cast<size_t>(x);
+    k = (k > p) ? p : k;
+    t = x - static_cast<double>(k);
+    return getCoefficients() + k * (p + 1);
+  }
+
+  /**
+   * @param       x               evaluation point
+   * @param[out]  t               local coordinate of x in its knot interval
+   * @param[out]  coefficients    coefficients of the piece containing x (or of the nearest piece
+   *                              if x lies outside of the support)
+   */
+  static inline void computePiece(double x, double& t, double* coefficients) {
+    x = clamp(x);
+    double k = 0.0;
+
+    SGPP_UNIFORM_BSPLINE_UNROLL
+    for (size_t m = 1; m <= p; m++) {
+      k += static_cast<double>(x >= static_cast<double>(m));
+    }
+
+    t = x - k;
+
+    const double* differences = getDifferences();
+    double binomial = 1.0;
+
+    SGPP_UNIFORM_BSPLINE_UNROLL
+    for (size_t j = 0; j <= p; j++) {
+      coefficients[j] = differences[j];
+    }
+
+    SGPP_UNIFORM_BSPLINE_UNROLL
+    for (size_t m = 1; m <= p; m++) {
+      // binomial coefficient (k choose m), the division is exact
+      binomial = binomial * (k - static_cast<double>(m - 1)) / static_cast<double>(m);
+
+      SGPP_UNIFORM_BSPLINE_UNROLL
+      for (size_t j = 0; j <= p; j++) {
+        coefficients[j] += binomial * differences[m * (p + 1) + j];
+      }
+    }
+  }
+
+  /**
+   * @param coefficients  coefficients of the polynomial (from the highest to the lowest power)
+   * @param t             evaluation point
+   * @return              value of the polynomial
+   */
+  static inline double evalPolynomial(const double* coefficients, double t) {
+    double y = coefficients[0];
+
+    SGPP_UNIFORM_BSPLINE_UNROLL
+    for (size_t j = 1; j <= p; j++) {
+      y = y * t + coefficients[j];
+    }
+
+    return y;
+  }
+
+  /**
+   * @param       coefficients  coefficients of the polynomial
+   *                            (from the highest to the lowest power)
+   * @param       t             evaluation point
+   * @param       factor        factor to scale the results with
+   * @param[out]  value         scaled value of the polynomial
+   * @param[out]  dx            scaled value of the derivative
+   * @param[out]  dxdx          scaled value of the 2nd derivative
+   */
+  static inline void evalPolynomialWithDerivatives(const double* coefficients, double t,
+                                                   double factor, double& value, double& dx,
+                                                   double& dxdx) {
+    double y = coefficients[0];
+    double dy = 0.0;
+    // half of the 2nd derivative
+    double dyHalf = 0.0;
+
+    SGPP_UNIFORM_BSPLINE_UNROLL
+    for (size_t j = 1; j <= p; j++) {
+      dyHalf = dyHalf * t + dy;
+      dy = dy * t + y;
+      y = y * t + coefficients[j];
+    }
+
+    value = factor * y;
+    dx = factor * dy;
+    dxdx = 2.0 * factor * dyHalf;
+  }
+
+  /**
+   * @param k     non-negative integer
+   * @return      k!
+   */
+  static constexpr double getFactorial(size_t k) {
+    return (k <= 1) ? 1.0 : static_cast<double>(k) * getFactorial(k - 1);
+  }
+};
+
+// coefficients of the pieces in the local coordinate t and their forward differences
+// (computed with exact rational arithmetic from the Cox-de Boor recursion)
+
+template <>
+inline const double* UniformBsplineKernel<0>::getCoefficients() {
+  static const double coefficients[] = {
+      1.0,
+  };
+  return coefficients;
+}
+
+template <>
+inline const double* UniformBsplineKernel<0>::getDifferences() {
+  static const double differences[] = {
+      1.0,
+  };
+  return differences;
+}
+
+template <>
+inline const double* UniformBsplineKernel<1>::getCoefficients() {
+  static const double coefficients[] = {
+      1.0, 0.0,
+      -1.0, 1.0,
+  };
+  return coefficients;
+}
+
+template <>
+inline const double* UniformBsplineKernel<1>::getDifferences() {
+  static const double differences[] = {
+      1.0, 0.0,
+      -2.0, 1.0,
+  };
+  return differences;
+}
+
+template <>
+inline const double* UniformBsplineKernel<2>::getCoefficients() {
+  static const double coefficients[] = {
+      1.0, 0.0, 0.0,
+      -2.0, 2.0, 1.0,
+      1.0, -2.0, 1.0,
+  };
+  return coefficients;
+}
+
+template <>
+inline const double* UniformBsplineKernel<2>::getDifferences() {
+  static const double differences[] = {
+      1.0, 0.0, 0.0,
+      -3.0, 2.0, 1.0,
+      6.0, -6.0, -1.0,
+  };
+  return differences;
+}
+
+template <>
+inline const double* UniformBsplineKernel<3>::getCoefficients() {
+  static const double coefficients[] = {
+      1.0, 0.0, 0.0, 0.0,
+      -3.0, 3.0, 3.0, 1.0,
+      3.0, -6.0, 0.0, 4.0,
+      -1.0, 3.0, -3.0, 1.0,
+  };
+  return coefficients;
+}
+
+template <>
+inline const double* UniformBsplineKernel<3>::getDifferences() {
+  static const double differences[] = {
+      1.0, 0.0, 0.0, 0.0,
+      -4.0, 3.0, 3.0, 1.0,
+      10.0, -12.0, -6.0, 2.0,
+      -20.0, 30.0, 6.0, -8.0,
+  };
+  return differences;
+}
+
+template <>
+inline const double* UniformBsplineKernel<4>::getCoefficients() {
+  static const double coefficients[] = {
+      1.0, 0.0, 0.0, 0.0, 0.0,
+      -4.0, 4.0, 6.0, 4.0, 1.0,
+      6.0, -12.0, -6.0, 12.0, 11.0,
+      -4.0, 12.0, -6.0, -12.0, 11.0,
+      1.0, -4.0, 6.0, -4.0, 1.0,
+  };
+  return coefficients;
+}
+
+template <>
+inline const double* UniformBsplineKernel<4>::getDifferences() {
+  static const double differences[] = {
+      1.0, 0.0, 0.0, 0.0, 0.0,
+      -5.0, 4.0, 6.0, 4.0, 1.0,
+      15.0, -20.0, -18.0, 4.0, 9.0,
+      -35.0, 60.0, 30.0, -36.0, -19.0,
+      70.0, -140.0, -30.0, 100.0, 19.0,
+  };
+  return differences;
+}
+
+template <>
+inline const double* UniformBsplineKernel<5>::getCoefficients() {
+  static const double coefficients[] = {
+      1.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+      -5.0, 5.0, 10.0, 10.0, 5.0, 1.0,
+      10.0, -20.0, -20.0, 20.0, 50.0, 26.0,
+      -10.0, 30.0, 0.0, -60.0, 0.0, 66.0,
+      5.0, -20.0, 20.0, 20.0, -50.0, 26.0,
+      -1.0, 5.0, -10.0, 10.0, -5.0, 1.0,
+  };
+  return coefficients;
+}
+
+template <>
+inline const double* UniformBsplineKernel<5>::getDifferences() {
+  static const double differences[] = {
+      1.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+      -6.0, 5.0, 10.0, 10.0, 5.0, 1.0,
+      21.0, -30.0, -40.0, 0.0, 40.0, 24.0,
+      -56.0, 105.0, 90.0, -90.0, -135.0, -9.0,
+      126.0, -280.0, -140.0, 340.0, 230.0, -86.0,
+      -252.0, 630.0, 140.0, -840.0, -230.0, 276.0,
+  };
+  return differences;
+}
+
+template <>
+inline const double* UniformBsplineKernel<6>::getCoefficients() {
+  static const double coefficients[] = {
+      1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+      -6.0, 6.0, 15.0, 20.0, 15.0, 6.0, 1.0,
+      15.0, -30.0, -45.0, 20.0, 135.0, 150.0, 57.0,
+      -20.0, 60.0, 30.0, -160.0, -150.0, 240.0, 302.0,
+      15.0, -60.0, 30.0, 160.0, -150.0, -240.0, 302.0,
+      -6.0, 30.0, -45.0, -20.0, 135.0, -150.0, 57.0,
+      1.0, -6.0, 15.0, -20.0, 15.0, -6.0, 1.0,
+  };
+  return coefficients;
+}
+
+template <>
+inline const double* UniformBsplineKernel<6>::getDifferences() {
+  static const double differences[] = {
+      1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+      -7.0, 6.0, 15.0, 20.0, 15.0, 6.0, 1.0,
+      28.0, -42.0, -75.0, -20.0, 105.0, 138.0, 55.0,
+      -84.0, 168.0, 210.0, -160.0, -510.0, -192.0, 134.0,
+      210.0, -504.0, -420.0, 840.0, 1200.0, -324.0, -568.0,
+      -462.0, 1260.0, 630.0, -2520.0, -1890.0, 1980.0, 1002.0,
+      924.0, -2772.0, -630.0, 5880.0, 1890.0, -5292.0, -1002.0,
+  };
+  return differences;
+}
+
+template <>
+inline const double* UniformBsplineKernel<7>::getCoefficients() {
+  static const double coefficients[] = {
+      1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+      -7.0, 7.0, 21.0, 35.0, 35.0, 21.0, 7.0, 1.0,
+      21.0, -42.0, -84.0, 0.0, 280.0, 504.0, 392.0, 120.0,
+      -35.0, 105.0, 105.0, -315.0, -665.0, 315.0, 1715.0, 1191.0,
+      35.0, -140.0, 0.0, 560.0, 0.0, -1680.0, 0.0, 2416.0,
+      -21.0, 105.0, -105.0, -315.0, 665.0, 315.0, -1715.0, 1191.0,
+      7.0, -42.0, 84.0, 0.0, -280.0, 504.0, -392.0, 120.0,
+      -1.0, 7.0, -21.0, 35.0, -35.0, 21.0, -7.0, 1.0,
+  };
+  return coefficients;
+}
+
+template <>
+inline const double* UniformBsplineKernel<7>::getDifferences() {
+  static const double differences[] = {
+      1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+      -8.0, 7.0, 21.0, 35.0, 35.0, 21.0, 7.0, 1.0,
+      36.0, -56.0, -126.0, -70.0, 210.0, 462.0, 378.0, 118.0,
+      -120.0, 252.0, 420.0, -210.0, -1400.0, -1134.0, 560.0, 834.0,
+      330.0, -840.0, -1008.0, 1680.0, 4200.0, 0.0, -4536.0, -1632.0,
+      -792.0, 2310.0, 1890.0, -6090.0, -8610.0, 6930.0, 11550.0, -174.0,
+      1716.0, -5544.0, -2772.0, 16380.0, 13020.0, -25452.0, -18564.0, 7188.0,
+      -3432.0, 12012.0, 2772.0, -36960.0, -13020.0, 62496.0, 18564.0, -21216.0,
+  };
+  return differences;
+}
+
+}  // namespace base
+}  // namespace sgpp
+
+#undef SGPP_UNIFORM_BSPLINE_UNROLL
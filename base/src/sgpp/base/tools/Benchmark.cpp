@@ -0,0 +1,485 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/Benchmark.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+/// maximum number of iterations of a benchmark instance
+const size_t MAX_ITERATIONS = 1000000000;
+
+std::vector<std::unique_ptr<Benchmark>>& getRegistry() {
+  static std::vector<std::unique_ptr<Benchmark>> registry;
+  return registry;
+}
+
+/// result of one run of a benchmark instance (times per iteration in nanoseconds)
+struct BenchmarkRun {
+  std::string name;
+  std::string runName;
+  std::string aggregateName;
+  size_t repetitionIndex;
+  size_t iterations;
+  double realTime;
+  double cpuTime;
+  double itemsPerSecond;
+  std::string label;
+};
+
+std::string escapeJSON(const std::string& str) {
+  std::string result;
+
+  for (char c : str) {
+    if ((c == '"') || (c == '\\')) {
+      result += '\\';
+      result += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      result += ' ';
+    } else {
+      result += c;
+    }
+  }
+
+  return result;
+}
+
+std::string getCurrentDate() {
+  std::time_t now = std::time(nullptr);
+  char buffer[32];
+  std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+  return buffer;
+}
+
+BenchmarkRun runInstance(const Benchmark& benchmark, size_t instance, double minTime) {
+  const std::vector<int64_t> args = benchmark.getInstanceArgs(instance);
+  size_t iterations = 1;
+
+  while (true) {
+    BenchmarkState state(args, iterations);
+    benchmark.getFunction()(state);
+
+    if (!state.isFinished()) {
+      throw std::runtime_error("Benchmark " + benchmark.getInstanceName(instance) +
+                               " did not run all iterations (keepRunning() not called?)");
+    }
+
+    const double realTime = state.getRealTime();
+
+    if ((realTime >= minTime) || (iterations >= MAX_ITERATIONS)) {
+      BenchmarkRun run;
+      run.name = benchmark.getInstanceName(instance);
+      run.runName = run.name;
+      run.repetitionIndex = 0;
+      run.iterations = iterations;
+      run.realTime = realTime * 1e9 / static_cast<double>(iterations);
+      run.cpuTime = state.getCpuTime() * 1e9 / static_cast<double>(iterations);
+      run.itemsPerSecond =
+          (realTime > 0.0) ? static_cast<double>(state.getItemsProcessed()) / realTime : 0.0;
+      run.label = state.getLabel();
+      return run;
+    }
+
+    // predict the number of iterations needed (like Google Benchmark, with a safety margin)
+    double multiplier = 10.0;
+
+    if (realTime > 0.1 * minTime) {
+      multiplier = std::min(10.0, std::max(1.0, 1.4 * minTime / realTime));
+    }
+
+    const size_t predictedIterations =
+        static_cast<size_t>(static_cast<double>(iterations) * multiplier);
+    iterations = std::min(MAX_ITERATIONS, std::max(iterations + 1, predictedIterations));
+  }
+}
+
+std::vector<BenchmarkRun> aggregate(const std::vector<BenchmarkRun>& runs) {
+  std::vector<BenchmarkRun> result;
+  const double n = static_cast<double>(runs.size());
+
+  for (const std::string aggregateName : {"mean", "median", "stddev"}) {
+    BenchmarkRun run = runs[0];
+    run.name = runs[0].runName + "_" + aggregateName;
+    run.aggregateName = aggregateName;
+    run.iterations = runs.size();
+
+    auto compute = [&](double BenchmarkRun::*member) {
+      std::vector<double> values;
+
+      for (const BenchmarkRun& r : runs) {
+        values.push_back(r.*member);
+      }
+
+      double mean = 0.0;
+
+      for (double value : values) {
+        mean += value / n;
+      }
+
+      if (aggregateName == "mean") {
+        return mean;
+      } else if (aggregateName == "median") {
+        std::sort(values.begin(), values.end());
+        const size_t m = values.size() / 2;
+        return (values.size() % 2 == 1) ? values[m] : 0.5 * (values[m - 1] + values[m]);
+      } else {
+        double variance = 0.0;
+
+        for (double value : values) {
+          variance += (value - mean) * (value - mean);
+        }
+
+        return (values.size() > 1) ? std::sqrt(variance / (n - 1.0)) : 0.0;
+      }
+    };
+
+    run.realTime = compute(&BenchmarkRun::realTime);
+    run.cpuTime = compute(&BenchmarkRun::cpuTime);
+    run.itemsPerSecond = compute(&BenchmarkRun::itemsPerSecond);
+    result.push_back(run);
+  }
+
+  return result;
+}
+
+void printRun(const BenchmarkRun& run, size_t nameWidth) {
+  std::cout << std::left << std::setw(static_cast<int>(nameWidth)) << run.name << std::right
+            << std::fixed << std::setprecision(0) << std::setw(15) << run.realTime << " ns"
+            << std::setw(15) << run.cpuTime << " ns" << std::setw(12) << run.iterations;
+
+  if (run.itemsPerSecond > 0.0) {
+    std::cout << std::scientific << std::setprecision(3)
+              << "  items_per_second=" << run.itemsPerSecond;
+  }
+
+  if (!run.label.empty()) {
+    std::cout << "  " << run.label;
+  }
+
+  std::cout << std::endl;
+}
+
+void writeJSON(std::ostream& stream, const std::string& executable,
+               const std::vector<BenchmarkRun>& runs) {
+  int numThreads = 1;
+#ifdef _OPENMP
+  numThreads = omp_get_max_threads();
+#endif
+#ifdef NDEBUG
+  const std::string buildType = "release";
+#else
+  const std::string buildType = "debug";
+#endif
+
+  stream << std::setprecision(17);
+  stream << "{\n";
+  stream << "  \"context\": {\n";
+  stream << "    \"date\": \"" << getCurrentDate() << "\",\n";
+  stream << "    \"executable\": \"" << escapeJSON(executable) << "\",\n";
+  stream << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+  stream << "    \"num_threads\": " << numThreads << ",\n";
+  stream << "    \"instruction_set\": \""
+         << CPUFeatures::toString(CPUFeatures::getHostInstructionSet()) << "\",\n";
+  stream << "    \"library_build_type\": \"" << buildType << "\"\n";
+  stream << "  },\n";
+  stream << "  \"benchmarks\": [";
+
+  for (size_t i = 0; i < runs.size(); i++) {
+    const BenchmarkRun& run = runs[i];
+    stream << ((i > 0) ? ",\n" : "\n");
+    stream << "    {\n";
+    stream << "      \"name\": \"" << escapeJSON(run.name) << "\",\n";
+    stream << "      \"run_name\": \"" << escapeJSON(run.runName) << "\",\n";
+
+    if (run.aggregateName.empty()) {
+      stream << "      \"run_type\": \"iteration\",\n";
+      stream << "      \"repetition_index\": " << run.repetitionIndex << ",\n";
+    } else {
+      stream << "      \"run_type\": \"aggregate\",\n";
+      stream << "      \"aggregate_name\": \"" << run.aggregateName << "\",\n";
+    }
+
+    stream << "      \"iterations\": " << run.iterations << ",\n";
+    stream << "      \"real_time\": " << run.realTime << ",\n";
+    stream << "      \"cpu_time\": " << run.cpuTime << ",\n";
+    stream << "      \"time_unit\": \"ns\"";
+
+    if (run.itemsPerSecond > 0.0) {
+      stream << ",\n      \"items_per_second\": " << run.itemsPerSecond;
+    }
+
+    if (!run.label.empty()) {
+      stream << ",\n      \"label\": \"" << escapeJSON(run.label) << "\"";
+    }
+
+    stream << "\n    }";
+  }
+
+  stream << "\n  ]\n";
+  stream << "}\n";
+}
+
+}  // namespace
+
+BenchmarkState::BenchmarkState(const std::vector<int64_t>& args, size_t maxIterations)
+    : args(args),
+      maxIterations(maxIterations),
+      iterations(0),
+      running(false),
+      realTime(0.0),
+      cpuTime(0.0),
+      itemsProcessed(0),
+      cpuStart(0) {}
+
+bool BenchmarkState::keepRunning() {
+  if (iterations == 0) {
+    startTimer();
+  }
+
+  if (iterations < maxIterations) {
+    iterations++;
+    return true;
+  }
+
+  if (running) {
+    stopTimer();
+  }
+
+  return false;
+}
+
+int64_t BenchmarkState::range(size_t i) const { return args.at(i); }
+
+void BenchmarkState::pauseTiming() {
+  if (running) {
+    stopTimer();
+  }
+}
+
+void BenchmarkState::resumeTiming() {
+  if (!running) {
+    startTimer();
+  }
+}
+
+void BenchmarkState::setItemsProcessed(size_t items) { itemsProcessed = items; }
+
+void BenchmarkState::setLabel(const std::string& label) { this->label = label; }
+
+size_t BenchmarkState::getMaxIterations() const { return maxIterations; }
+
+bool BenchmarkState::isFinished() const { return (iterations == maxIterations) && !running; }
+
+double BenchmarkState::getRealTime() const { return realTime; }
+
+double BenchmarkState::getCpuTime() const { return cpuTime; }
+
+size_t BenchmarkState::getItemsProcessed() const { return itemsProcessed; }
+
+const std::string& BenchmarkState::getLabel() const { return label; }
+
+void BenchmarkState::startTimer() {
+  running = true;
+  cpuStart = std::clock();
+  realStart = std::chrono::steady_clock::now();
+}
+
+void BenchmarkState::stopTimer() {
+  const std::chrono::steady_clock::time_point realStop = std::chrono::steady_clock::now();
+  const std::clock_t cpuStop = std::clock();
+  running = false;
+  realTime += std::chrono::duration<double>(realStop - realStart).count();
+  cpuTime += static_cast<double>(cpuStop - cpuStart) / CLOCKS_PER_SEC;
+}
+
+Benchmark::Benchmark(const std::string& name, Function function)
+    : name(name), function(function) {}
+
+Benchmark* Benchmark::args(const std::vector<int64_t>& args) {
+  argsList.push_back(args);
+  return this;
+}
+
+Benchmark* Benchmark::argsProduct(const std::vector<std::vector<int64_t>>& argLists) {
+  std::vector<std::vector<int64_t>> product(1);
+
+  for (const std::vector<int64_t>& argList : argLists) {
+    std::vector<std::vector<int64_t>> newProduct;
+
+    for (const std::vector<int64_t>& args : product) {
+      for (int64_t arg : argList) {
+        newProduct.push_back(args);
+        newProduct.back().push_back(arg);
+      }
+    }
+
+    product = newProduct;
+  }
+
+  argsList.insert(argsList.end(), product.begin(), product.end());
+  return this;
+}
+
+Benchmark* Benchmark::argNames(const std::vector<std::string>& names) {
+  this->names = names;
+  return this;
+}
+
+size_t Benchmark::getNumberOfInstances() const { return std::max<size_t>(argsList.size(), 1); }
+
+std::string Benchmark::getInstanceName(size_t i) const {
+  std::string instanceName = name;
+
+  if (i < argsList.size()) {
+    for (size_t j = 0; j < argsList[i].size(); j++) {
+      instanceName += "/";
+
+      if ((j < names.size()) && !names[j].empty()) {
+        instanceName += names[j] + ":";
+      }
+
+      instanceName += std::to_string(argsList[i][j]);
+    }
+  }
+
+  return instanceName;
+}
+
+std::vector<int64_t> Benchmark::getInstanceArgs(size_t i) const {
+  return (i < argsList.size()) ? argsList[i] : std::vector<int64_t>();
+}
+
+const Benchmark::Function& Benchmark::getFunction() const { return function; }
+
+Benchmark* registerBenchmark(const std::string& name, Benchmark::Function function) {
+  getRegistry().emplace_back(new Benchmark(name, function));
+  return getRegistry().back().get();
+}
+
+int runBenchmarks(int argc, char* argv[]) {
+  std::string filter = ".*";
+  double minTime = 0.5;
+  size_t repetitions = 1;
+  std::string outFile;
+  bool listOnly = false;
+
+  for (int i = 1; i < argc; i++) {
+    const std::string arg(argv[i]);
+    const size_t pos = arg.find('=');
+    const std::string key = arg.substr(0, pos);
+    const std::string value = (pos == std::string::npos) ? "" : arg.substr(pos + 1);
+
+    if (key == "--benchmark_filter") {
+      filter = value;
+    } else if (key == "--benchmark_min_time") {
+      minTime = std::stod(value);
+    } else if (key == "--benchmark_repetitions") {
+      repetitions = std::max(1, std::stoi(value));
+    } else if (key == "--benchmark_out") {
+      outFile = value;
+    } else if (key == "--benchmark_list_tests") {
+      listOnly = true;
+    } else {
+      std::cerr << "Usage: " << argv[0] << " [--benchmark_filter=REGEX]"
+                << " [--benchmark_min_time=SECONDS] [--benchmark_repetitions=N]"
+                << " [--benchmark_out=FILE] [--benchmark_list_tests]" << std::endl;
+      return ((key == "--help") || (key == "-h")) ? 0 : 1;
+    }
+  }
+
+  const std::regex filterRegex(filter);
+  std::vector<std::pair<const Benchmark*, size_t>> instances;
+  size_t nameWidth = 10;
+
+  for (const std::unique_ptr<Benchmark>& benchmark : getRegistry()) {
+    for (size_t i = 0; i < benchmark->getNumberOfInstances(); i++) {
+      const std::string name = benchmark->getInstanceName(i);
+
+      if (std::regex_search(name, filterRegex)) {
+        instances.push_back(std::make_pair(benchmark.get(), i));
+        nameWidth = std::max(nameWidth, name.size() + ((repetitions > 1) ? 7 : 0));
+      }
+    }
+  }
+
+  if (listOnly) {
+    for (const std::pair<const Benchmark*, size_t>& instance : instances) {
+      std::cout << instance.first->getInstanceName(instance.second) << std::endl;
+    }
+
+    return 0;
+  }
+
+  std::cout << std::left << std::setw(static_cast<int>(nameWidth)) << "Benchmark" << std::right
+            << std::setw(18) << "Time" << std::setw(18) << "CPU" << std::setw(12)
+            << "Iterations" << std::endl;
+  std::cout << std::string(nameWidth + 48, '-') << std::endl;
+
+  std::vector<BenchmarkRun> allRuns;
+
+  try {
+    for (const std::pair<const Benchmark*, size_t>& instance : instances) {
+      std::vector<BenchmarkRun> runs;
+
+      for (size_t r = 0; r < repetitions; r++) {
+        runs.push_back(runInstance(*instance.first, instance.second, minTime));
+        runs.back().repetitionIndex = r;
+        printRun(runs.back(), nameWidth);
+      }
+
+      allRuns.insert(allRuns.end(), runs.begin(), runs.end());
+
+      if (repetitions > 1) {
+        for (const BenchmarkRun& run : aggregate(runs)) {
+          printRun(run, nameWidth);
+          allRuns.push_back(run);
+        }
+      }
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  if (!outFile.empty()) {
+    std::ofstream stream(outFile);
+
+    if (!stream) {
+      std::cerr << "Error: could not open " << outFile << std::endl;
+      return 1;
+    }
+
+    writeJSON(stream, argv[0], allRuns);
+  }
+
+  return 0;
+}
+
+}  // namespace base
+}  // namespace sgpp
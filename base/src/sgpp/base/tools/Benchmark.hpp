@@ -0,0 +1,276 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * State of a running benchmark, passed to the benchmark function.
+ * The measured code is placed in the loop
+ * \code
+ * while (state.keepRunning()) { ... }
+ * \endcode
+ * The setup before the loop is not measured. The number of iterations is determined by the
+ * runner such that the total time exceeds the minimum benchmark time.
+ */
+class BenchmarkState {
+ public:
+  /**
+   * Constructor
+   *
+   * @param args          arguments of the benchmark instance (see Benchmark::args)
+   * @param maxIterations number of iterations to run
+   */
+  BenchmarkState(const std::vector<int64_t>& args, size_t maxIterations);
+
+  /**
+   * Starts the timer in the first call and stops it after the last iteration.
+   *
+   * @return whether another iteration has to be run
+   */
+  bool keepRunning();
+
+  /**
+   * @param i index of the argument
+   * @return i-th argument of the benchmark instance
+   */
+  int64_t range(size_t i = 0) const;
+
+  /**
+   * Excludes the following code from the measurement (until resumeTiming() is called).
+   */
+  void pauseTiming();
+
+  /**
+   * Resumes the measurement after pauseTiming().
+   */
+  void resumeTiming();
+
+  /**
+   * @param items number of processed items (e.g., grid points or data points)
+   *              in all iterations, used to report the throughput
+   */
+  void setItemsProcessed(size_t items);
+
+  /**
+   * @param label additional information (e.g., number of grid points), printed and stored
+   */
+  void setLabel(const std::string& label);
+
+  /**
+   * @return number of iterations to run
+   */
+  size_t getMaxIterations() const;
+
+  /**
+   * @return whether all iterations have been run
+   */
+  bool isFinished() const;
+
+  /**
+   * @return measured wall clock time in seconds
+   */
+  double getRealTime() const;
+
+  /**
+   * @return measured CPU time of the process in seconds (sum over all threads)
+   */
+  double getCpuTime() const;
+
+  /**
+   * @return number of processed items
+   */
+  size_t getItemsProcessed() const;
+
+  /**
+   * @return label
+   */
+  const std::string& getLabel() const;
+
+ protected:
+  /// arguments of the benchmark instance
+  std::vector<int64_t> args;
+  /// number of iterations to run
+  size_t maxIterations;
+  /// number of started iterations
+  size_t iterations;
+  /// whether the timer is running
+  bool running;
+  /// measured wall clock time in seconds
+  double realTime;
+  /// measured CPU time in seconds
+  double cpuTime;
+  /// number of processed items
+  size_t itemsProcessed;
+  /// label
+  std::string label;
+  /// start of the current measurement (wall clock)
+  std::chrono::steady_clock::time_point realStart;
+  /// start of the current measurement (CPU clock)
+  std::clock_t cpuStart;
+
+  /**
+   * starts the timer
+   */
+  void startTimer();
+
+  /**
+   * stops the timer and accumulates the times
+   */
+  void stopTimer();
+};
+
+/**
+ * Registered benchmark, i.e., a benchmark function with a list of argument tuples.
+ * Every argument tuple is run as a separate benchmark instance named
+ * <tt>name/argName1:arg1/argName2:arg2/...</tt>.
+ */
+class Benchmark {
+ public:
+  /// benchmark function
+  typedef std::function<void(BenchmarkState&)> Function;
+
+  /**
+   * Constructor
+   *
+   * @param name     name of the benchmark
+   * @param function benchmark function
+   */
+  Benchmark(const std::string& name, Function function);
+
+  /**
+   * Adds an argument tuple.
+   *
+   * @param args arguments (read with BenchmarkState::range)
+   * @return this benchmark (to allow chaining)
+   */
+  Benchmark* args(const std::vector<int64_t>& args);
+
+  /**
+   * Adds the Cartesian product of the argument lists as argument tuples.
+   *
+   * @param argLists list of possible values for each argument
+   * @return this benchmark (to allow chaining)
+   */
+  Benchmark* argsProduct(const std::vector<std::vector<int64_t>>& argLists);
+
+  /**
+   * @param names names of the arguments (used in the instance names)
+   * @return this benchmark (to allow chaining)
+   */
+  Benchmark* argNames(const std::vector<std::string>& names);
+
+  /**
+   * @return number of benchmark instances (at least one)
+   */
+  size_t getNumberOfInstances() const;
+
+  /**
+   * @param i index of the instance
+   * @return name of the i-th instance
+   */
+  std::string getInstanceName(size_t i) const;
+
+  /**
+   * @param i index of the instance
+   * @return arguments of the i-th instance
+   */
+  std::vector<int64_t> getInstanceArgs(size_t i) const;
+
+  /**
+   * @return benchmark function
+   */
+  const Function& getFunction() const;
+
+ protected:
+  /// name of the benchmark
+  std::string name;
+  /// benchmark function
+  Function function;
+  /// argument tuples
+  std::vector<std::vector<int64_t>> argsList;
+  /// names of the arguments
+  std::vector<std::string> names;
+};
+
+/**
+ * Registers a benchmark, which will be run by runBenchmarks.
+ * Normally, the macros SGPP_BENCHMARK or SGPP_BENCHMARK_CAPTURE are used instead.
+ *
+ * @param name     name of the benchmark
+ * @param function benchmark function
+ * @return pointer to the registered benchmark (owned by the registry)
+ */
+Benchmark* registerBenchmark(const std::string& name, Benchmark::Function function);
+
+/**
+ * Runs the registered benchmarks and reports the results on stdout and optionally as JSON file
+ * (compatible with the output of Google Benchmark, see tools/compare_benchmarks.py).
+ *
+ * Command line options:
+ * - <tt>--benchmark_filter=REGEX</tt>: only run instances whose name matches the regex
+ * - <tt>--benchmark_min_time=SECONDS</tt>: minimum measured time per instance (default 0.5)
+ * - <tt>--benchmark_repetitions=N</tt>: repetitions per instance, reports mean, median and
+ *   standard deviation if greater than one (default 1)
+ * - <tt>--benchmark_out=FILE</tt>: write the results as JSON to FILE
+ * - <tt>--benchmark_list_tests</tt>: only list the names of the instances
+ *
+ * @param argc number of command line arguments
+ * @param argv command line arguments
+ * @return exit code (0 on success)
+ */
+int runBenchmarks(int argc, char* argv[]);
+
+/**
+ * Prevents the compiler from optimizing away the computation of a value whose result is not
+ * used otherwise in the benchmark loop.
+ *
+ * @param value value to keep
+ */
+template <class T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+
+}  // namespace base
+}  // namespace sgpp
+
+#define SGPP_BENCHMARK_CONCAT_(a, b) a##b
+#define SGPP_BENCHMARK_CONCAT(a, b) SGPP_BENCHMARK_CONCAT_(a, b)
+
+/**
+ * Registers a function <tt>void function(sgpp::base::BenchmarkState& state)</tt>
+ * as benchmark, e.g., <tt>SGPP_BENCHMARK(benchmarkFoo)->args({2, 5});</tt>.
+ */
+#define SGPP_BENCHMARK(function)                                                    \
+  static ::sgpp::base::Benchmark* SGPP_BENCHMARK_CONCAT(sgppBenchmark_, __LINE__) = \
+      ::sgpp::base::registerBenchmark(#function, function)
+
+/**
+ * Registers a function <tt>void function(sgpp::base::BenchmarkState& state, ...)</tt>
+ * with additional fixed arguments as benchmark named <tt>function/label</tt>, e.g.,
+ * <tt>SGPP_BENCHMARK_CAPTURE(benchmarkFoo, linear, GridType::Linear)->args({2, 5});</tt>.
+ */
+#define SGPP_BENCHMARK_CAPTURE(function, label, ...)                               \
+  static ::sgpp::base::Benchmark* SGPP_BENCHMARK_CONCAT(sgppBenchmark_, __LINE__) = \
+      ::sgpp::base::registerBenchmark(                                             \
+          #function "/" #label,                                                    \
+          [](::sgpp::base::BenchmarkState& state) { function(state, __VA_ARGS__); })
@@ -0,0 +1,174 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/tool_exception.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define SGPP_CPUID_X86
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#define SGPP_CPUID_X86
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+#ifdef SGPP_CPUID_X86
+namespace {
+
+void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+#if defined(_MSC_VER)
+  int r[4];
+  __cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+  for (size_t i = 0; i < 4; i++) {
+    regs[i] = static_cast<uint32_t>(r[i]);
+  }
+#else
+  __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// extended control register 0, tells which register states the OS saves on context switches
+uint64_t xgetbv0() {
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  uint32_t eax, edx;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+}  // namespace
+#endif
+
+InstructionSet CPUFeatures::detectHostInstructionSet() {
+#ifdef SGPP_CPUID_X86
+  uint32_t regs[4];
+  cpuid(0, 0, regs);
+  const uint32_t maxLeaf = regs[0];
+
+  if (maxLeaf < 1) {
+    return InstructionSet::GENERIC;
+  }
+
+  cpuid(1, 0, regs);
+  const bool sse3 = (regs[2] & (1u << 0)) != 0;
+  const bool fma = (regs[2] & (1u << 12)) != 0;
+  const bool osxsave = (regs[2] & (1u << 27)) != 0;
+  const bool avx = (regs[2] & (1u << 28)) != 0;
+
+  if (!sse3) {
+    return InstructionSet::GENERIC;
+  }
+
+  // the OS has to save the YMM (and for AVX-512 the ZMM and mask) registers
+  const uint64_t xcr0 = osxsave ? xgetbv0() : 0;
+  const bool osYmm = (xcr0 & 0x6) == 0x6;
+  const bool osZmm = (xcr0 & 0xe6) == 0xe6;
+
+  if (!avx || !osYmm) {
+    return InstructionSet::SSE3;
+  }
+
+  bool avx2 = false;
+  bool avx512f = false;
+  bool avx512cd = false;
+
+  if (maxLeaf >= 7) {
+    cpuid(7, 0, regs);
+    avx2 = (regs[1] & (1u << 5)) != 0;
+    avx512f = (regs[1] & (1u << 16)) != 0;
+    avx512cd = (regs[1] & (1u << 28)) != 0;
+  }
+
+  // the AVX2 and AVX-512 variants are compiled with FMA
+  if (avx512f && avx512cd && fma && osZmm) {
+    return InstructionSet::AVX512;
+  } else if (avx2 && fma) {
+    return InstructionSet::AVX2;
+  } else {
+    return InstructionSet::AVX;
+  }
+#else
+  return InstructionSet::GENERIC;
+#endif
+}
+
+InstructionSet CPUFeatures::getHostInstructionSet() {
+  static const InstructionSet hostInstructionSet = detectHostInstructionSet();
+  return hostInstructionSet;
+}
+
+InstructionSet CPUFeatures::getKernelInstructionSet() {
+#ifdef SGPP_KERNEL_DISPATCH
+  InstructionSet instructionSet = getHostInstructionSet();
+  const char* requested = std::getenv("SGPP_INSTRUCTION_SET");
+
+  if ((requested != nullptr) && (*requested != '\0')) {
+    // never select a variant the host cannot execute
+    instructionSet = std::min(instructionSet, fromString(requested));
+  }
+
+  return instructionSet;
+#else
+  return SGPP_COMPILED_INSTRUCTION_SET;
+#endif
+}
+
+bool CPUFeatures::isSupported(InstructionSet instructionSet) {
+  return instructionSet <= getHostInstructionSet();
+}
+
+std::string CPUFeatures::toString(InstructionSet instructionSet) {
+  switch (instructionSet) {
+    case InstructionSet::GENERIC:
+      return "generic";
+    case InstructionSet::SSE3:
+      return "sse3";
+    case InstructionSet::AVX:
+      return "avx";
+    case InstructionSet::AVX2:
+      return "avx2";
+    case InstructionSet::AVX512:
+      return "avx512";
+  }
+
+  return "generic";
+}
+
+InstructionSet CPUFeatures::fromString(const std::string& name) {
+  std::string lowerName(name);
+  std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(),
+                 [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+  if (lowerName == "generic") {
+    return InstructionSet::GENERIC;
+  } else if (lowerName == "sse3") {
+    return InstructionSet::SSE3;
+  } else if (lowerName == "avx") {
+    return InstructionSet::AVX;
+  } else if (lowerName == "avx2") {
+    return InstructionSet::AVX2;
+  } else if (lowerName == "avx512") {
+    return InstructionSet::AVX512;
+  } else {
+    throw tool_exception(
+        "CPUFeatures: unknown instruction set, expected generic, sse3, avx, avx2 or avx512");
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
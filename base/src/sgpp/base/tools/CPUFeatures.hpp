@@ -0,0 +1,90 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * x86 instruction set extensions the hand-vectorized kernels are written for,
+ * ordered by capability.
+ */
+enum class InstructionSet { GENERIC = 0, SSE3 = 1, AVX = 2, AVX2 = 3, AVX512 = 4 };
+
+}  // namespace base
+}  // namespace sgpp
+
+/**
+ * Instruction set the current translation unit is compiled for. Kernels that are compiled
+ * once per instruction set (SCons option KERNEL_DISPATCH) use this to name their variant.
+ */
+#if defined(__AVX512F__) || defined(__MIC__)
+#define SGPP_COMPILED_INSTRUCTION_SET sgpp::base::InstructionSet::AVX512
+#elif defined(__AVX2__)
+#define SGPP_COMPILED_INSTRUCTION_SET sgpp::base::InstructionSet::AVX2
+#elif defined(__AVX__)
+#define SGPP_COMPILED_INSTRUCTION_SET sgpp::base::InstructionSet::AVX
+#elif defined(__SSE3__)
+#define SGPP_COMPILED_INSTRUCTION_SET sgpp::base::InstructionSet::SSE3
+#else
+#define SGPP_COMPILED_INSTRUCTION_SET sgpp::base::InstructionSet::GENERIC
+#endif
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Runtime detection of the instruction set extensions supported by the CPU (via cpuid) and
+ * selection of the kernel variant to use.
+ *
+ * If SG++ was built with KERNEL_DISPATCH, the streaming kernels are available for every
+ * InstructionSet and the best one supported by the host is used. The environment variable
+ * SGPP_INSTRUCTION_SET (generic, sse3, avx, avx2 or avx512) limits the selection, e.g., for
+ * benchmarking the variants against each other on the same machine.
+ * Without KERNEL_DISPATCH, only the variant selected by ARCH at compile time exists.
+ */
+class CPUFeatures {
+ public:
+  /**
+   * @return best instruction set supported by the CPU and enabled by the operating system,
+   *         detected once and cached afterwards
+   */
+  static InstructionSet getHostInstructionSet();
+
+  /**
+   * @return instruction set the kernels should use, i.e., the best one that is supported by the
+   *         host and compiled into the library, limited by SGPP_INSTRUCTION_SET
+   */
+  static InstructionSet getKernelInstructionSet();
+
+  /**
+   * @param instructionSet  instruction set
+   * @return whether the host can execute code compiled for instructionSet
+   */
+  static bool isSupported(InstructionSet instructionSet);
+
+  /**
+   * @param instructionSet  instruction set
+   * @return lower case name as used in SGPP_INSTRUCTION_SET
+   */
+  static std::string toString(InstructionSet instructionSet);
+
+  /**
+   * @param name  case-insensitive name (generic, sse3, avx, avx2 or avx512)
+   * @return corresponding instruction set, throws a tool_exception for unknown names
+   */
+  static InstructionSet fromString(const std::string& name);
+
+ private:
+  static InstructionSet detectHostInstructionSet();
+};
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,152 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/tool_exception.hpp>
+#include <sgpp/base/tools/MonteCarloEstimator.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace sgpp {
+namespace base {
+
+MonteCarloEstimator::MonteCarloEstimator()
+    : numSamples(0), sum(0.0), compensation(0.0), sumSquaredDeviations(0.0) {}
+
+void MonteCarloEstimator::addBlock(const double* values, size_t numValues) {
+  if (numValues == 0) {
+    return;
+  }
+
+  MonteCarloEstimator block;
+
+  for (size_t i = 0; i < numValues; i++) {
+    block.addToSum(values[i]);
+  }
+
+  block.numSamples = numValues;
+  const double mean = block.getMean();
+
+  // second pass while the block is still in the cache
+  for (size_t i = 0; i < numValues; i++) {
+    const double deviation = values[i] - mean;
+    block.sumSquaredDeviations += deviation * deviation;
+  }
+
+  merge(block);
+}
+
+void MonteCarloEstimator::merge(const MonteCarloEstimator& other) {
+  if (other.numSamples == 0) {
+    return;
+  }
+
+  if (numSamples == 0) {
+    *this = other;
+    return;
+  }
+
+  const double n1 = static_cast<double>(numSamples);
+  const double n2 = static_cast<double>(other.numSamples);
+  const double delta = other.getMean() - getMean();
+
+  sumSquaredDeviations += other.sumSquaredDeviations + delta * delta * n1 * n2 / (n1 + n2);
+  addToSum(other.sum);
+  addToSum(other.compensation);
+  numSamples += other.numSamples;
+}
+
+double MonteCarloEstimator::getMean() const {
+  return (numSamples == 0) ? 0.0 : (sum + compensation) / static_cast<double>(numSamples);
+}
+
+double MonteCarloEstimator::getVariance() const {
+  return (numSamples < 2) ? 0.0 : sumSquaredDeviations / static_cast<double>(numSamples - 1);
+}
+
+double MonteCarloEstimator::getStandardError() const {
+  return (numSamples == 0) ? 0.0 : std::sqrt(getVariance() / static_cast<double>(numSamples));
+}
+
+void MonteCarloEstimator::addToSum(double summand) {
+  const double newSum = sum + summand;
+
+  // Neumaier's variant of Kahan summation, which also handles summands larger than the sum
+  if (std::abs(sum) >= std::abs(summand)) {
+    compensation += (sum - newSum) + summand;
+  } else {
+    compensation += (summand - newSum) + sum;
+  }
+
+  sum = newSum;
+}
+
+std::mt19937_64 MonteCarloEstimator::createBlockGenerator(std::uint64_t seed, size_t block) {
+  const std::uint64_t blockNumber = static_cast<std::uint64_t>(block);
+  std::seed_seq seedSequence{static_cast<std::uint32_t>(seed),
+                             static_cast<std::uint32_t>(seed >> 32),
+                             static_cast<std::uint32_t>(blockNumber),
+                             static_cast<std::uint32_t>(blockNumber >> 32)};
+  return std::mt19937_64(seedSequence);
+}
+
+MonteCarloEstimator MonteCarloEstimator::estimate(size_t dim, size_t maxSamples, size_t blockSize,
+                                                  double targetError,
+                                                  const BlockFunction& blockFunction) {
+  if (blockSize == 0) {
+    throw tool_exception("MonteCarloEstimator::estimate : blockSize has to be positive");
+  }
+
+  const size_t numBlocks = (maxSamples + blockSize - 1) / blockSize;
+  MonteCarloEstimator result;
+  size_t nextBlock = 0;
+  bool targetErrorReached = false;
+
+#pragma omp parallel
+  {
+    DataMatrix points(0, dim);
+    DataVector values(0);
+
+    while (true) {
+      size_t block;
+      bool stop;
+
+#pragma omp critical(MonteCarloEstimatorState)
+      {
+        block = nextBlock++;
+        stop = targetErrorReached;
+      }
+
+      if (stop || (block >= numBlocks)) {
+        break;
+      }
+
+      const size_t numValues = std::min(blockSize, maxSamples - block * blockSize);
+      points.resizeRowsCols(numValues, dim);
+      values.resize(numValues);
+      blockFunction(block, points, values);
+
+      MonteCarloEstimator blockEstimate;
+      blockEstimate.addBlock(values.getPointer(), numValues);
+
+#pragma omp critical(MonteCarloEstimatorState)
+      {
+        result.merge(blockEstimate);
+
+        if ((targetError > 0.0) && (result.numSamples >= 2 * blockSize) &&
+            (result.getStandardError() <= targetError)) {
+          targetErrorReached = true;
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,122 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <random>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Running estimate of the mean and variance of a stream of Monte Carlo samples.
+ *
+ * Samples are added in blocks. The sum of the samples is accumulated with compensated
+ * (Kahan-Babuska) summation, and the sum of squared deviations is computed per block with
+ * two passes and merged with the update formula of Chan et al. Hence, the accuracy does not
+ * degrade for very long streams (e.g., \f$10^9\f$ samples), and estimates of different threads
+ * can be merged in any order.
+ */
+class MonteCarloEstimator {
+ public:
+  /**
+   * Function computing the samples of a block, i.e., drawing the points (numSamples x dim,
+   * already resized) and writing the integrand values at these points to values (already
+   * resized). The function is called concurrently from multiple threads.
+   */
+  typedef std::function<void(size_t block, DataMatrix& points, DataVector& values)>
+      BlockFunction;
+
+  /**
+   * Constructor, creates an empty estimate.
+   */
+  MonteCarloEstimator();
+
+  /**
+   * @param values     sample values
+   * @param numValues  number of sample values
+   */
+  void addBlock(const double* values, size_t numValues);
+
+  /**
+   * @param other estimate of other, disjoint samples
+   */
+  void merge(const MonteCarloEstimator& other);
+
+  /**
+   * @return number of samples
+   */
+  size_t getNumberOfSamples() const { return numSamples; }
+
+  /**
+   * @return sample mean
+   */
+  double getMean() const;
+
+  /**
+   * @return (unbiased) sample variance of the samples
+   */
+  double getVariance() const;
+
+  /**
+   * @return estimated standard error of the mean, i.e., \f$\sqrt{\sigma^2 / N}\f$
+   */
+  double getStandardError() const;
+
+  /**
+   * Estimates the mean of the samples computed by blockFunction in a streaming fashion: the
+   * samples are computed and reduced in blocks of blockSize samples by all threads, so the
+   * memory does not depend on the total number of samples. Block b always gets the samples
+   * with the numbers b * blockSize, ..., such that deterministic block functions give the
+   * same samples independent of the number of threads.
+   *
+   * If targetError is positive, no new blocks are started as soon as the standard error of
+   * the estimate is at most targetError (after at least two blocks).
+   *
+   * @param dim            dimension of the points
+   * @param maxSamples     maximal number of samples
+   * @param blockSize      number of samples per block
+   * @param targetError    target standard error or zero to use all samples
+   * @param blockFunction  function computing the samples of a block
+   * @return estimate
+   */
+  static MonteCarloEstimator estimate(size_t dim, size_t maxSamples, size_t blockSize,
+                                      double targetError, const BlockFunction& blockFunction);
+
+  /**
+   * @param seed  seed of the whole estimation
+   * @param block number of the block
+   * @return random number generator for the block, independent of the generators of the
+   *         other blocks
+   */
+  static std::mt19937_64 createBlockGenerator(std::uint64_t seed, size_t block);
+
+ private:
+  /// number of samples
+  size_t numSamples;
+  /// sum of the samples
+  double sum;
+  /// compensation of the rounding errors of sum
+  double compensation;
+  /// sum of the squared deviations from the mean
+  double sumSquaredDeviations;
+
+  /**
+   * Adds a summand to sum with compensated summation.
+   *
+   * @param summand summand
+   */
+  void addToSum(double summand);
+};
+
+}  // namespace base
+}  // namespace sgpp
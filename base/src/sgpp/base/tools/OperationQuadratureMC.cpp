@@ -6,6 +6,7 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/tools/MonteCarloEstimator.hpp>
 #include <sgpp/base/tools/OperationQuadratureMC.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -13,37 +14,30 @@
 #include <cmath>
 #include <cstdlib>
 #include <ctime>
+#include <random>
 
 namespace sgpp {
 namespace base {
 
 OperationQuadratureMC::OperationQuadratureMC(Grid& grid, int mcPaths)
-    : grid(&grid), mcPaths(mcPaths) {
-  // init seed for random number generator
-  srand(static_cast<unsigned>(time(nullptr)));
+    : grid(&grid),
+      mcPaths(mcPaths),
+      seed(static_cast<std::uint64_t>(time(nullptr))),
+      nextBlock(0),
+      standardError(0.0),
+      numberOfUsedSamples(0) {
   // this->simple_rand.seed((unsigned)time(0));
 }
 
 double OperationQuadratureMC::doQuadrature(DataVector& alpha) {
+  return doQuadratureStreaming(alpha);
+}
+
+double OperationQuadratureMC::doQuadratureStreaming(DataVector& alpha, double targetError,
+                                                    size_t blockSize) {
   size_t dim = grid->getDimension();
   BoundingBox& boundingBox = grid->getBoundingBox();
 
-  // create number of paths (uniformly drawn from [0,1]^d)
-  DataMatrix dm(mcPaths, dim);
-
-  for (size_t i = 0; i < mcPaths; i++) {
-    for (size_t d = 0; d < dim; d++) {
-      dm.set(i, d,
-             boundingBox.transformPointToBoundingBox(d, static_cast<double>(rand()) / RAND_MAX));
-      /*dm.set(i, d, boundingBox.transformPointToBoundingBox(
-                       d, static_cast<double>(this->simple_rand()) / RAND_MAX));*/
-    }
-  }
-
-  DataVector res(mcPaths);
-  std::unique_ptr<OperationMultipleEval>(sgpp::op_factory::createOperationMultipleEval(*grid, dm))
-      ->mult(alpha, res);
-
   // multiply with determinant of "unit cube -> BoundingBox" transformation
   double determinant = 1.0;
 
@@ -51,7 +45,31 @@ double OperationQuadratureMC::doQuadrature(DataVector& alpha) {
     determinant *= boundingBox.getIntervalWidth(d);
   }
 
-  return (res.sum() / static_cast<double>(mcPaths)) * determinant;
+  // continue with unused block generators, otherwise every call would return the same estimate
+  const size_t firstBlock = nextBlock;
+  nextBlock += (mcPaths + blockSize - 1) / blockSize;
+
+  MonteCarloEstimator estimator = MonteCarloEstimator::estimate(
+      dim, mcPaths, blockSize, targetError / determinant,
+      [&](size_t block, DataMatrix& points, DataVector& values) {
+        // paths of the block (uniformly drawn from [0,1]^d)
+        std::mt19937_64 rng = MonteCarloEstimator::createBlockGenerator(seed, firstBlock + block);
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+        for (size_t i = 0; i < points.getNrows(); i++) {
+          for (size_t d = 0; d < dim; d++) {
+            points.set(i, d, boundingBox.transformPointToBoundingBox(d, distribution(rng)));
+          }
+        }
+
+        std::unique_ptr<OperationMultipleEval>(
+            sgpp::op_factory::createOperationMultipleEval(*grid, points))
+            ->mult(alpha, values);
+      });
+
+  standardError = estimator.getStandardError() * determinant;
+  numberOfUsedSamples = estimator.getNumberOfSamples();
+  return estimator.getMean() * determinant;
 }
 
 double OperationQuadratureMC::doQuadratureFunc(FUNC func, void* clientdata) {
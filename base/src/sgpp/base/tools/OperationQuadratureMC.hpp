@@ -12,6 +12,7 @@
 #include <sgpp/globaldef.hpp>
 
 // Better random number generator in C++11
+#include <cstdint>
 #include <random>
 
 namespace sgpp {
@@ -45,11 +46,54 @@ class OperationQuadratureMC : public OperationQuadrature {
 
   /**
    * Quadrature using simple MC in @f$\Omega=[0,1]^d@f$.
+   * Same as doQuadratureStreaming with default arguments.
    *
    * @param alpha Coefficient vector for current grid
    */
   double doQuadrature(sgpp::base::DataVector& alpha) override;
 
+  /**
+   * Quadrature using simple MC in @f$\Omega=[0,1]^d@f$, streaming the samples.
+   * The samples are drawn and evaluated in blocks by all threads, where every block has its
+   * own random number generator, and reduced with compensated summation
+   * (see MonteCarloEstimator). Thus, the memory does not depend on the number of samples.
+   * Every call continues with blocks that were not used before, so repeated calls give
+   * independent estimates; call setSeed to reproduce a sequence of estimates.
+   *
+   * @param alpha       Coefficient vector for current grid
+   * @param targetError Stop as soon as the estimated standard error is at most targetError
+   *                    (zero to use all mcPaths samples)
+   * @param blockSize   Number of samples per block
+   */
+  double doQuadratureStreaming(sgpp::base::DataVector& alpha, double targetError = 0.0,
+                               size_t blockSize = 1024);
+
+  /**
+   * @return estimated standard error of the last call of doQuadrature or doQuadratureStreaming
+   */
+  double getStandardError() const { return standardError; }
+
+  /**
+   * @return number of samples used by the last call of doQuadrature or doQuadratureStreaming
+   */
+  size_t getNumberOfUsedSamples() const { return numberOfUsedSamples; }
+
+  /**
+   * Sets the seed and restarts the random number sequence of doQuadrature and
+   * doQuadratureStreaming.
+   *
+   * @param seed Seed of doQuadrature and doQuadratureStreaming (defaults to the current time)
+   */
+  void setSeed(std::uint64_t seed) {
+    this->seed = seed;
+    nextBlock = 0;
+  }
+
+  /**
+   * @return seed of doQuadrature and doQuadratureStreaming
+   */
+  std::uint64_t getSeed() const { return seed; }
+
   /**
    * Quadrature of an arbitrary function using
    * simple MC in @f$\Omega=[0,1]^d@f$.
@@ -78,6 +122,14 @@ class OperationQuadratureMC : public OperationQuadrature {
   size_t mcPaths;
   // random number generator
   std::minstd_rand simple_rand;
+  // seed of the block generators of doQuadratureStreaming
+  std::uint64_t seed;
+  // number of the first block generator of the next streaming quadrature
+  size_t nextBlock;
+  // estimated standard error of the last streaming quadrature
+  double standardError;
+  // number of samples of the last streaming quadrature
+  size_t numberOfUsedSamples;
 };
 
 }  // namespace base
@@ -0,0 +1,56 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/tool_exception.hpp>
+#include <sgpp/base/tools/ScatterReduction.hpp>
+#include <sgpp/base/tools/ScopedLock.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace sgpp {
+namespace base {
+
+ScatterReduction::ScatterReduction(DataVector& result, size_t blockSize, size_t bufferCapacity)
+    : result(result), blockSize(blockSize), bufferCapacity(bufferCapacity) {
+  if ((blockSize == 0) || (bufferCapacity == 0)) {
+    throw tool_exception("ScatterReduction: blockSize and bufferCapacity must not be zero");
+  }
+
+  locks.resize((result.getSize() + blockSize - 1) / blockSize);
+}
+
+ScatterReduction::Buffer::Buffer(ScatterReduction& reduction) : reduction(reduction) {
+  entries.reserve(reduction.bufferCapacity);
+}
+
+ScatterReduction::Buffer::~Buffer() { flush(); }
+
+void ScatterReduction::Buffer::flush() {
+  // sorting groups the contributions by block, so every lock is taken once per flush
+  std::sort(entries.begin(), entries.end(),
+            [](const std::pair<size_t, double>& a, const std::pair<size_t, double>& b) {
+              return a.first < b.first;
+            });
+
+  size_t k = 0;
+
+  while (k < entries.size()) {
+    const size_t block = entries[k].first / reduction.blockSize;
+    const size_t blockEnd = (block + 1) * reduction.blockSize;
+    ScopedLock lock(reduction.locks[block]);
+
+    for (; (k < entries.size()) && (entries[k].first < blockEnd); k++) {
+      reduction.result[entries[k].first] += entries[k].second;
+    }
+  }
+
+  entries.clear();
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,108 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/tools/MutexType.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Parallel accumulation result[i] += value of contributions with scattered indices i, e.g., in
+ * the transposed multi-evaluation, where every data point contributes to all grid points whose
+ * support contains it.
+ *
+ * Instead of a private copy of result per thread that is merged serially afterwards, every
+ * thread collects its contributions in a Buffer of bounded size. When the buffer is full (and
+ * when it is destroyed), its contributions are sorted by index and added to result block by
+ * block, each block of result being protected by its own lock. Hence the scratch memory per
+ * thread does not depend on the size of result, and threads only wait for each other if they
+ * flush into the same block at the same time.
+ *
+ * @code
+ * ScatterReduction reduction(result);
+ *
+ * #pragma omp parallel
+ * {
+ *   ScatterReduction::Buffer buffer(reduction);
+ *
+ *   #pragma omp for
+ *   for (size_t j = 0; j < n; j++) {
+ *     buffer.add(index(j), value(j));
+ *   }
+ * }  // the remaining contributions are flushed by the destructor of the buffer
+ * @endcode
+ */
+class ScatterReduction {
+ public:
+  /**
+   * Per-thread collection of contributions, must not be shared between threads.
+   */
+  class Buffer {
+   public:
+    /**
+     * @param reduction reduction the contributions are added to
+     */
+    explicit Buffer(ScatterReduction& reduction);
+
+    /**
+     * Destructor, flushes the remaining contributions.
+     */
+    ~Buffer();
+
+    /**
+     * Adds value to result[index] (deferred until the next flush).
+     *
+     * @param index index in result
+     * @param value contribution
+     */
+    void add(size_t index, double value) {
+      entries.emplace_back(index, value);
+
+      if (entries.size() >= reduction.bufferCapacity) {
+        flush();
+      }
+    }
+
+    /**
+     * Adds all collected contributions to result.
+     */
+    void flush();
+
+   private:
+    /// reduction the contributions are added to
+    ScatterReduction& reduction;
+    /// collected (index, value) pairs
+    std::vector<std::pair<size_t, double>> entries;
+  };
+
+  /**
+   * @param result          vector the contributions are added to (not reset)
+   * @param blockSize       number of entries of result that share a lock
+   * @param bufferCapacity  number of contributions a Buffer collects before flushing
+   */
+  explicit ScatterReduction(DataVector& result, size_t blockSize = 4096,
+                            size_t bufferCapacity = 8192);
+
+ private:
+  /// vector the contributions are added to
+  DataVector& result;
+  /// number of entries of result that share a lock
+  size_t blockSize;
+  /// number of contributions a Buffer collects before flushing
+  size_t bufferCapacity;
+  /// one lock per block of result
+  std::vector<MutexType> locks;
+};
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,158 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/exception/tool_exception.hpp>
+#include <sgpp/base/tools/TensorProductQuadrature.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+/// all tables hold three moments per entry, unused moments are zero
+const size_t MAX_MOMENTS = 3;
+}  // namespace
+
+TensorProductQuadrature::TensorProductQuadrature(GridStorage& storage,
+                                                 const Moments1D& moments1D,
+                                                 size_t numMoments)
+    : numDims(storage.getDimension()),
+      numPoints(storage.getSize()),
+      numMoments(numMoments),
+      numPairs(0),
+      pairNumbers(numPoints * numDims) {
+  if ((numMoments == 0) || (numMoments > MAX_MOMENTS)) {
+    throw tool_exception("TensorProductQuadrature: numMoments has to be 1, 2 or 3");
+  }
+
+  std::unordered_map<uint64_t, uint32_t> pairs;
+
+  for (size_t i = 0; i < numPoints; i++) {
+    const GridPoint& point = storage.getPoint(i);
+
+    for (size_t d = 0; d < numDims; d++) {
+      const level_t level = point.getLevel(d);
+      const index_t index = point.getIndex(d);
+      const uint64_t key = (static_cast<uint64_t>(level) << 32) | index;
+      auto inserted = pairs.emplace(key, static_cast<uint32_t>(numPairs));
+
+      if (inserted.second) {
+        this->moments1D.resize((numPairs + 1) * MAX_MOMENTS, 0.0);
+        moments1D(level, index, &this->moments1D[numPairs * MAX_MOMENTS]);
+        numPairs++;
+      }
+
+      pairNumbers[i * numDims + d] = inserted.first->second;
+    }
+  }
+}
+
+TensorProductQuadrature::TensorProductQuadrature(GridStorage& storage, SBasis& basis)
+    : TensorProductQuadrature(
+          storage,
+          [&basis](level_t level, index_t index, double* integral) {
+            integral[0] = basis.getIntegral(level, index);
+          },
+          1) {}
+
+double TensorProductQuadrature::quadrature(const DataVector& alpha) const {
+  double moments[MAX_MOMENTS];
+  computeMoments(alpha, nullptr, moments);
+  return moments[0];
+}
+
+double TensorProductQuadrature::firstMoment(const DataVector& alpha,
+                                            const DataMatrix* bounds) const {
+  if (numMoments < 2) {
+    throw tool_exception("TensorProductQuadrature: first moments of 1-D basis not available");
+  }
+
+  double moments[MAX_MOMENTS];
+  computeMoments(alpha, bounds, moments);
+  return moments[1];
+}
+
+double TensorProductQuadrature::secondMoment(const DataVector& alpha,
+                                             const DataMatrix* bounds) const {
+  if (numMoments < 3) {
+    throw tool_exception("TensorProductQuadrature: second moments of 1-D basis not available");
+  }
+
+  double moments[MAX_MOMENTS];
+  computeMoments(alpha, bounds, moments);
+  return moments[2];
+}
+
+void TensorProductQuadrature::computeMoments(const DataVector& alpha, const DataMatrix* bounds,
+                                             double* moments) const {
+  if ((bounds != nullptr) && ((bounds->getNcols() != 2) || (bounds->getNrows() != numDims))) {
+    throw application_exception(
+        "TensorProductQuadrature::computeMoments - bounds matrix has the wrong shape");
+  }
+
+  if (alpha.getSize() != numPoints) {
+    throw application_exception(
+        "TensorProductQuadrature::computeMoments - alpha has the wrong size");
+  }
+
+  // moments of the 1-D basis functions on the bounds of every dimension,
+  // with x = xlower + width * y for y in [0, 1]
+  std::vector<double> table(numDims * numPairs * MAX_MOMENTS);
+
+  for (size_t d = 0; d < numDims; d++) {
+    const double xlower = (bounds == nullptr) ? 0.0 : bounds->get(d, 0);
+    const double width = (bounds == nullptr) ? 1.0 : (bounds->get(d, 1) - xlower);
+
+    for (size_t p = 0; p < numPairs; p++) {
+      const double* unitMoments = &moments1D[p * MAX_MOMENTS];
+      double* boundedMoments = &table[(d * numPairs + p) * MAX_MOMENTS];
+      boundedMoments[0] = unitMoments[0];
+      boundedMoments[1] = width * unitMoments[1] + xlower * unitMoments[0];
+      boundedMoments[2] = width * width * unitMoments[2] + 2.0 * width * xlower * unitMoments[1] +
+                          xlower * xlower * unitMoments[0];
+    }
+  }
+
+  double moment0 = 0.0;
+  double moment1 = 0.0;
+  double moment2 = 0.0;
+
+#pragma omp parallel for schedule(static) reduction(+ : moment0, moment1, moment2)
+  for (size_t i = 0; i < numPoints; i++) {
+    const uint32_t* pointPairs = &pairNumbers[i * numDims];
+    double product0 = alpha[i];
+    double product1 = alpha[i];
+    double product2 = alpha[i];
+
+    for (size_t d = 0; d < numDims; d++) {
+      const double* entry = &table[(d * numPairs + pointPairs[d]) * MAX_MOMENTS];
+      product0 *= entry[0];
+      product1 *= entry[1];
+      product2 *= entry[2];
+    }
+
+    moment0 += product0;
+    moment1 += product1;
+    moment2 += product2;
+  }
+
+  moments[0] = moment0;
+
+  if (numMoments > 1) {
+    moments[1] = moment1;
+  }
+
+  if (numMoments > 2) {
+    moments[2] = moment2;
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
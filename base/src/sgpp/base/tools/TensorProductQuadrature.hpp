@@ -0,0 +1,115 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/LevelIndexTypes.hpp>
+#include <sgpp/base/operation/hash/common/basis/Basis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+#include <functional>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Quadrature and moments of sparse grid functions with tensor-product basis functions,
+ * \f[ \int \prod_t (a_t + w_t x_t)^k \varphi_{\ell_t,i_t}(x_t) \,\mathrm{d}\vec{x},
+ *     \quad k = 0, 1, 2, \f]
+ * where \f$[a_t, a_t + w_t]\f$ are the bounds of the original domain.
+ *
+ * The 1-D moments \f$\int_0^1 x^k \varphi_{\ell,i}(x) \,\mathrm{d}x\f$ are computed only
+ * once for every distinct level-index pair of the grid (which usually requires Gauss-Legendre
+ * quadrature), instead of once for every grid point and dimension. The moments of the grid
+ * function are then computed with a parallel pass over the grid points, which evaluates all
+ * three moments at once if needed (e.g., for mean and variance).
+ *
+ * The object may be kept and reused for different coefficient vectors and bounds as long as
+ * the grid is not changed.
+ */
+class TensorProductQuadrature {
+ public:
+  /**
+   * Function computing the 1-D moments of a basis function on [0, 1],
+   * i.e., moments[k] = \f$\int_0^1 x^k \varphi_{\ell,i}(x) \,\mathrm{d}x\f$ for
+   * k < numMoments.
+   */
+  typedef std::function<void(level_t level, index_t index, double* moments)> Moments1D;
+
+  /**
+   * @param storage     storage of the grid
+   * @param moments1D   function computing the 1-D moments of the basis functions
+   * @param numMoments  number of moments computed by moments1D (1, 2 or 3)
+   */
+  TensorProductQuadrature(GridStorage& storage, const Moments1D& moments1D,
+                          size_t numMoments = 3);
+
+  /**
+   * Uses the integrals given by the basis, i.e., only quadrature is available.
+   *
+   * @param storage storage of the grid
+   * @param basis   basis of the grid
+   */
+  TensorProductQuadrature(GridStorage& storage, SBasis& basis);
+
+  /**
+   * @param alpha coefficient vector
+   * @return integral of the sparse grid function over the unit cube
+   */
+  double quadrature(const DataVector& alpha) const;
+
+  /**
+   * @param alpha  coefficient vector
+   * @param bounds bounds of the original domain (dimension x 2) or nullptr for the unit cube
+   * @return first moment (as computed by OperationFirstMoment)
+   */
+  double firstMoment(const DataVector& alpha, const DataMatrix* bounds = nullptr) const;
+
+  /**
+   * @param alpha  coefficient vector
+   * @param bounds bounds of the original domain (dimension x 2) or nullptr for the unit cube
+   * @return second moment (as computed by OperationSecondMoment)
+   */
+  double secondMoment(const DataVector& alpha, const DataMatrix* bounds = nullptr) const;
+
+  /**
+   * Computes all moments in a single pass over the grid points. For a density, the mean is
+   * the first moment and the variance is the second moment minus the squared first moment.
+   *
+   * @param      alpha    coefficient vector
+   * @param      bounds   bounds of the original domain (dimension x 2) or nullptr
+   * @param[out] moments  moments[k] for k < numMoments (numMoments entries)
+   */
+  void computeMoments(const DataVector& alpha, const DataMatrix* bounds, double* moments) const;
+
+  /**
+   * @return number of distinct level-index pairs of the grid
+   */
+  size_t getNumberOfDistinctPairs() const { return numPairs; }
+
+ private:
+  /// dimension of the grid
+  size_t numDims;
+  /// number of grid points
+  size_t numPoints;
+  /// number of moments per level-index pair
+  size_t numMoments;
+  /// number of distinct level-index pairs
+  size_t numPairs;
+  /// 1-D moments of the distinct level-index pairs (numPairs x numMoments)
+  std::vector<double> moments1D;
+  /// number of the level-index pair of every grid point in every dimension (numPoints x numDims)
+  std::vector<uint32_t> pairNumbers;
+};
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,290 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+std::string escapeJSON(const char* str) {
+  std::string result;
+
+  for (const char* c = str; *c != '\0'; c++) {
+    if ((*c == '"') || (*c == '\\')) {
+      result += '\\';
+      result += *c;
+    } else if (static_cast<unsigned char>(*c) < 0x20) {
+      char buffer[8];
+      snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(*c));
+      result += buffer;
+    } else {
+      result += *c;
+    }
+  }
+
+  return result;
+}
+
+}  // namespace
+
+std::atomic<bool> Tracer::enabled(true);
+
+thread_local TracingThreadBuffer* Tracer::threadBuffer = nullptr;
+
+Tracer::Tracer() : startTime(std::chrono::steady_clock::now()) {}
+
+Tracer::~Tracer() {
+  const char* filename = std::getenv("SGPP_TRACE_FILE");
+
+  if ((filename != nullptr) && (filename[0] != '\0')) {
+    try {
+      writeChromeTrace(std::string(filename));
+    } catch (const file_exception& e) {
+      std::cerr << e.what() << std::endl;
+    }
+  }
+}
+
+Tracer& Tracer::getInstance() {
+  static Tracer tracer;
+  return tracer;
+}
+
+void Tracer::setEnabled(bool enabled) { Tracer::enabled.store(enabled); }
+
+bool Tracer::isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+int64_t Tracer::now() const {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                              startTime)
+      .count();
+}
+
+TracingThreadBuffer* Tracer::registerThread() {
+  std::lock_guard<std::mutex> lock(buffersMutex);
+  buffers.emplace_back(new TracingThreadBuffer());
+  TracingThreadBuffer* buffer = buffers.back().get();
+  buffer->threadId = buffers.size() - 1;
+  std::fill(buffer->counters, buffer->counters + NUMBER_OF_TRACING_COUNTERS, 0);
+  return buffer;
+}
+
+void Tracer::clear() {
+  std::lock_guard<std::mutex> lock(buffersMutex);
+
+  for (std::unique_ptr<TracingThreadBuffer>& buffer : buffers) {
+    buffer->events.clear();
+    std::fill(buffer->counters, buffer->counters + NUMBER_OF_TRACING_COUNTERS, 0);
+  }
+}
+
+std::vector<uint64_t> Tracer::getCounters() const {
+  std::lock_guard<std::mutex> lock(buffersMutex);
+  std::vector<uint64_t> result(NUMBER_OF_TRACING_COUNTERS, 0);
+
+  for (const std::unique_ptr<TracingThreadBuffer>& buffer : buffers) {
+    for (size_t k = 0; k < NUMBER_OF_TRACING_COUNTERS; k++) {
+      result[k] += buffer->counters[k];
+    }
+  }
+
+  return result;
+}
+
+std::vector<TracingSummaryEntry> Tracer::getSummary() const {
+  std::lock_guard<std::mutex> lock(buffersMutex);
+  // scopes are identified by name, as the same literal may have different addresses
+  std::map<std::string, TracingSummaryEntry> entries;
+
+  for (const std::unique_ptr<TracingThreadBuffer>& buffer : buffers) {
+    for (const TracingEvent& event : buffer->events) {
+      auto inserted = entries.emplace(event.name, TracingSummaryEntry());
+      TracingSummaryEntry& entry = inserted.first->second;
+
+      if (inserted.second) {
+        entry.name = event.name;
+        entry.calls = 0;
+        entry.time = 0.0;
+        std::fill(entry.counters, entry.counters + NUMBER_OF_TRACING_COUNTERS, 0);
+      }
+
+      entry.calls++;
+      entry.time += static_cast<double>(event.duration) * 1e-9;
+
+      for (size_t k = 0; k < NUMBER_OF_TRACING_COUNTERS; k++) {
+        entry.counters[k] += event.counters[k];
+      }
+    }
+  }
+
+  std::vector<TracingSummaryEntry> result;
+
+  for (auto& entry : entries) {
+    result.push_back(entry.second);
+  }
+
+  std::stable_sort(result.begin(), result.end(),
+                   [](const TracingSummaryEntry& lhs, const TracingSummaryEntry& rhs) {
+                     return lhs.time > rhs.time;
+                   });
+  return result;
+}
+
+void Tracer::printSummary(std::ostream& stream) const {
+  const std::vector<TracingSummaryEntry> summary = getSummary();
+  const std::vector<uint64_t> totals = getCounters();
+  size_t nameWidth = 5;
+
+  for (const TracingSummaryEntry& entry : summary) {
+    nameWidth = std::max(nameWidth, entry.name.size());
+  }
+
+  const std::ios::fmtflags flags = stream.flags();
+  const std::streamsize precision = stream.precision();
+  stream << std::left << std::setw(static_cast<int>(nameWidth)) << "Scope" << std::right
+         << std::setw(10) << "Calls" << std::setw(12) << "Time [s]";
+
+  for (size_t k = 0; k < NUMBER_OF_TRACING_COUNTERS; k++) {
+    stream << std::setw(22) << getCounterName(static_cast<TracingCounter>(k));
+  }
+
+  stream << "\n";
+
+  for (const TracingSummaryEntry& entry : summary) {
+    stream << std::left << std::setw(static_cast<int>(nameWidth)) << entry.name << std::right
+           << std::setw(10) << entry.calls << std::setw(12) << std::fixed << std::setprecision(4)
+           << entry.time;
+
+    for (size_t k = 0; k < NUMBER_OF_TRACING_COUNTERS; k++) {
+      stream << std::setw(22) << entry.counters[k];
+    }
+
+    stream << "\n";
+  }
+
+  // counters of all threads, including increments outside of traced scopes
+  stream << std::left << std::setw(static_cast<int>(nameWidth)) << "Total" << std::right
+         << std::setw(10) << "" << std::setw(12) << "";
+
+  for (size_t k = 0; k < NUMBER_OF_TRACING_COUNTERS; k++) {
+    stream << std::setw(22) << totals[k];
+  }
+
+  stream << std::endl;
+  stream.flags(flags);
+  stream.precision(precision);
+}
+
+void Tracer::writeChromeTrace(std::ostream& stream) const {
+  std::lock_guard<std::mutex> lock(buffersMutex);
+  const std::ios::fmtflags flags = stream.flags();
+  const std::streamsize precision = stream.precision();
+  bool first = true;
+
+  stream << "{\n  \"displayTimeUnit\": \"ms\",\n  \"traceEvents\": [";
+  stream << std::fixed << std::setprecision(3);
+
+  for (const std::unique_ptr<TracingThreadBuffer>& buffer : buffers) {
+    stream << (first ? "\n" : ",\n") << "    {\"name\": \"thread_name\", \"ph\": \"M\", "
+           << "\"pid\": 0, \"tid\": " << buffer->threadId << ", \"args\": {\"name\": \"thread "
+           << buffer->threadId << "\"}}";
+    first = false;
+
+    // complete events ("X") with times in microseconds
+    for (const TracingEvent& event : buffer->events) {
+      stream << ",\n    {\"name\": \"" << escapeJSON(event.name)
+             << "\", \"cat\": \"sgpp\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << buffer->threadId
+             << ", \"ts\": " << static_cast<double>(event.start) * 1e-3
+             << ", \"dur\": " << static_cast<double>(event.duration) * 1e-3 << ", \"args\": {";
+      bool firstArg = true;
+
+      for (size_t k = 0; k < NUMBER_OF_TRACING_COUNTERS; k++) {
+        if (event.counters[k] > 0) {
+          stream << (firstArg ? "" : ", ") << "\"" << getCounterName(static_cast<TracingCounter>(k))
+                 << "\": " << event.counters[k];
+          firstArg = false;
+        }
+      }
+
+      stream << "}}";
+    }
+  }
+
+  stream << "\n  ]\n}\n";
+  stream.flags(flags);
+  stream.precision(precision);
+}
+
+void Tracer::writeChromeTrace(const std::string& filename) const {
+  std::ofstream file(filename);
+
+  if (!file) {
+    throw file_exception("Tracer::writeChromeTrace: cannot open the output file");
+  }
+
+  writeChromeTrace(file);
+}
+
+const char* Tracer::getCounterName(TracingCounter counter) {
+  switch (counter) {
+    case TracingCounter::Flops:
+      return "flops";
+    case TracingCounter::BytesStreamed:
+      return "bytesStreamed";
+    case TracingCounter::HashLookups:
+      return "hashLookups";
+    case TracingCounter::CGIterations:
+      return "cgIterations";
+    case TracingCounter::RefinementCandidates:
+      return "refinementCandidates";
+  }
+
+  return "unknown";
+}
+
+TracingScope::TracingScope(const char* name)
+    : name(name), buffer(Tracer::isEnabled() ? &Tracer::getThreadBuffer() : nullptr), start(0) {
+  if (buffer != nullptr) {
+    std::copy(buffer->counters, buffer->counters + NUMBER_OF_TRACING_COUNTERS, counters);
+    start = Tracer::getInstance().now();
+  }
+}
+
+TracingScope::~TracingScope() {
+  if (buffer == nullptr) {
+    return;
+  }
+
+  TracingEvent event;
+  event.name = name;
+  event.start = start;
+  event.duration = Tracer::getInstance().now() - start;
+
+  // the counters may have been reset by Tracer::clear in the meantime
+  for (size_t k = 0; k < NUMBER_OF_TRACING_COUNTERS; k++) {
+    event.counters[k] = (buffer->counters[k] >= counters[k]) ? buffer->counters[k] - counters[k]
+                                                             : buffer->counters[k];
+  }
+
+  buffer->events.push_back(event);
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,267 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Counters which can be incremented by instrumented code (see SGPP_TRACE_COUNT).
+ */
+enum class TracingCounter : size_t {
+  /// floating point operations (estimated by the kernels)
+  Flops,
+  /// bytes read from or written to memory (compulsory traffic estimated by the kernels)
+  BytesStreamed,
+  /// lookups in the hash map of a HashGridStorage
+  HashLookups,
+  /// iterations of the conjugate gradients solvers
+  CGIterations,
+  /// refinable grid points considered during refinement
+  RefinementCandidates
+};
+
+/// number of different tracing counters
+const size_t NUMBER_OF_TRACING_COUNTERS = 5;
+
+/**
+ * Finished traced scope, stored in the buffer of the thread which executed it.
+ */
+struct TracingEvent {
+  /// name of the scope (string literal)
+  const char* name;
+  /// start time in nanoseconds since the start of the tracer
+  int64_t start;
+  /// duration in nanoseconds
+  int64_t duration;
+  /// counter increments of the thread during the scope
+  uint64_t counters[NUMBER_OF_TRACING_COUNTERS];
+};
+
+/**
+ * Per-thread buffer of the tracer, only written by its own thread.
+ */
+struct TracingThreadBuffer {
+  /// consecutive number of the thread (in the order of the first traced event)
+  size_t threadId;
+  /// finished scopes
+  std::vector<TracingEvent> events;
+  /// counter values of the thread
+  uint64_t counters[NUMBER_OF_TRACING_COUNTERS];
+};
+
+/**
+ * Aggregated statistics of all scopes with the same name.
+ */
+struct TracingSummaryEntry {
+  /// name of the scope
+  std::string name;
+  /// number of executions (over all threads)
+  size_t calls;
+  /// accumulated duration in seconds (over all threads, including nested scopes)
+  double time;
+  /// accumulated counter increments (including nested scopes)
+  uint64_t counters[NUMBER_OF_TRACING_COUNTERS];
+};
+
+/**
+ * Lightweight instrumentation of hot paths with named scopes and counters.
+ *
+ * Instrumented code uses the macros SGPP_TRACE_SCOPE and SGPP_TRACE_COUNT, which are only
+ * compiled if SGPP_TRACING is defined (SCons option USE_TRACING=1) and vanish otherwise.
+ * Every thread records into its own buffer, such that no synchronization is needed on the hot
+ * path. Counters are attributed to the scopes which are open in the same thread.
+ *
+ * The recorded data can be printed as summary (printSummary) or exported in the
+ * Chrome trace event format (writeChromeTrace), which can be viewed with chrome://tracing or
+ * Perfetto. If the environment variable SGPP_TRACE_FILE is set, the trace is written to this
+ * file at program exit.
+ *
+ * Reading or clearing the recorded data must not happen concurrently to traced code.
+ */
+class Tracer {
+ public:
+  /**
+   * @return global tracer
+   */
+  static Tracer& getInstance();
+
+  /**
+   * Destructor, writes the trace to SGPP_TRACE_FILE if the variable is set.
+   */
+  ~Tracer();
+
+  /**
+   * @param enabled whether scopes and counters are recorded (default: true)
+   */
+  static void setEnabled(bool enabled);
+
+  /**
+   * @return whether scopes and counters are recorded
+   */
+  static bool isEnabled();
+
+  /**
+   * Increments a counter of the current thread.
+   *
+   * @param counter counter
+   * @param value   increment
+   */
+  static void count(TracingCounter counter, uint64_t value);
+
+  /**
+   * @return buffer of the current thread (created in the first call)
+   */
+  static TracingThreadBuffer& getThreadBuffer();
+
+  /**
+   * @return current time in nanoseconds since the start of the tracer
+   */
+  int64_t now() const;
+
+  /**
+   * Discards all recorded scopes and resets the counters.
+   */
+  void clear();
+
+  /**
+   * @return counter values summed over all threads
+   */
+  std::vector<uint64_t> getCounters() const;
+
+  /**
+   * @return statistics of the recorded scopes, sorted by descending time
+   */
+  std::vector<TracingSummaryEntry> getSummary() const;
+
+  /**
+   * Prints the statistics of the recorded scopes and the counter totals as table.
+   *
+   * @param stream output stream
+   */
+  void printSummary(std::ostream& stream) const;
+
+  /**
+   * Writes the recorded scopes in the Chrome trace event format (JSON).
+   *
+   * @param stream output stream
+   */
+  void writeChromeTrace(std::ostream& stream) const;
+
+  /**
+   * Writes the recorded scopes in the Chrome trace event format (JSON).
+   *
+   * @param filename name of the output file
+   */
+  void writeChromeTrace(const std::string& filename) const;
+
+  /**
+   * @param counter counter
+   * @return name of the counter (as used in the output)
+   */
+  static const char* getCounterName(TracingCounter counter);
+
+ protected:
+  /// whether scopes and counters are recorded
+  static std::atomic<bool> enabled;
+  /// buffer of the current thread
+  static thread_local TracingThreadBuffer* threadBuffer;
+  /// start of the tracer
+  std::chrono::steady_clock::time_point startTime;
+  /// buffers of all threads
+  std::vector<std::unique_ptr<TracingThreadBuffer>> buffers;
+  /// mutex for the list of buffers
+  mutable std::mutex buffersMutex;
+
+  /**
+   * Constructor
+   */
+  Tracer();
+
+  /**
+   * Creates the buffer of the current thread.
+   *
+   * @return new buffer
+   */
+  TracingThreadBuffer* registerThread();
+};
+
+/**
+ * Traced scope, records the duration and the counter increments of the current thread between
+ * construction and destruction (normally used via SGPP_TRACE_SCOPE).
+ */
+class TracingScope {
+ public:
+  /**
+   * Constructor, starts the scope.
+   *
+   * @param name name of the scope, has to be a string literal (only the pointer is stored)
+   */
+  explicit TracingScope(const char* name);
+
+  /**
+   * Destructor, records the scope.
+   */
+  ~TracingScope();
+
+ protected:
+  /// name of the scope
+  const char* name;
+  /// buffer of the current thread (nullptr if tracing was disabled at the start)
+  TracingThreadBuffer* buffer;
+  /// start time in nanoseconds
+  int64_t start;
+  /// counter values at the start
+  uint64_t counters[NUMBER_OF_TRACING_COUNTERS];
+};
+
+inline void Tracer::count(TracingCounter counter, uint64_t value) {
+  if (enabled.load(std::memory_order_relaxed)) {
+    getThreadBuffer().counters[static_cast<size_t>(counter)] += value;
+  }
+}
+
+inline TracingThreadBuffer& Tracer::getThreadBuffer() {
+  if (threadBuffer == nullptr) {
+    threadBuffer = getInstance().registerThread();
+  }
+
+  return *threadBuffer;
+}
+
+}  // namespace base
+}  // namespace sgpp
+
+#define SGPP_TRACE_CONCAT_(a, b) a##b
+#define SGPP_TRACE_CONCAT(a, b) SGPP_TRACE_CONCAT_(a, b)
+
+#ifdef SGPP_TRACING
+/**
+ * Traces the rest of the enclosing block under the given name (string literal).
+ */
+#define SGPP_TRACE_SCOPE(name) \
+  ::sgpp::base::TracingScope SGPP_TRACE_CONCAT(sgppTracingScope_, __LINE__)(name)
+/**
+ * Increments the given TracingCounter (e.g., Flops) by value, which is not evaluated
+ * if tracing is disabled at compile time.
+ */
+#define SGPP_TRACE_COUNT(counter, value) \
+  ::sgpp::base::Tracer::count(::sgpp::base::TracingCounter::counter, (value))
+#else
+#define SGPP_TRACE_SCOPE(name) static_cast<void>(0)
+#define SGPP_TRACE_COUNT(counter, value) static_cast<void>(0)
+#endif
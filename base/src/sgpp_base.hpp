@@ -44,6 +44,7 @@
 #include <sgpp/base/operation/hash/common/basis/PolyModifiedBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/PolyModifiedClenshawCurtisBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/PrewaveletBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/UniformBsplineKernel.hpp>
 #include <sgpp/base/operation/hash/common/basis/WaveletBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/WaveletBoundaryBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/WaveletModifiedBasis.hpp>
@@ -66,11 +67,15 @@
 #include <sgpp/base/application/ScreenOutput.hpp>
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixView.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataVectorView.hpp>
 
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/grid/GridDataBase.hpp>
+#include <sgpp/base/grid/GridModelFile.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/storage/regular/RegularGridStorage.hpp>
 
 #include <sgpp/base/grid/GeneralGridTypeParser.hpp>
 #include <sgpp/base/grid/GridTypeParser.hpp>
@@ -157,6 +162,7 @@
 #include <sgpp/base/grid/type/WaveletGrid.hpp>
 #include <sgpp/base/grid/type/WeaklyFundamentalNakSplineBoundaryGrid.hpp>
 #include <sgpp/base/grid/type/WeaklyFundamentalSplineBoundaryGrid.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
 #include <sgpp/base/tools/Distribution.hpp>
 #include <sgpp/base/tools/DistributionLogNormal.hpp>
 #include <sgpp/base/tools/DistributionNormal.hpp>
@@ -169,6 +175,7 @@
 #include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
 #include <sgpp/base/tools/GridPrinter.hpp>
 #include <sgpp/base/tools/GridPrinterForStretching.hpp>
+#include <sgpp/base/tools/MonteCarloEstimator.hpp>
 #include <sgpp/base/tools/MultipleClassPoint.hpp>
 #include <sgpp/base/tools/MutexType.hpp>
 #include <sgpp/base/tools/OperationQuadratureMC.hpp>
@@ -178,6 +185,7 @@
 #include <sgpp/base/tools/SGppStopwatch.hpp>
 #include <sgpp/base/tools/ScopedLock.hpp>
 #include <sgpp/base/tools/StdNormalDistribution.hpp>
+#include <sgpp/base/tools/TensorProductQuadrature.hpp>
 
 #include <sgpp/base/tools/sle/solver/Armadillo.hpp>
 #include <sgpp/base/tools/sle/solver/Auto.hpp>
@@ -20,8 +20,14 @@
 
 #include <iostream>
 #include <algorithm>
+#include <memory>
+#include <string>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using sgpp::base::DataVector;
 using sgpp::base::DataMatrix;
 using sgpp::base::Grid;
@@ -297,4 +303,96 @@ BOOST_AUTO_TEST_CASE(TestBoundaryPredictive) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestThreadIndependence) {
+  // refines with many equal surpluses, so the tie-breaking decides which points are refined
+  auto refine = [](int numThreads) {
+#ifdef _OPENMP
+    omp_set_num_threads(numThreads);
+#endif
+    std::unique_ptr<Grid> grid(Grid::createLinearGrid(3));
+    grid->getGenerator().regular(3);
+    GridStorage& storage = grid->getStorage();
+
+    for (size_t step = 0; step < 3; step++) {
+      DataVector alpha(storage.getSize());
+
+      for (size_t i = 0; i < alpha.getSize(); i++) {
+        alpha[i] = static_cast<double>(i % 5);
+      }
+
+      SurplusRefinementFunctor functor(alpha, 7);
+      grid->getGenerator().refine(functor);
+    }
+
+    std::vector<std::string> points;
+
+    for (size_t i = 0; i < storage.getSize(); i++) {
+      points.push_back(storage.getPoint(i).toString());
+    }
+
+    return points;
+  };
+
+#ifdef _OPENMP
+  const int maxThreads = omp_get_max_threads();
+#else
+  const int maxThreads = 1;
+#endif
+  std::vector<std::string> serialPoints = refine(1);
+  std::vector<std::string> parallelPoints = refine(std::max(maxThreads, 4));
+#ifdef _OPENMP
+  omp_set_num_threads(maxThreads);
+#endif
+
+  BOOST_CHECK_EQUAL(serialPoints.size(), parallelPoints.size());
+  BOOST_CHECK(serialPoints == parallelPoints);
+}
+
+/**
+ * Refinement which ranks the grid points by their sequence number instead of the functor value.
+ */
+class SequenceNumberRefinement : public HashRefinement {
+ public:
+  mutable size_t numberOfCalls = 0;
+
+  AbstractRefinement::refinement_list_type getIndicator(
+      GridStorage& storage, const GridStorage::grid_map_iterator& iter,
+      const RefinementFunctor& functor) const override {
+    numberOfCalls++;
+    AbstractRefinement::refinement_list_type list;
+    list.emplace_front(
+        std::make_shared<AbstractRefinement::refinement_key_type>(*(iter->first), iter->second),
+        static_cast<double>(iter->second));
+    return list;
+  }
+};
+
+BOOST_AUTO_TEST_CASE(TestGetIndicatorOverride) {
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  grid->getGenerator().regular(3);
+  GridStorage& storage = grid->getStorage();
+  const size_t size = storage.getSize();
+
+  // exactly the points with level sum 4 can be refined
+  std::vector<size_t> refinable;
+
+  for (size_t i = 0; i < size; i++) {
+    if (storage.getPoint(i).getLevelSum() == 4) {
+      refinable.push_back(i);
+    }
+  }
+
+  // the functor prefers the first refinable point, the refinement the last one
+  DataVector alpha(size, 0.0);
+  alpha[refinable.front()] = 1.0;
+  SurplusRefinementFunctor functor(alpha, 1);
+  SequenceNumberRefinement refinement;
+  refinement.free_refine(storage, functor);
+
+  BOOST_CHECK_EQUAL(refinement.numberOfCalls, refinable.size());
+  BOOST_CHECK(storage.getPoint(refinable.front()).isLeaf());
+  BOOST_CHECK(!storage.getPoint(refinable.back()).isLeaf());
+  BOOST_CHECK_GT(storage.getSize(), size);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,106 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixView.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataVectorView.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataMatrixView;
+using sgpp::base::DataVector;
+using sgpp::base::DataVectorView;
+
+BOOST_AUTO_TEST_SUITE(TestDataMatrixView)
+
+BOOST_AUTO_TEST_CASE(testDataVectorView) {
+  std::vector<double> data = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+
+  // every second element, starting at index 1
+  DataVectorView view(data.data() + 1, 3, 2);
+  BOOST_CHECK_EQUAL(view.getSize(), 3);
+  BOOST_CHECK(!view.isContiguous());
+  BOOST_CHECK_EQUAL(view[0], 1.0);
+  BOOST_CHECK_EQUAL(view.get(2), 5.0);
+
+  view.set(1, -3.0);
+  BOOST_CHECK_EQUAL(data[3], -3.0);
+
+  DataVector copy;
+  view.copyTo(copy);
+  BOOST_CHECK_EQUAL(copy.getSize(), 3);
+  BOOST_CHECK_EQUAL(copy[1], -3.0);
+  BOOST_CHECK_EQUAL(view.dotProduct(DataVector{1.0, 1.0, 1.0}), 3.0);
+
+  view.copyFrom(DataVector{7.0, 8.0, 9.0});
+  BOOST_CHECK_EQUAL(data[5], 9.0);
+  BOOST_CHECK_EQUAL(data[6], 6.0);
+  BOOST_CHECK_THROW(view.copyFrom(DataVector(2)), sgpp::base::data_exception);
+
+  // views of DataVectors share their memory
+  DataVector vector(4, 1.0);
+  DataVectorView vectorView(vector);
+  BOOST_CHECK(vectorView.isContiguous());
+  vectorView.setAll(2.0);
+  BOOST_CHECK_EQUAL(vector.sum(), 8.0);
+}
+
+BOOST_AUTO_TEST_CASE(testDataMatrixView) {
+  DataMatrix matrix(4, 3);
+
+  for (size_t i = 0; i < 4; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      matrix.set(i, j, static_cast<double>(10 * i + j));
+    }
+  }
+
+  DataMatrixView view(matrix);
+  BOOST_CHECK(view.isContiguous());
+  BOOST_CHECK_EQUAL(view.getNrows(), 4);
+  BOOST_CHECK_EQUAL(view.getNcols(), 3);
+  BOOST_CHECK_EQUAL(view.get(2, 1), 21.0);
+
+  // rows and columns are views into the matrix
+  DataVectorView row = view.getRowView(3);
+  BOOST_CHECK_EQUAL(row.get(2), 32.0);
+  DataVectorView column = view.getColumnView(1);
+  BOOST_CHECK_EQUAL(column.getStride(), 3);
+  column.set(0, -1.0);
+  BOOST_CHECK_EQUAL(matrix.get(0, 1), -1.0);
+
+  DataVector rowCopy(3);
+  view.getRow(1, rowCopy);
+  BOOST_CHECK_EQUAL(rowCopy[2], 12.0);
+  DataVector columnCopy(4);
+  view.getColumn(2, columnCopy);
+  BOOST_CHECK_EQUAL(columnCopy[3], 32.0);
+  BOOST_CHECK_THROW(view.getRow(0, columnCopy), sgpp::base::data_exception);
+
+  // block of rows without copying
+  DataMatrixView block = view.getRows(1, 2);
+  BOOST_CHECK_EQUAL(block.getNrows(), 2);
+  BOOST_CHECK_EQUAL(block.get(0, 0), 10.0);
+  BOOST_CHECK_EQUAL(block.get(1, 2), 22.0);
+  BOOST_CHECK_THROW(view.getRows(3, 2), sgpp::base::data_exception);
+
+  // transposed (column-major) view of the same memory
+  DataMatrixView transposed(matrix.getPointer(), 3, 4, 1, 3);
+  BOOST_CHECK(!transposed.isContiguous());
+  BOOST_CHECK_EQUAL(transposed.get(1, 2), 21.0);
+
+  DataMatrix copy;
+  transposed.copyTo(copy);
+  BOOST_CHECK_EQUAL(copy.getNrows(), 3);
+  BOOST_CHECK_EQUAL(copy.getNcols(), 4);
+  BOOST_CHECK_EQUAL(copy.get(2, 3), 32.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,9 +6,23 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixView.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/GridModelFile.hpp>
 
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
 using sgpp::base::Grid;
+using sgpp::base::GridModelFile;
 
 BOOST_AUTO_TEST_SUITE(test_Grid)
 
@@ -26,4 +40,68 @@ BOOST_AUTO_TEST_CASE(test_clone) {
   delete newGrid;
 }
 
+BOOST_AUTO_TEST_CASE(test_GridModelFile) {
+  const std::string filename = "test_GridModelFile.bin";
+  const size_t dim = 3;
+  std::unique_ptr<Grid> grid(Grid::createBsplineBoundaryGrid(dim, 3));
+  grid->getGenerator().regular(3);
+
+  sgpp::base::BoundingBox1D boundary(-1.0, 2.0);
+  grid->getBoundingBox().setBoundary(1, boundary);
+
+  const size_t numPoints = grid->getSize();
+  DataMatrix coefficients(numPoints, 2);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    coefficients.set(i, 0, static_cast<double>(i));
+    coefficients.set(i, 1, -0.5 * static_cast<double>(i));
+  }
+
+  GridModelFile::write(filename, *grid, coefficients);
+
+  // memory-mapped and bulk read have to give the same result
+  for (bool useMemoryMapping : {true, false}) {
+    GridModelFile model(filename, useMemoryMapping);
+    BOOST_CHECK_EQUAL(model.getDimension(), dim);
+    BOOST_CHECK_EQUAL(model.getNumberOfPoints(), numPoints);
+    BOOST_CHECK_EQUAL(model.getNumberOfColumns(), 2);
+
+    // same type, degree, bounding box, points (in the same order) and leaf properties
+    std::unique_ptr<Grid> loadedGrid(model.createGrid());
+    BOOST_CHECK_EQUAL(loadedGrid->serialize(), grid->serialize());
+    BOOST_CHECK_EQUAL(loadedGrid->getStorage().getSequenceNumber(grid->getStorage().getPoint(7)),
+                      7);
+
+    sgpp::base::DataMatrixView view = model.getCoefficients();
+    BOOST_CHECK_EQUAL(view.getNrows(), numPoints);
+    BOOST_CHECK_EQUAL(view.get(numPoints - 1, 1), coefficients.get(numPoints - 1, 1));
+
+    DataMatrix loadedCoefficients;
+    model.getCoefficients(loadedCoefficients);
+    BOOST_CHECK_EQUAL(loadedCoefficients.sum(), coefficients.sum());
+
+    DataVector vector;
+    BOOST_CHECK_THROW(model.getCoefficients(vector), sgpp::base::data_exception);
+  }
+
+  DataVector alpha(numPoints, 1.0);
+  GridModelFile::write(filename, *grid, alpha);
+  DataVector loadedAlpha;
+  GridModelFile(filename).getCoefficients(loadedAlpha);
+  BOOST_CHECK_EQUAL(loadedAlpha.getSize(), numPoints);
+  BOOST_CHECK_EQUAL(loadedAlpha.sum(), static_cast<double>(numPoints));
+
+  BOOST_CHECK_THROW(GridModelFile::write(filename, *grid, DataVector(numPoints + 1)),
+                    sgpp::base::data_exception);
+
+  // the text serialization is not a model file
+  {
+    std::ofstream fout(filename);
+    fout << grid->serialize();
+  }
+
+  BOOST_CHECK_THROW(GridModelFile model(filename), sgpp::base::file_exception);
+  std::remove(filename.c_str());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -7,13 +7,22 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataMatrixView.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalLinear.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalModLinear.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
 
 using sgpp::base::BoundingBox1D;
 using sgpp::base::DataMatrix;
+using sgpp::base::DataMatrixView;
 using sgpp::base::DataVector;
 using sgpp::base::Grid;
 using sgpp::base::GridStorage;
@@ -78,4 +87,85 @@ BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
   BOOST_CHECK_CLOSE(result[2], result_ref[2], 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalView) {
+  const size_t dim = 3;
+  const size_t numberDataPoints = 50;
+
+  // column-major storage with two extra rows that are not part of the dataset
+  const size_t ld = numberDataPoints + 2;
+  std::vector<double> storage(ld * dim);
+  DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < numberDataPoints; i++) {
+    for (size_t j = 0; j < dim; j++) {
+      const double x = std::fmod(0.37 * static_cast<double>(i + 1) * static_cast<double>(j + 2),
+                                 1.0);
+      dataset.set(i, j, x);
+      storage[j * ld + i + 1] = x;
+    }
+  }
+
+  DataMatrixView view(storage.data() + 1, numberDataPoints, dim, 1, ld);
+
+  for (auto gridFactory : {Grid::createLinearGrid, Grid::createModLinearGrid}) {
+    std::unique_ptr<Grid> grid(gridFactory(dim));
+    grid->getGenerator().regular(3);
+    const size_t N = grid->getSize();
+
+    DataVector alpha(N);
+
+    for (size_t i = 0; i < N; i++) {
+      alpha[i] = static_cast<double>(i % 7) - 3.0;
+    }
+
+    std::unique_ptr<OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+    std::unique_ptr<OperationMultipleEval> opView(
+        sgpp::op_factory::createOperationMultipleEval(*grid, view));
+
+    DataVector result(numberDataPoints);
+    DataVector resultView(numberDataPoints);
+    op->mult(alpha, result);
+    opView->mult(alpha, resultView);
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      BOOST_CHECK_EQUAL(result[i], resultView[i]);
+    }
+
+    DataVector source(numberDataPoints, 0.5);
+    DataVector resultTranspose(N);
+    DataVector resultTransposeView(N);
+    op->multTranspose(source, resultTranspose);
+    opView->multTranspose(source, resultTransposeView);
+
+    for (size_t i = 0; i < N; i++) {
+      BOOST_CHECK_CLOSE(resultTranspose[i], resultTransposeView[i], 1e-12);
+    }
+
+    // a copy has to stay valid after the original is destroyed
+    std::unique_ptr<OperationMultipleEval> opCopy;
+
+    if (grid->getType() == sgpp::base::GridType::Linear) {
+      opCopy.reset(new sgpp::base::OperationMultipleEvalLinear(
+          dynamic_cast<sgpp::base::OperationMultipleEvalLinear&>(*opView)));
+    } else {
+      opCopy.reset(new sgpp::base::OperationMultipleEvalModLinear(
+          dynamic_cast<sgpp::base::OperationMultipleEvalModLinear&>(*opView)));
+    }
+
+    opView.reset();
+    resultView.setAll(0.0);
+    opCopy->mult(alpha, resultView);
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      BOOST_CHECK_EQUAL(result[i], resultView[i]);
+    }
+  }
+
+  // views are only supported by some operations
+  std::unique_ptr<Grid> polyGrid(Grid::createPolyGrid(dim, 2));
+  BOOST_CHECK_THROW(sgpp::op_factory::createOperationMultipleEval(*polyGrid, view),
+                    sgpp::base::factory_exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -6,7 +6,10 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/exception/tool_exception.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/operation/hash/common/basis/PolyBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/PolyBoundaryBasis.hpp>
@@ -18,7 +21,9 @@
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
 #include <sgpp/base/tools/GaussLegendreQuadRule1D.hpp>
 #include <sgpp/base/tools/OperationQuadratureMC.hpp>
+#include <sgpp/base/tools/TensorProductQuadrature.hpp>
 
+#include <cmath>
 #include <vector>
 
 using sgpp::base::BoundingBox1D;
@@ -309,6 +314,42 @@ BOOST_AUTO_TEST_CASE(testQuadratureMC) {
   delete opMC;
 }
 
+BOOST_AUTO_TEST_CASE(testQuadratureMCStreaming) {
+  size_t dim = 2;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+  grid->getBoundingBox().setBoundary(0, BoundingBox1D(1.0, 3.0));
+
+  DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) alpha[i] = static_cast<double>(i % 5);
+
+  double resDirect =
+      std::unique_ptr<OperationQuadrature>(sgpp::op_factory::createOperationQuadrature(*grid))
+          ->doQuadrature(alpha);
+
+  OperationQuadratureMC opMC(*grid, 1000000);
+  opMC.setSeed(1234);
+  double resMC = opMC.doQuadratureStreaming(alpha);
+  BOOST_CHECK_EQUAL(opMC.getNumberOfUsedSamples(), 1000000);
+  BOOST_CHECK_SMALL(resMC - resDirect, 5.0 * opMC.getStandardError());
+
+  // repeated calls continue the random number sequence
+  double resNext = opMC.doQuadrature(alpha);
+  BOOST_CHECK_NE(resNext, resMC);
+  BOOST_CHECK_SMALL(resNext - resDirect, 5.0 * opMC.getStandardError());
+
+  // same seed, same samples
+  opMC.setSeed(opMC.getSeed());
+  BOOST_CHECK_CLOSE(opMC.doQuadrature(alpha), resMC, 1e-10);
+
+  // stop early once the standard error is small enough
+  double resTarget = opMC.doQuadratureStreaming(alpha, 0.05, 1000);
+  BOOST_CHECK_LT(opMC.getNumberOfUsedSamples(), 1000000);
+  BOOST_CHECK_LE(opMC.getStandardError(), 0.05);
+  BOOST_CHECK_SMALL(resTarget - resDirect, 0.25);
+}
+
 BOOST_AUTO_TEST_CASE(test_GaussQuadrature) {
   sgpp::base::GaussLegendreQuadRule1D quadRule1D;
 
@@ -510,3 +551,129 @@ BOOST_AUTO_TEST_CASE(testQuadratureModFundamentalSpline) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(testTensorProductQuadrature)
+
+// composite Gauss-Legendre rule on the unit cube, exact for the piecewise polynomial
+// basis functions of the test grids times polynomials of degree two
+double calcMomentGauss(Grid& grid, DataVector& alpha, sgpp::base::DataMatrix& bounds,
+                       size_t k) {
+  const size_t dim = grid.getDimension();
+  const size_t numCells = 32;
+  const size_t quadOrder = 5;
+  DataVector coordinates, weights;
+  sgpp::base::GaussLegendreQuadRule1D gauss;
+  gauss.getLevelPointsAndWeightsNormalized(quadOrder, coordinates, weights);
+
+  std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEvalNaive(grid));
+  const size_t numPoints1D = numCells * quadOrder;
+  size_t numPoints = 1;
+
+  for (size_t t = 0; t < dim; t++) numPoints *= numPoints1D;
+
+  DataVector point(dim);
+  double sum = 0.0;
+
+  for (size_t i = 0; i < numPoints; i++) {
+    double weight = 1.0;
+    size_t j = i;
+
+    for (size_t t = 0; t < dim; t++) {
+      const size_t cell = (j % numPoints1D) / quadOrder;
+      const size_t c = (j % numPoints1D) % quadOrder;
+      j /= numPoints1D;
+      point[t] = (static_cast<double>(cell) + coordinates[c]) / static_cast<double>(numCells);
+      const double x = bounds.get(t, 0) + (bounds.get(t, 1) - bounds.get(t, 0)) * point[t];
+      weight *= weights[c] / static_cast<double>(numCells) * std::pow(x, static_cast<double>(k));
+    }
+
+    sum += weight * opEval->eval(alpha, point);
+  }
+
+  return sum;
+}
+
+BOOST_AUTO_TEST_CASE(testMomentsPolyAndBspline) {
+  const size_t dim = 2;
+  const size_t level = 4;
+  const size_t deg = 3;
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.emplace_back(Grid::createPolyGrid(dim, deg));
+  grids.emplace_back(Grid::createModPolyGrid(dim, deg));
+  grids.emplace_back(Grid::createBsplineGrid(dim, deg));
+  grids.emplace_back(Grid::createModBsplineGrid(dim, deg));
+
+  sgpp::base::DataMatrix bounds(dim, 2);
+  bounds.set(0, 0, -1.0);
+  bounds.set(0, 1, 2.0);
+  bounds.set(1, 0, 0.5);
+  bounds.set(1, 1, 1.5);
+
+  for (auto& grid : grids) {
+    grid->getGenerator().regular(level);
+    const size_t N = grid->getSize();
+    DataVector alpha(N);
+
+    for (size_t i = 0; i < N; i++) alpha[i] = static_cast<double>(i % 7) - 3.0;
+
+    double firstMoment = std::unique_ptr<sgpp::base::OperationFirstMoment>(
+                             sgpp::op_factory::createOperationFirstMoment(*grid))
+                             ->doQuadrature(alpha, &bounds);
+    double secondMoment = std::unique_ptr<sgpp::base::OperationSecondMoment>(
+                              sgpp::op_factory::createOperationSecondMoment(*grid))
+                              ->doQuadrature(alpha, &bounds);
+    BOOST_CHECK_CLOSE(firstMoment, calcMomentGauss(*grid, alpha, bounds, 1), 1e-8);
+    BOOST_CHECK_CLOSE(secondMoment, calcMomentGauss(*grid, alpha, bounds, 2), 1e-8);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testComputeMoments) {
+  const size_t dim = 3;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+  const size_t N = grid->getSize();
+  DataVector alpha(N, 1.0);
+
+  // hat functions: integral h, first moment x_i h, second moment (x_i^2 + h^2 / 6) h
+  sgpp::base::TensorProductQuadrature quadrature(
+      grid->getStorage(), [](sgpp::base::level_t level, sgpp::base::index_t index,
+                             double* moments) {
+        const double h = 1.0 / static_cast<double>(1 << level);
+        const double x = static_cast<double>(index) * h;
+        moments[0] = h;
+        moments[1] = x * h;
+        moments[2] = (x * x + h * h / 6.0) * h;
+      });
+
+  // only the pairs (l, i) with odd i and l <= 4
+  BOOST_CHECK_EQUAL(quadrature.getNumberOfDistinctPairs(), 15);
+
+  double moments[3];
+  quadrature.computeMoments(alpha, nullptr, moments);
+  BOOST_CHECK_CLOSE(moments[0], std::unique_ptr<OperationQuadrature>(
+                                    sgpp::op_factory::createOperationQuadrature(*grid))
+                                    ->doQuadrature(alpha),
+                    1e-12);
+  BOOST_CHECK_CLOSE(moments[0], quadrature.quadrature(alpha), 1e-12);
+  BOOST_CHECK_CLOSE(moments[1], quadrature.firstMoment(alpha), 1e-12);
+  BOOST_CHECK_CLOSE(moments[2], quadrature.secondMoment(alpha), 1e-12);
+
+  // integrals given by the basis of the grid
+  sgpp::base::TensorProductQuadrature basisQuadrature(grid->getStorage(), grid->getBasis());
+  BOOST_CHECK_CLOSE(basisQuadrature.quadrature(alpha), moments[0], 1e-12);
+  BOOST_CHECK_THROW(basisQuadrature.firstMoment(alpha), sgpp::base::tool_exception);
+
+  // moments of the constant part on the unit cube, i.e., of the first grid point
+  DataVector unit(N, 0.0);
+  unit[0] = 1.0;
+  BOOST_CHECK_CLOSE(quadrature.firstMoment(unit), 0.125 * 0.125, 1e-12);
+  BOOST_CHECK_CLOSE(quadrature.secondMoment(unit), std::pow(0.5 * (0.25 + 0.25 / 6.0), 3), 1e-12);
+
+  BOOST_CHECK_THROW(quadrature.quadrature(DataVector(N + 1)), sgpp::base::application_exception);
+  BOOST_CHECK_THROW(sgpp::base::TensorProductQuadrature(
+                        grid->getStorage(),
+                        [](sgpp::base::level_t, sgpp::base::index_t, double*) {}, 4),
+                    sgpp::base::tool_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
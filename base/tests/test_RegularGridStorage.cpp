@@ -0,0 +1,226 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/generation_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashGenerator.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridIterator.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+#include <sgpp/base/grid/storage/regular/RegularGridStorage.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationHierarchisation.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::HashGenerator;
+using sgpp::base::HashGridIterator;
+using sgpp::base::HashGridPoint;
+using sgpp::base::HashGridStorage;
+using sgpp::base::OperationHierarchisation;
+using sgpp::base::RegularGridStorage;
+
+BOOST_AUTO_TEST_SUITE(TestRegularGridStorage)
+
+BOOST_AUTO_TEST_CASE(testRankUnrank) {
+  for (size_t dim = 1; dim <= 4; dim++) {
+    for (sgpp::base::level_t level = 1; level <= 5; level++) {
+      HashGridStorage hashStorage(dim);
+      HashGenerator().regular(hashStorage, level);
+      RegularGridStorage regularStorage(dim, level);
+      BOOST_CHECK_EQUAL(regularStorage.getSize(), hashStorage.getSize());
+
+      // ranks of the points of the hash storage are a permutation
+      std::vector<bool> found(regularStorage.getSize(), false);
+
+      for (size_t i = 0; i < hashStorage.getSize(); i++) {
+        const size_t seq = regularStorage.getSequenceNumber(hashStorage.getPoint(i));
+        BOOST_REQUIRE_LT(seq, regularStorage.getSize());
+        BOOST_CHECK(!found[seq]);
+        found[seq] = true;
+
+        HashGridPoint point(dim);
+        regularStorage.getPoint(seq, point);
+        BOOST_CHECK(point.equals(hashStorage.getPoint(i)));
+        BOOST_CHECK_EQUAL(point.isLeaf(), hashStorage.getPoint(i).isLeaf());
+        BOOST_CHECK_EQUAL(regularStorage.isLeaf(seq), hashStorage.getPoint(i).isLeaf());
+      }
+    }
+  }
+
+  RegularGridStorage regularStorage(2, 3);
+  HashGridPoint point(2);
+  point.set(0, 3, 1);
+  point.set(1, 2, 1);
+  BOOST_CHECK(!regularStorage.isContaining(point));
+  point.set(1, 1, 2);
+  BOOST_CHECK(!regularStorage.isContaining(point));
+  point.set(1, 1, 1);
+  BOOST_CHECK(regularStorage.isContaining(point));
+}
+
+BOOST_AUTO_TEST_CASE(testNavigation) {
+  const size_t dim = 3;
+  HashGridStorage hashStorage(dim);
+  RegularGridStorage regularStorage(dim, 4);
+  regularStorage.generate(hashStorage);
+
+  // generated storage uses the rank order
+  for (size_t seq = 0; seq < regularStorage.getSize(); seq++) {
+    BOOST_CHECK_EQUAL(hashStorage.getSequenceNumber(hashStorage.getPoint(seq)), seq);
+    BOOST_CHECK_EQUAL(regularStorage.getSequenceNumber(hashStorage.getPoint(seq)), seq);
+  }
+
+  // children and parents agree with the navigation in the hash storage
+  // (the hash storage reports missing points with sequence numbers greater than getSize())
+  HashGridIterator iterator(hashStorage);
+  const size_t size = regularStorage.getSize();
+  std::vector<RegularGridStorage::level_type> levels(dim);
+  std::vector<RegularGridStorage::index_type> indices(dim);
+
+  for (size_t seq = 0; seq < size; seq++) {
+    regularStorage.getPoint(seq, levels.data(), indices.data());
+    BOOST_CHECK_EQUAL(regularStorage.isLeaf(levels.data()), regularStorage.isLeaf(seq));
+
+    for (size_t d = 0; d < dim; d++) {
+      iterator.set(hashStorage.getPoint(seq));
+      iterator.leftChild(d);
+      BOOST_CHECK_EQUAL(regularStorage.getLeftChild(levels.data(), indices.data(), d),
+                        std::min(iterator.seq(), size));
+
+      iterator.set(hashStorage.getPoint(seq));
+      iterator.rightChild(d);
+      BOOST_CHECK_EQUAL(regularStorage.getRightChild(levels.data(), indices.data(), d),
+                        std::min(iterator.seq(), size));
+
+      if (hashStorage.getPoint(seq).getLevel(d) > 1) {
+        iterator.set(hashStorage.getPoint(seq));
+        iterator.up(d);
+        BOOST_CHECK_EQUAL(regularStorage.getParent(levels.data(), indices.data(), d),
+                          std::min(iterator.seq(), size));
+      } else {
+        BOOST_CHECK_EQUAL(regularStorage.getParent(levels.data(), indices.data(), d), size);
+      }
+
+      // ends of the support
+      HashGridPoint point(hashStorage.getPoint(seq));
+      const double h = 1.0 / static_cast<double>(1 << levels[d]);
+      const double x = point.getStandardCoordinate(d);
+      const size_t left = regularStorage.getLeftAncestor(levels.data(), indices.data(), d);
+      const size_t right = regularStorage.getRightAncestor(levels.data(), indices.data(), d);
+
+      if (indices[d] == 1) {
+        BOOST_CHECK_EQUAL(left, size);
+      } else {
+        BOOST_REQUIRE_LT(left, size);
+        BOOST_CHECK_CLOSE(hashStorage.getPoint(left).getStandardCoordinate(d), x - h, 1e-12);
+        BOOST_CHECK_LT(hashStorage.getPoint(left).getLevel(d), levels[d]);
+      }
+
+      if (indices[d] == (1u << levels[d]) - 1) {
+        BOOST_CHECK_EQUAL(right, size);
+      } else {
+        BOOST_REQUIRE_LT(right, size);
+        BOOST_CHECK_CLOSE(hashStorage.getPoint(right).getStandardCoordinate(d), x + h, 1e-12);
+        BOOST_CHECK_LT(hashStorage.getPoint(right).getLevel(d), levels[d]);
+      }
+    }
+
+    // the arrays are restored
+    HashGridPoint point(dim);
+    regularStorage.getPoint(seq, point);
+
+    for (size_t d = 0; d < dim; d++) {
+      BOOST_CHECK_EQUAL(levels[d], point.getLevel(d));
+      BOOST_CHECK_EQUAL(indices[d], point.getIndex(d));
+    }
+  }
+
+  DataMatrix level, index;
+  DataMatrix hashLevel(size, dim);
+  DataMatrix hashIndex(size, dim);
+  regularStorage.getLevelIndexArraysForEval(level, index);
+  hashStorage.getLevelIndexArraysForEval(hashLevel, hashIndex);
+  level.sub(hashLevel);
+  index.sub(hashIndex);
+  BOOST_CHECK_EQUAL(level.max(), 0.0);
+  BOOST_CHECK_EQUAL(index.max(), 0.0);
+  BOOST_CHECK_EQUAL(level.min(), 0.0);
+  BOOST_CHECK_EQUAL(index.min(), 0.0);
+
+  BOOST_CHECK_THROW(regularStorage.generate(hashStorage), sgpp::base::generation_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testHierarchisation) {
+  const size_t dim = 3;
+  const sgpp::base::level_t level = 5;
+
+  // the same grid in rank order and in the order of HashGenerator::regular
+  std::unique_ptr<Grid> regularGrid(Grid::createLinearGrid(dim));
+  RegularGridStorage regularStorage(dim, level);
+  regularStorage.generate(regularGrid->getStorage());
+  BOOST_CHECK(regularStorage.isRankOrdered(regularGrid->getStorage()));
+
+  std::unique_ptr<Grid> hashGrid(Grid::createLinearGrid(dim));
+  hashGrid->getGenerator().regular(level);
+  HashGridStorage& hashStorage = hashGrid->getStorage();
+  BOOST_CHECK(!regularStorage.isRankOrdered(hashStorage));
+
+  DataVector regularValues(regularStorage.getSize());
+  DataVector hashValues(hashStorage.getSize());
+
+  for (size_t i = 0; i < hashStorage.getSize(); i++) {
+    double value = 1.0;
+
+    for (size_t d = 0; d < dim; d++) {
+      const double x = hashStorage.getPoint(i).getStandardCoordinate(d);
+      value *= std::sin(3.0 * x) + x * x;
+    }
+
+    hashValues[i] = value;
+    regularValues[regularStorage.getSequenceNumber(hashStorage.getPoint(i))] = value;
+  }
+
+  std::unique_ptr<OperationHierarchisation>(
+      sgpp::op_factory::createOperationHierarchisation(*regularGrid))
+      ->doHierarchisation(regularValues);
+  std::unique_ptr<OperationHierarchisation>(
+      sgpp::op_factory::createOperationHierarchisation(*hashGrid))
+      ->doHierarchisation(hashValues);
+
+  for (size_t i = 0; i < hashStorage.getSize(); i++) {
+    BOOST_CHECK_CLOSE(regularValues[regularStorage.getSequenceNumber(hashStorage.getPoint(i))],
+                      hashValues[i], 1e-10);
+  }
+
+  // dehierarchisation is not affected
+  std::unique_ptr<OperationHierarchisation>(
+      sgpp::op_factory::createOperationHierarchisation(*regularGrid))
+      ->doDehierarchisation(regularValues);
+
+  for (size_t i = 0; i < hashStorage.getSize(); i++) {
+    double value = 1.0;
+
+    for (size_t d = 0; d < dim; d++) {
+      const double x = hashStorage.getPoint(i).getStandardCoordinate(d);
+      value *= std::sin(3.0 * x) + x * x;
+    }
+
+    BOOST_CHECK_CLOSE(regularValues[regularStorage.getSequenceNumber(hashStorage.getPoint(i))],
+                      value, 1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
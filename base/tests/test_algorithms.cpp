@@ -13,6 +13,7 @@
 #include <sgpp/base/operation/hash/common/basis/LinearClenshawCurtisBoundaryBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearStretchedBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/UniformBsplineKernel.hpp>
 
 #include <boost/test/unit_test.hpp>
 
@@ -341,6 +342,82 @@ void weaklyFundamentalSplineTest(SBasis& basis, bool modified = false) {
   }
 }
 
+double coxDeBoorBSpline(double x, size_t p) {
+  // Return value of uniform B-spline by Cox-de Boor recursion.
+  if ((x < 0.0) || (x >= static_cast<double>(p) + 1.0)) {
+    return 0.0;
+  } else if (p == 0) {
+    return 1.0;
+  }
+
+  const double pDbl = static_cast<double>(p);
+  return (x / pDbl) * coxDeBoorBSpline(x, p - 1) +
+         ((pDbl + 1.0 - x) / pDbl) * coxDeBoorBSpline(x - 1.0, p - 1);
+}
+
+template <size_t p>
+void uniformBsplineKernelTest() {
+  // Compare degree-templated kernel with Cox-de Boor recursion.
+  std::vector<double> points;
+
+  for (int j = -8; j <= 8 * static_cast<int>(p + 2); j++) {
+    points.push_back(static_cast<double>(j) / 8.0 + 0.01);
+    points.push_back(static_cast<double>(j) / 8.0);
+  }
+
+  points.push_back(std::numeric_limits<double>::infinity());
+  points.push_back(-std::numeric_limits<double>::infinity());
+
+  const size_t n = points.size();
+  std::vector<double> values(n), dxs(n), dxdxs(n), blockValues(n);
+  sgpp::base::UniformBsplineKernel<p>::evalBlock(points.data(), values.data(), dxs.data(),
+                                                 dxdxs.data(), n);
+  sgpp::base::UniformBsplineKernel<p>::evalBlock(points.data(), blockValues.data(), n);
+
+  for (size_t k = 0; k < n; k++) {
+    const double x = points[k];
+    const double value = coxDeBoorBSpline(x, p);
+    const double dx = ((p >= 1) ? coxDeBoorBSpline(x, p - 1) - coxDeBoorBSpline(x - 1.0, p - 1)
+                                : 0.0);
+    const double dxdx = ((p >= 2) ? coxDeBoorBSpline(x, p - 2) -
+                                        2.0 * coxDeBoorBSpline(x - 1.0, p - 2) +
+                                        coxDeBoorBSpline(x - 2.0, p - 2)
+                                  : 0.0);
+
+    double fusedValue, fusedDx, fusedDxDx;
+    sgpp::base::UniformBsplineKernel<p>::evalWithDerivatives(x, fusedValue, fusedDx, fusedDxDx);
+
+    BOOST_CHECK_SMALL(sgpp::base::UniformBsplineKernel<p>::eval(x) - value, 1e-12);
+    BOOST_CHECK_SMALL(fusedValue - value, 1e-12);
+    BOOST_CHECK_SMALL(fusedDx - dx, 1e-12);
+    BOOST_CHECK_SMALL(fusedDxDx - dxdx, 1e-12);
+    BOOST_CHECK_SMALL(blockValues[k] - value, 1e-12);
+    BOOST_CHECK_SMALL(values[k] - value, 1e-12);
+    BOOST_CHECK_SMALL(dxs[k] - dx, 1e-12);
+    BOOST_CHECK_SMALL(dxdxs[k] - dxdx, 1e-12);
+  }
+}
+
+template <class Basis>
+void evalWithDerivativesTest(Basis& basis) {
+  // Compare fused evaluation with separate evaluation of value and derivatives.
+  for (level_t l = 1; l <= 4; l++) {
+    const index_t hInv = static_cast<index_t>(1) << l;
+
+    for (index_t i = 1; i < hInv; i += 2) {
+      for (size_t j = 0; j <= 64; j++) {
+        const double x = static_cast<double>(j) / 64.0;
+        double value, dx, dxdx;
+        basis.evalWithDerivatives(l, i, x, value, dx, dxdx);
+
+        BOOST_CHECK_CLOSE(value, basis.eval(l, i, x), 1e-10);
+        BOOST_CHECK_CLOSE(dx, basis.evalDx(l, i, x), 1e-10);
+        BOOST_CHECK_CLOSE(dxdx, basis.evalDxDx(l, i, x), 1e-10);
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE(TestAlgorithms)
 
 BOOST_AUTO_TEST_CASE(TestLinearBasis) {
@@ -439,6 +516,25 @@ BOOST_AUTO_TEST_CASE(TestBsplineClenshawCurtisModifiedBasis) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(TestUniformBsplineKernel) {
+  // Test degree-templated uniform B-spline kernels and fused evaluation.
+  uniformBsplineKernelTest<0>();
+  uniformBsplineKernelTest<1>();
+  uniformBsplineKernelTest<2>();
+  uniformBsplineKernelTest<3>();
+  uniformBsplineKernelTest<4>();
+  uniformBsplineKernelTest<5>();
+  uniformBsplineKernelTest<6>();
+  uniformBsplineKernelTest<7>();
+
+  for (size_t p = 1; p <= 11; p += 2) {
+    sgpp::base::SBsplineBase basis(p);
+    evalWithDerivativesTest(basis);
+    sgpp::base::SBsplineModifiedBase modifiedBasis(p);
+    evalWithDerivativesTest(modifiedBasis);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(TestFundamentalNakSplineBasis) {
   // Test fundamental not-a-knot spline basis.
   const size_t pMax = 5;
@@ -5,13 +5,118 @@
 
 import unittest, sys
 
+import numpy as np
+
+from pysgpp import Grid, DataVector, DataVectorView, DataMatrixView, \
+                   createOperationEval, createOperationMultipleEval
+
 import refinement_strategy.testsuite as refinement_strategy_tests
 #import refinement_functor.testsuite as refinement_functor_tests
 
+
+class TestDataView(unittest.TestCase):
+
+    """ Test the numpy typemaps of DataVectorView and DataMatrixView.
+
+    The views have to share the memory of the numpy arrays instead of
+    copying them.
+    """
+
+    def setUp(self):
+        self.grid = Grid.createLinearGrid(2)
+        self.grid.getGenerator().regular(3)
+        self.alpha = DataVector(self.grid.getSize())
+        for i in range(self.alpha.getSize()):
+            self.alpha.set(i, 1.0 + 0.5 * i)
+
+    def evalReference(self, x):
+        point = DataVector(len(x))
+        for d in range(len(x)):
+            point.set(d, float(x[d]))
+        return createOperationEval(self.grid).eval(self.alpha, point)
+
+    def checkMult(self, op, X):
+        result = DataVector(X.shape[0])
+        op.mult(self.alpha, result)
+        for i in range(X.shape[0]):
+            self.assertAlmostEqual(result.get(i), self.evalReference(X[i]))
+
+    def test_vectorView(self):
+        x = np.array([0.1, 0.2, 0.3])
+        view = DataVectorView(x)
+        self.assertEqual(view.getSize(), 3)
+
+        # writing through the view changes the array and vice versa
+        view.set(1, 0.7)
+        self.assertEqual(x[1], 0.7)
+        x[2] = 0.9
+        self.assertEqual(view.get(2), 0.9)
+
+        point = np.array([0.3, 0.6])
+        self.assertAlmostEqual(createOperationEval(self.grid).eval(self.alpha, point),
+                               self.evalReference(point))
+
+    def test_matrixView(self):
+        X = np.array([[0.1, 0.2], [0.3, 0.7], [0.9, 0.4]])
+        view = DataMatrixView(X)
+        self.assertEqual(view.getNrows(), 3)
+        self.assertEqual(view.getNcols(), 2)
+
+        view.set(2, 1, 0.5)
+        self.assertEqual(X[2, 1], 0.5)
+        X[0, 0] = 0.25
+        self.assertEqual(view.get(0, 0), 0.25)
+
+        # Fortran order is viewed without copying as well
+        F = np.asfortranarray(X)
+        viewF = DataMatrixView(F)
+        F[1, 0] = 0.6
+        self.assertEqual(viewF.get(1, 0), 0.6)
+
+    def test_multipleEval(self):
+        X = np.array([[0.1, 0.2], [0.3, 0.7], [0.9, 0.4]])
+        op = createOperationMultipleEval(self.grid, X)
+        self.checkMult(op, X)
+
+        # the operation evaluates the current content of the array
+        X[1, 0] = 0.6
+        X[2, 1] = 0.1
+        self.checkMult(op, X)
+
+        F = np.asfortranarray(X)
+        opF = createOperationMultipleEval(self.grid, F)
+        F[0, 1] = 0.8
+        self.checkMult(opF, F)
+
+    def assertRejected(self, f, *args):
+        # overload resolution fails with a NotImplementedError in older SWIG versions
+        self.assertRaises((TypeError, NotImplementedError), f, *args)
+
+    def test_rejectedArrays(self):
+        X = np.array([[0.1, 0.2, 0.3], [0.3, 0.7, 0.5], [0.9, 0.4, 0.2]])
+
+        # non-contiguous
+        self.assertRejected(DataMatrixView, X[:, ::2])
+        self.assertRejected(DataMatrixView, X[::2, :])
+        self.assertRejected(DataVectorView, X[:, 0])
+        self.assertRejected(createOperationMultipleEval, self.grid, X[:, 1:])
+
+        # misaligned
+        buf = np.zeros(4 * 8 + 1, dtype=np.uint8)
+        misaligned = np.frombuffer(buf.data, dtype=np.float64, count=4, offset=1)
+        self.assertFalse(misaligned.flags.aligned)
+        self.assertRejected(DataVectorView, misaligned)
+        self.assertRejected(DataMatrixView, misaligned.reshape(2, 2))
+
+        # wrong type
+        self.assertRejected(DataVectorView, np.array([1, 2, 3], dtype=np.int64))
+
+
 if __name__ == '__main__':
     alltests = unittest.TestSuite([
             unittest.defaultTestLoader.suiteClass(refinement_strategy_tests.alltests),
             #unittest.defaultTestLoader.suiteClass(refinement_functor_tests.alltests),
+            unittest.defaultTestLoader.loadTestsFromTestCase(TestDataView),
             ])
 
     result = unittest.TextTestRunner(verbosity=9).run(alltests)
@@ -6,15 +6,33 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/exception/tool_exception.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
+#include <sgpp/base/tools/MonteCarloEstimator.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/RandomNumberGenerator.hpp>
+#include <sgpp/base/tools/ScatterReduction.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
 #include <sgpp/base/tools/sle/system/FullSLE.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <sstream>
 #include <string>
 #include <vector>
 
+using sgpp::base::CPUFeatures;
+using sgpp::base::InstructionSet;
+using sgpp::base::MonteCarloEstimator;
 using sgpp::base::Printer;
 using sgpp::base::RandomNumberGenerator;
+using sgpp::base::ScatterReduction;
+using sgpp::base::Tracer;
+using sgpp::base::TracingCounter;
+using sgpp::base::TracingScope;
+using sgpp::base::TracingSummaryEntry;
 
 double calculateMean(std::vector<double>& x) {
   double mean = 0.0;
@@ -124,3 +142,191 @@ BOOST_AUTO_TEST_CASE(TestRandomNumberGenerator) {
     BOOST_CHECK_SMALL(calculateVariance(numbers) - (kDbl * kDbl - 1.0) / 12.0, 0.01 * kDbl * kDbl);
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestCPUFeatures) {
+  const std::vector<InstructionSet> instructionSets = {
+      InstructionSet::GENERIC, InstructionSet::SSE3, InstructionSet::AVX, InstructionSet::AVX2,
+      InstructionSet::AVX512};
+
+  for (InstructionSet instructionSet : instructionSets) {
+    BOOST_CHECK(CPUFeatures::fromString(CPUFeatures::toString(instructionSet)) == instructionSet);
+    BOOST_CHECK_EQUAL(CPUFeatures::isSupported(instructionSet),
+                      instructionSet <= CPUFeatures::getHostInstructionSet());
+  }
+
+  BOOST_CHECK(CPUFeatures::fromString("AVX2") == InstructionSet::AVX2);
+  BOOST_CHECK_THROW(CPUFeatures::fromString("neon"), sgpp::base::tool_exception);
+
+  // this test binary runs on the host, hence everything it was compiled for is supported
+  BOOST_CHECK(CPUFeatures::isSupported(SGPP_COMPILED_INSTRUCTION_SET));
+
+#if defined(SGPP_KERNEL_DISPATCH) && !defined(_WIN32)
+  // the override limits the selection, but never exceeds the host's capabilities
+  for (InstructionSet instructionSet : instructionSets) {
+    setenv("SGPP_INSTRUCTION_SET", CPUFeatures::toString(instructionSet).c_str(), 1);
+    BOOST_CHECK(CPUFeatures::getKernelInstructionSet() ==
+                std::min(instructionSet, CPUFeatures::getHostInstructionSet()));
+  }
+
+  unsetenv("SGPP_INSTRUCTION_SET");
+  BOOST_CHECK(CPUFeatures::getKernelInstructionSet() == CPUFeatures::getHostInstructionSet());
+#else
+  BOOST_CHECK(CPUFeatures::getKernelInstructionSet() == SGPP_COMPILED_INSTRUCTION_SET);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(TestScatterReduction) {
+  const size_t n = 1000;
+  const size_t m = 20000;
+  sgpp::base::DataVector expected(n, 1.0);
+  sgpp::base::DataVector result(n, 1.0);
+
+  for (size_t j = 0; j < m; j++) {
+    expected[(j * 7919) % n] += static_cast<double>(j % 13);
+  }
+
+  // small blocks and buffers to exercise repeated flushes and many locks
+  ScatterReduction reduction(result, 16, 100);
+
+#pragma omp parallel
+  {
+    ScatterReduction::Buffer buffer(reduction);
+
+#pragma omp for
+    for (size_t j = 0; j < m; j++) {
+      buffer.add((j * 7919) % n, static_cast<double>(j % 13));
+    }
+  }
+
+  // all contributions are integers, hence the order of summation does not matter
+  for (size_t i = 0; i < n; i++) {
+    BOOST_CHECK_EQUAL(result[i], expected[i]);
+  }
+
+  BOOST_CHECK_THROW(ScatterReduction(result, 0), sgpp::base::tool_exception);
+}
+
+BOOST_AUTO_TEST_CASE(TestMonteCarloEstimator) {
+  // large offset, where the variance by the sum of squares would be lost completely
+  const size_t n = 100000;
+  std::vector<double> values(n);
+
+  for (size_t i = 0; i < n; i++) {
+    values[i] = 1e9 + static_cast<double>(i % 10);
+  }
+
+  MonteCarloEstimator estimator;
+
+  for (size_t i = 0; i < n; i += 999) {
+    estimator.addBlock(&values[i], std::min<size_t>(999, n - i));
+  }
+
+  BOOST_CHECK_EQUAL(estimator.getNumberOfSamples(), n);
+  BOOST_CHECK_CLOSE(estimator.getMean(), 1e9 + 4.5, 1e-12);
+  BOOST_CHECK_CLOSE(estimator.getVariance(), 8.25 * n / (n - 1.0), 1e-6);
+
+  // streaming estimate with a deterministic block function
+  auto blockFunction = [](size_t block, sgpp::base::DataMatrix& points,
+                          sgpp::base::DataVector& values) {
+    std::mt19937_64 rng = MonteCarloEstimator::createBlockGenerator(42, block);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    for (size_t i = 0; i < points.getNrows(); i++) {
+      values[i] = 0.0;
+
+      for (size_t d = 0; d < points.getNcols(); d++) {
+        points.set(i, d, distribution(rng));
+        values[i] += points.get(i, d);
+      }
+    }
+  };
+
+  MonteCarloEstimator full = MonteCarloEstimator::estimate(3, 100001, 1000, 0.0, blockFunction);
+  BOOST_CHECK_EQUAL(full.getNumberOfSamples(), 100001);
+  BOOST_CHECK_CLOSE(full.getMean(), 1.5, 1.0);
+  BOOST_CHECK_CLOSE(full.getVariance(), 0.25, 2.0);
+  BOOST_CHECK_CLOSE(full.getStandardError(), std::sqrt(0.25 / 100001.0), 2.0);
+
+  // the samples do not depend on the number of threads, only the summation order does
+  MonteCarloEstimator again = MonteCarloEstimator::estimate(3, 100001, 1000, 0.0, blockFunction);
+  BOOST_CHECK_CLOSE(again.getMean(), full.getMean(), 1e-12);
+
+  MonteCarloEstimator early = MonteCarloEstimator::estimate(3, 100001, 1000, 0.01, blockFunction);
+  BOOST_CHECK_LT(early.getNumberOfSamples(), full.getNumberOfSamples());
+  BOOST_CHECK_LE(early.getStandardError(), 0.01);
+
+  BOOST_CHECK_THROW(MonteCarloEstimator::estimate(3, 10, 0, 0.0, blockFunction),
+                    sgpp::base::tool_exception);
+}
+
+BOOST_AUTO_TEST_CASE(TestTracer) {
+  Tracer& tracer = Tracer::getInstance();
+  tracer.clear();
+  const size_t n = 1000;
+
+  // nested scopes include the counter increments of inner scopes in the same thread
+  {
+    TracingScope outer("testOuter");
+    Tracer::count(TracingCounter::Flops, 10);
+
+    for (size_t i = 0; i < 3; i++) {
+      TracingScope inner("testInner");
+      Tracer::count(TracingCounter::Flops, 1);
+      Tracer::count(TracingCounter::HashLookups, 2);
+    }
+  }
+
+  // per-thread buffers
+#pragma omp parallel
+  {
+    TracingScope parallel("testParallel");
+
+#pragma omp for
+    for (size_t i = 0; i < n; i++) {
+      Tracer::count(TracingCounter::BytesStreamed, 8);
+    }
+  }
+
+  // nothing is recorded if tracing is disabled at runtime
+  Tracer::setEnabled(false);
+  {
+    TracingScope disabled("testDisabled");
+    Tracer::count(TracingCounter::Flops, 100);
+  }
+  Tracer::setEnabled(true);
+
+  std::vector<TracingSummaryEntry> summary = tracer.getSummary();
+  BOOST_REQUIRE_EQUAL(summary.size(), 3);
+
+  for (const TracingSummaryEntry& entry : summary) {
+    if (entry.name == "testOuter") {
+      BOOST_CHECK_EQUAL(entry.calls, 1);
+      BOOST_CHECK_EQUAL(entry.counters[static_cast<size_t>(TracingCounter::Flops)], 13);
+      BOOST_CHECK_EQUAL(entry.counters[static_cast<size_t>(TracingCounter::HashLookups)], 6);
+    } else if (entry.name == "testInner") {
+      BOOST_CHECK_EQUAL(entry.calls, 3);
+      BOOST_CHECK_EQUAL(entry.counters[static_cast<size_t>(TracingCounter::Flops)], 3);
+    } else {
+      BOOST_CHECK_EQUAL(entry.name, "testParallel");
+      BOOST_CHECK_EQUAL(entry.counters[static_cast<size_t>(TracingCounter::BytesStreamed)],
+                        8 * n);
+    }
+
+    BOOST_CHECK_GE(entry.time, 0.0);
+  }
+
+  std::vector<uint64_t> counters = tracer.getCounters();
+  BOOST_CHECK_EQUAL(counters[static_cast<size_t>(TracingCounter::Flops)], 13);
+  BOOST_CHECK_EQUAL(counters[static_cast<size_t>(TracingCounter::BytesStreamed)], 8 * n);
+
+  std::ostringstream trace;
+  tracer.writeChromeTrace(trace);
+  BOOST_CHECK_NE(trace.str().find("\"traceEvents\""), std::string::npos);
+  BOOST_CHECK_NE(trace.str().find("\"name\": \"testInner\", \"cat\": \"sgpp\", \"ph\": \"X\""),
+                 std::string::npos);
+  BOOST_CHECK_EQUAL(trace.str().find("testDisabled"), std::string::npos);
+
+  tracer.clear();
+  BOOST_CHECK(tracer.getSummary().empty());
+  BOOST_CHECK_EQUAL(tracer.getCounters()[static_cast<size_t>(TracingCounter::Flops)], 0);
+}
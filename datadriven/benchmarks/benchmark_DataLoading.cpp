@@ -0,0 +1,86 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/Benchmark.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <random>
+#include <sstream>
+#include <string>
+
+using sgpp::base::BenchmarkState;
+
+namespace {
+
+/**
+ * Generates a synthetic dataset (reproducible, uniform random values) in ARFF or CSV format,
+ * such that no dataset files are needed.
+ */
+std::string generateDataset(size_t numberOfInstances, size_t dim, bool arff) {
+  std::ostringstream stream;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  stream.precision(17);
+
+  if (arff) {
+    stream << "@RELATION \"benchmark\"\n\n";
+
+    for (size_t t = 0; t < dim; t++) {
+      stream << "@ATTRIBUTE x" << t << " NUMERIC\n";
+    }
+
+    stream << "@ATTRIBUTE class NUMERIC\n\n@DATA\n";
+  }
+
+  for (size_t i = 0; i < numberOfInstances; i++) {
+    for (size_t t = 0; t <= dim; t++) {
+      stream << ((t > 0) ? "," : "") << distribution(generator);
+    }
+
+    stream << "\n";
+  }
+
+  return stream.str();
+}
+
+void benchmarkReadARFF(BenchmarkState& state) {
+  const std::string content = generateDataset(static_cast<size_t>(state.range(0)),
+                                              static_cast<size_t>(state.range(1)), true);
+
+  while (state.keepRunning()) {
+    sgpp::datadriven::Dataset dataset = sgpp::datadriven::ARFFTools::readARFFFromString(content);
+    sgpp::base::doNotOptimize(dataset.getNumberInstances());
+  }
+
+  state.setItemsProcessed(static_cast<size_t>(state.range(0)) * state.getMaxIterations());
+  state.setLabel("bytes=" + std::to_string(content.size()));
+}
+
+void benchmarkReadCSV(BenchmarkState& state) {
+  const std::string content = generateDataset(static_cast<size_t>(state.range(0)),
+                                              static_cast<size_t>(state.range(1)), false);
+
+  while (state.keepRunning()) {
+    std::istringstream stream(content);
+    sgpp::datadriven::Dataset dataset = sgpp::datadriven::CSVTools::readCSV(stream);
+    sgpp::base::doNotOptimize(dataset.getNumberInstances());
+  }
+
+  state.setItemsProcessed(static_cast<size_t>(state.range(0)) * state.getMaxIterations());
+  state.setLabel("bytes=" + std::to_string(content.size()));
+}
+
+}  // namespace
+
+SGPP_BENCHMARK(benchmarkReadARFF)
+    ->argNames({"instances", "dim"})
+    ->argsProduct({{1000, 100000}, {2, 10}});
+SGPP_BENCHMARK(benchmarkReadCSV)
+    ->argNames({"instances", "dim"})
+    ->argsProduct({{1000, 100000}, {2, 10}});
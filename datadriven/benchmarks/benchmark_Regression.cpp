@@ -0,0 +1,74 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/tools/Benchmark.hpp>
+#include <sgpp/datadriven/algorithm/DMSystemMatrix.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+
+using sgpp::base::BenchmarkState;
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+
+namespace {
+
+/// macro benchmark: regularized least squares regression (system setup and CG solution)
+void benchmarkLeastSquaresRegression(BenchmarkState& state) {
+  const size_t dim = static_cast<size_t>(state.range(0));
+  const size_t numberOfInstances = static_cast<size_t>(state.range(2));
+  std::unique_ptr<Grid> grid(Grid::createModLinearGrid(dim));
+  grid->getGenerator().regular(static_cast<size_t>(state.range(1)));
+
+  DataMatrix trainData(numberOfInstances, dim);
+  DataVector targets(numberOfInstances);
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (size_t i = 0; i < numberOfInstances; i++) {
+    targets[i] = 1.0;
+
+    for (size_t t = 0; t < dim; t++) {
+      trainData(i, t) = distribution(generator);
+      targets[i] *= std::sin(3.0 * trainData(i, t));
+    }
+  }
+
+  size_t cgIterations = 0;
+
+  while (state.keepRunning()) {
+    std::shared_ptr<sgpp::base::OperationMatrix> opIdentity(
+        sgpp::op_factory::createOperationIdentity(*grid));
+    sgpp::datadriven::DMSystemMatrix systemMatrix(*grid, trainData, opIdentity, 1e-4);
+    DataVector b(grid->getSize());
+    DataVector alpha(grid->getSize());
+    systemMatrix.generateb(targets, b);
+    sgpp::solver::ConjugateGradients cg(200, 1e-6);
+    cg.solve(systemMatrix, alpha, b, false, false);
+    cgIterations = cg.getNumberIterations();
+  }
+
+  state.setItemsProcessed(numberOfInstances * state.getMaxIterations());
+  state.setLabel("N=" + std::to_string(grid->getSize()) +
+                 " cgIterations=" + std::to_string(cgIterations));
+}
+
+}  // namespace
+
+SGPP_BENCHMARK(benchmarkLeastSquaresRegression)
+    ->argNames({"dim", "level", "instances"})
+    ->args({2, 6, 2000})
+    ->args({5, 3, 2000});
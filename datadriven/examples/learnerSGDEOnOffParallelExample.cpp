@@ -16,6 +16,7 @@
 #include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/tools/SGppStopwatch.hpp>
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/LearnerSGDEOnOffParallel.hpp>
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/LoadAwareScheduler.hpp>
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/MPIMethods.hpp>
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/RoundRobinScheduler.hpp>
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
@@ -200,8 +201,9 @@ int main(int argc, char *argv[]) {
   size_t batchSize = 0;
   parseInputValue(argv[3], batchSize);
 
-  // Create the MPI Task Scheduling using the round robin algorithm
-  sgpp::datadriven::RoundRobinScheduler scheduler(batchSize);
+  // Create the MPI Task Scheduling, which assigns batches to the least loaded worker
+  // (use sgpp::datadriven::RoundRobinScheduler for strict rotation)
+  sgpp::datadriven::LoadAwareScheduler scheduler(batchSize);
 
   /**
    * Create the learner.
@@ -0,0 +1,134 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/*
+ * Compares the data-resident MPI MultiEval-operation with the serial one on random data.
+ * Run with, e.g., "mpirun -np 4 ./multiEvalDistributedMPI".
+ */
+
+#ifdef USE_MPI
+
+#define MPICH_SKIP_MPICXX
+#include <mpi.h>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalMPI/OperationMultiEvalMPIDistributed.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+
+double maxError(const sgpp::base::DataVector& v1, const sgpp::base::DataVector& v2) {
+  double error = 0.0;
+
+  for (size_t i = 0; i < v1.getSize(); i++) {
+    error = std::max(error, std::abs(v1[i] - v2[i]));
+  }
+
+  return error;
+}
+
+int main(int argc, char** argv) {
+  MPI_Init(&argc, &argv);
+
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  const size_t dim = 4;
+  const size_t level = 5;
+  const size_t numData = 10000;
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(level);
+
+  // every rank creates the same data set, the coefficients are broadcast from rank 0
+  std::mt19937 mt(42);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  sgpp::base::DataMatrix dataset(numData, dim);
+
+  for (size_t i = 0; i < numData; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(i, d, dist(mt));
+    }
+  }
+
+  sgpp::base::DataVector alpha(grid->getSize());
+  sgpp::base::DataVector source(numData);
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = dist(mt);
+  }
+
+  for (size_t i = 0; i < numData; i++) {
+    source[i] = dist(mt);
+  }
+
+  std::unique_ptr<sgpp::base::OperationMultipleEval> serialEval(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+  sgpp::base::DataVector serialResult(numData);
+  sgpp::base::DataVector serialTransposedResult(grid->getSize());
+  serialEval->mult(alpha, serialResult);
+  serialEval->multTranspose(source, serialTransposedResult);
+
+  for (bool overlap : {false, true}) {
+    sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+        sgpp::datadriven::OperationMultipleEvalType::DEFAULT,
+        sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT,
+        sgpp::datadriven::OperationMultipleEvalMPIType::NONE, "DEFAULT");
+    std::unique_ptr<sgpp::base::OperationMultipleEval> distributedEval;
+
+    if (overlap) {
+      distributedEval.reset(new sgpp::datadriven::OperationMultiEvalMPIDistributed(
+          *grid, dataset, configuration, true));
+    } else {
+      sgpp::datadriven::OperationMultipleEvalConfiguration distributedConfiguration(
+          sgpp::datadriven::OperationMultipleEvalType::DEFAULT,
+          sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT,
+          sgpp::datadriven::OperationMultipleEvalMPIType::DISTRIBUTED, "DEFAULT");
+      distributedEval.reset(
+          sgpp::op_factory::createOperationMultipleEval(*grid, dataset, distributedConfiguration));
+    }
+
+    sgpp::base::DataVector result(numData);
+    sgpp::base::DataVector transposedResult(grid->getSize());
+    distributedEval->mult(alpha, result);
+    double multDuration = distributedEval->getDuration();
+    distributedEval->multTranspose(source, transposedResult);
+    double multTransposeDuration = distributedEval->getDuration();
+
+    if (rank == 0) {
+      std::cout << "ranks: " << size << ", overlap: " << overlap << std::endl;
+      std::cout << "mult:          max error " << maxError(result, serialResult) << ", duration "
+                << multDuration << "s" << std::endl;
+      std::cout << "multTranspose: max error "
+                << maxError(transposedResult, serialTransposedResult) << ", duration "
+                << multTransposeDuration << "s" << std::endl;
+    }
+  }
+
+  MPI_Finalize();
+  return 0;
+}
+
+#else
+
+#include <iostream>
+
+int main(int argc, char** argv) {
+  std::cout << "error: build with MPI to enable this example" << std::endl;
+  return 0;
+}
+
+#endif
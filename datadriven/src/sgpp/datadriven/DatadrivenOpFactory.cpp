@@ -6,6 +6,7 @@
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 
 #include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
 
 #include <sgpp/base/grid/type/ModBsplineGrid.hpp>
 #include <sgpp/base/grid/type/ModPolyGrid.hpp>
@@ -87,7 +88,10 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationTestPrewavelet.hpp>
 
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalModMaskStreaming/OperationMultiEvalModMaskStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalMortonOrder/OperationMultiEvalMortonOrder.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBSpline/OperationMultiEvalStreamingBSpline.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingPoly/OperationMultiEvalStreamingPoly.hpp>
 
 #ifdef __AVX__
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/combined/OperationMultipleEvalSubspaceCombined.hpp>
@@ -108,6 +112,7 @@
 
 #ifdef USE_MPI
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalMPI/OperationMultiEvalMPI.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalMPI/OperationMultiEvalMPIDistributed.hpp>
 #endif
 
 #ifdef USE_HPX
@@ -409,6 +414,7 @@ datadriven::OperationDensityConditionalKDE* createOperationDensityConditionalKDE
 base::OperationMultipleEval* createOperationMultipleEval(
     base::Grid& grid, base::DataMatrix& dataset,
     sgpp::datadriven::OperationMultipleEvalConfiguration& configuration) {
+  SGPP_TRACE_SCOPE("datadriven::op_factory::createOperationMultipleEval");
   if (configuration.getMPIType() == sgpp::datadriven::OperationMultipleEvalMPIType::MASTERSLAVE) {
 #ifdef USE_MPI
     if (grid.getType() == base::GridType::Linear) {
@@ -419,6 +425,15 @@ base::OperationMultipleEval* createOperationMultipleEval(
 #else
     throw base::factory_exception(
         "Error creating function: the library wasn't compiled with MPI support");
+#endif
+  } else if (configuration.getMPIType() ==
+             sgpp::datadriven::OperationMultipleEvalMPIType::DISTRIBUTED) {
+#ifdef USE_MPI
+    // every rank evaluates its shard with the node-local operation of the configuration
+    return new datadriven::OperationMultiEvalMPIDistributed(grid, dataset, configuration);
+#else
+    throw base::factory_exception(
+        "Error creating function: the library wasn't compiled with MPI support");
 #endif
   } else if (configuration.getMPIType() == sgpp::datadriven::OperationMultipleEvalMPIType::HPX) {
 #ifdef USE_HPX
@@ -456,18 +471,21 @@ base::OperationMultipleEval* createOperationMultipleEval(
 #ifdef __AVX__
         return new datadriven::OperationMultipleEvalSubspaceCombined(grid, dataset);
 #else
-        throw base::factory_exception(
-            "Error creating function: the library wasn't compiled with AVX");
+        // the subspace kernels are AVX-only, use the runtime-dispatched streaming kernels instead
+        return new datadriven::OperationMultiEvalStreaming(grid, dataset);
 #endif
       } else if (configuration.getSubType() ==
                  sgpp::datadriven::OperationMultipleEvalSubType::SIMPLE) {
 #ifdef __AVX__
         return new datadriven::OperationMultipleEvalSubspaceSimple(grid, dataset);
 #else
-        throw base::factory_exception(
-            "Error creating function: the library wasn't compiled with AVX");
+        return new datadriven::OperationMultiEvalStreaming(grid, dataset);
 #endif
       }
+    } else if (configuration.getType() == datadriven::OperationMultipleEvalType::MORTONORDER) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalMortonOrder(grid, dataset);
+      }
     } else if (configuration.getType() == datadriven::OperationMultipleEvalType::SCALAPACK) {
 #ifdef USE_SCALAPACK
       return new datadriven::OperationMultipleEvalLinearDistributed(grid, dataset);
@@ -507,6 +525,10 @@ base::OperationMultipleEval* createOperationMultipleEval(
             "Error creating function: the library wasn't compiled with OpenCL support");
 #endif
       }
+    } else if (configuration.getType() == datadriven::OperationMultipleEvalType::MORTONORDER) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalMortonOrder(grid, dataset);
+      }
     } else if (configuration.getType() == datadriven::OperationMultipleEvalType::SCALAPACK) {
 #ifdef USE_SCALAPACK
       return new datadriven::OperationMultipleEvalModLinearDistributed(grid, dataset);
@@ -517,6 +539,9 @@ base::OperationMultipleEval* createOperationMultipleEval(
     }
   } else if (grid.getType() == base::GridType::Bspline) {
     if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalStreamingBSpline(grid, dataset);
+      }
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::OCL) {
 #ifdef USE_OCL
         return datadriven::createStreamingBSplineOCLConfigured(grid, dataset, configuration);
@@ -526,8 +551,21 @@ base::OperationMultipleEval* createOperationMultipleEval(
 #endif
       }
     }
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING &&
+        configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+      return new datadriven::OperationMultiEvalStreamingBSpline(grid, dataset);
+    }
+  } else if (grid.getType() == base::GridType::ModPoly) {
+    if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING &&
+        configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+      return new datadriven::OperationMultiEvalStreamingPoly(grid, dataset);
+    }
   } else if (grid.getType() == base::GridType::Poly) {
-    if (configuration.getType() == datadriven::OperationMultipleEvalType::DEFAULT) {
+    if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING &&
+        configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+      return new datadriven::OperationMultiEvalStreamingPoly(grid, dataset);
+    } else if (configuration.getType() == datadriven::OperationMultipleEvalType::DEFAULT) {
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::CUDA) {
 #ifdef USE_CUDA
         return new datadriven::OperationMultiEvalCuda(grid, dataset, grid.getDegree(), false);
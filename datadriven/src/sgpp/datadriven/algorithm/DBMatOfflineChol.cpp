@@ -6,6 +6,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
 
 #include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
 #include <sgpp/datadriven/algorithm/DBMatDMSChol.hpp>
 
 #ifdef USE_GSL
@@ -18,7 +19,6 @@
 #endif /* USE_GSL */
 
 #include <algorithm>
-#include <chrono>
 #include <iomanip>
 #include <string>
 #include <vector>
@@ -50,9 +50,10 @@ void DBMatOfflineChol::decomposeMatrix(
       // Already decomposed => Do nothing
       return;
     } else {
-      // auto begin = std::chrono::high_resolution_clock::now();
-
+      SGPP_TRACE_SCOPE("DBMatOfflineChol::decomposeMatrix");
       size_t n = lhsMatrix.getNrows();
+      SGPP_TRACE_COUNT(Flops, n * n * n / 3);
+      SGPP_TRACE_COUNT(BytesStreamed, sizeof(double) * n * n);
       gsl_matrix_view m =
           gsl_matrix_view_array(lhsMatrix.getPointer(), n,
                                 n);  // Create GSL matrix view for decomposition
@@ -69,11 +70,6 @@ void DBMatOfflineChol::decomposeMatrix(
         }
       }
       isDecomposed = true;
-      // auto end = std::chrono::high_resolution_clock::now();
-      // std::cout << "Chol decomp took "
-      //          << std::chrono::duration_cast<std::chrono::milliseconds>(end -
-      //          begin).count()
-      //          << "ms" << std::endl;
     }
   } else {
     throw algorithm_exception(
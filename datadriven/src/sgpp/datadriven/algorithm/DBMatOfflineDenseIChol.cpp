@@ -5,9 +5,9 @@
 
 #include <sgpp/datadriven/algorithm/DBMatOfflineDenseIChol.hpp>
 #include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
 
 #include <algorithm>
-#include <chrono>
 #include <string>
 #include <vector>
 
@@ -32,8 +32,7 @@ void DBMatOfflineDenseIChol::decomposeMatrix(
     if (isDecomposed) {
       return;
     } else {
-      //  auto begin = std::chrono::high_resolution_clock::now();
-
+      SGPP_TRACE_SCOPE("DBMatOfflineDenseIChol::decomposeMatrix");
       DataMatrix tmpMatrix(lhsMatrix.getNrows(), lhsMatrix.getNcols());
 
 // only copy lower triangular matrix
@@ -49,12 +48,6 @@ void DBMatOfflineDenseIChol::decomposeMatrix(
             densityEstimationConfig.iCholSweepsDecompose_);
     }
     isDecomposed = true;
-    //    auto end = std::chrono::high_resolution_clock::now();
-    //    std::cout << "IChol decompostition took"
-    //              << std::chrono::duration_cast<std::chrono::milliseconds>(end
-    //              - begin).count() <<
-    //              "ms"
-    //              << std::endl;
   } else {
     throw algorithm_exception(
         "Matrix has to be constructed before it can be decomposed");
@@ -66,8 +59,7 @@ void DBMatOfflineDenseIChol::choleskyModification(
     datadriven::DensityEstimationConfiguration& densityEstimationConfig,
     size_t newPoints, std::vector<size_t>& deletedPoints, double lambda) {
   if (newPoints > 0) {
-    //    auto begin = std::chrono::high_resolution_clock::now();
-
+    SGPP_TRACE_SCOPE("DBMatOfflineDenseIChol::choleskyModification");
     size_t gridSize = grid.getSize();
     size_t gridDim = grid.getDimension();
 
@@ -160,13 +152,6 @@ void DBMatOfflineDenseIChol::choleskyModification(
 
     ichol(matRefine, lhsMatrix, densityEstimationConfig.iCholSweepsRefine_,
           (gridSize - newPoints));
-
-    //    auto end = std::chrono::high_resolution_clock::now();
-    //    std::cout << "IChol refinement took "
-    //              << std::chrono::duration_cast<std::chrono::milliseconds>(end
-    //              - begin).count() <<
-    //              "ms"
-    //              << std::endl;
   }
 }
 
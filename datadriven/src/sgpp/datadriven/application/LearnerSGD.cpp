@@ -49,13 +49,20 @@ LearnerSGD::LearnerSGD(base::RegularGridConfiguration& gridConfig,
       batchData(nullptr),
       batchLabels(nullptr),
       batchError(base::DataVector(0)),
+      miniBatchData(0, pTrainData.getNcols()),
+      miniBatchEval(nullptr),
       gridConfig(gridConfig),
       adaptivityConfig(adaptivityConfig),
       lambda(lambda),
       gamma(gamma),
       currentGamma(gamma),
       batchSize(batchSize),
-      useValidData(useValidData) {
+      miniBatchSize(1),
+      useValidData(useValidData),
+      useAdam(false),
+      adamBeta1(0.25),
+      adamBeta2(0.95),
+      adamEpsilon(1e-8) {
   // if no validation data is provided -> create buffer
   // which contains already processed data points
   // (required for computing error contributions used for predictive refinement)
@@ -101,10 +108,25 @@ std::unique_ptr<base::Grid> LearnerSGD::createRegularGrid() {
   return uGrid;
 }
 
+void LearnerSGD::setMiniBatchSize(size_t miniBatchSize) {
+  if (miniBatchSize == 0) {
+    throw base::application_exception("LearnerSGD::setMiniBatchSize : size has to be positive");
+  }
+  this->miniBatchSize = miniBatchSize;
+}
+
+void LearnerSGD::setUseAdam(bool useAdam, double beta1, double beta2, double epsilon) {
+  this->useAdam = useAdam;
+  adamBeta1 = beta1;
+  adamBeta2 = beta2;
+  adamEpsilon = epsilon;
+}
+
 void LearnerSGD::train(size_t maxDataPasses, std::string refType, std::string refMonitor,
                        size_t refPeriod, double errorDeclineThreshold,
                        size_t errorDeclineBufferSize, size_t minRefInterval) {
   size_t dim = trainData.getNcols();
+  size_t numTrainData = trainData.getNrows();
 
   // initialize counter for dataset passes
   size_t cntDataPasses = 0;
@@ -131,101 +153,84 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType, std::string re
   double acc = getAccuracy(testData, testLabels, 0.0);
   avgErrors.append(1.0 - acc);
 
-  // parameters for ADAM
-  /*sgpp::base::DataVector m(alpha.getSize(), 0.0);
-  sgpp::base::DataVector v(alpha.getSize(), 0.0);
-  double beta_1 = 0.25;
-  double beta_2 = 0.95;
-  double epsilon = 1e-8;*/
+  // the mini-batch matrix is refilled in place, so the evaluation operation only has to be
+  // recreated if the grid or the size of the mini-batch changes (the operations of the supported
+  // grid types read the dataset on every call instead of preparing a copy of it)
+  size_t stepSize = std::min(miniBatchSize, numTrainData);
+  size_t stepsPerPass = (numTrainData + stepSize - 1) / stepSize;
+  miniBatchData.resizeRowsCols(stepSize, dim);
+  miniBatchEval.reset(op_factory::createOperationMultipleEval(*grid, miniBatchData));
+  sgpp::base::DataVector predictions(stepSize);
+  sgpp::base::DataVector residuals(stepSize);
+  sgpp::base::DataVector gradient(alpha.getSize());
+  if (useAdam) {
+    adamM.resizeZero(alpha.getSize());
+    adamM.setAll(0.0);
+    adamV.resizeZero(alpha.getSize());
+    adamV.setAll(0.0);
+  }
 
-  // counts total number of processed data points
+  // counts total number of processed data points and SGD steps
   size_t processedPoints = 0;
+  size_t processedSteps = 0;
   // main loop which performs the learning process
   while (cntDataPasses < maxDataPasses) {
-    for (size_t currIt = 0; currIt < trainData.getNrows(); currIt++) {
-      // get next training sample x and its label y
-      sgpp::base::DataVector x(dim);
-      trainData.getRow(currIt, x);
-      double y = trainLabels.get(currIt);
+    for (size_t batchStart = 0; batchStart < numTrainData; batchStart += stepSize) {
+      size_t currentBatchSize = std::min(stepSize, numTrainData - batchStart);
+      if (currentBatchSize != miniBatchData.getNrows()) {
+        miniBatchData.resizeRows(currentBatchSize);
+        predictions.resize(currentBatchSize);
+        residuals.resize(currentBatchSize);
+        miniBatchEval.reset(op_factory::createOperationMultipleEval(*grid, miniBatchData));
+      }
+      std::copy(trainData.getPointer() + batchStart * dim,
+                trainData.getPointer() + (batchStart + currentBatchSize) * dim,
+                miniBatchData.getPointer());
 
-      // store data point in batch dataset used for checking
+      // store data points in batch dataset used for checking
       // predictive refinement criterion
       // if validation set is used -> not needed
       if (!useValidData) {
-        pushToBatch(x, y);
+        sgpp::base::DataVector x(dim);
+        for (size_t i = 0; i < currentBatchSize; i++) {
+          miniBatchData.getRow(i, x);
+          pushToBatch(x, trainLabels.get(batchStart + i));
+        }
+      }
+
+      // gradient of the mean squared loss of the mini-batch
+      miniBatchEval->mult(alpha, predictions);
+      for (size_t i = 0; i < currentBatchSize; i++) {
+        residuals[i] = (predictions[i] - trainLabels.get(batchStart + i)) /
+                       static_cast<double>(currentBatchSize);
       }
+      miniBatchEval->multTranspose(residuals, gradient);
+
+      // smoothing according to L. Bottou
+      size_t t1 = (processedSteps > dim + 1) ? processedSteps - dim : 1;
+      size_t t2 = (processedSteps > stepsPerPass + 1) ? processedSteps - stepsPerPass : 1;
+      double mu = (t1 > t2) ? static_cast<double>(t1) : static_cast<double>(t2);
+      mu = 1.0 / mu;
 
-      sgpp::base::DataVector delta(alpha.getSize());
-
-      sgpp::base::DataVector singleAlpha(1);
-      singleAlpha[0] = 1.0;
-
-      // perform SGD step
-      sgpp::base::DataMatrix dm(x.getPointer(), 1, x.getSize());
-      std::unique_ptr<base::OperationMultipleEval> multEval(
-          op_factory::createOperationMultipleEval(*grid, dm));
-      multEval->multTranspose(singleAlpha, delta);
-
-      double residual = delta.dotProduct(alpha) - y;
-
-      // ADAM
-      // gradient
-      /*delta.mult(residual);
-      delta.axpy(lambda, alpha);
-      sgpp::base::DataVector grad_1(delta);
-      sgpp::base::DataVector grad_2(delta);
-      //update biased first and second moment estimates
-      grad_1.mult(1.0-beta_1);
-      m.mult(beta_1);
-      m.add(grad_1);
-      grad_2.sqr();
-      grad_2.mult(1.0-beta_2);
-      v.mult(beta_2);
-      v.add(grad_2);
-      //update bias-corrected first and second moment estimates
-      //m.mult(1.0/(1.0-std::pow(beta_1,currIt+1)));
-      //v.mult(1.0/(1.0-std::pow(beta_2,currIt+1)));
-      m.mult(1.0/(1.0-std::pow(beta_1,processedPoints+1)));
-      v.mult(1.0/(1.0-std::pow(beta_2,processedPoints+1)));
-      //update alpha
-      v.sqrt();
-      sgpp::base::DataVector eps_vec(alpha.getSize(), epsilon);
-      v.add(eps_vec);
-      m.componentwise_div(v);
-      m.mult(currentGamma);
-      alpha.sub(m);*/
-
-      // SGD
-      alpha.mult(1 - currentGamma * lambda);
-      alpha.axpy(-currentGamma * residual, delta);
+      // SGD / ADAM step and averaging
+      updateSurpluses(gradient, mu, processedSteps + 1);
 
       // learning rate according to L. Bottou
       /*currentGamma =
           gamma *
           std::pow(
-              (1 + gamma * lGamma * (static_cast<double>(processedPoints) + 1)),
+              (1 + gamma * lGamma * (static_cast<double>(processedSteps) + 1)),
               -0.75);*/
       currentGamma =
           gamma *
-          std::pow((1 + gamma * lambda * (static_cast<double>(processedPoints) + 1)), -0.75);
-
-      // smoothing according to L. Bottou
-      size_t t1 = (processedPoints > dim + 1) ? processedPoints - dim : 1;
-      size_t t2 =
-          (processedPoints > trainData.getNrows() + 1) ? processedPoints - trainData.getNrows() : 1;
-      double mu = (t1 > t2) ? static_cast<double>(t1) : static_cast<double>(t2);
-      mu = 1.0 / mu;
-
-      // average SGD / ADAM
-      alphaAvg.mult(1 - mu);
-      alphaAvg.axpy(mu, alpha);
+          std::pow((1 + gamma * lambda * (static_cast<double>(processedSteps) + 1)), -0.75);
 
       size_t refinementsNecessary = 0;
       if (refCnt < refNum && processedPoints > 0 && monitor) {
         // check if refinement should be performed
         currentBatchError = getError(*batchData, *batchLabels, "MSE");
         currentTrainError = getError(trainData, trainLabels, "MSE");
-        monitor->pushToBuffer(1, currentBatchError, currentTrainError);
+        monitor->pushToBuffer(currentBatchSize, currentBatchError, currentTrainError);
         refinementsNecessary = monitor->refinementsNecessary();
       }
 
@@ -255,10 +260,12 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType, std::string re
         }
         alpha.resizeZero(grid->getSize());
         alphaAvg.resizeZero(grid->getSize());
-
-        // required for ADAM
-        // m.resizeZero(grid->getSize());
-        // v.resizeZero(grid->getSize());
+        gradient.resize(grid->getSize());
+        if (useAdam) {
+          adamM.resizeZero(grid->getSize());
+          adamV.resizeZero(grid->getSize());
+        }
+        miniBatchEval.reset(op_factory::createOperationMultipleEval(*grid, miniBatchData));
 
         std::cout << "refinement step: " << refCnt + 1 << std::endl;
         std::cout << "new grid size: " << grid->getSize() << std::endl;
@@ -267,16 +274,18 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType, std::string re
         refinementsNecessary--;
       }
 
-      // save current error
-      if ((processedPoints + 1) % 10 == 0) {
+      // save current error every 10 processed data points
+      if ((processedPoints + currentBatchSize) / 10 > processedPoints / 10) {
         acc = getAccuracy(testData, testLabels, 0.0);
         avgErrors.append(1.0 - acc);
       }
 
-      processedPoints++;
+      processedPoints += currentBatchSize;
+      processedSteps++;
     }
     cntDataPasses++;
   }
+  delete monitor;
   std::cout << "# Training finished" << std::endl;
   std::cout << "final grid size: " << grid->getSize() << std::endl;
   // double mse = getError(testData, testLabels, "MSE");
@@ -285,6 +294,40 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType, std::string re
   error = 1.0 - getAccuracy(testData, testLabels, 0.0);
 }
 
+void LearnerSGD::updateSurpluses(const base::DataVector& gradient, double mu, size_t step) {
+  double* alphaData = alpha.getPointer();
+  double* alphaAvgData = alphaAvg.getPointer();
+  const double* gradientData = gradient.getPointer();
+  size_t gridSize = alpha.getSize();
+
+  if (useAdam) {
+    double* m = adamM.getPointer();
+    double* v = adamV.getPointer();
+    double beta1 = adamBeta1;
+    double beta2 = adamBeta2;
+    double epsilon = adamEpsilon;
+    // bias corrections of the moment estimates
+    double correction1 = 1.0 / (1.0 - std::pow(beta1, static_cast<double>(step)));
+    double correction2 = 1.0 / (1.0 - std::pow(beta2, static_cast<double>(step)));
+#pragma omp parallel for simd schedule(static)
+    for (size_t i = 0; i < gridSize; i++) {
+      double g = gradientData[i] + lambda * alphaData[i];
+      m[i] = beta1 * m[i] + (1.0 - beta1) * g;
+      v[i] = beta2 * v[i] + (1.0 - beta2) * g * g;
+      alphaData[i] -=
+          currentGamma * (m[i] * correction1) / (std::sqrt(v[i] * correction2) + epsilon);
+      alphaAvgData[i] = (1.0 - mu) * alphaAvgData[i] + mu * alphaData[i];
+    }
+  } else {
+    double decay = 1.0 - currentGamma * lambda;
+#pragma omp parallel for simd schedule(static)
+    for (size_t i = 0; i < gridSize; i++) {
+      alphaData[i] = decay * alphaData[i] - currentGamma * gradientData[i];
+      alphaAvgData[i] = (1.0 - mu) * alphaAvgData[i] + mu * alphaData[i];
+    }
+  }
+}
+
 void LearnerSGD::storeResults(base::DataMatrix& testDataset) {
   base::DataVector predictedLabels(testDataset.getNrows());
   predict(testDataset, predictedLabels);
@@ -8,9 +8,11 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -79,6 +81,25 @@ class LearnerSGD {
   void train(size_t maxDataPasses, std::string refType, std::string refMonitor, size_t refPeriod,
              double errorDeclineThreshold, size_t errorDeclineBufferSize, size_t minRefInterval);
 
+  /**
+   * Sets the number of training points per SGD step. The gradient of a mini-batch is computed
+   * with a single multiple evaluation over all of its points, which is evaluated in parallel.
+   * The default of 1 corresponds to classical SGD.
+   *
+   * @param miniBatchSize The number of data points per step
+   */
+  void setMiniBatchSize(size_t miniBatchSize);
+
+  /**
+   * Enables ADAM updates of the surpluses instead of plain SGD updates.
+   *
+   * @param useAdam Specifies if ADAM should be used
+   * @param beta1 Decay rate of the first moment estimate
+   * @param beta2 Decay rate of the second moment estimate
+   * @param epsilon Term added to the denominator for numerical stability
+   */
+  void setUseAdam(bool useAdam, double beta1 = 0.25, double beta2 = 0.95, double epsilon = 1e-8);
+
   /**
    * Computes the classification accuracy on the given dataset.
    *
@@ -160,6 +181,16 @@ class LearnerSGD {
    */
   void pushToBatch(sgpp::base::DataVector& x, double y);
 
+  /**
+   * Updates the surpluses, the averaged surpluses and (if ADAM is used) the
+   * moment estimates in a single parallel pass over the grid points.
+   *
+   * @param gradient The gradient of the loss term for the current mini-batch
+   * @param mu The weight of the current surpluses in the averaged surpluses
+   * @param step The number of the current SGD step (starting at 1)
+   */
+  void updateSurpluses(const base::DataVector& gradient, double mu, size_t step);
+
   std::unique_ptr<base::Grid> grid;
   base::DataVector alpha;
   base::DataVector alphaAvg;
@@ -171,6 +202,20 @@ class LearnerSGD {
   base::DataVector* batchLabels;
   base::DataVector batchError;
 
+  /// data points of the current mini-batch
+  base::DataMatrix miniBatchData;
+  /**
+   * evaluation operation for the mini-batch, rebuilt only after refinement or if the size of the
+   * mini-batch changes (the last mini-batch of a pass may be smaller); the mini-batch data is
+   * refilled in place, which is only valid for operations that do not copy the dataset (like
+   * the ones of the supported Linear and ModLinear grids)
+   */
+  std::unique_ptr<base::OperationMultipleEval> miniBatchEval;
+  /// first moment estimate for ADAM
+  base::DataVector adamM;
+  /// second moment estimate for ADAM
+  base::DataVector adamV;
+
   base::RegularGridConfiguration gridConfig;
   base::AdaptivityConfiguration adaptivityConfig;
 
@@ -179,8 +224,14 @@ class LearnerSGD {
   double currentGamma;
 
   size_t batchSize;
+  size_t miniBatchSize;
 
   bool useValidData;
+  bool useAdam;
+
+  double adamBeta1;
+  double adamBeta2;
+  double adamEpsilon;
 };
 
 }  // namespace datadriven
@@ -531,6 +531,7 @@ void LearnerSGDE::trainOnline(base::DataVector& labels, base::DataMatrix& testDa
                               size_t accDeclineBufferSize, size_t minRefInterval, bool usePrior) {
   this->trainLabels = std::make_shared<base::DataVector>(labels);
   this->usePrior = usePrior;
+  dataBasedRefinementFunctor.reset();
 
   size_t dim = trainData->getNcols();
 
@@ -664,23 +665,30 @@ void LearnerSGDE::trainOnline(base::DataVector& labels, base::DataMatrix& testDa
         sgpp::datadriven::ZeroCrossingRefinementFunctor funcZrcr(
             refGrids, refAlphas, refPriors, adaptivityConfig.numRefinementPoints_, levelPenalize,
             preCompute);
-        // Data-based refinement. Needs a problem dependent coeffA. The values
-        // can be determined by testing (aim at ~10 % of the training data is
-        // to be marked relevant). Cross-validation or similar can/should be
-        // employed
-        // to determine this value.
-        std::vector<double> coeffA;
-        coeffA.push_back(1.2);  // ripley 1.2
-        coeffA.push_back(1.2);  // ripley 1.2
-        base::DataMatrix* refTrainData = trainData.get();
-        base::DataVector* refTrainLabels = trainLabels.get();
-        sgpp::datadriven::DataBasedRefinementFunctor funcData(
-            refGrids, refAlphas, refPriors, refTrainData, refTrainLabels,
-            adaptivityConfig.numRefinementPoints_, levelPenalize, coeffA);
         if (refType == "zero") {
           func = &funcZrcr;
         } else if (refType == "data") {
-          func = &funcData;
+          // the data-based functor is kept between refinement steps, such
+          // that its cached evaluations of the training data only have to
+          // be updated
+          if (!dataBasedRefinementFunctor) {
+            // Data-based refinement. Needs a problem dependent coeffA. The
+            // values can be determined by testing (aim at ~10 % of the
+            // training data is to be marked relevant). Cross-validation or
+            // similar can/should be employed to determine this value.
+            std::vector<double> coeffA;
+            coeffA.push_back(1.2);  // ripley 1.2
+            coeffA.push_back(1.2);  // ripley 1.2
+            base::DataMatrix* refTrainData = trainData.get();
+            base::DataVector* refTrainLabels = trainLabels.get();
+            dataBasedRefinementFunctor = std::make_unique<DataBasedRefinementFunctor>(
+                refGrids, refAlphas, refPriors, refTrainData, refTrainLabels,
+                adaptivityConfig.numRefinementPoints_, levelPenalize, coeffA);
+          } else {
+            dataBasedRefinementFunctor->setPriors(refPriors);
+            dataBasedRefinementFunctor->updateH();
+          }
+          func = dataBasedRefinementFunctor.get();
         }
 
         // refine each grid
@@ -14,11 +14,13 @@
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/datadriven/configuration/CrossvalidationConfiguration.hpp>
 #include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
+#include <sgpp/datadriven/functors/classification/DataBasedRefinementFunctor.hpp>
 #include <sgpp/solver/TypesSolver.hpp>
 
 #include <sgpp/globaldef.hpp>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -322,6 +324,9 @@ class LearnerSGDE : public datadriven::DensityEstimator {
   std::shared_ptr<base::DataVector> trainLabels;
   // stores prior values mapped to class labels
   std::map<int, double> priors;
+  // data-based refinement functor (used in trainOnline(...)), kept to update
+  // its cached evaluations incrementally between refinement steps
+  std::unique_ptr<DataBasedRefinementFunctor> dataBasedRefinementFunctor;
   // specifies whether prior probabilities should be used to predict class
   // labels
   bool usePrior;
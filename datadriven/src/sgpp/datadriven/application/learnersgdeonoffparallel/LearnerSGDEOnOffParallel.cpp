@@ -362,25 +362,30 @@ void LearnerSGDEOnOffParallel::doRefinementForAll(
                                          priorVector,   adaptivityConfig.numRefinementPoints_,
                                          levelPenalize, preCompute};
 
-  // Data-based refinement. Needs a problem dependent coeffA. The values
-  // can be determined by testing (aim at ~10 % of the training data is
-  // to be marked relevant). Cross-validation or similar can/should be
-  // employed
-  // to determine this value.
-  std::vector<double> coeffA;
-  coeffA.push_back(1.2);  // ripley 1.2
-  coeffA.push_back(1.2);  // ripley 1.2
-  DataMatrix *trainDataRef = &(trainData.getData());
-  DataVector *trainLabelsRef = &(trainData.getTargets());
-  DataBasedRefinementFunctor funcData = DataBasedRefinementFunctor{
-      gridVector,    alphas,         priorVector,
-      trainDataRef,  trainLabelsRef, adaptivityConfig.numRefinementPoints_,
-      levelPenalize, coeffA};
-
   if (refinementFunctorType == "zero") {
     func = &funcZrcr;
   } else if (refinementFunctorType == "data") {
-    func = &funcData;
+    // The data-based functor is kept between refinement steps, such that its
+    // cached evaluations of the training data only have to be updated
+    if (!dataBasedRefinementFunctor) {
+      // Data-based refinement. Needs a problem dependent coeffA. The values
+      // can be determined by testing (aim at ~10 % of the training data is
+      // to be marked relevant). Cross-validation or similar can/should be
+      // employed
+      // to determine this value.
+      std::vector<double> coeffA;
+      coeffA.push_back(1.2);  // ripley 1.2
+      coeffA.push_back(1.2);  // ripley 1.2
+      DataMatrix *trainDataRef = &(trainData.getData());
+      DataVector *trainLabelsRef = &(trainData.getTargets());
+      dataBasedRefinementFunctor = std::make_unique<DataBasedRefinementFunctor>(
+          gridVector, alphas, priorVector, trainDataRef, trainLabelsRef,
+          adaptivityConfig.numRefinementPoints_, levelPenalize, coeffA);
+    } else {
+      dataBasedRefinementFunctor->setPriors(priorVector);
+      dataBasedRefinementFunctor->updateH();
+    }
+    func = dataBasedRefinementFunctor.get();
   }
 
   // perform refinement/coarsening for each grid
@@ -396,7 +401,7 @@ void LearnerSGDEOnOffParallel::doRefinementForAll(
   MPIMethods::waitForIncomingMessageType(
       UPDATE_GRID, static_cast<int>(getNumClasses()), [](PendingMPIRequest &request) {
         auto *refinementResultNetworkMessage = static_cast<RefinementResultNetworkMessage *>(
-            static_cast<void *>(request.buffer->payload));
+            static_cast<void *>(request.getPacket()->payload));
         // Ensure it is a system matrix packet and the last in the sequence
         D(std::cout << "Test packet grid version " << refinementResultNetworkMessage->gridversion
                     << ", update type " << refinementResultNetworkMessage->updateType << std::endl;)
@@ -641,6 +646,8 @@ size_t LearnerSGDEOnOffParallel::assignBatchToWorker(size_t batchOffset, bool do
             << " with size " << assignTaskResult.taskSize << std::endl;
   MPIMethods::assignBatch(assignTaskResult.workerID, batchOffset, assignTaskResult.taskSize,
                           doCrossValidation);
+  mpiTaskScheduler.onBatchAssigned(assignTaskResult.workerID, batchOffset,
+                                   assignTaskResult.taskSize);
   return assignTaskResult.taskSize;
 }
 
@@ -16,6 +16,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOnlineDE.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 #include <sgpp/datadriven/functors/MultiGridRefinementFunctor.hpp>
+#include <sgpp/datadriven/functors/classification/DataBasedRefinementFunctor.hpp>
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/MPITaskScheduler.hpp>
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/AuxiliaryStructures.hpp>
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/RefinementHandler.hpp>
@@ -23,6 +24,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -347,6 +349,10 @@ class LearnerSGDEOnOffParallel {
   // The online objects (density functions)
   std::vector<std::pair<std::unique_ptr<DBMatOnlineDE>, size_t>> densityFunctions;
 
+  // Data-based refinement functor, kept to update its cached evaluations
+  // incrementally between refinement steps
+  std::unique_ptr<DataBasedRefinementFunctor> dataBasedRefinementFunctor;
+
   // Counter for total number of data points processed within ona data pass
   size_t processedPoints;
 
@@ -0,0 +1,117 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/MPIMethods.hpp>
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/LoadAwareScheduler.hpp>
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/LearnerSGDEOnOffParallel.hpp>
+#include <sgpp/base/exception/algorithm_exception.hpp>
+
+#include <algorithm>
+
+namespace sgpp {
+namespace datadriven {
+LoadAwareScheduler::LoadAwareScheduler(size_t batchSize, size_t maxOutstandingBatchesPerWorker)
+    : batchSize(batchSize),
+      maxOutstandingBatchesPerWorker(std::max<size_t>(maxOutstandingBatchesPerWorker, 1)),
+      lastWorkerID(0),
+      numOutstandingRequestsCurrentRefinement(0),
+      numOutstandingRequestsLastRefinement(0) {
+  learnerInstance = nullptr;
+}
+
+void LoadAwareScheduler::assignTaskVariableTaskSize(TaskType taskType, AssignTaskResult &result) {
+  assignTaskStaticTaskSize(taskType, result);
+  result.taskSize = batchSize;
+}
+
+void LoadAwareScheduler::assignTaskStaticTaskSize(TaskType taskType, AssignTaskResult &result) {
+  // The world size is only known after the learner initialized MPI
+  outstandingBatchesPerWorker.resize(getNumRanks(), 0);
+
+  if (getNumRanks() < 2) {
+    throw sgpp::base::algorithm_exception("No workers available for task assignment.");
+  }
+
+  if (taskType == TRAIN_FROM_BATCH) {
+    // Process incoming results instead of queueing more work on busy workers
+    while (allWorkersSaturated()) {
+      D(std::cout << "All workers are busy, waiting for results" << std::endl;)
+      MPIMethods::waitForAnyMPIRequestsToComplete();
+    }
+    numOutstandingRequestsCurrentRefinement += getNumClasses();
+  }
+  result.workerID = findLeastLoadedWorker();
+}
+
+int LoadAwareScheduler::findLeastLoadedWorker() {
+  int numWorkers = static_cast<int>(outstandingBatchesPerWorker.size()) - 1;
+  int bestWorkerID = 0;
+
+  for (int i = 1; i <= numWorkers; i++) {
+    int workerID = (lastWorkerID + i - 1) % numWorkers + 1;
+    if (bestWorkerID == 0 || outstandingBatchesPerWorker[workerID] <
+                                 outstandingBatchesPerWorker[bestWorkerID]) {
+      bestWorkerID = workerID;
+    }
+  }
+
+  lastWorkerID = bestWorkerID;
+  return bestWorkerID;
+}
+
+bool LoadAwareScheduler::allWorkersSaturated() const {
+  return std::all_of(outstandingBatchesPerWorker.begin() + 1, outstandingBatchesPerWorker.end(),
+                     [this](size_t outstandingBatches) {
+                       return outstandingBatches >= maxOutstandingBatchesPerWorker;
+                     });
+}
+
+void LoadAwareScheduler::onBatchAssigned(int workerID, size_t batchOffset, size_t batchSize) {
+  outstandingBatchesPerWorker.resize(getNumRanks(), 0);
+  outstandingBatchesPerWorker[workerID]++;
+  assignedBatches.insert(
+      std::make_pair(batchOffset + batchSize, AssignedBatch{workerID, getNumClasses()}));
+}
+
+size_t LoadAwareScheduler::getNumRanks() const { return MPIMethods::getWorldSize(); }
+
+size_t LoadAwareScheduler::getNumClasses() const { return learnerInstance->getNumClasses(); }
+
+bool LoadAwareScheduler::isReadyForRefinement() {
+  return numOutstandingRequestsLastRefinement == 0;
+}
+
+void LoadAwareScheduler::onMergeRequestIncoming(size_t batchOffset,
+                                                size_t /*batchSize*/,
+                                                size_t remoteGridVersion,
+                                                size_t localGridVersion) {
+  if (remoteGridVersion == localGridVersion) {
+    numOutstandingRequestsCurrentRefinement--;
+  } else if (remoteGridVersion + 1 == localGridVersion) {
+    numOutstandingRequestsLastRefinement--;
+  } else {
+    throw sgpp::base::algorithm_exception("Received merge request that was too old.");
+  }
+
+  // The oldest batch with this offset, batches of later data passes may reuse the offset
+  auto assignedBatch = assignedBatches.lower_bound(batchOffset);
+  if (assignedBatch == assignedBatches.end() || assignedBatch->first != batchOffset) {
+    throw sgpp::base::algorithm_exception("Received merge request for unknown batch.");
+  }
+  if (--assignedBatch->second.remainingMergeRequests == 0) {
+    outstandingBatchesPerWorker[assignedBatch->second.workerID]--;
+    assignedBatches.erase(assignedBatch);
+  }
+}
+
+void LoadAwareScheduler::onRefinementStarted() {
+  if (numOutstandingRequestsLastRefinement != 0) {
+    throw sgpp::base::algorithm_exception("Refinement started illegally.");
+  }
+  numOutstandingRequestsLastRefinement = numOutstandingRequestsCurrentRefinement;
+  numOutstandingRequestsCurrentRefinement = 0;
+}
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,156 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/MPITaskScheduler.hpp>
+
+#include <map>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+/**
+ * Scheduler that tracks the batches outstanding on each worker and assigns new tasks to the
+ * worker with the least outstanding work. The number of outstanding batches per worker is
+ * bounded, so slow workers do not accumulate long queues: if all workers are saturated, the
+ * master processes incoming results until a worker becomes available again, which effectively
+ * lets idle workers take over the work that would have been queued on busy ones.
+ */
+class LoadAwareScheduler : public MPITaskScheduler {
+ public:
+  /**
+   * Create a scheduler that distributes batches of the specified size to the least loaded
+   * worker.
+   * @param batchSize The size of one training batch to distribute.
+   * @param maxOutstandingBatchesPerWorker The maximum number of batches that may be queued on a
+   * worker at the same time.
+   */
+  explicit LoadAwareScheduler(size_t batchSize, size_t maxOutstandingBatchesPerWorker = 2);
+
+  /**
+   * Assign a task of static size to the least loaded worker. Batches are only assigned once
+   * a worker has less than the maximum number of outstanding batches.
+   * @param taskType Type of task to assign to a worker.
+   * @param result The result of determining assignment.
+   */
+  void assignTaskStaticTaskSize(TaskType taskType, AssignTaskResult &result) override;
+
+  /**
+   * Assign a task of variable size equal to the batch size to the least loaded worker.
+   * @param taskType Type of task to assign to a worker.
+   * @param result The result of determining assignment.
+   */
+  void assignTaskVariableTaskSize(TaskType taskType, AssignTaskResult &result) override;
+
+  /**
+   * Check whether the master can start to refine. This can only happen if all requests from one
+   * cycle ago have successfully completed.
+   * @return Whether to start refining.
+   */
+  bool isReadyForRefinement() override;
+
+  /**
+   * Update the number of outstanding requests of the refinement cycles and of the worker that
+   * trained the batch.
+   * @param batchOffset The offset reported by the worker, i.e., the end of the batch.
+   * @param batchSize Not used.
+   * @param remoteGridVersion The grid version that was used to train the batch.
+   * @param localGridVersion The current grid version on the master.
+   */
+  void onMergeRequestIncoming(size_t batchOffset, size_t batchSize,
+                              size_t remoteGridVersion, size_t localGridVersion) override;
+
+  /**
+   * Move the number of current outstanding requests into the number of previous outstanding
+   * requests.
+   */
+  void onRefinementStarted() override;
+
+  /**
+   * Record the batch as outstanding on the worker it was sent to.
+   * @param workerID The MPI rank of the worker the batch was sent to.
+   * @param batchOffset The offset of the batch.
+   * @param batchSize The size of the batch.
+   */
+  void onBatchAssigned(int workerID, size_t batchOffset, size_t batchSize) override;
+
+ protected:
+  /**
+   * A batch that was sent to a worker and whose results have not been merged completely.
+   */
+  struct AssignedBatch {
+    /**
+     * The MPI rank of the worker training the batch.
+     */
+    int workerID;
+    /**
+     * The number of merge requests (one per class) still to be received.
+     */
+    size_t remainingMergeRequests;
+  };
+
+  /**
+   * Find the worker with the least outstanding batches. Ties are broken in round robin order
+   * starting after the last assigned worker.
+   * @return The MPI rank of the worker.
+   */
+  int findLeastLoadedWorker();
+
+  /**
+   * Check whether all workers have the maximum number of outstanding batches.
+   * @return Whether no worker can accept another batch.
+   */
+  bool allWorkersSaturated() const;
+
+  /**
+   * Get the number of MPI ranks, i.e., the master and all workers.
+   * @return The size of the MPI world.
+   */
+  virtual size_t getNumRanks() const;
+
+  /**
+   * Get the number of merge requests that complete a batch.
+   * @return The number of classes of the learner.
+   */
+  virtual size_t getNumClasses() const;
+
+  /**
+   * The batch size to use for all workers.
+   */
+  size_t batchSize;
+  /**
+   * The maximum number of batches that may be queued on a worker at the same time.
+   */
+  size_t maxOutstandingBatchesPerWorker;
+  /**
+   * The worker that had work assigned to it last.
+   */
+  int lastWorkerID;
+  /**
+   * The number of outstanding batches for every MPI rank (the master's entry is unused).
+   */
+  std::vector<size_t> outstandingBatchesPerWorker;
+  /**
+   * The outstanding batches, keyed by the end of the batch, as this is the offset the workers
+   * report on merging. Batches with equal keys are stored in assignment order.
+   */
+  std::multimap<size_t, AssignedBatch> assignedBatches;
+
+  /**
+   * Track how many outstanding requests (batch*class) are pending for the current refinement
+   * cycle.
+   */
+  size_t numOutstandingRequestsCurrentRefinement;
+  /**
+   * Track how many outstanding requests (batch*class) are pending for the previous refinement
+   * cycle.
+   */
+  size_t numOutstandingRequestsLastRefinement;
+};
+}  // namespace datadriven
+}  // namespace sgpp
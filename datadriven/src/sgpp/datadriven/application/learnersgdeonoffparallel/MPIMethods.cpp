@@ -11,10 +11,12 @@
 #include <sgpp/base/exception/algorithm_exception.hpp>
 
 #include <thread>
+#include <algorithm>
 #include <climits>
 #include <cstring>
 #include <list>
 #include <numeric>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -128,6 +130,7 @@ void MPIMethods::handleIncomingRequestFromCallback(PendingMPIRequest &request) {
 
   D(std::cout << "Zeroing Buffer" << std::endl;)
   std::memset(request.buffer, 0, sizeof(MPI_Packet));
+  std::vector<unsigned char>().swap(request.largeMessage);
 }
 
 void
@@ -204,6 +207,39 @@ MPIMethods::sendRefinementUpdates(size_t &classIndex, std::list<size_t> &deleted
 void MPIMethods::sendSystemMatrixDecomposition(const size_t &classIndex,
                                                DataMatrix &newSystemMatrixDecomposition,
                                                int mpiTarget) {
+  size_t numValues = newSystemMatrixDecomposition.size();
+  if (numValues * sizeof(double) > sizeof(RefinementResultSystemMatrixNetworkMessage::payload)) {
+    // Send the decomposition at once instead of segmenting it
+    std::vector<unsigned char> largeMessage = createLargeMessage(
+        UPDATE_GRID, offsetof(RefinementResultNetworkMessage, payload) +
+                         offsetof(RefinementResultSystemMatrixNetworkMessage, payload) +
+                         numValues * sizeof(double));
+    auto *mpiPacket = static_cast<MPI_Packet *>(static_cast<void *>(largeMessage.data()));
+    auto *networkMessage =
+        static_cast<RefinementResultNetworkMessage *>(static_cast<void *>(mpiPacket->payload));
+
+    networkMessage->classIndex = classIndex;
+    networkMessage->updateType = SYSTEM_MATRIX_DECOMPOSITION;
+    networkMessage->listLength = numValues;
+    networkMessage->gridversion = learnerInstance->getLocalGridVersion(classIndex);
+
+    auto *systemMatrixNetworkMessage =
+        static_cast<RefinementResultSystemMatrixNetworkMessage *>(
+            static_cast<void *>(networkMessage->payload));
+
+    systemMatrixNetworkMessage->matrixWidth = newSystemMatrixDecomposition.getNcols();
+    systemMatrixNetworkMessage->matrixHeight = newSystemMatrixDecomposition.getNrows();
+    systemMatrixNetworkMessage->offset = 0;
+    std::copy(newSystemMatrixDecomposition.begin(), newSystemMatrixDecomposition.end(),
+              static_cast<double *>(static_cast<void *>(systemMatrixNetworkMessage->payload)));
+
+    D(std::cout << "Sending system matrix for class " << classIndex << " with " << numValues
+                << " values as large message (grid version " << networkMessage->gridversion
+                << ", target " << mpiTarget << ")" << std::endl;)
+    sendLargeMessage(mpiTarget, largeMessage, true);
+    return;
+  }
+
   auto iterator = newSystemMatrixDecomposition.begin();
   auto listEnd = newSystemMatrixDecomposition.end();
 
@@ -269,6 +305,89 @@ void MPIMethods::sendCommandNoArgs(const int destinationRank, MPI_COMMAND_ID com
   sendISend(destinationRank, mpiPacket);
 }
 
+std::vector<unsigned char> MPIMethods::createLargeMessage(MPI_COMMAND_ID commandId,
+                                                         size_t containedPacketSize) {
+  std::vector<unsigned char> largeMessage(calculateTotalPacketSize(containedPacketSize));
+  static_cast<MPI_Packet *>(static_cast<void *>(largeMessage.data()))->commandID = commandId;
+  return largeMessage;
+}
+
+PendingMPIRequest &MPIMethods::sendLargeMessage(int destinationRank,
+                                                std::vector<unsigned char> &largeMessage,
+                                                bool highPriority) {
+  CHECK_SIZE_T_TO_INT(largeMessage.size())
+  int worldRank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &worldRank);
+  bool isBroadcast = destinationRank == MPI_ANY_SOURCE;
+
+  auto *mpiPacket = new MPI_Packet;
+  mpiPacket->commandID = LARGE_MESSAGE;
+
+  auto *announcement =
+      static_cast<LargeMessageNetworkMessage *>(static_cast<void *>(mpiPacket->payload));
+  announcement->sourceRank = worldRank;
+  announcement->isBroadcast = isBroadcast;
+  announcement->messageSize = largeMessage.size();
+
+  // Workers start to receive a broadcast large message after the announcement arrived
+  if (isBroadcast) {
+    sendIBcast(mpiPacket);
+  }
+
+  PendingMPIRequest &pendingMPIRequest = createPendingMPIRequest(nullptr, false);
+  pendingMPIRequest.largeMessage.swap(largeMessage);
+  void *messageBuffer = pendingMPIRequest.largeMessage.data();
+  int messageSize = static_cast<int>(pendingMPIRequest.largeMessage.size());
+
+  if (isBroadcast) {
+    MPI_Ibcast(messageBuffer, messageSize, MPI_UNSIGNED_CHAR, MPI_MASTER_RANK, MPI_COMM_WORLD,
+               pendingMPIRequest.getMPIRequestFromHandle());
+  } else {
+    MPI_Isend(messageBuffer, messageSize, MPI_UNSIGNED_CHAR, destinationRank,
+              MPI_TAG_LARGE_MESSAGE, MPI_COMM_WORLD, pendingMPIRequest.getMPIRequestFromHandle());
+    sendISend(destinationRank, mpiPacket,
+              calculateTotalPacketSize(sizeof(LargeMessageNetworkMessage)), highPriority);
+  }
+
+  D(std::cout << "Large message of " << messageSize << " bytes stored at " << &pendingMPIRequest
+              << std::endl;)
+  return pendingMPIRequest;
+}
+
+void MPIMethods::receiveLargeMessage(PendingMPIRequest &announcementRequest) {
+  auto *announcement = static_cast<LargeMessageNetworkMessage *>(
+      static_cast<void *>(announcementRequest.buffer->payload));
+  std::vector<unsigned char> &largeMessage = announcementRequest.largeMessage;
+
+  if (announcement->isBroadcast) {
+    CHECK_SIZE_T_TO_INT(announcement->messageSize)
+    largeMessage.resize(announcement->messageSize);
+
+    // Non-blocking collectives do not match blocking ones
+    MPI_Request mpiRequest;
+    MPI_Ibcast(largeMessage.data(), static_cast<int>(largeMessage.size()), MPI_UNSIGNED_CHAR,
+               MPI_MASTER_RANK, MPI_COMM_WORLD, &mpiRequest);
+    MPI_Wait(&mpiRequest, MPI_STATUS_IGNORE);
+  } else {
+    // Matched probe, such that the size is known before receiving the message at once
+    MPI_Message mpiMessage;
+    MPI_Status mpiStatus{};
+    MPI_Mprobe(announcement->sourceRank, MPI_TAG_LARGE_MESSAGE, MPI_COMM_WORLD, &mpiMessage,
+               &mpiStatus);
+
+    int messageSize = 0;
+    MPI_Get_count(&mpiStatus, MPI_UNSIGNED_CHAR, &messageSize);
+    CHECK_INT_TO_UINT(messageSize)
+    largeMessage.resize(static_cast<size_t>(messageSize));
+    MPI_Mrecv(largeMessage.data(), messageSize, MPI_UNSIGNED_CHAR, &mpiMessage,
+              MPI_STATUS_IGNORE);
+  }
+
+  D(std::cout << "Received large message of " << largeMessage.size() << " bytes from "
+              << announcement->sourceRank << " with command "
+              << announcementRequest.getPacket()->commandID << std::endl;)
+}
+
 PendingMPIRequest &MPIMethods::sendIBcast(MPI_Packet *mpiPacket) {
   PendingMPIRequest &pendingMPIRequest = createPendingMPIRequest(mpiPacket, false);
 
@@ -335,6 +454,32 @@ void MPIMethods::receiveMergeGridNetworkMessage(MergeGridNetworkMessage &network
 size_t
 MPIMethods::sendMergeGridNetworkMessage(size_t classIndex, size_t batchOffset, size_t batchSize,
                                         base::DataVector &alphaVector) {
+  if (alphaVector.size() * sizeof(double) > sizeof(MergeGridNetworkMessage::payload)) {
+    // Send the alpha vector at once instead of segmenting it
+    std::vector<unsigned char> largeMessage = createLargeMessage(
+        MERGE_GRID,
+        offsetof(MergeGridNetworkMessage, payload) + alphaVector.size() * sizeof(double));
+    auto *mpiPacket = static_cast<MPI_Packet *>(static_cast<void *>(largeMessage.data()));
+    auto *networkMessage =
+        static_cast<MergeGridNetworkMessage *>(static_cast<void *>(mpiPacket->payload));
+
+    networkMessage->classIndex = classIndex;
+    networkMessage->gridversion = learnerInstance->getLocalGridVersion(classIndex);
+    networkMessage->payloadOffset = 0;
+    networkMessage->payloadLength = alphaVector.size();
+    networkMessage->batchSize = batchSize;
+    networkMessage->batchOffset = batchOffset;
+    networkMessage->alphaTotalSize = alphaVector.size();
+    std::copy(alphaVector.begin(), alphaVector.end(),
+              static_cast<double *>(static_cast<void *>(networkMessage->payload)));
+
+    D(std::cout << "Sending merge for class " << classIndex << " with " << alphaVector.size()
+                << " values as large message and grid version " << networkMessage->gridversion
+                << std::endl;)
+    sendLargeMessage(MPI_MASTER_RANK, largeMessage);
+    return alphaVector.size();
+  }
+
   size_t offset = 0;
   auto beginIterator = alphaVector.begin();
   auto endIterator = alphaVector.end();
@@ -456,6 +601,12 @@ void MPIMethods::processCompletedMPIRequests() {
 
 void MPIMethods::processCompletedMPIRequest(
     const std::list<sgpp::datadriven::PendingMPIRequest>::iterator &pendingMPIRequestIterator) {
+  // Receive an announced large message first, such that the track requests see its contents
+  if (pendingMPIRequestIterator->inbound &&
+      pendingMPIRequestIterator->buffer->commandID == LARGE_MESSAGE) {
+    receiveLargeMessage(*pendingMPIRequestIterator);
+  }
+
   D(std::cout << "Updating " << messageTrackRequests.size() << " track requests" << std::endl;)
   for (MessageTrackRequest &trackRequest : messageTrackRequests) {
     if (trackRequest.predicate(*pendingMPIRequestIterator)) {
@@ -541,7 +692,7 @@ void MPIMethods::waitForIncomingMessageType(MPI_COMMAND_ID commandId, unsigned i
               << std::endl;)
   auto trackRequest = createTrackRequest(numOccurrences, [commandId, predicate](
       PendingMPIRequest &mpiRequest) {
-    return mpiRequest.inbound && mpiRequest.buffer->commandID == commandId &&
+    return mpiRequest.inbound && mpiRequest.getPacket()->commandID == commandId &&
         predicate(mpiRequest);
   });
 
@@ -586,14 +737,14 @@ MPIMethods::findPendingMPIRequest(unsigned int completedRequestIndex) {
   throw sgpp::base::algorithm_exception("Could not find PendingMPIRequest for Pool Index.");
 }
 
-void MPIMethods::receiveGridComponentsUpdate(RefinementResultNetworkMessage *networkMessage) {
+void MPIMethods::receiveGridComponentsUpdate(RefinementResultNetworkMessage *networkMessage,
+                                             const void *bufferEnd) {
   size_t classIndex = networkMessage->classIndex;
   RefinementResult &refinementResult = learnerInstance->getRefinementHandler().getRefinementResult(
       classIndex);
 
   size_t listLength = networkMessage->listLength;
   size_t processedPoints = 0;
-  void *bufferEnd = std::end(networkMessage->payload);
 
   D(std::cout << "Receiving " << listLength << " grid modifications for class " << classIndex
               << " (update type " << networkMessage->updateType << ", remote grid version "
@@ -727,7 +878,7 @@ void MPIMethods::receiveGridComponentsUpdate(RefinementResultNetworkMessage *net
 }
 
 void MPIMethods::processIncomingMPICommands(PendingMPIRequest &pendingMPIRequest) {
-  MPI_Packet *mpiPacket = pendingMPIRequest.buffer;
+  MPI_Packet *mpiPacket = pendingMPIRequest.getPacket();
   D(std::cout << "Processing incoming command " << mpiPacket->commandID << std::endl;)
   void *networkMessagePointer = &(mpiPacket->payload);
 
@@ -735,7 +886,8 @@ void MPIMethods::processIncomingMPICommands(PendingMPIRequest &pendingMPIRequest
     case UPDATE_GRID: {
       auto *refinementResultNetworkMessage =
           static_cast<RefinementResultNetworkMessage *>(networkMessagePointer);
-      receiveGridComponentsUpdate(refinementResultNetworkMessage);
+      receiveGridComponentsUpdate(refinementResultNetworkMessage,
+                                  pendingMPIRequest.getPacketEnd());
     }
       break;
     case MERGE_GRID: {
@@ -103,9 +103,11 @@ class MPIMethods {
    * Extract the data into a refinement result and apply to grid or apply to system matrix.
    * This includes additions, deletions, and system matrix updates.
    * @param networkMessage The message containing the modification data.
+   * @param bufferEnd The end of the message's payload.
    */
   static void
-  receiveGridComponentsUpdate(sgpp::datadriven::RefinementResultNetworkMessage *networkMessage);
+  receiveGridComponentsUpdate(sgpp::datadriven::RefinementResultNetworkMessage *networkMessage,
+                              const void *bufferEnd);
 
   /**
    * Cancel any remaining requests and shutdown the MPI communicator.
@@ -203,6 +205,28 @@ class MPIMethods {
   static void sendRefinementUpdates(size_t &classIndex, std::list<size_t> &deletedGridPointsIndices,
                                     std::list<LevelIndexVector> &addedGridPoints);
 
+  /**
+   * Allocate a large message, i.e., an MPI_Packet header followed by a payload of arbitrary size.
+   * @param commandId The command of the large message.
+   * @param containedPacketSize The size of the payload.
+   * @return The large message with the command set.
+   */
+  static std::vector<unsigned char> createLargeMessage(MPI_COMMAND_ID commandId,
+                                                       size_t containedPacketSize);
+
+  /**
+   * Send a large message in a single transfer instead of segmenting it into MPI_Packets.
+   * The transfer is announced with a LARGE_MESSAGE packet on the normal channels, such that the
+   * receiver can probe for the message and receive it at once.
+   * @param destinationRank The MPI rank of the receiving node. Use MPI_ANY_SOURCE for broadcast.
+   * @param largeMessage The message to send, its contents are moved into the pending request.
+   * @param highPriority Whether to announce the message on the high priority no_wait channel.
+   * @return The pending MPI request to track completion.
+   */
+  static PendingMPIRequest &sendLargeMessage(int destinationRank,
+                                             std::vector<unsigned char> &largeMessage,
+                                             bool highPriority = false);
+
   /**
    * Send an MPI command using point to point communication without any further payload.
    * @param destinationRank The MPI rank of the receiving node.
@@ -301,6 +325,13 @@ class MPIMethods {
    */
   static void runBatch(MPI_Packet *assignBatchMessage);
 
+  /**
+   * Receive the large message announced by the packet of the specified request and attach it to
+   * the request, such that it is processed in place of the announcement.
+   * @param announcementRequest The completed request holding the LARGE_MESSAGE packet.
+   */
+  static void receiveLargeMessage(PendingMPIRequest &announcementRequest);
+
   /**
    * Receive a packet of changes from the master and apply them to the grid and refinement result
    * or to the system matrix decomposition.
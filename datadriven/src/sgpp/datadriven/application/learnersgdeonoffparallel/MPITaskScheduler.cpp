@@ -10,5 +10,8 @@ namespace datadriven {
 void MPITaskScheduler::setLearnerInstance(LearnerSGDEOnOffParallel *instance) {
   learnerInstance = instance;
 }
+
+void MPITaskScheduler::onBatchAssigned(int /*workerID*/, size_t /*batchOffset*/,
+                                       size_t /*batchSize*/) {}
 }
 }
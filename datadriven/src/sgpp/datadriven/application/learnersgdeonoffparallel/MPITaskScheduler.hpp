@@ -85,6 +85,15 @@ class MPITaskScheduler {
                          size_t remoteGridVersion,
                          size_t localGridVersion) = 0;
 
+  /**
+   * Callback for when a batch was sent to a worker. Can be used to track the work assigned to
+   * each worker.
+   * @param workerID The MPI rank of the worker the batch was sent to.
+   * @param batchOffset The offset of the batch.
+   * @param batchSize The size of the batch.
+   */
+  virtual void onBatchAssigned(int workerID, size_t batchOffset, size_t batchSize);
+
   /**
    * Set the learner instance for which to task schedule.
    * @param instance The learner instance.
@@ -10,6 +10,7 @@
 #define MPI_MAX_PROCESSOR_NAME_LENGTH 256
 #define MPI_TAG_HIGH_PRIORITY_NO_BLOCK 42
 #define MPI_TAG_STANDARD_COMMAND 41
+#define MPI_TAG_LARGE_MESSAGE 43
 
 #define REFINENEMT_RESULT_PAYLOAD_SIZE (MPI_PACKET_MAX_PAYLOAD_SIZE\
                                    - 3 * sizeof(size_t)\
@@ -53,7 +54,12 @@ enum MPI_COMMAND_ID {
   /**
    * A confirmation packet sent by a worker to acknowledge all requests were completed.
    */
-      WORKER_SHUTDOWN_SUCCESS
+      WORKER_SHUTDOWN_SUCCESS,
+  /**
+   * A packet announcing a message that does not fit into an MPI_Packet and is transmitted in a
+   * single transfer on its own.
+   */
+      LARGE_MESSAGE
 };
 
 /**
@@ -215,5 +221,26 @@ struct AssignSystemMatrixUpdateNetworkMessage {
   size_t gridversion;
 };
 
+/**
+ * Message wrapped in an MPI_Packet announcing a large message. The large message starts with the
+ * header of an MPI_Packet, followed by a payload of arbitrary length. Point to point large
+ * messages are sent on MPI_TAG_LARGE_MESSAGE and received with a probe, broadcast large messages
+ * follow the announcement in a separate broadcast of the announced size.
+ */
+struct LargeMessageNetworkMessage {
+  /**
+   * The MPI rank of the sender.
+   */
+  int sourceRank;
+  /**
+   * Whether the large message is broadcast from the master.
+   */
+  bool isBroadcast;
+  /**
+   * The total size of the large message in bytes.
+   */
+  size_t messageSize;
+};
+
 }  // namespace datadriven
 }  // namespace sgpp
@@ -5,6 +5,8 @@
 
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/PendingMPIRequest.hpp>
 
+#include <iterator>
+
 namespace sgpp {
 namespace datadriven {
 PendingMPIRequest::PendingMPIRequest(MPIRequestPool *requestPool)
@@ -20,6 +22,20 @@ MPI_Request *PendingMPIRequest::getMPIRequestFromHandle() {
   return mpiRequestPool.getMPIRequestHandle(mpiRequestIndex);
 }
 
+MPI_Packet *PendingMPIRequest::getPacket() {
+  if (largeMessage.empty()) {
+    return buffer;
+  }
+  return static_cast<MPI_Packet *>(static_cast<void *>(largeMessage.data()));
+}
+
+const void *PendingMPIRequest::getPacketEnd() {
+  if (largeMessage.empty()) {
+    return std::end(buffer->payload);
+  }
+  return largeMessage.data() + largeMessage.size();
+}
+
 size_t PendingMPIRequest::getMPIRequestIndex() {
   return mpiRequestIndex;
 }
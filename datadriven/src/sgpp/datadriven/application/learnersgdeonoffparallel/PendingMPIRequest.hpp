@@ -9,6 +9,8 @@
 
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/MPIRequestPool.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace datadriven {
 class PendingMPIRequest {
@@ -41,6 +43,23 @@ class PendingMPIRequest {
    * Whether this PendingMPIRequest is a request for incoming messages.
    */
   bool inbound;
+  /**
+   * Holds a large message (MPI_Packet header followed by a payload of arbitrary length) that is
+   * sent by this request or that was received after this request delivered its announcement.
+   */
+  std::vector<unsigned char> largeMessage;
+
+  /**
+   * Get the packet carried by this request, which is the large message if there is one.
+   * @return The packet of this request.
+   */
+  sgpp::datadriven::MPI_Packet *getPacket();
+
+  /**
+   * Get the end of the packet carried by this request.
+   * @return The end of the packet's payload.
+   */
+  const void *getPacketEnd();
 
   /**
    * Fetch the MPI_Request from its handle that is attached to this PendingMPIRequest.
@@ -4,11 +4,13 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorFactory.hpp>
 #include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
 #include <iostream>
+#include <sstream>
 #include <string>
 
 namespace sgpp {
@@ -24,6 +26,10 @@ void SparseGridMiner::setModel(ModelFittingBase* model) { fitter.reset(model); }
 
 Visualizer* SparseGridMiner::getVisualizer() { return &(*visualizer); }
 
+void SparseGridMiner::setEarlyStoppingCriterion(std::function<bool(double)> criterion) {
+  earlyStoppingCriterion = criterion;
+}
+
 void SparseGridMiner::print(std::ostringstream& messageStream) { print(messageStream.str()); }
 
 void SparseGridMiner::print(const char* message) { print(std::string(message)); }
@@ -38,5 +44,18 @@ void SparseGridMiner::print(const std::string& message) {
 #endif
 }
 
+SparseGridMiner::TracingSummary::TracingSummary(bool verbose) : verbose(verbose) {}
+
+SparseGridMiner::TracingSummary::~TracingSummary() {
+#ifdef SGPP_TRACING
+  if (verbose) {
+    std::ostringstream out;
+    out << "###############Tracing summary" << std::endl;
+    base::Tracer::getInstance().printSummary(out);
+    print(out);
+  }
+#endif
+}
+
 } /* namespace datadriven */
 }  // namespace sgpp
@@ -11,6 +11,7 @@
 #include <sgpp/datadriven/datamining/modules/scoring/Scorer.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
 
+#include <functional>
 #include <initializer_list>
 #include <memory>
 #include <sstream>
@@ -83,6 +84,14 @@ class SparseGridMiner {
 
   Visualizer *getVisualizer();
 
+  /**
+   * Set a criterion to cancel the learning process early. It is evaluated once on the validation
+   * score obtained after the first refinement step. If it returns true, learn() stops and returns
+   * this score.
+   * @param criterion predicate on the validation score, an empty function disables early stopping
+   */
+  void setEarlyStoppingCriterion(std::function<bool(double)> criterion);
+
   /**
    * Evaluate the model on a certain test dataset.
    *
@@ -111,6 +120,25 @@ class SparseGridMiner {
   static void print(std::ostringstream &messageStream);
 
  protected:
+  /**
+   * Prints the summary of the traced scopes and counters (see sgpp::base::Tracer) when it is
+   * destroyed, if verbose output is requested and SG++ is compiled with tracing (USE_TRACING=1).
+   * Declared in learn before the traced scope of the learning process, such that the summary
+   * includes this scope.
+   */
+  class TracingSummary {
+   public:
+    /**
+     * @param verbose whether the summary should be printed
+     */
+    explicit TracingSummary(bool verbose);
+
+    ~TracingSummary();
+
+   private:
+    bool verbose;
+  };
+
   /**
    * Fitter that trains a model based on data samples.
    */
@@ -125,6 +153,12 @@ class SparseGridMiner {
   * an input of graphic libraries to visualize the models
   */
   std::unique_ptr<Visualizer> visualizer;
+
+  /**
+   * Optional criterion to stop learning after the first refinement step (e.g. for cancelling bad
+   * trials during hyperparameter optimization)
+   */
+  std::function<bool(double)> earlyStoppingCriterion;
 };
 }  // namespace datadriven
 }  // namespace sgpp
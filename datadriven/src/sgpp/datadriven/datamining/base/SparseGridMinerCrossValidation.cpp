@@ -6,6 +6,7 @@
 #include <sgpp/datadriven/datamining/base/SparseGridMinerCrossValidation.hpp>
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorFactory.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
@@ -21,6 +22,9 @@ SparseGridMinerCrossValidation::SparseGridMinerCrossValidation(
     : SparseGridMiner(fitter, scorer, visualizer), dataSource{dataSource} {}
 
 double SparseGridMinerCrossValidation::learn(bool verbose) {
+  TracingSummary tracingSummary(verbose);
+  SGPP_TRACE_SCOPE("SparseGridMinerCrossValidation::learn");
+
 // todo(fuchsgdk): see below
 
 #ifdef USE_SCALAPACK
@@ -38,6 +42,7 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
   std::vector<double> scores;
   scores.reserve(crossValidationConfig.kfold_);
 
+  bool checkEarlyStopping = static_cast<bool>(earlyStoppingCriterion);
   for (size_t fold = 0; fold < crossValidationConfig.kfold_; fold++) {
     dataSource->setFold(fold);
 
@@ -114,6 +119,18 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
         size_t refinements = monitor->refinementsNecessary();
         while (refinements--) {
           fitter->adapt();
+          if (checkEarlyStopping) {
+            // only checked on the first fold, the score of the other folds is not known yet
+            checkEarlyStopping = false;
+            double scoreRefined = scorer->test(*fitter, *validationData);
+            if (earlyStoppingCriterion(scoreRefined)) {
+              if (verbose) {
+                print("Learning stopped early after the first refinement step.");
+              }
+              delete monitor;
+              return scoreRefined;
+            }
+          }
         }
 
         if (verbose) {
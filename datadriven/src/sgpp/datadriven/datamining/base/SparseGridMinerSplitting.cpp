@@ -6,6 +6,7 @@
 #include <sgpp/datadriven/datamining/base/SparseGridMinerSplitting.hpp>
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorFactory.hpp>
 #include <sgpp/datadriven/datamining/builder/ScorerFactory.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
@@ -22,6 +23,9 @@ SparseGridMinerSplitting::SparseGridMinerSplitting(DataSourceSplitting* dataSour
     : SparseGridMiner(fitter, scorer, visualizer), dataSource{dataSource} {}
 
 double SparseGridMinerSplitting::learn(bool verbose) {
+  TracingSummary tracingSummary(verbose);
+  SGPP_TRACE_SCOPE("SparseGridMinerSplitting::learn");
+
 #ifdef USE_SCALAPACK
   if (fitter->getFitterConfiguration().getParallelConfig().scalapackEnabled_) {
     auto processGrid = fitter->getProcessGrid();
@@ -56,6 +60,7 @@ double SparseGridMinerSplitting::learn(bool verbose) {
     }
   }
 
+  bool checkEarlyStopping = static_cast<bool>(earlyStoppingCriterion);
   for (size_t epoch = 0; epoch < dataSource->getConfig().epochs_; epoch++) {
     if (verbose) {
       std::ostringstream out;
@@ -101,6 +106,17 @@ double SparseGridMinerSplitting::learn(bool verbose) {
       size_t refinements = monitor->refinementsNecessary();
       while (refinements--) {
         fitter->adapt();
+        if (checkEarlyStopping) {
+          checkEarlyStopping = false;
+          double scoreRefined = scorer->test(*fitter, *(dataSource->getValidationData()));
+          if (earlyStoppingCriterion(scoreRefined)) {
+            if (verbose) {
+              print("Learning stopped early after the first refinement step.");
+            }
+            delete monitor;
+            return scoreRefined;
+          }
+        }
       }
       if (verbose) {
         print("###############Iteration finished.");
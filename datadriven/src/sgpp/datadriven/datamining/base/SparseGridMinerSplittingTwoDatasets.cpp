@@ -7,6 +7,7 @@
 
 #include <sgpp/datadriven/tools/Dataset.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorFactory.hpp>
 
 #include <iostream>
@@ -23,6 +24,9 @@ SparseGridMinerSplittingTwoDatasets::SparseGridMinerSplittingTwoDatasets(
       dataSourceQ{dataSource[1]} {}
 
 double SparseGridMinerSplittingTwoDatasets::learn(bool verbose) {
+  TracingSummary tracingSummary(verbose);
+  SGPP_TRACE_SCOPE("SparseGridMinerSplittingTwoDatasets::learn");
+
   fitter->verboseSolver = verbose;
   // Setup refinement monitor
   RefinementMonitorFactory monitorFactory;
@@ -37,12 +37,22 @@ SparseGridMiner* MinerFactory::buildMiner(const std::string& path) const {
 
 sgpp::datadriven::HyperparameterOptimizer* MinerFactory::buildHPO(const std::string& path) const {
   DataMiningConfigParser parser(path);
+  HyperparameterOptimizer* hpo;
   if (parser.getHPOMethod("bayesian") == "harmonica") {
-    return new HarmonicaHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser),
-                                                parser);
+    hpo = new HarmonicaHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser),
+                                               parser);
   } else {
-    return new BoHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser);
+    hpo = new BoHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser);
   }
+
+  // every concurrently trained trial needs a miner with its own data source
+  HPOConfig hpoConfig;
+  hpoConfig.setupDefaults();
+  parser.getHPOConfig(hpoConfig);
+  for (int64_t i = 1; i < hpoConfig.getNParallelTrials(); i++) {
+    hpo->addTrialMiner(buildMiner(path));
+  }
+  return hpo;
 }
 
 DataSourceSplitting* MinerFactory::createDataSourceSplitting(
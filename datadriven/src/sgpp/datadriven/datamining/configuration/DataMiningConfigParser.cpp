@@ -1075,6 +1075,12 @@ void DataMiningConfigParser::getHPOConfig(HPOConfig &config) {
     auto node = static_cast<DictNode *>(&(*configFile)["hpo"]);
     config.setSeed(parseInt(*node, "randomSeed", config.getSeed(), "hpo"));
     config.setNTrainSamples(parseInt(*node, "trainSize", config.getNTrainSamples(), "hpo"));
+    config.setNParallelTrials(
+        parseInt(*node, "parallelTrials", config.getNParallelTrials(), "hpo"));
+    config.setThreadsPerTrial(
+        parseInt(*node, "threadsPerTrial", config.getThreadsPerTrial(), "hpo"));
+    config.setEarlyStoppingFactor(
+        parseDouble(*node, "earlyStoppingFactor", config.getEarlyStoppingFactor(), "hpo"));
     if (node->contains("harmonica")) {
       auto harmonica = static_cast<DictNode *>(&(*node)["harmonica"]);
       config.setLambda(parseDouble(*harmonica, "lambda", config.getLambda(), "hpo"));
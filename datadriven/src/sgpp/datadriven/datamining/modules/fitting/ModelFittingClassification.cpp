@@ -278,10 +278,19 @@ MultiGridRefinementFunctor* ModelFittingClassification::getRefinementFunctor(
           return nullptr;
         }
       }
-      return new DataBasedRefinementFunctor(
-          grids, surpluses, priors, &(dataset->getData()),
-          &(dataset->getTargets()), refinementConfig.numRefinementPoints_,
-          refinementConfig.levelPenalize_, refinementConfig.scalingCoefficients_);
+      // the functor is kept between refinement steps, such that only the
+      // changes of grids and surpluses have to be evaluated
+      if (dataBasedRefinementFunctor &&
+          dataBasedRefinementFunctor->getNumGrids() == grids.size()) {
+        dataBasedRefinementFunctor->setPriors(priors);
+        dataBasedRefinementFunctor->updateH();
+      } else {
+        dataBasedRefinementFunctor = std::make_unique<DataBasedRefinementFunctor>(
+            grids, surpluses, priors, &(dataset->getData()),
+            &(dataset->getTargets()), refinementConfig.numRefinementPoints_,
+            refinementConfig.levelPenalize_, refinementConfig.scalingCoefficients_);
+      }
+      return dataBasedRefinementFunctor.get();
     }
     case RefinementFunctorType::SurplusVolume: {
       std::string errorMessage =
@@ -406,7 +415,10 @@ bool ModelFittingClassification::adapt() {
                   << " (new size : " << (grids[idx]->getSize()) << ")"
                   << std::endl;
       }
-      delete func;
+      // the data-based functor is owned by this object
+      if (func != dataBasedRefinementFunctor.get()) {
+        delete func;
+      }
     }
     refinementsPerformed++;
     return true;
@@ -416,6 +428,9 @@ bool ModelFittingClassification::adapt() {
 
 void ModelFittingClassification::update(Dataset& newDataset) {
   dataset = &newDataset;
+  if (dataBasedRefinementFunctor) {
+    dataBasedRefinementFunctor->setData(&(dataset->getData()), &(dataset->getTargets()));
+  }
 
   // Split the dataset into classes
   DataVector tmp(newDataset.getDimension());
@@ -445,6 +460,7 @@ void ModelFittingClassification::update(Dataset& newDataset) {
 }
 
 void ModelFittingClassification::reset() {
+  dataBasedRefinementFunctor.reset();
   models.clear();
   classNumberInstances.clear();
   classIdx.clear();
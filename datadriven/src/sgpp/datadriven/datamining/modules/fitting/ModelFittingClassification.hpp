@@ -13,6 +13,7 @@
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBaseSingleGrid.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingDensityEstimation.hpp>
 #include <sgpp/datadriven/functors/MultiGridRefinementFunctor.hpp>
+#include <sgpp/datadriven/functors/classification/DataBasedRefinementFunctor.hpp>
 #include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
 #include <sgpp/globaldef.hpp>
@@ -179,7 +180,8 @@ class ModelFittingClassification : public ModelFittingBase {
    * @param grids vector of pointers to grids for each class
    * @param surpluses vector of pointers to the surpluses for each class
    * @param priors vector of priors for each class
-   * @return pointer to a refinement functor that suits the model settings
+   * @return pointer to a refinement functor that suits the model settings, the data-based functor
+   * is owned by this object, all others have to be deleted by the caller
    */
   MultiGridRefinementFunctor* getRefinementFunctor(std::vector<Grid*> grids,
                                                    std::vector<DataVector*> surpluses,
@@ -218,6 +220,12 @@ class ModelFittingClassification : public ModelFittingBase {
    */
   std::vector<size_t> classNumberInstances;
 
+  /**
+   * Data-based refinement functor, kept between refinement steps to update its cached evaluations
+   * incrementally
+   */
+  std::unique_ptr<DataBasedRefinementFunctor> dataBasedRefinementFunctor;
+
 #ifdef USE_SCALAPACK
   /**
    * BLACS process grid for ScaLAPACK version
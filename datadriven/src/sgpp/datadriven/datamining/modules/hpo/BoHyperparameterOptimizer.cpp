@@ -7,6 +7,7 @@
 #include <sgpp/datadriven/datamining/modules/hpo/BoHyperparameterOptimizer.hpp>
 #include <sgpp/datadriven/datamining/modules/hpo/bo/BayesianOptimization.hpp>
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <limits>
@@ -62,28 +63,33 @@ double BoHyperparameterOptimizer::run(bool writeToFile) {
   std::mt19937 generator(static_cast<std::mt19937::result_type>(config.getSeed()));
 
   // random warmup phase
-  for (int i = 0; i < config.getNRandom(); ++i) {
+  std::vector<ModelFittingBase *> fitters(static_cast<size_t>(config.getNRandom()));
+  std::vector<std::string> configStrings(fitters.size());
+  for (size_t i = 0; i < fitters.size(); ++i) {
     initialConfigs.emplace_back(prototype);
     initialConfigs[i].randomize(generator);
     fitterFactory->setBO(initialConfigs[i]);
-    std::string configString = fitterFactory->printConfig();
-    // std::unique_ptr<ModelFittingBase> fitter(fitterFactory->buildFitter());
-    miner->setModel(fitterFactory->buildFitter());
-    double result = miner->learn(false);
-    // hpoScorer->calculateScore(*fitter, *trainData, &stdDeviation);
+    configStrings[i] = fitterFactory->printConfig();
+    fitters[i] = fitterFactory->buildFitter();
+  }
+  DataVector results(fitters.size());
+  evaluateTrials(fitters, results, best);
+
+  for (size_t i = 0; i < fitters.size(); ++i) {
+    double result = results[i];
     initialConfigs[i].setScore(transformScore(result));
-    std::cout << (i + 1) << configString << ", " << result;
+    std::cout << (i + 1) << configStrings[i] << ", " << result;
     if (writeToFile) {
       myfile.open(fn.str(), std::ios_base::app);
       if (myfile.is_open()) {
-        myfile << (i + 1) << configString << ", " << result << std::endl;
+        myfile << (i + 1) << configStrings[i] << ", " << result << std::endl;
       }
       myfile.close();
     }
     if (result < best) {
       best = result;
-      bestscnt = i + 1;
-      bestconfigstring = configString;
+      bestscnt = static_cast<int>(i + 1);
+      bestconfigstring = configStrings[i];
       std::cout << " new best!";
     }
     std::cout << std::endl;
@@ -95,31 +101,50 @@ double BoHyperparameterOptimizer::run(bool writeToFile) {
   bo.setScales(bo.fitScales(), 0.7);
 
 
-  // main loop
-  for (int q = 0; q < config.getNRuns(); q++) {
-    BOConfig nextConfig = bo.main(prototype);
-    fitterFactory->setBO(nextConfig);
-    std::string configString = fitterFactory->printConfig();
-    miner->setModel(fitterFactory->buildFitter());
-    double result = miner->learn(false);
-    nextConfig.setScore(transformScore(result));
-    bo.updateGP(nextConfig, true);
-    bo.setScales(bo.fitScales(), 0.1);
-    std::cout << (q + config.getNRandom() + 1) << configString << ", " << result;
-    if (writeToFile) {
-      myfile.open(fn.str(), std::ios_base::app);
-      if (myfile.is_open()) {
-        myfile << (q + config.getNRandom() + 1) << configString << ", " << result << std::endl;
-      }
-      myfile.close();
+  // main loop, proposes one batch of points per iteration to keep all trial miners busy
+  size_t batchSize = static_cast<size_t>(std::max(config.getNParallelTrials(),
+                                                  static_cast<int64_t>(1)));
+  for (int q = 0; q < config.getNRuns(); q += static_cast<int>(batchSize)) {
+    size_t nBatch = std::min(batchSize, static_cast<size_t>(config.getNRuns() - q));
+    std::vector<BOConfig> nextConfigs;
+    if (nBatch == 1) {
+      nextConfigs.push_back(bo.main(prototype));
+    } else {
+      nextConfigs = bo.proposeBatch(prototype, nBatch);
     }
-    if (result < best) {
-      best = result;
-      bestscnt = static_cast<int>(q + config.getNRandom() + 1);
-      bestconfigstring = configString;
-      std::cout << " new best!";
+
+    fitters.resize(nBatch);
+    configStrings.resize(nBatch);
+    for (size_t i = 0; i < nBatch; ++i) {
+      fitterFactory->setBO(nextConfigs[i]);
+      configStrings[i] = fitterFactory->printConfig();
+      fitters[i] = fitterFactory->buildFitter();
     }
-    std::cout << std::endl;
+    results.resize(nBatch);
+    evaluateTrials(fitters, results, best);
+
+    for (size_t i = 0; i < nBatch; ++i) {
+      double result = results[i];
+      int sampleNo = static_cast<int>(q + config.getNRandom() + 1 + static_cast<int>(i));
+      nextConfigs[i].setScore(transformScore(result));
+      bo.updateGP(nextConfigs[i], true);
+      std::cout << sampleNo << configStrings[i] << ", " << result;
+      if (writeToFile) {
+        myfile.open(fn.str(), std::ios_base::app);
+        if (myfile.is_open()) {
+          myfile << sampleNo << configStrings[i] << ", " << result << std::endl;
+        }
+        myfile.close();
+      }
+      if (result < best) {
+        best = result;
+        bestscnt = sampleNo;
+        bestconfigstring = configStrings[i];
+        std::cout << " new best!";
+      }
+      std::cout << std::endl;
+    }
+    bo.setScales(bo.fitScales(), 0.1);
   }
   if (writeToFile) {
     myfile.open(fn.str(), std::ios_base::app);
@@ -18,6 +18,9 @@ void HPOConfig::setupDefaults() {
   constraints = {2, 2};
   lambda = 1;
   nRandom = 10;
+  nParallelTrials = 1;
+  threadsPerTrial = 0;
+  earlyStoppingFactor = 0;
 }
 
 int64_t HPOConfig::getSeed() const {
@@ -75,5 +78,29 @@ int64_t HPOConfig::getNTrainSamples() const {
 void HPOConfig::setNTrainSamples(int64_t nTrainSamples) {
   HPOConfig::nTrainSamples = nTrainSamples;
 }
+
+int64_t HPOConfig::getNParallelTrials() const {
+  return nParallelTrials;
+}
+
+void HPOConfig::setNParallelTrials(int64_t nParallelTrials) {
+  HPOConfig::nParallelTrials = nParallelTrials;
+}
+
+int64_t HPOConfig::getThreadsPerTrial() const {
+  return threadsPerTrial;
+}
+
+void HPOConfig::setThreadsPerTrial(int64_t threadsPerTrial) {
+  HPOConfig::threadsPerTrial = threadsPerTrial;
+}
+
+double HPOConfig::getEarlyStoppingFactor() const {
+  return earlyStoppingFactor;
+}
+
+void HPOConfig::setEarlyStoppingFactor(double earlyStoppingFactor) {
+  HPOConfig::earlyStoppingFactor = earlyStoppingFactor;
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -48,6 +48,18 @@ class HPOConfig {
 
   void setNTrainSamples(int64_t nTrainSamples);
 
+  int64_t getNParallelTrials() const;
+
+  void setNParallelTrials(int64_t nParallelTrials);
+
+  int64_t getThreadsPerTrial() const;
+
+  void setThreadsPerTrial(int64_t threadsPerTrial);
+
+  double getEarlyStoppingFactor() const;
+
+  void setEarlyStoppingFactor(double earlyStoppingFactor);
+
  private:
   /**
    * Seed for random sampling in both harmonica and bayesian optimization
@@ -77,6 +89,21 @@ class HPOConfig {
    * number of samples bayesian optimization is run for
    */
   int64_t nRuns;
+  /**
+   * Number of trials (fitter configurations) that are trained concurrently. For bayesian
+   * optimization this is also the size of the batch of points proposed per iteration.
+   */
+  int64_t nParallelTrials;
+  /**
+   * Number of OpenMP threads each concurrent trial may use, 0 splits the available threads
+   * evenly among the trials
+   */
+  int64_t threadsPerTrial;
+  /**
+   * A trial is cancelled if its validation score after the first refinement step exceeds this
+   * factor times the best score found so far, 0 disables early stopping
+   */
+  double earlyStoppingFactor;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -60,11 +60,9 @@ double HarmonicaHyperparameterOptimizer::run(bool writeToFile) {
     std::vector<std::string> configStrings(nRuns);
     harmonica.prepareConfigs(fitters, static_cast<int>(config.getSeed()), configStrings);
 
-    // run samples (parallelize here)
+    // run samples concurrently, then report them in order
+    evaluateTrials(fitters, scores, best);
     for (size_t i = 0; i < nRuns; i++) {
-      miner->setModel(fitters[i]);
-      scores[i] = miner->learn(false);
-      // hpoScorer->calculateScore(*(fitters[i]), *trainData, &stdDeviation);
       std::cout << scnt << configStrings[i] << ", " << scores[i];
       if (scores[i] < best) {
         best = scores[i];
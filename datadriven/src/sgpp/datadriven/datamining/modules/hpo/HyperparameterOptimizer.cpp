@@ -5,7 +5,9 @@
 
 #include <sgpp/datadriven/datamining/modules/hpo/HyperparameterOptimizer.hpp>
 
+#include <omp.h>
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <limits>
@@ -20,5 +22,67 @@ HyperparameterOptimizer::HyperparameterOptimizer(SparseGridMiner* miner,
   config.setupDefaults();
   parser.getHPOConfig(config);
 }
+
+void HyperparameterOptimizer::addTrialMiner(SparseGridMiner *trialMiner) {
+  trialMiners.emplace_back(trialMiner);
+}
+
+void HyperparameterOptimizer::evaluateTrials(std::vector<ModelFittingBase *> &fitters,
+                                             base::DataVector &scores, double bestSoFar) {
+  if (fitters.empty()) {
+    return;
+  }
+  size_t nWorkers = std::min(trialMiners.size() + 1, fitters.size());
+  if (config.getNParallelTrials() > 0) {
+    nWorkers = std::min(nWorkers, static_cast<size_t>(config.getNParallelTrials()));
+  }
+  int threadsPerTrial = static_cast<int>(config.getThreadsPerTrial());
+  if (threadsPerTrial <= 0) {
+    threadsPerTrial = std::max(1, omp_get_max_threads() / static_cast<int>(nWorkers));
+  }
+
+  double best = bestSoFar;
+  double earlyStoppingFactor = config.getEarlyStoppingFactor();
+  std::function<bool(double)> criterion;
+  if (earlyStoppingFactor > 0) {
+    criterion = [&best, earlyStoppingFactor](double score) {
+      double reference;
+#pragma omp critical(HyperparameterOptimizerBest)
+      { reference = best; }
+      return reference < std::numeric_limits<double>::infinity() &&
+             score > earlyStoppingFactor * reference;
+    };
+  }
+  miner->setEarlyStoppingCriterion(criterion);
+  for (auto &trialMiner : trialMiners) {
+    trialMiner->setEarlyStoppingCriterion(criterion);
+  }
+
+  // allow the trials to spawn their own parallel regions
+  int maxActiveLevels = omp_get_max_active_levels();
+  omp_set_max_active_levels(std::max(maxActiveLevels, 2));
+
+#pragma omp parallel num_threads(static_cast<int>(nWorkers))
+  {
+    size_t worker = static_cast<size_t>(omp_get_thread_num());
+    SparseGridMiner *workerMiner = (worker == 0) ? miner.get() : trialMiners[worker - 1].get();
+    omp_set_num_threads(threadsPerTrial);
+
+#pragma omp for schedule(dynamic, 1)
+    for (size_t i = 0; i < fitters.size(); i++) {
+      workerMiner->setModel(fitters[i]);
+      double score = workerMiner->learn(false);
+      scores[i] = score;
+#pragma omp critical(HyperparameterOptimizerBest)
+      { best = std::min(best, score); }
+    }
+  }
+
+  omp_set_max_active_levels(maxActiveLevels);
+  miner->setEarlyStoppingCriterion(std::function<bool(double)>());
+  for (auto &trialMiner : trialMiners) {
+    trialMiner->setEarlyStoppingCriterion(std::function<bool(double)>());
+  }
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
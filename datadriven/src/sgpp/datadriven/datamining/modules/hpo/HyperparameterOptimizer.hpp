@@ -12,6 +12,7 @@
 #include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -69,13 +70,36 @@ class HyperparameterOptimizer {
    */
   virtual double run(bool writeToFile) = 0;
 
+  /**
+   * Add another miner that is used to train trials concurrently to the main miner. Each miner
+   * should have its own data source as all miners learn at the same time.
+   * @param trialMiner configured instance of SGMiner object. The HyperparameterOptimizer instance
+   * will take ownership of the passed object.
+   */
+  void addTrialMiner(SparseGridMiner *trialMiner);
 
  protected:
+  /**
+   * Train and score a batch of independent fitter configurations. The trials are distributed
+   * dynamically over the available miners, each running with its share of OpenMP threads. If
+   * early stopping is configured, a trial is cancelled after its first refinement step if its
+   * score is clearly worse than the best one seen so far.
+   * @param fitters fitters to train, ownership is passed to the miners
+   * @param scores vector of the same size as fitters to store the score of each trial in
+   * @param bestSoFar best score of previous trials used as reference for early stopping
+   */
+  void evaluateTrials(std::vector<ModelFittingBase *> &fitters, base::DataVector &scores,
+                      double bestSoFar);
   /**
    * Miner providing all testing facilities
    */
   std::unique_ptr<SparseGridMiner> miner;
 
+  /**
+   * Additional miners to train trials concurrently with miner
+   */
+  std::vector<std::unique_ptr<SparseGridMiner>> trialMiners;
+
   /**
    * FitterFactory to provide fitters for running different hyperparameter configurations.
    */
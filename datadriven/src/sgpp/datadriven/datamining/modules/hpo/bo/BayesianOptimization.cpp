@@ -101,6 +101,25 @@ BOConfig BayesianOptimization::main(BOConfig &prototype) {
   return bestConfig;
 }
 
+std::vector<BOConfig> BayesianOptimization::proposeBatch(BOConfig &prototype, size_t batchSize) {
+  std::vector<BOConfig> batch;
+  batch.reserve(batchSize);
+  double lie = std::numeric_limits<double>::infinity();
+  for (auto &config : allConfigs) {
+    lie = std::fmin(lie, config.getScore());
+  }
+  BayesianOptimization liar(*this);
+  for (size_t i = 0; i < batchSize; i++) {
+    batch.push_back(liar.main(prototype));
+    if (i + 1 < batchSize) {
+      BOConfig lied(batch.back());
+      lied.setScore(lie);
+      liar.updateGP(lied, true);
+    }
+  }
+  return batch;
+}
+
 double BayesianOptimization::acquisitionOuter(const base::DataVector &inp) {
   base::DataVector kernelrow(allConfigs.size());
   for (size_t i = 0; i < allConfigs.size(); i++) {
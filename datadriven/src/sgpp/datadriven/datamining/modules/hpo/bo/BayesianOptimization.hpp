@@ -65,6 +65,16 @@ class BayesianOptimization {
    */
   BOConfig main(BOConfig &prototype);
 
+  /**
+   * routine to find a batch of new sample points that can be evaluated concurrently. Uses the
+   * constant liar heuristic: every proposed point enters a copy of the Gaussian Process with the
+   * best score so far as a fake score before the next point is proposed.
+   * @param prototype baseline BOConfig
+   * @param batchSize number of sample points to propose
+   * @return new sample points
+   */
+  std::vector<BOConfig> proposeBatch(BOConfig &prototype, size_t batchSize);
+
 
   /**
    * kernel function
@@ -4,6 +4,7 @@
 // sgpp.sparsegrids.org
 
 
+#include <sgpp/base/operation/hash/common/basis/Basis.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
@@ -12,6 +13,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <memory>
 #include <vector>
 
 
@@ -28,7 +30,9 @@ namespace datadriven {
                              bool levelPen,
                              std::vector<double> coeff_a,
                              double thresh) :
-    grids(grids), alphas(alphas), priors(priors), evals(0, 0),
+    grids(grids), alphas(alphas), priors(priors), priorsChanged(false),
+    evals(0, 0),
+    cachedAlphas(), cachedPoints(), cachedData(nullptr), cachedDataRows(0),
     data(data), targets(targets), h(grids.size()),
     means(), coeff_a(coeff_a), current_grid_index(0),
     refinements_num(refinements_num),
@@ -90,50 +94,218 @@ namespace datadriven {
                                            base::DataVector* targets) {
     this->data = data;
     this->targets = targets;
+    // the content behind the pointers may have changed as well
+    cachedData = nullptr;
+  }
+
+  void DataBasedRefinementFunctor::setPriors(const std::vector<double>& priors) {
+    if (priors != this->priors) {
+      this->priors = priors;
+      priorsChanged = true;
+    }
   }
 
   void DataBasedRefinementFunctor::computeH() {
     // Evaluate all grids at all data points
-    base::DataVector evalVec(data->getNrows());
     evals.resize(data->getNrows(), grids.size());
     for (size_t i = 0; i < grids.size(); i++) {
-      std::unique_ptr<base::OperationMultipleEval>
-        opEval(op_factory::createOperationMultipleEval(*grids.at(i),
-                                                       *data));
-      opEval->eval(*alphas.at(i), evalVec);
-      evals.setColumn(i, evalVec);
-      means.push_back(evalVec.sum() *
-                      (priors.at(i) / static_cast<double>(data->getNrows())));
+      evaluateClass(i);
+      cacheClassState(i);
     }
+    cachedData = data;
+    cachedDataRows = data->getNrows();
+    computeHFromEvaluations();
+  }
 
-    // Compute the sets H_k by pairwise H_kl for all class combiniations
-    // of k != l
+  void DataBasedRefinementFunctor::updateH() {
+    if (data == nullptr || targets == nullptr) {
+      return;
+    }
+    if (data != cachedData || data->getNrows() != cachedDataRows ||
+        evals.getNcols() != grids.size() || cachedAlphas.size() != grids.size()) {
+      computeH();
+      return;
+    }
+    bool anyChanged = false;
     for (size_t i = 0; i < grids.size(); i++) {
-      h.push_back(base::DataMatrix());
-      h.at(i).resize(0, data->getNcols());
-      for (size_t j = 0; j < grids.size(); j++) {
-        if (i == j) {
-          continue;
+      bool changed = false;
+      if (!updateClassEvaluations(i, changed)) {
+        evaluateClass(i);
+        changed = true;
+      }
+      if (changed) {
+        cacheClassState(i);
+        anyChanged = true;
+      }
+    }
+    if (anyChanged || priorsChanged) {
+      computeHFromEvaluations();
+    }
+  }
+
+  void DataBasedRefinementFunctor::preComputeEvaluations() {
+    updateH();
+  }
+
+  void DataBasedRefinementFunctor::evaluateClass(size_t cl_ind) {
+    base::DataVector evalVec(data->getNrows());
+    std::unique_ptr<base::OperationMultipleEval>
+      opEval(op_factory::createOperationMultipleEval(*grids.at(cl_ind),
+                                                     *data));
+    opEval->eval(*alphas.at(cl_ind), evalVec);
+    evals.setColumn(cl_ind, evalVec);
+  }
+
+  bool DataBasedRefinementFunctor::updateClassEvaluations(size_t cl_ind,
+                                                          bool& changed) {
+    base::Grid& grid = *grids.at(cl_ind);
+    base::GridStorage& storage = grid.getStorage();
+    base::DataVector& alpha = *alphas.at(cl_ind);
+    base::DataVector& cachedAlpha = cachedAlphas.at(cl_ind);
+    std::vector<base::HashGridPoint>& points = cachedPoints.at(cl_ind);
+
+    // Only tensor products of one dimensional bases can be evaluated point
+    // by point
+    base::GridType type = grid.getType();
+    if (type != base::GridType::Linear && type != base::GridType::ModLinear &&
+        type != base::GridType::LinearL0Boundary &&
+        type != base::GridType::LinearBoundary &&
+        type != base::GridType::Poly && type != base::GridType::ModPoly &&
+        type != base::GridType::PolyBoundary) {
+      changed = true;
+      return false;
+    }
+
+    // Removed points would have to be subtracted, which requires a full
+    // evaluation
+    size_t numPoints = std::min(alpha.getSize(), storage.getSize());
+    if (numPoints < points.size()) {
+      changed = true;
+      return false;
+    }
+    for (size_t j = 0; j < points.size(); j++) {
+      if (!storage.getPoint(j).equals(points[j])) {
+        changed = true;
+        return false;
+      }
+    }
+
+    std::vector<size_t> changedPoints;
+    std::vector<double> deltas;
+    for (size_t j = 0; j < numPoints; j++) {
+      double old = (j < cachedAlpha.getSize()) ? cachedAlpha[j] : 0.0;
+      if (alpha[j] != old) {
+        changedPoints.push_back(j);
+        deltas.push_back(alpha[j] - old);
+      }
+    }
+    if (changedPoints.empty()) {
+      changed = numPoints != points.size();
+      return true;
+    }
+    changed = true;
+    // Evaluating single basis functions only pays off for few changes
+    if (changedPoints.size() > numPoints / 8) {
+      return false;
+    }
+
+    size_t dim = storage.getDimension();
+    std::vector<unsigned int> levels(changedPoints.size() * dim);
+    std::vector<unsigned int> indices(changedPoints.size() * dim);
+    for (size_t j = 0; j < changedPoints.size(); j++) {
+      base::HashGridPoint& gp = storage.getPoint(changedPoints[j]);
+      for (size_t d = 0; d < dim; d++) {
+        levels[j * dim + d] = gp.getLevel(d);
+        indices[j * dim + d] = gp.getIndex(d);
+      }
+    }
+
+    base::SBasis& basis = grid.getBasis();
+    size_t numData = data->getNrows();
+    #pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < numData; i++) {
+      const double* x = data->getPointer() + i * dim;
+      double contribution = 0.0;
+      for (size_t j = 0; j < changedPoints.size(); j++) {
+        double value = deltas[j];
+        for (size_t d = 0; d < dim && value != 0.0; d++) {
+          value *= basis.eval(levels[j * dim + d], indices[j * dim + d], x[d]);
         }
-        computeHkl(h.at(i), i, j);
+        contribution += value;
       }
+      evals.set(i, cl_ind, evals.get(i, cl_ind) + contribution);
     }
+    return true;
   }
 
-  void DataBasedRefinementFunctor::computeHkl(base::DataMatrix& inters,
-                                              size_t cl_ind1,
-                                              size_t cl_ind2) {
-    double val_1 = 0.0; double val_2 = 0.0;
-    base::DataVector p(data->getNcols());
-    for (size_t i = 0; i < evals.getNrows(); i++) {
-      val_1 = evals.get(i, cl_ind1);
-      val_2 = evals.get(i, cl_ind2);
-      // If both PDFs surpass the threshold: mu * coeff_a, added the data
-      // point
-      if (val_1 > means.at(cl_ind1) * coeff_a.at(cl_ind1) &&
-         val_2 > means.at(cl_ind2) * coeff_a.at(cl_ind2)) {
-        data->getRow(i, p);
-        inters.appendRow(p);
+  void DataBasedRefinementFunctor::cacheClassState(size_t cl_ind) {
+    if (cachedAlphas.size() != grids.size()) {
+      cachedAlphas.resize(grids.size());
+      cachedPoints.resize(grids.size());
+    }
+    base::GridStorage& storage = grids.at(cl_ind)->getStorage();
+    base::DataVector& alpha = *alphas.at(cl_ind);
+    size_t numPoints = std::min(alpha.getSize(), storage.getSize());
+    cachedAlphas.at(cl_ind) = base::DataVector(alpha.getPointer(), numPoints);
+    std::vector<base::HashGridPoint>& points = cachedPoints.at(cl_ind);
+    points.clear();
+    points.reserve(numPoints);
+    for (size_t j = 0; j < numPoints; j++) {
+      points.push_back(storage.getPoint(j));
+    }
+  }
+
+  void DataBasedRefinementFunctor::computeHFromEvaluations() {
+    size_t numClasses = grids.size();
+    size_t numData = evals.getNrows();
+    size_t dim = data->getNcols();
+
+    priorsChanged = false;
+    means.assign(numClasses, 0.0);
+    base::DataVector evalVec(numData);
+    for (size_t k = 0; k < numClasses; k++) {
+      evals.getColumn(k, evalVec);
+      means[k] = evalVec.sum() *
+                 (priors.at(k) / static_cast<double>(numData));
+    }
+
+    // Mark for each data point which PDFs surpass their threshold
+    // mu * coeff_a. A point is added to H_k once for every other class l
+    // that is marked as well (this equals the union of all pairwise H_kl).
+    std::vector<char> above(numData * numClasses);
+    std::vector<size_t> aboveCount(numData);
+    #pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < numData; i++) {
+      size_t count = 0;
+      for (size_t k = 0; k < numClasses; k++) {
+        bool isAbove = evals.get(i, k) > means[k] * coeff_a.at(k);
+        above[i * numClasses + k] = isAbove;
+        count += isAbove;
+      }
+      aboveCount[i] = count;
+    }
+
+    h.resize(numClasses);
+    #pragma omp parallel for schedule(dynamic)
+    for (size_t k = 0; k < numClasses; k++) {
+      size_t rows = 0;
+      for (size_t i = 0; i < numData; i++) {
+        if (above[i * numClasses + k]) {
+          rows += aboveCount[i] - 1;
+        }
+      }
+      base::DataMatrix& hk = h[k];
+      hk.resize(rows, dim);
+      double* row = hk.getPointer();
+      for (size_t i = 0; i < numData; i++) {
+        if (!above[i * numClasses + k]) {
+          continue;
+        }
+        const double* p = data->getPointer() + i * dim;
+        for (size_t l = 1; l < aboveCount[i]; l++) {
+          std::copy(p, p + dim, row);
+          row += dim;
+        }
       }
     }
   }
@@ -11,6 +11,7 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
 #include <sgpp/datadriven/functors/MultiGridRefinementFunctor.hpp>
 
 #include <vector>
@@ -66,12 +67,20 @@ class DataBasedRefinementFunctor : public MultiGridRefinementFunctor {
   /**
    * Set the training data + targets which is the basis for determining
    * relevant data points. This method is only necessary in data-streaming
-   * scenarios where the training data changes overall.
+   * scenarios where the training data changes overall. The cached
+   * evaluations are discarded, the next call of updateH() recomputes H.
    * @param data Pointer to the (subset of) training data used
    * @param targets Pointer to the related targets
    */
   void setData(base::DataMatrix* data, base::DataVector* targets);
 
+  /**
+   * Set the priors of the classes, e.g. after new data was processed.
+   * The next call of updateH() recomputes H from the cached evaluations.
+   * @param priors Vector of priors related to the classificator
+   */
+  void setPriors(const std::vector<double>& priors);
+
   /**
    * Recomputes the set of relevant data (the set H). If the training
    * data is changed, call this method to actually re-compute H.
@@ -80,6 +89,22 @@ class DataBasedRefinementFunctor : public MultiGridRefinementFunctor {
    */
   void computeH();
 
+  /**
+   * Updates H after grids or surpluses changed, e.g. after refinement.
+   * The evaluations of the data points are cached per class. Only the
+   * contributions of grid points whose surplus changed since the last
+   * update (including points added by refinement) are evaluated; a class
+   * is evaluated from scratch if most of its surpluses changed, points were
+   * removed, or the training data was replaced. H is only rebuilt if at
+   * least one class or the priors changed.
+   */
+  void updateH();
+
+  /**
+   * Brings the cached evaluations and H up to date, see updateH().
+   */
+  void preComputeEvaluations() override;
+
   /**
    * Returns a ref to the specified H_k, used for debugging /plotting
    * @param index The index k for H_k
@@ -92,11 +117,28 @@ class DataBasedRefinementFunctor : public MultiGridRefinementFunctor {
   std::vector<base::DataVector*> alphas;
   std::vector<double> priors;
 
+  /**
+   * Whether H has to be recomputed even if no evaluations changed
+   */
+  bool priorsChanged;
+
   /**
    * Evaluations of data points are cached here
    */
   base::DataMatrix evals;
 
+  /**
+   * Surpluses and grid points per class the cached evaluations are based on
+   */
+  std::vector<base::DataVector> cachedAlphas;
+  std::vector<std::vector<base::HashGridPoint>> cachedPoints;
+
+  /**
+   * Training data the cached evaluations are based on
+   */
+  base::DataMatrix* cachedData;
+  size_t cachedDataRows;
+
   /**
    * Pointer to the training data used for determining H
    */
@@ -133,11 +175,28 @@ class DataBasedRefinementFunctor : public MultiGridRefinementFunctor {
 
 
   /**
-   * Computes the "intersection data points" of class k and l
+   * Evaluates the grid of a class at all data points and stores the
+   * results in the corresponding column of this->evals
+   */
+  void evaluateClass(size_t cl_ind);
+
+  /**
+   * Adds the contributions of changed surpluses of a class to the cached
+   * evaluations.
+   * @return False if the cache cannot be updated incrementally
+   */
+  bool updateClassEvaluations(size_t cl_ind, bool& changed);
+
+  /**
+   * Recomputes the means and all sets H_k from the cached evaluations
+   */
+  void computeHFromEvaluations();
+
+  /**
+   * Remembers surpluses and grid points the evaluations of a class are
+   * based on
    */
-  void computeHkl(base::DataMatrix& inters,
-                  size_t cl_ind1,
-                  size_t cl_ind2);
+  void cacheClassState(size_t cl_ind);
 
   /**
    * Is point in support of basis function at gp
@@ -36,7 +36,7 @@ enum class OperationMultipleEvalSubType {
   CUDA
 };
 
-enum class OperationMultipleEvalMPIType { NONE, MASTERSLAVE, HPX };
+enum class OperationMultipleEvalMPIType { NONE, MASTERSLAVE, HPX, DISTRIBUTED };
 
 class OperationMultipleEvalConfiguration {
  private:
@@ -0,0 +1,70 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationClusteringCPU.hpp>
+
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationCreateGraphBruteForceCPU.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationCreateGraphKDTreeCPU.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationDensityCPU.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationPruneGraphCPU.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace ClusteringCPU {
+
+OperationClusteringCPU::OperationClusteringCPU(bool useKDTree, bool verbose)
+    : useKDTree(useKDTree), verbose(verbose) {}
+
+std::vector<size_t> OperationClusteringCPU::calculate_clusters(base::Grid& grid,
+                                                               base::DataMatrix& dataset,
+                                                               double lambda, size_t k,
+                                                               double treshold) {
+  base::SGppStopwatch stopwatch;
+  stopwatch.start();
+  size_t gridsize = grid.getSize();
+  base::DataVector alpha(gridsize);
+  base::DataVector b(gridsize);
+
+  DensityCPU::OperationDensityCPU multOperation(grid, lambda);
+  if (verbose) std::cout << "Creating rhs..." << std::endl;
+  multOperation.generateb(dataset, b);
+
+  if (verbose) std::cout << "Creating alpha..." << std::endl;
+  solver::ConjugateGradients solver(1000, 0.001);
+  solver.solve(multOperation, alpha, b, false, verbose);
+  double max = alpha.max();
+  double min = alpha.min();
+  alpha.mult(1.0 / (max - min));
+
+  if (verbose) std::cout << "Starting graph creation..." << std::endl;
+  std::unique_ptr<DensityCPU::OperationCreateGraphCPU> graphOperation;
+  if (useKDTree) {
+    graphOperation.reset(new DensityCPU::OperationCreateGraphKDTreeCPU(dataset, k));
+  } else {
+    graphOperation.reset(new DensityCPU::OperationCreateGraphBruteForceCPU(dataset, k));
+  }
+  std::vector<int> graph(dataset.getNrows() * k);
+  graphOperation->create_graph(graph);
+
+  if (verbose) std::cout << "Starting graph pruning..." << std::endl;
+  DensityCPU::OperationPruneGraphCPU pruneOperation(grid, alpha, dataset, treshold, k);
+  pruneOperation.prune_graph(graph);
+
+  std::vector<size_t> clusters = DensityCPU::OperationCreateGraphCPU::find_clusters(graph, k);
+  if (verbose) {
+    std::cout << "Time required for clustering: " << stopwatch.stop() << std::endl;
+  }
+  return clusters;
+}
+
+}  // namespace ClusteringCPU
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,56 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace ClusteringCPU {
+
+/**
+ * Density-based clustering without OpenCL, the CPU counterpart of
+ * ClusteringOCL::OperationClusteringOCL. Estimates the density on a sparse grid, creates the k
+ * nearest neighbor graph of the data, removes nodes and edges in low density regions and assigns
+ * the connected components of the remaining graph to clusters.
+ */
+class OperationClusteringCPU {
+ public:
+  /**
+   * Constructor
+   *
+   * @param useKDTree use a k-d tree instead of the blocked brute force k nearest neighbor search
+   * (recommended for low dimensional data)
+   * @param verbose print progress information
+   */
+  explicit OperationClusteringCPU(bool useKDTree = false, bool verbose = false);
+
+  /**
+   * Cluster a dataset
+   *
+   * @param grid grid for the density estimation
+   * @param dataset data points (one per row)
+   * @param lambda regularization parameter of the density estimation
+   * @param k number of neighbors per data point
+   * @param treshold density threshold (relative to the range of the surpluses)
+   * @return cluster index for each data point, 0 for noise
+   */
+  std::vector<size_t> calculate_clusters(base::Grid& grid, base::DataMatrix& dataset,
+                                         double lambda, size_t k, double treshold);
+
+ private:
+  /// use a k-d tree for the graph creation
+  bool useKDTree;
+  /// print progress information
+  bool verbose;
+};
+
+}  // namespace ClusteringCPU
+}  // namespace datadriven
+}  // namespace sgpp
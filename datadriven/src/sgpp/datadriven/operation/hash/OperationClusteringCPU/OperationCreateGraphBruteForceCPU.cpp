@@ -0,0 +1,97 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationCreateGraphBruteForceCPU.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityCPU {
+
+OperationCreateGraphBruteForceCPU::OperationCreateGraphBruteForceCPU(base::DataMatrix& dataset,
+                                                                     size_t k)
+    : OperationCreateGraphCPU(dataset, k),
+      dataTransposed(dataset.getNrows() * dataset.getNcols()) {
+  size_t numPoints = dataset.getNrows();
+  size_t dims = dataset.getNcols();
+  for (size_t i = 0; i < numPoints; i++) {
+    for (size_t d = 0; d < dims; d++) {
+      dataTransposed[d * numPoints + i] = dataset.get(i, d);
+    }
+  }
+}
+
+void OperationCreateGraphBruteForceCPU::create_graph(std::vector<int>& resultVector, int startid,
+                                                     int chunksize) {
+  size_t count = getChunkSize(startid, chunksize, resultVector.size());
+  size_t start = static_cast<size_t>(startid);
+  size_t numPoints = dataset.getNrows();
+  size_t dims = dataset.getNcols();
+  const double* data = dataset.getPointer();
+  const double* transposed = dataTransposed.data();
+
+#pragma omp parallel
+  {
+    std::vector<double> dists(referenceBlockSize);
+    std::vector<double> kDists(queryBlockSize * k);
+    std::vector<int> kIndices(queryBlockSize * k);
+    std::vector<size_t> maxIndices(queryBlockSize);
+
+#pragma omp for schedule(dynamic)
+    for (size_t queryBlock = 0; queryBlock < count; queryBlock += queryBlockSize) {
+      size_t queryBlockEnd = std::min(count, queryBlock + queryBlockSize);
+      std::fill(kDists.begin(), kDists.end(), std::numeric_limits<double>::max());
+      std::fill(kIndices.begin(), kIndices.end(), 0);
+      std::fill(maxIndices.begin(), maxIndices.end(), 0);
+
+      for (size_t refBlock = 0; refBlock < numPoints; refBlock += referenceBlockSize) {
+        size_t refBlockSize = std::min(numPoints, refBlock + referenceBlockSize) - refBlock;
+
+        for (size_t q = 0; q < queryBlockEnd - queryBlock; q++) {
+          size_t query = start + queryBlock + q;
+          double* dist = dists.data();
+          std::fill(dists.begin(), dists.begin() + refBlockSize, 0.0);
+
+          for (size_t d = 0; d < dims; d++) {
+            const double x = data[query * dims + d];
+            const double* column = transposed + d * numPoints + refBlock;
+#pragma omp simd
+            for (size_t r = 0; r < refBlockSize; r++) {
+              double diff = x - column[r];
+              dist[r] += diff * diff;
+            }
+          }
+
+          // replace the currently farthest neighbor, same selection as the OpenCL kernel
+          double* qDists = &kDists[q * k];
+          int* qIndices = &kIndices[q * k];
+          size_t& maxIndex = maxIndices[q];
+          for (size_t r = 0; r < refBlockSize; r++) {
+            if (dist[r] < qDists[maxIndex] && refBlock + r != query) {
+              qDists[maxIndex] = dist[r];
+              qIndices[maxIndex] = static_cast<int>(refBlock + r);
+              maxIndex = 0;
+              for (size_t j = 1; j < k; j++) {
+                if (qDists[maxIndex] < qDists[j]) {
+                  maxIndex = j;
+                }
+              }
+            }
+          }
+        }
+      }
+
+      std::copy(kIndices.begin(), kIndices.begin() + (queryBlockEnd - queryBlock) * k,
+                resultVector.begin() + queryBlock * k);
+    }
+  }
+}
+
+}  // namespace DensityCPU
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,45 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationCreateGraphCPU.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityCPU {
+
+/**
+ * Exact brute force k nearest neighbor graph. Queries and reference points are processed in
+ * cache-sized blocks, the distances of a block are computed dimension-wise on a transposed copy of
+ * the dataset so that the inner loop vectorizes. The neighbors of a data point are stored in the
+ * same (unsorted) order as produced by the OpenCL kernel.
+ */
+class OperationCreateGraphBruteForceCPU : public OperationCreateGraphCPU {
+ public:
+  /**
+   * Constructor
+   *
+   * @param dataset data points (one per row)
+   * @param k number of neighbors per data point
+   */
+  OperationCreateGraphBruteForceCPU(base::DataMatrix& dataset, size_t k);
+
+  void create_graph(std::vector<int>& resultVector, int startid = 0, int chunksize = 0) override;
+
+ private:
+  /// number of query points processed together
+  static const size_t queryBlockSize = 64;
+  /// number of reference points kept in cache for a query block
+  static const size_t referenceBlockSize = 1024;
+  /// dataset stored dimension by dimension
+  std::vector<double> dataTransposed;
+};
+
+}  // namespace DensityCPU
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,137 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationCreateGraphCPU.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityCPU {
+
+namespace {
+
+/// find the root of a node, halving the path on the way
+size_t findRoot(std::vector<std::atomic<size_t>>& parent, size_t node) {
+  while (true) {
+    size_t p = parent[node].load();
+    if (p == node) {
+      return node;
+    }
+    size_t grandParent = parent[p].load();
+    if (grandParent != p) {
+      // path halving, failure is harmless as another thread already shortened the path
+      parent[node].compare_exchange_weak(p, grandParent);
+    }
+    node = grandParent;
+  }
+}
+
+/// merge the components of two nodes, roots are always linked to the smaller index
+void unite(std::vector<std::atomic<size_t>>& parent, size_t a, size_t b) {
+  while (true) {
+    a = findRoot(parent, a);
+    b = findRoot(parent, b);
+    if (a == b) {
+      return;
+    }
+    if (a < b) {
+      std::swap(a, b);
+    }
+    size_t expected = a;
+    if (parent[a].compare_exchange_strong(expected, b)) {
+      return;
+    }
+  }
+}
+
+}  // namespace
+
+OperationCreateGraphCPU::OperationCreateGraphCPU(base::DataMatrix& dataset, size_t k)
+    : dataset(dataset), k(k) {
+  if (k == 0 || k >= dataset.getNrows()) {
+    throw base::operation_exception(
+        "OperationCreateGraphCPU: k has to be in [1, number of data points)");
+  }
+}
+
+size_t OperationCreateGraphCPU::getChunkSize(int startid, int chunksize,
+                                             size_t resultSize) const {
+  size_t numPoints = dataset.getNrows();
+  if (startid < 0 || chunksize < 0 || static_cast<size_t>(startid) > numPoints) {
+    throw base::operation_exception("OperationCreateGraphCPU: invalid chunk");
+  }
+  size_t count = (chunksize == 0) ? numPoints - static_cast<size_t>(startid)
+                                  : static_cast<size_t>(chunksize);
+  if (static_cast<size_t>(startid) + count > numPoints || resultSize < count * k) {
+    throw base::operation_exception("OperationCreateGraphCPU: invalid chunk");
+  }
+  return count;
+}
+
+std::vector<size_t> OperationCreateGraphCPU::find_clusters(std::vector<int>& graph, size_t k) {
+  size_t numNodes = graph.size() / k;
+  std::vector<std::atomic<size_t>> parent(numNodes);
+  std::vector<char> active(numNodes);
+
+  // a node takes part in the clustering if it was not pruned and has at least one edge left
+#pragma omp parallel for
+  for (size_t node = 0; node < numNodes; node++) {
+    parent[node].store(node);
+    bool hasEdge = false;
+    if (graph[node * k] != -1) {
+      for (size_t i = node * k; i < (node + 1) * k; i++) {
+        if (graph[i] >= 0) {
+          hasEdge = true;
+          break;
+        }
+      }
+    }
+    active[node] = hasEdge;
+  }
+
+#pragma omp parallel for schedule(dynamic, 1024)
+  for (size_t node = 0; node < numNodes; node++) {
+    if (!active[node]) {
+      continue;
+    }
+    for (size_t i = node * k; i < (node + 1) * k; i++) {
+      if (graph[i] < 0) {
+        continue;
+      }
+      size_t neighbor = static_cast<size_t>(graph[i]);
+      if (neighbor < numNodes && active[neighbor]) {
+        unite(parent, node, neighbor);
+      }
+    }
+  }
+
+  // roots are the smallest index of their component, so numbering them in order of their index
+  // is deterministic
+  std::vector<size_t> clusters(numNodes, 0);
+  size_t clusterCount = 0;
+  for (size_t node = 0; node < numNodes; node++) {
+    if (active[node] && parent[node].load() == node) {
+      clusters[node] = ++clusterCount;
+    }
+  }
+
+#pragma omp parallel for
+  for (size_t node = 0; node < numNodes; node++) {
+    size_t root = findRoot(parent, node);
+    if (active[node] && root != node) {
+      clusters[node] = clusters[root];
+    }
+  }
+  return clusters;
+}
+
+}  // namespace DensityCPU
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,74 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityCPU {
+
+/**
+ * Base class for the CPU k nearest neighbor graph operations, the counterpart of
+ * DensityOCLMultiPlatform::OperationCreateGraphOCL. The graph is stored as k neighbor indices per
+ * data point. Pruned edges are marked with -2, pruned nodes with -1 in their first edge.
+ */
+class OperationCreateGraphCPU {
+ public:
+  /**
+   * Constructor
+   *
+   * @param dataset data points (one per row)
+   * @param k number of neighbors per data point
+   */
+  OperationCreateGraphCPU(base::DataMatrix& dataset, size_t k);
+
+  virtual ~OperationCreateGraphCPU() = default;
+
+  /**
+   * Create the k nearest neighbor graph for some data points of the dataset
+   *
+   * @param resultVector vector of size chunksize * k that will contain the neighbors
+   * @param startid index of the first data point
+   * @param chunksize number of data points, 0 creates the graph for all data points
+   */
+  virtual void create_graph(std::vector<int>& resultVector, int startid = 0,
+                            int chunksize = 0) = 0;
+
+  /**
+   * Assign a cluster index for each data point using the connected components of the graph.
+   * The components are found with a parallel union-find, edges are treated as undirected.
+   * Clusters are numbered from 1 in the order of their smallest data point index, data points
+   * without remaining edges are assigned to cluster 0.
+   *
+   * @param graph (pruned) k nearest neighbor graph
+   * @param k number of neighbors per data point
+   * @return cluster index for each data point
+   */
+  static std::vector<size_t> find_clusters(std::vector<int>& graph, size_t k);
+
+ protected:
+  /**
+   * Determine the range of data points to process
+   *
+   * @param startid index of the first data point
+   * @param chunksize number of data points, 0 means all remaining data points
+   * @param resultSize size of the result vector
+   * @return number of data points to process
+   */
+  size_t getChunkSize(int startid, int chunksize, size_t resultSize) const;
+
+  /// data points (one per row)
+  base::DataMatrix& dataset;
+  /// number of neighbors per data point
+  size_t k;
+};
+
+}  // namespace DensityCPU
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,134 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationCreateGraphKDTreeCPU.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityCPU {
+
+OperationCreateGraphKDTreeCPU::OperationCreateGraphKDTreeCPU(base::DataMatrix& dataset, size_t k,
+                                                             size_t leafSize)
+    : OperationCreateGraphCPU(dataset, k),
+      leafSize(std::max(leafSize, static_cast<size_t>(1))),
+      pointIndices(dataset.getNrows()) {
+  for (size_t i = 0; i < pointIndices.size(); i++) {
+    pointIndices[i] = i;
+  }
+  nodes.reserve(2 * (pointIndices.size() / this->leafSize + 1));
+  build(0, pointIndices.size());
+}
+
+size_t OperationCreateGraphKDTreeCPU::build(size_t begin, size_t end) {
+  size_t nodeIndex = nodes.size();
+  nodes.push_back(Node{begin, end, 0, 0.0, 0, 0});
+  if (end - begin <= leafSize) {
+    return nodeIndex;
+  }
+
+  // split along the dimension with the largest extent at the median
+  size_t dims = dataset.getNcols();
+  size_t splitDim = 0;
+  double maxExtent = -1.0;
+  for (size_t d = 0; d < dims; d++) {
+    double minValue = std::numeric_limits<double>::max();
+    double maxValue = std::numeric_limits<double>::lowest();
+    for (size_t i = begin; i < end; i++) {
+      double value = dataset.get(pointIndices[i], d);
+      minValue = std::min(minValue, value);
+      maxValue = std::max(maxValue, value);
+    }
+    if (maxValue - minValue > maxExtent) {
+      maxExtent = maxValue - minValue;
+      splitDim = d;
+    }
+  }
+
+  size_t middle = begin + (end - begin) / 2;
+  std::nth_element(pointIndices.begin() + begin, pointIndices.begin() + middle,
+                   pointIndices.begin() + end, [this, splitDim](size_t a, size_t b) {
+                     return dataset.get(a, splitDim) < dataset.get(b, splitDim);
+                   });
+  double splitValue = dataset.get(pointIndices[middle], splitDim);
+
+  size_t left = build(begin, middle);
+  size_t right = build(middle, end);
+  nodes[nodeIndex].splitDim = splitDim;
+  nodes[nodeIndex].splitValue = splitValue;
+  nodes[nodeIndex].left = left;
+  nodes[nodeIndex].right = right;
+  return nodeIndex;
+}
+
+void OperationCreateGraphKDTreeCPU::search(size_t nodeIndex, size_t query,
+                                           std::vector<std::pair<double, size_t>>& heap) const {
+  const Node& node = nodes[nodeIndex];
+  size_t dims = dataset.getNcols();
+  const double* queryPoint = dataset.getPointer() + query * dims;
+
+  if (node.left == 0 && node.right == 0) {
+    for (size_t i = node.begin; i < node.end; i++) {
+      size_t candidate = pointIndices[i];
+      if (candidate == query) {
+        continue;
+      }
+      const double* point = dataset.getPointer() + candidate * dims;
+      double dist = 0.0;
+      for (size_t d = 0; d < dims; d++) {
+        double diff = queryPoint[d] - point[d];
+        dist += diff * diff;
+      }
+      std::pair<double, size_t> entry(dist, candidate);
+      if (heap.size() < k) {
+        heap.push_back(entry);
+        std::push_heap(heap.begin(), heap.end());
+      } else if (entry < heap.front()) {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.back() = entry;
+        std::push_heap(heap.begin(), heap.end());
+      }
+    }
+    return;
+  }
+
+  double diff = queryPoint[node.splitDim] - node.splitValue;
+  size_t nearChild = (diff < 0.0) ? node.left : node.right;
+  size_t farChild = (diff < 0.0) ? node.right : node.left;
+  search(nearChild, query, heap);
+  if (heap.size() < k || diff * diff <= heap.front().first) {
+    search(farChild, query, heap);
+  }
+}
+
+void OperationCreateGraphKDTreeCPU::create_graph(std::vector<int>& resultVector, int startid,
+                                                 int chunksize) {
+  size_t count = getChunkSize(startid, chunksize, resultVector.size());
+  size_t start = static_cast<size_t>(startid);
+
+#pragma omp parallel
+  {
+    std::vector<std::pair<double, size_t>> heap;
+    heap.reserve(k + 1);
+
+#pragma omp for schedule(dynamic, 256)
+    for (size_t i = 0; i < count; i++) {
+      heap.clear();
+      search(0, start + i, heap);
+      std::sort_heap(heap.begin(), heap.end());
+      for (size_t j = 0; j < k; j++) {
+        resultVector[i * k + j] = static_cast<int>(heap[j].second);
+      }
+    }
+  }
+}
+
+}  // namespace DensityCPU
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,62 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationCreateGraphCPU.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityCPU {
+
+/**
+ * Exact k nearest neighbor graph using a k-d tree. Suited for low dimensional data where the
+ * brute force search becomes too expensive. The neighbors of a data point are stored sorted by
+ * ascending distance.
+ */
+class OperationCreateGraphKDTreeCPU : public OperationCreateGraphCPU {
+ public:
+  /**
+   * Constructor, builds the k-d tree
+   *
+   * @param dataset data points (one per row)
+   * @param k number of neighbors per data point
+   * @param leafSize maximal number of data points in a leaf of the tree
+   */
+  OperationCreateGraphKDTreeCPU(base::DataMatrix& dataset, size_t k, size_t leafSize = 32);
+
+  void create_graph(std::vector<int>& resultVector, int startid = 0, int chunksize = 0) override;
+
+ private:
+  /// node of the k-d tree, leaves have no children and refer to a range of pointIndices
+  struct Node {
+    size_t begin;
+    size_t end;
+    size_t splitDim;
+    double splitValue;
+    size_t left;
+    size_t right;
+  };
+
+  /// recursively build the tree for pointIndices[begin, end), returns the index of the node
+  size_t build(size_t begin, size_t end);
+
+  /// search the neighbors of a data point in the subtree of a node
+  void search(size_t nodeIndex, size_t query, std::vector<std::pair<double, size_t>>& heap) const;
+
+  /// maximal number of data points in a leaf
+  size_t leafSize;
+  /// nodes of the tree, the root is the first node
+  std::vector<Node> nodes;
+  /// data point indices ordered such that every node refers to a contiguous range
+  std::vector<size_t> pointIndices;
+};
+
+}  // namespace DensityCPU
+}  // namespace datadriven
+}  // namespace sgpp
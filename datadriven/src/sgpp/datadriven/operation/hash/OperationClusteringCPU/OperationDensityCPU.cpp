@@ -0,0 +1,51 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationDensityCPU.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/pde/operation/PdeOpFactory.hpp>
+
+#include <algorithm>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityCPU {
+
+OperationDensityCPU::OperationDensityCPU(base::Grid& grid, double lambda)
+    : grid(grid), lTwoDotProduct(op_factory::createOperationLTwoDotProduct(grid)), lambda(lambda) {}
+
+void OperationDensityCPU::mult(base::DataVector& alpha, base::DataVector& result) {
+  lTwoDotProduct->mult(alpha, result);
+  result.axpy(lambda, alpha);
+}
+
+void OperationDensityCPU::generateb(base::DataMatrix& dataset, base::DataVector& b,
+                                    size_t start_id, size_t chunksize) {
+  size_t gridSize = grid.getSize();
+  if (chunksize == 0) {
+    chunksize = gridSize - start_id;
+  }
+  if (start_id + chunksize > gridSize || b.getSize() < chunksize) {
+    throw base::operation_exception("OperationDensityCPU::generateb: invalid chunk");
+  }
+
+  std::unique_ptr<base::OperationMultipleEval> eval(
+      op_factory::createOperationMultipleEval(grid, dataset));
+  base::DataVector ones(dataset.getNrows(), 1.0);
+  base::DataVector fullB(gridSize);
+  eval->multTranspose(ones, fullB);
+
+  double scale = 1.0 / static_cast<double>(dataset.getNrows());
+  for (size_t i = 0; i < chunksize; i++) {
+    b[i] = fullB[start_id + i] * scale;
+  }
+}
+
+}  // namespace DensityCPU
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,63 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <memory>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityCPU {
+
+/**
+ * CPU counterpart of DensityOCLMultiPlatform::OperationDensity. Applies the density estimation
+ * system matrix (R + lambda * I), where R is the L2 dot product matrix of the basis functions,
+ * and computes the right hand side b_i = 1/N sum_m phi_i(x_m). Both are computed with the
+ * (OpenMP parallel) up/down and multiple evaluation operations of the grid instead of the dense
+ * O(M^2) OpenCL kernel.
+ */
+class OperationDensityCPU : public base::OperationMatrix {
+ public:
+  /**
+   * Constructor
+   *
+   * @param grid grid the density is estimated on
+   * @param lambda regularization parameter
+   */
+  OperationDensityCPU(base::Grid& grid, double lambda);
+
+  ~OperationDensityCPU() override = default;
+
+  /// Execute one matrix-vector multiplication with the density matrix
+  void mult(base::DataVector& alpha, base::DataVector& result) override;
+
+  /**
+   * Generates the right hand side vector for the density equation
+   *
+   * @param dataset data points (one per row)
+   * @param b vector that will contain the entries start_id, ..., start_id + chunksize - 1
+   * @param start_id first entry of b to compute
+   * @param chunksize number of entries of b to compute, 0 computes all entries
+   */
+  void generateb(base::DataMatrix& dataset, base::DataVector& b, size_t start_id = 0,
+                 size_t chunksize = 0);
+
+ private:
+  /// grid the density is estimated on
+  base::Grid& grid;
+  /// L2 dot product of the basis functions
+  std::unique_ptr<base::OperationMatrix> lTwoDotProduct;
+  /// regularization parameter
+  double lambda;
+};
+
+}  // namespace DensityCPU
+}  // namespace datadriven
+}  // namespace sgpp
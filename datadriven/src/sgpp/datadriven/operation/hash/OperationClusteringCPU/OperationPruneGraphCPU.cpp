@@ -0,0 +1,86 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationPruneGraphCPU.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityCPU {
+
+const size_t OperationPruneGraphCPU::evaluationBlockSize;
+
+OperationPruneGraphCPU::OperationPruneGraphCPU(base::Grid& grid, base::DataVector& alpha,
+                                               base::DataMatrix& data, double threshold,
+                                               size_t k)
+    : grid(grid), alpha(alpha), data(data), threshold(threshold), k(k) {}
+
+void OperationPruneGraphCPU::prune_graph(std::vector<int>& graph, size_t startid,
+                                         size_t chunksize) {
+  size_t numPoints = data.getNrows();
+  size_t dims = data.getNcols();
+  if (chunksize == 0) {
+    chunksize = numPoints - startid;
+  }
+  if (startid + chunksize > numPoints || graph.size() < chunksize * k) {
+    throw base::operation_exception("OperationPruneGraphCPU::prune_graph: invalid chunk");
+  }
+
+  for (size_t blockStart = 0; blockStart < chunksize; blockStart += evaluationBlockSize) {
+    size_t blockSize = std::min(evaluationBlockSize, chunksize - blockStart);
+
+    // every data point is followed by the midpoints of its k edges
+    base::DataMatrix evaluationPoints(blockSize * (k + 1), dims);
+#pragma omp parallel for
+    for (size_t i = 0; i < blockSize; i++) {
+      size_t point = startid + blockStart + i;
+      const double* pointCoords = data.getPointer() + point * dims;
+      double* row = evaluationPoints.getPointer() + i * (k + 1) * dims;
+      std::copy(pointCoords, pointCoords + dims, row);
+      for (size_t j = 0; j < k; j++) {
+        int neighbor = graph[(blockStart + i) * k + j];
+        row += dims;
+        if (neighbor < 0) {
+          std::copy(pointCoords, pointCoords + dims, row);
+          continue;
+        }
+        const double* neighborCoords = data.getPointer() + static_cast<size_t>(neighbor) * dims;
+        for (size_t d = 0; d < dims; d++) {
+          row[d] = neighborCoords[d] + (pointCoords[d] - neighborCoords[d]) * 0.5;
+        }
+      }
+    }
+
+    base::DataVector densities(evaluationPoints.getNrows());
+    std::unique_ptr<base::OperationMultipleEval> eval(
+        op_factory::createOperationMultipleEval(grid, evaluationPoints));
+    eval->mult(alpha, densities);
+
+#pragma omp parallel for
+    for (size_t i = 0; i < blockSize; i++) {
+      int* edges = &graph[(blockStart + i) * k];
+      if (densities[i * (k + 1)] < threshold) {
+        std::fill(edges, edges + k, -1);
+        continue;
+      }
+      for (size_t j = 0; j < k; j++) {
+        if (edges[j] >= 0 && densities[i * (k + 1) + 1 + j] < threshold) {
+          edges[j] = -2;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace DensityCPU
+}  // namespace datadriven
+}  // namespace sgpp
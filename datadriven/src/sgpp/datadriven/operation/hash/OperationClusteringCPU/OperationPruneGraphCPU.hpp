@@ -0,0 +1,65 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace DensityCPU {
+
+/**
+ * CPU counterpart of DensityOCLMultiPlatform::OperationPruneGraphOCL. Removes all nodes of the k
+ * nearest neighbor graph at which the density is below a threshold (marked with -1) and all edges
+ * whose midpoint has a density below the threshold (marked with -2). The density is evaluated
+ * blockwise with the multiple evaluation operation of the grid.
+ */
+class OperationPruneGraphCPU {
+ public:
+  /**
+   * Constructor
+   *
+   * @param grid grid of the density function
+   * @param alpha surpluses of the density function
+   * @param data data points (one per row) the graph was created for
+   * @param threshold density threshold
+   * @param k number of neighbors per data point
+   */
+  OperationPruneGraphCPU(base::Grid& grid, base::DataVector& alpha, base::DataMatrix& data,
+                         double threshold, size_t k);
+
+  /**
+   * Deletes all nodes and edges within areas of low density which are in the given graph chunk
+   *
+   * @param graph graph of the data points startid, ..., startid + chunksize - 1
+   * @param startid index of the first data point
+   * @param chunksize number of data points, 0 prunes the graph of all data points
+   */
+  void prune_graph(std::vector<int>& graph, size_t startid = 0, size_t chunksize = 0);
+
+ private:
+  /// number of data points whose node and edge densities are evaluated together
+  static const size_t evaluationBlockSize = 8192;
+
+  /// grid of the density function
+  base::Grid& grid;
+  /// surpluses of the density function
+  base::DataVector& alpha;
+  /// data points
+  base::DataMatrix& data;
+  /// density threshold
+  double threshold;
+  /// number of neighbors per data point
+  size_t k;
+};
+
+}  // namespace DensityCPU
+}  // namespace datadriven
+}  // namespace sgpp
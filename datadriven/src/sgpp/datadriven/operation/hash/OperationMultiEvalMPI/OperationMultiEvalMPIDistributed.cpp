@@ -0,0 +1,172 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalMPI/OperationMultiEvalMPIDistributed.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+OperationMultiEvalMPIDistributed::OperationMultiEvalMPIDistributed(
+    base::Grid& grid, base::DataMatrix& dataset,
+    OperationMultipleEvalConfiguration nodeConfiguration, bool overlapCommunication,
+    MPI_Comm comm)
+    : OperationMultipleEval(grid, dataset),
+      nodeConfiguration(nodeConfiguration.getType(), nodeConfiguration.getSubType(),
+                        OperationMultipleEvalMPIType::NONE, nodeConfiguration.getName()),
+      comm(comm),
+      rank(0),
+      size(1),
+      shardStart(0),
+      shardEnd(0),
+      duration(-1.0) {
+  if (nodeConfiguration.getParameters() != nullptr) {
+    this->nodeConfiguration = OperationMultipleEvalConfiguration(
+        nodeConfiguration.getType(), nodeConfiguration.getSubType(),
+        OperationMultipleEvalMPIType::NONE, *nodeConfiguration.getParameters(),
+        nodeConfiguration.getName());
+  }
+
+  if (dataset.getNrows() > static_cast<size_t>(std::numeric_limits<int>::max())) {
+    throw base::operation_exception(
+        "OperationMultiEvalMPIDistributed: too many data points for MPI counts");
+  }
+
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &size);
+
+  // contiguous shards of (almost) equal size, split into blocks for overlapping
+  const size_t numData = dataset.getNrows();
+  const size_t numRanks = static_cast<size_t>(size);
+  const size_t numBlocks = overlapCommunication ? 2 : 1;
+  blocks.resize(numBlocks);
+
+  for (size_t b = 0; b < numBlocks; b++) {
+    Block& block = blocks[b];
+    block.counts.resize(numRanks);
+    block.displacements.resize(numRanks);
+
+    for (size_t r = 0; r < numRanks; r++) {
+      const size_t rankStart = r * numData / numRanks;
+      const size_t rankEnd = (r + 1) * numData / numRanks;
+      const size_t blockStart = rankStart + b * (rankEnd - rankStart) / numBlocks;
+      const size_t blockEnd = rankStart + (b + 1) * (rankEnd - rankStart) / numBlocks;
+      block.counts[r] = static_cast<int>(blockEnd - blockStart);
+      block.displacements[r] = static_cast<int>(blockStart);
+
+      if (r == static_cast<size_t>(rank)) {
+        block.start = blockStart;
+        block.end = blockEnd;
+      }
+    }
+
+    // copy the data points once, they stay on this rank
+    block.data.resizeRowsCols(block.end - block.start, dataset.getNcols());
+    base::DataVector row(dataset.getNcols());
+
+    for (size_t i = block.start; i < block.end; i++) {
+      dataset.getRow(i, row);
+      block.data.setRow(i - block.start, row);
+    }
+
+    block.nodeMultiEval.reset(
+        op_factory::createOperationMultipleEval(grid, block.data, this->nodeConfiguration));
+  }
+
+  shardStart = blocks.front().start;
+  shardEnd = blocks.back().end;
+}
+
+OperationMultiEvalMPIDistributed::~OperationMultiEvalMPIDistributed() {}
+
+void OperationMultiEvalMPIDistributed::mult(base::DataVector& alpha, base::DataVector& result) {
+  double start = MPI_Wtime();
+
+  // all ranks have to use the coefficients of rank 0
+  broadcastAlpha = alpha;
+  MPI_Bcast(broadcastAlpha.getPointer(), static_cast<int>(broadcastAlpha.getSize()), MPI_DOUBLE,
+            0, comm);
+
+  result.resize(dataset.getNrows());
+  std::vector<MPI_Request> requests(blocks.size());
+
+  for (size_t b = 0; b < blocks.size(); b++) {
+    Block& block = blocks[b];
+    block.localResult.resize(block.end - block.start);
+
+    if (block.end > block.start) {
+      block.nodeMultiEval->mult(broadcastAlpha, block.localResult);
+    }
+
+    // gather the results of the block while the next block is computed
+    MPI_Iallgatherv(block.localResult.getPointer(), block.counts[rank], MPI_DOUBLE,
+                    result.getPointer(), block.counts.data(), block.displacements.data(),
+                    MPI_DOUBLE, comm, &requests[b]);
+  }
+
+  MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+  this->duration = MPI_Wtime() - start;
+}
+
+void OperationMultiEvalMPIDistributed::multTranspose(base::DataVector& source,
+                                                     base::DataVector& result) {
+  double start = MPI_Wtime();
+
+  // all ranks have to use the source of rank 0, as in mult
+  broadcastSource = source;
+  MPI_Bcast(broadcastSource.getPointer(), static_cast<int>(broadcastSource.getSize()),
+            MPI_DOUBLE, 0, comm);
+
+  const size_t gridSize = grid.getSize();
+  std::vector<MPI_Request> requests(blocks.size());
+
+  for (size_t b = 0; b < blocks.size(); b++) {
+    Block& block = blocks[b];
+    block.localResult.resize(gridSize);
+    block.localResult.setAll(0.0);
+    block.reducedResult.resize(gridSize);
+
+    if (block.end > block.start) {
+      base::DataVector sourceBlock(block.end - block.start);
+
+      for (size_t i = block.start; i < block.end; i++) {
+        sourceBlock[i - block.start] = broadcastSource[i];
+      }
+
+      block.nodeMultiEval->multTranspose(sourceBlock, block.localResult);
+    }
+
+    // sum up the partial results of the block while the next block is computed
+    MPI_Iallreduce(block.localResult.getPointer(), block.reducedResult.getPointer(),
+                   static_cast<int>(gridSize), MPI_DOUBLE, MPI_SUM, comm, &requests[b]);
+  }
+
+  MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+
+  result.resize(gridSize);
+  result.copyFrom(blocks.front().reducedResult);
+
+  for (size_t b = 1; b < blocks.size(); b++) {
+    result.add(blocks[b].reducedResult);
+  }
+
+  this->duration = MPI_Wtime() - start;
+}
+
+void OperationMultiEvalMPIDistributed::prepare() {
+  for (Block& block : blocks) {
+    block.nodeMultiEval->prepare();
+  }
+}
+
+double OperationMultiEvalMPIDistributed::getDuration() { return this->duration; }
+
+}  // namespace datadriven
+}  // namespace sgpp
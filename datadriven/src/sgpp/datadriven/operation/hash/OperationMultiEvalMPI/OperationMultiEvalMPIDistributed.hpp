@@ -0,0 +1,101 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#define MPICH_SKIP_MPICXX
+#include <mpi.h>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * This class is a data-resident MPI wrapper for other MultiEval-operations.
+ *
+ * Every rank owns a fixed, contiguous shard of the dataset for the lifetime of the operation and
+ * evaluates it with a node-local MultiEval-operation, so no data points are sent after the
+ * construction. In mult, alpha is broadcast from rank 0 and the results of all shards are gathered
+ * on all ranks. In multTranspose, source is broadcast from rank 0 and the partial results of the
+ * shards are summed up on all ranks with MPI_Allreduce. Hence, mult and multTranspose are
+ * collective operations that have to be called by all ranks of the communicator, e.g., from a
+ * solver that runs on all ranks, and the input vectors of the other ranks are ignored.
+ *
+ * Optionally, every shard is split into two blocks, such that the communication of the result of
+ * the first block (with non-blocking collectives) overlaps with the computation of the second one.
+ */
+class OperationMultiEvalMPIDistributed : public base::OperationMultipleEval {
+ public:
+  /**
+   * @param grid the sparse grid used for this operation
+   * @param dataset data set (all data points, every rank copies its shard)
+   * @param nodeConfiguration configuration of the node-local MultiEval-operations
+   * @param overlapCommunication whether to overlap communication and computation
+   * @param comm communicator of the ranks sharing the data set
+   */
+  OperationMultiEvalMPIDistributed(base::Grid& grid, base::DataMatrix& dataset,
+                                   OperationMultipleEvalConfiguration nodeConfiguration,
+                                   bool overlapCommunication = false,
+                                   MPI_Comm comm = MPI_COMM_WORLD);
+
+  ~OperationMultiEvalMPIDistributed();
+
+  void mult(base::DataVector& alpha, base::DataVector& result) override;
+
+  void multTranspose(base::DataVector& source, base::DataVector& result) override;
+
+  void prepare() override;
+
+  double getDuration() override;
+
+  std::string getImplementationName() override { return "MPI_DISTRIBUTED"; }
+
+  /**
+   * @return index of the first data point of the shard of this rank
+   */
+  size_t getShardStart() const { return shardStart; }
+
+  /**
+   * @return index after the last data point of the shard of this rank
+   */
+  size_t getShardEnd() const { return shardEnd; }
+
+ protected:
+  /// data points of a block of the shard of this rank and their node-local operation
+  struct Block {
+    size_t start;
+    size_t end;
+    base::DataMatrix data;
+    std::unique_ptr<base::OperationMultipleEval> nodeMultiEval;
+    /// number of data points of this block on every rank (for MPI_Iallgatherv)
+    std::vector<int> counts;
+    /// index of the first data point of this block on every rank (for MPI_Iallgatherv)
+    std::vector<int> displacements;
+    base::DataVector localResult;
+    base::DataVector reducedResult;
+  };
+
+  OperationMultipleEvalConfiguration nodeConfiguration;
+  MPI_Comm comm;
+  int rank;
+  int size;
+  size_t shardStart;
+  size_t shardEnd;
+  std::vector<Block> blocks;
+  base::DataVector broadcastAlpha;
+  base::DataVector broadcastSource;
+  double duration;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
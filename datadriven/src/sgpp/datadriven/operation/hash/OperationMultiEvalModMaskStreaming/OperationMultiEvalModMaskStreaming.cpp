@@ -12,12 +12,81 @@
 namespace sgpp {
 namespace datadriven {
 
+// kernel variants, each one is defined by the *_multImpl.cpp and *_multTransposeImpl.cpp files
+// compiled for the respective instruction set
+template <>
+void OperationMultiEvalModMaskStreaming::multImpl<base::InstructionSet::GENERIC>(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, base::DataMatrix* dataset, base::DataVector& alpha,
+    base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
+    const size_t start_index_data, const size_t end_index_data);
+template <>
+void OperationMultiEvalModMaskStreaming::multTransposeImpl<base::InstructionSet::GENERIC>(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, base::DataMatrix* dataset, base::DataVector& source,
+    base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
+    const size_t start_index_data, const size_t end_index_data);
+
+template <>
+void OperationMultiEvalModMaskStreaming::multImpl<base::InstructionSet::SSE3>(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, base::DataMatrix* dataset, base::DataVector& alpha,
+    base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
+    const size_t start_index_data, const size_t end_index_data);
+template <>
+void OperationMultiEvalModMaskStreaming::multTransposeImpl<base::InstructionSet::SSE3>(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, base::DataMatrix* dataset, base::DataVector& source,
+    base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
+    const size_t start_index_data, const size_t end_index_data);
+
+template <>
+void OperationMultiEvalModMaskStreaming::multImpl<base::InstructionSet::AVX>(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, base::DataMatrix* dataset, base::DataVector& alpha,
+    base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
+    const size_t start_index_data, const size_t end_index_data);
+template <>
+void OperationMultiEvalModMaskStreaming::multTransposeImpl<base::InstructionSet::AVX>(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, base::DataMatrix* dataset, base::DataVector& source,
+    base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
+    const size_t start_index_data, const size_t end_index_data);
+
+template <>
+void OperationMultiEvalModMaskStreaming::multImpl<base::InstructionSet::AVX2>(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, base::DataMatrix* dataset, base::DataVector& alpha,
+    base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
+    const size_t start_index_data, const size_t end_index_data);
+template <>
+void OperationMultiEvalModMaskStreaming::multTransposeImpl<base::InstructionSet::AVX2>(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, base::DataMatrix* dataset, base::DataVector& source,
+    base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
+    const size_t start_index_data, const size_t end_index_data);
+
+template <>
+void OperationMultiEvalModMaskStreaming::multImpl<base::InstructionSet::AVX512>(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, base::DataMatrix* dataset, base::DataVector& alpha,
+    base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
+    const size_t start_index_data, const size_t end_index_data);
+template <>
+void OperationMultiEvalModMaskStreaming::multTransposeImpl<base::InstructionSet::AVX512>(
+    std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+    std::vector<double>& offset, base::DataMatrix* dataset, base::DataVector& source,
+    base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
+    const size_t start_index_data, const size_t end_index_data);
+
 OperationMultiEvalModMaskStreaming::OperationMultiEvalModMaskStreaming(base::Grid& grid,
                                                                        base::DataMatrix& dataset)
     : OperationMultipleEval(grid, dataset),
       preparedDataset(dataset),
       myTimer_(sgpp::base::SGppStopwatch()),
-      duration(-1.0) {
+      duration(-1.0),
+      instructionSet(base::CPUFeatures::getKernelInstructionSet()) {
+  this->selectKernels();
   this->storage = &grid.getStorage();
   this->padDataset(this->preparedDataset);
   this->preparedDataset.transpose();
@@ -83,11 +152,11 @@ size_t OperationMultiEvalModMaskStreaming::getChunkGridPoints() {
   return 12;
 }
 size_t OperationMultiEvalModMaskStreaming::getChunkDataPoints() {
-#if defined(__MIC__) || defined(__AVX512F__)
-  return STREAMING_MODLINEAR_MIC_AVX512_UNROLLING_WIDTH;
-#else
-  return 24;  // must be divisible by 24
-#endif
+  if (this->instructionSet == base::InstructionSet::AVX512) {
+    return STREAMING_MODLINEAR_MIC_AVX512_UNROLLING_WIDTH;
+  } else {
+    return 24;  // must be divisible by 24
+  }
 }
 
 void OperationMultiEvalModMaskStreaming::mult(sgpp::base::DataVector& alpha,
@@ -107,8 +176,8 @@ void OperationMultiEvalModMaskStreaming::mult(sgpp::base::DataVector& alpha,
     getOpenMPPartitionSegment(0, this->preparedDataset.getNcols(), &start, &end,
                               getChunkDataPoints());
 
-    this->multImpl(this->level, this->index, this->mask, this->offset, &this->preparedDataset,
-                   alpha, result, 0, alpha.getSize(), start, end);
+    (this->*multKernel)(this->level, this->index, this->mask, this->offset,
+                        &this->preparedDataset, alpha, result, 0, alpha.getSize(), start, end);
   }
   result.resize(originalSize);
   this->duration = this->myTimer_.stop();
@@ -136,9 +205,9 @@ void OperationMultiEvalModMaskStreaming::multTranspose(sgpp::base::DataVector& s
 
     getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
 
-    this->multTransposeImpl(this->level, this->index, this->mask, this->offset,
-                            &this->preparedDataset, source, result, start, end, 0,
-                            this->preparedDataset.getNcols());
+    (this->*multTransposeKernel)(this->level, this->index, this->mask, this->offset,
+                                 &this->preparedDataset, source, result, start, end, 0,
+                                 this->preparedDataset.getNcols());
   }
   source.resize(originalSize);
   this->duration = this->myTimer_.stop();
@@ -167,6 +236,73 @@ size_t OperationMultiEvalModMaskStreaming::padDataset(sgpp::base::DataMatrix& da
 
 double OperationMultiEvalModMaskStreaming::getDuration() { return this->duration; }
 
+template <base::InstructionSet isa>
+bool OperationMultiEvalModMaskStreaming::usesKernels() const {
+  return this->multKernel == &OperationMultiEvalModMaskStreaming::multImpl<isa> &&
+         this->multTransposeKernel == &OperationMultiEvalModMaskStreaming::multTransposeImpl<isa>;
+}
+
+base::InstructionSet OperationMultiEvalModMaskStreaming::getInstructionSet() {
+#ifdef SGPP_KERNEL_DISPATCH
+  // determined from the installed kernels instead of the requested instruction set
+  if (usesKernels<base::InstructionSet::AVX512>()) {
+    return base::InstructionSet::AVX512;
+  } else if (usesKernels<base::InstructionSet::AVX2>()) {
+    return base::InstructionSet::AVX2;
+  } else if (usesKernels<base::InstructionSet::AVX>()) {
+    return base::InstructionSet::AVX;
+  } else if (usesKernels<base::InstructionSet::SSE3>()) {
+    return base::InstructionSet::SSE3;
+  }
+  return base::InstructionSet::GENERIC;
+#else
+  return SGPP_COMPILED_INSTRUCTION_SET;
+#endif
+}
+
+void OperationMultiEvalModMaskStreaming::selectKernels() {
+#ifdef SGPP_KERNEL_DISPATCH
+  switch (this->instructionSet) {
+    case base::InstructionSet::AVX512:
+      this->multKernel =
+          &OperationMultiEvalModMaskStreaming::multImpl<base::InstructionSet::AVX512>;
+      this->multTransposeKernel =
+          &OperationMultiEvalModMaskStreaming::multTransposeImpl<base::InstructionSet::AVX512>;
+      break;
+    case base::InstructionSet::AVX2:
+      this->multKernel =
+          &OperationMultiEvalModMaskStreaming::multImpl<base::InstructionSet::AVX2>;
+      this->multTransposeKernel =
+          &OperationMultiEvalModMaskStreaming::multTransposeImpl<base::InstructionSet::AVX2>;
+      break;
+    case base::InstructionSet::AVX:
+      this->multKernel =
+          &OperationMultiEvalModMaskStreaming::multImpl<base::InstructionSet::AVX>;
+      this->multTransposeKernel =
+          &OperationMultiEvalModMaskStreaming::multTransposeImpl<base::InstructionSet::AVX>;
+      break;
+    case base::InstructionSet::SSE3:
+      this->multKernel =
+          &OperationMultiEvalModMaskStreaming::multImpl<base::InstructionSet::SSE3>;
+      this->multTransposeKernel =
+          &OperationMultiEvalModMaskStreaming::multTransposeImpl<base::InstructionSet::SSE3>;
+      break;
+    case base::InstructionSet::GENERIC:
+      this->multKernel =
+          &OperationMultiEvalModMaskStreaming::multImpl<base::InstructionSet::GENERIC>;
+      this->multTransposeKernel =
+          &OperationMultiEvalModMaskStreaming::multTransposeImpl<base::InstructionSet::GENERIC>;
+      break;
+  }
+#else
+  // only the variant selected by ARCH is compiled
+  this->multKernel =
+      &OperationMultiEvalModMaskStreaming::multImpl<SGPP_COMPILED_INSTRUCTION_SET>;
+  this->multTransposeKernel =
+      &OperationMultiEvalModMaskStreaming::multTransposeImpl<SGPP_COMPILED_INSTRUCTION_SET>;
+#endif
+}
+
 void OperationMultiEvalModMaskStreaming::prepare() { this->recalculateLevelIndexMask(); }
 
 void OperationMultiEvalModMaskStreaming::recalculateLevelIndexMask() {
@@ -10,6 +10,7 @@
 #endif
 
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
 #include <sgpp/base/tools/SGppStopwatch.hpp>
 #include <sgpp/base/exception/operation_exception.hpp>
 
@@ -42,6 +43,20 @@ class OperationMultiEvalModMaskStreaming : public base::OperationMultipleEval {
 
   double duration;
 
+  /// instruction set of the kernel variant in use, see base::CPUFeatures
+  base::InstructionSet instructionSet;
+
+  typedef void (OperationMultiEvalModMaskStreaming::*MultKernel)(
+      std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
+      std::vector<double>& offset, sgpp::base::DataMatrix* dataset,
+      sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+      const size_t start_index_grid, const size_t end_index_grid,
+      const size_t start_index_data, const size_t end_index_data);
+
+  /// kernel variants of instructionSet
+  MultKernel multKernel;
+  MultKernel multTransposeKernel;
+
  public:
   OperationMultiEvalModMaskStreaming(base::Grid& grid,
                                      base::DataMatrix& dataset);
@@ -62,7 +77,18 @@ class OperationMultiEvalModMaskStreaming : public base::OperationMultipleEval {
 
   double getDuration() override;
 
+  /**
+   * @return instruction set of the kernel variant used by mult and multTranspose
+   */
+  base::InstructionSet getInstructionSet();
+
  private:
+  /**
+   * @return whether the kernel variants for the instruction set isa are installed
+   */
+  template <base::InstructionSet isa>
+  bool usesKernels() const;
+
   void getPartitionSegment(size_t start, size_t end, size_t segmentCount,
                            size_t segmentNumber, size_t* segmentStart,
                            size_t* segmentEnd, size_t blockSize);
@@ -72,6 +98,12 @@ class OperationMultiEvalModMaskStreaming : public base::OperationMultipleEval {
   void getOpenMPPartitionSegment(size_t start, size_t end, size_t* segmentStart,
                                  size_t* segmentEnd, size_t blocksize);
 
+  /**
+   * Kernel variants, the specialization for an instruction set is defined by
+   * OperationMultiEvalModMaskStreaming_multImpl.cpp compiled for this instruction set
+   * (SGPP_COMPILED_INSTRUCTION_SET).
+   */
+  template <base::InstructionSet isa>
   void multImpl(std::vector<double>& level, std::vector<double>& index,
                 std::vector<double>& mask, std::vector<double>& offset,
                 sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
@@ -79,6 +111,7 @@ class OperationMultiEvalModMaskStreaming : public base::OperationMultipleEval {
                 const size_t end_index_grid, const size_t start_index_data,
                 const size_t end_index_data);
 
+  template <base::InstructionSet isa>
   void multTransposeImpl(std::vector<double>& level, std::vector<double>& index,
                          std::vector<double>& mask, std::vector<double>& offset,
                          sgpp::base::DataMatrix* dataset,
@@ -90,6 +123,8 @@ class OperationMultiEvalModMaskStreaming : public base::OperationMultipleEval {
                          const size_t end_index_data);
 
   void recalculateLevelIndexMask();
+
+  void selectKernels();
 };
 }  // namespace datadriven
 }  // namespace sgpp
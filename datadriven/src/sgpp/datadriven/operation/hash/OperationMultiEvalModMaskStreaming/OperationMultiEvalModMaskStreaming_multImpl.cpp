@@ -26,7 +26,8 @@ namespace sgpp {
 namespace datadriven {
 
 #if defined(__SSE3__) && !defined(__AVX__) && !defined(__AVX512F__)
-void OperationMultiEvalModMaskStreaming::multImpl(
+template <>
+void OperationMultiEvalModMaskStreaming::multImpl<SGPP_COMPILED_INSTRUCTION_SET>(
     std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
     std::vector<double>& offset, sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
     sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
@@ -157,7 +158,8 @@ void OperationMultiEvalModMaskStreaming::multImpl(
 #endif
 
 #if defined(__SSE3__) && defined(__AVX__) && !defined(__AVX512F__)
-void OperationMultiEvalModMaskStreaming::multImpl(
+template <>
+void OperationMultiEvalModMaskStreaming::multImpl<SGPP_COMPILED_INSTRUCTION_SET>(
     std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
     std::vector<double>& offset, sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
     sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
@@ -294,7 +296,8 @@ void OperationMultiEvalModMaskStreaming::multImpl(
 #endif
 
 #if defined(__MIC__) || defined(__AVX512F__)
-void OperationMultiEvalModMaskStreaming::multImpl(
+template <>
+void OperationMultiEvalModMaskStreaming::multImpl<SGPP_COMPILED_INSTRUCTION_SET>(
     std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
     std::vector<double>& offset, sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
     sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
@@ -602,7 +605,8 @@ void OperationMultiEvalModMaskStreaming::multImpl(
 #endif
 
 #if !defined(__SSE3__) && !defined(__AVX__) && !defined(__MIC__) && !defined(__AVX512F__)
-void OperationMultiEvalModMaskStreaming::multImpl(
+template <>
+void OperationMultiEvalModMaskStreaming::multImpl<SGPP_COMPILED_INSTRUCTION_SET>(
     std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
     std::vector<double>& offset, sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
     sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
@@ -617,7 +621,10 @@ void OperationMultiEvalModMaskStreaming::multImpl(
   size_t result_size = result.getSize();
   size_t dims = dataset->getNrows();
 
+// with kernel dispatch, the generic variant is always built as a fallback
+#ifndef SGPP_KERNEL_DISPATCH
 #warning "warning: using fallback implementation for OperationMultiEvalModMaskStreaming_mult"
+#endif
 
   for (size_t c = start_index_data; c < end_index_data;
        c += std::min<size_t>((size_t)getChunkDataPoints(), (end_index_data - c))) {
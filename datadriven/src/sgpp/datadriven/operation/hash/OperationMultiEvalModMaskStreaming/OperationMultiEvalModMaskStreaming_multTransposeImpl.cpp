@@ -24,7 +24,8 @@
 namespace sgpp {
 namespace datadriven {
 
-void OperationMultiEvalModMaskStreaming::multTransposeImpl(
+template <>
+void OperationMultiEvalModMaskStreaming::multTransposeImpl<SGPP_COMPILED_INSTRUCTION_SET>(
     std::vector<double>& level, std::vector<double>& index, std::vector<double>& mask,
     std::vector<double>& offset, sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
     sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
@@ -492,8 +493,11 @@ void OperationMultiEvalModMaskStreaming::multTransposeImpl(
 #endif
 
 #if !defined(__SSE3__) && !defined(__AVX__) && !defined(__MIC__) && !defined(__AVX512F__)
+// with kernel dispatch, the generic variant is always built as a fallback
+#ifndef SGPP_KERNEL_DISPATCH
 #warning \
     "warning: using fallback implementation for OperationMultiEvalModMaskStreaming_multTranspose"
+#endif
 
   for (size_t k = start_index_grid; k < end_index_grid;
        k += std::min<size_t>((size_t)getChunkGridPoints(), (end_index_grid - k))) {
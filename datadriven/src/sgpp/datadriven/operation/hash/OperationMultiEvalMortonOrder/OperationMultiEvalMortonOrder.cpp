@@ -0,0 +1,368 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalMortonOrder/OperationMultiEvalMortonOrder.hpp>
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/mortonOrder/MortonOrder.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+OperationMultiEvalMortonOrder::OperationMultiEvalMortonOrder(base::Grid& grid,
+                                                             base::DataMatrix& dataset)
+    : OperationMultipleEval(grid, dataset),
+      storage(&grid.getStorage()),
+      dims(grid.getDimension()),
+      isModified(false),
+      dataSize(dataset.getNrows()),
+      tileCount(0),
+      myTimer_(sgpp::base::SGppStopwatch()),
+      duration(-1.0) {
+  if (grid.getType() == base::GridType::Linear) {
+    this->isModified = false;
+  } else if (grid.getType() == base::GridType::ModLinear) {
+    this->isModified = true;
+  } else {
+    throw base::operation_exception(
+        "OperationMultiEvalMortonOrder: only Linear and ModLinear grids are supported");
+  }
+
+  if (dataset.getNcols() != this->dims) {
+    throw base::operation_exception(
+        "OperationMultiEvalMortonOrder: dimension of dataset and grid do not match");
+  }
+
+  this->sortDataset(dataset);
+
+  // create the kernel specific data structures for the current grid
+  this->prepare();
+}
+
+OperationMultiEvalMortonOrder::~OperationMultiEvalMortonOrder() {}
+
+void OperationMultiEvalMortonOrder::sortDataset(base::DataMatrix& dataset) {
+  Dataset zCurve(this->dataSize, this->dims);
+  zCurve.getData() = dataset;
+  MortonOrder order(&zCurve);
+  this->permutation = order.getPermutation();
+
+  this->sortedData.resize(this->dims * this->dataSize);
+
+  for (size_t s = 0; s < this->dataSize; s++) {
+    for (size_t d = 0; d < this->dims; d++) {
+      this->sortedData[d * this->dataSize + s] = dataset.get(this->permutation[s], d);
+    }
+  }
+
+  this->tileCount = (this->dataSize + MORTON_ORDER_TILE_SIZE - 1) / MORTON_ORDER_TILE_SIZE;
+  this->tileLower.resize(this->tileCount * this->dims);
+  this->tileUpper.resize(this->tileCount * this->dims);
+
+  for (size_t tile = 0; tile < this->tileCount; tile++) {
+    const size_t begin = tile * MORTON_ORDER_TILE_SIZE;
+    const size_t end = std::min(begin + MORTON_ORDER_TILE_SIZE, this->dataSize);
+
+    for (size_t d = 0; d < this->dims; d++) {
+      const double* x = &this->sortedData[d * this->dataSize];
+      const auto bounds = std::minmax_element(x + begin, x + end);
+      this->tileLower[tile * this->dims + d] = *bounds.first;
+      this->tileUpper[tile * this->dims + d] = *bounds.second;
+    }
+  }
+}
+
+void OperationMultiEvalMortonOrder::recalculateSubspaces() {
+  std::map<std::vector<base::HashGridPoint::level_type>, size_t> subspaceIndex;
+  std::vector<std::vector<size_t>> members;
+  std::vector<base::HashGridPoint::level_type> level(this->dims);
+
+  this->subspaces.clear();
+
+  for (size_t m = 0; m < this->storage->getSize(); m++) {
+    base::GridPoint& point = this->storage->getPoint(m);
+
+    for (size_t d = 0; d < this->dims; d++) {
+      level[d] = point.getLevel(d);
+
+      if (level[d] == 0) {
+        throw base::operation_exception(
+            "OperationMultiEvalMortonOrder: grids with boundary points are not supported");
+      }
+    }
+
+    auto it = subspaceIndex.find(level);
+
+    if (it == subspaceIndex.end()) {
+      it = subspaceIndex.insert(std::make_pair(level, this->subspaces.size())).first;
+      this->subspaces.push_back(Subspace());
+      this->subspaces.back().level = level;
+      members.push_back(std::vector<size_t>());
+    }
+
+    members[it->second].push_back(m);
+  }
+
+  for (size_t i = 0; i < this->subspaces.size(); i++) {
+    Subspace& subspace = this->subspaces[i];
+    subspace.stride.resize(this->dims);
+
+    // linearized index of a grid point: sum_d (index_d - 1) / 2 * stride_d
+    size_t levelSum = 0;
+    size_t size = 1;
+
+    for (size_t d = 0; d < this->dims; d++) {
+      levelSum += subspace.level[d] - 1;
+
+      if (levelSum >= 64) {
+        throw base::operation_exception(
+            "OperationMultiEvalMortonOrder: subspace has too many grid points");
+      }
+
+      subspace.stride[d] = size;
+      size <<= (subspace.level[d] - 1);
+    }
+
+    subspace.isFull = (members[i].size() == size);
+
+    if (subspace.isFull) {
+      subspace.gridIndexDense.resize(size);
+    }
+
+    for (size_t m : members[i]) {
+      base::GridPoint& point = this->storage->getPoint(m);
+      size_t key = 0;
+
+      for (size_t d = 0; d < this->dims; d++) {
+        key += (point.getIndex(d) - 1) / 2 * subspace.stride[d];
+      }
+
+      if (subspace.isFull) {
+        subspace.gridIndexDense[key] = m;
+      } else {
+        subspace.gridIndexSparse[key] = m;
+      }
+    }
+  }
+}
+
+template <typename Visitor>
+void OperationMultiEvalMortonOrder::forEachOverlap(const Subspace& subspace, size_t tile,
+                                                   size_t* scratch, Visitor visitor) const {
+  size_t* first = scratch;
+  size_t* last = scratch + this->dims;
+  size_t* current = scratch + 2 * this->dims;
+  size_t key = 0;
+
+  for (size_t d = 0; d < this->dims; d++) {
+    // the support of index i is ((i - 1) * h, (i + 1) * h), so the odd indices intersecting
+    // [lower, upper] lie in [floor(lower / h), ceil(upper / h)]
+    const int64_t hInv = static_cast<int64_t>(1) << subspace.level[d];
+    int64_t iMin = static_cast<int64_t>(std::floor(this->tileLower[tile * this->dims + d] *
+                                                   static_cast<double>(hInv))) | 1;
+    int64_t iMax = static_cast<int64_t>(std::ceil(this->tileUpper[tile * this->dims + d] *
+                                                  static_cast<double>(hInv)));
+
+    if (iMax % 2 == 0) {
+      iMax--;
+    }
+
+    // if all points of the tile lie on the boundary (e.g., binary features), the range above is
+    // outside of the domain, but the modified boundary functions do not vanish there
+    iMin = std::min<int64_t>(std::max<int64_t>(iMin, 1), hInv - 1);
+    iMax = std::max<int64_t>(std::min<int64_t>(iMax, hInv - 1), 1);
+
+    if (iMin > iMax) {
+      return;
+    }
+
+    first[d] = static_cast<size_t>(iMin - 1) / 2;
+    last[d] = static_cast<size_t>(iMax - 1) / 2;
+    current[d] = first[d];
+    key += first[d] * subspace.stride[d];
+  }
+
+  while (true) {
+    if (subspace.isFull) {
+      visitor(subspace.gridIndexDense[key]);
+    } else {
+      auto it = subspace.gridIndexSparse.find(key);
+
+      if (it != subspace.gridIndexSparse.end()) {
+        visitor(it->second);
+      }
+    }
+
+    // advance the multi-index (odometer)
+    size_t d = 0;
+
+    while (d < this->dims) {
+      if (current[d] < last[d]) {
+        current[d]++;
+        key += subspace.stride[d];
+        break;
+      }
+
+      key -= (current[d] - first[d]) * subspace.stride[d];
+      current[d] = first[d];
+      d++;
+    }
+
+    if (d == this->dims) {
+      return;
+    }
+  }
+}
+
+void OperationMultiEvalMortonOrder::evalTile(size_t gridIndex, size_t begin, size_t end,
+                                             double* values) const {
+  base::GridPoint& point = this->storage->getPoint(gridIndex);
+  const size_t count = end - begin;
+
+  for (size_t d = 0; d < this->dims; d++) {
+    const base::HashGridPoint::level_type level = point.getLevel(d);
+    const base::HashGridPoint::index_type index = point.getIndex(d);
+    const double hInv = static_cast<double>(static_cast<uint64_t>(1) << level);
+    const double i = static_cast<double>(index);
+    const double* x = &this->sortedData[d * this->dataSize + begin];
+
+    if (!this->isModified || ((level > 1) && (index > 1) && (hInv - 1.0 > i))) {
+      for (size_t c = 0; c < count; c++) {
+        values[c] *= std::max(0.0, 1.0 - std::fabs(hInv * x[c] - i));
+      }
+    } else if (level == 1) {
+      // constant one
+      continue;
+    } else if (index == 1) {
+      for (size_t c = 0; c < count; c++) {
+        values[c] *= std::max(0.0, 2.0 - hInv * x[c]);
+      }
+    } else {
+      for (size_t c = 0; c < count; c++) {
+        values[c] *= std::max(0.0, hInv * x[c] - i + 1.0);
+      }
+    }
+  }
+}
+
+void OperationMultiEvalMortonOrder::mult(sgpp::base::DataVector& alpha,
+                                         sgpp::base::DataVector& result) {
+  this->myTimer_.start();
+
+  if (result.getSize() != this->dataSize) {
+    result.resize(this->dataSize);
+  }
+
+#pragma omp parallel
+  {
+    std::vector<size_t> scratch(3 * this->dims);
+    double values[MORTON_ORDER_TILE_SIZE];
+    double sums[MORTON_ORDER_TILE_SIZE];
+
+#pragma omp for schedule(dynamic)
+    for (size_t tile = 0; tile < this->tileCount; tile++) {
+      const size_t begin = tile * MORTON_ORDER_TILE_SIZE;
+      const size_t end = std::min(begin + MORTON_ORDER_TILE_SIZE, this->dataSize);
+      const size_t count = end - begin;
+
+      std::fill(sums, sums + count, 0.0);
+
+      for (const Subspace& subspace : this->subspaces) {
+        this->forEachOverlap(subspace, tile, scratch.data(), [&](size_t gridIndex) {
+          const double alphaValue = alpha[gridIndex];
+
+          if (alphaValue == 0.0) {
+            return;
+          }
+
+          std::fill(values, values + count, alphaValue);
+          this->evalTile(gridIndex, begin, end, values);
+
+          for (size_t c = 0; c < count; c++) {
+            sums[c] += values[c];
+          }
+        });
+      }
+
+      for (size_t c = 0; c < count; c++) {
+        result[this->permutation[begin + c]] = sums[c];
+      }
+    }
+  }
+
+  this->duration = this->myTimer_.stop();
+}
+
+void OperationMultiEvalMortonOrder::multTranspose(sgpp::base::DataVector& source,
+                                                  sgpp::base::DataVector& result) {
+  this->myTimer_.start();
+
+  std::vector<double> sortedSource(this->dataSize);
+
+  for (size_t s = 0; s < this->dataSize; s++) {
+    sortedSource[s] = source[this->permutation[s]];
+  }
+
+  result.setAll(0.0);
+
+  // every grid point belongs to exactly one subspace, so the threads write disjoint entries
+#pragma omp parallel
+  {
+    std::vector<size_t> scratch(3 * this->dims);
+    double values[MORTON_ORDER_TILE_SIZE];
+
+#pragma omp for schedule(dynamic)
+    for (size_t i = 0; i < this->subspaces.size(); i++) {
+      for (size_t tile = 0; tile < this->tileCount; tile++) {
+        const size_t begin = tile * MORTON_ORDER_TILE_SIZE;
+        const size_t end = std::min(begin + MORTON_ORDER_TILE_SIZE, this->dataSize);
+        const size_t count = end - begin;
+
+        this->forEachOverlap(this->subspaces[i], tile, scratch.data(), [&](size_t gridIndex) {
+          std::fill(values, values + count, 1.0);
+          this->evalTile(gridIndex, begin, end, values);
+
+          double sum = 0.0;
+
+          for (size_t c = 0; c < count; c++) {
+            sum += values[c] * sortedSource[begin + c];
+          }
+
+          result[gridIndex] += sum;
+        });
+      }
+    }
+  }
+
+  this->duration = this->myTimer_.stop();
+}
+
+size_t OperationMultiEvalMortonOrder::getOverlapCount() {
+  std::vector<size_t> scratch(3 * this->dims);
+  size_t overlaps = 0;
+
+  for (const Subspace& subspace : this->subspaces) {
+    for (size_t tile = 0; tile < this->tileCount; tile++) {
+      this->forEachOverlap(subspace, tile, scratch.data(), [&](size_t) { overlaps++; });
+    }
+  }
+
+  return overlaps;
+}
+
+double OperationMultiEvalMortonOrder::getDuration() { return this->duration; }
+
+void OperationMultiEvalMortonOrder::prepare() { this->recalculateSubspaces(); }
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,113 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+#ifndef MORTON_ORDER_TILE_SIZE
+// number of consecutive data points (in Morton order) that form a tile
+#define MORTON_ORDER_TILE_SIZE 64
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Multi-evaluation for linear and modified linear grids that exploits the locality of the data.
+ *
+ * The data points are sorted along a Z-curve (see MortonOrder) and cut into tiles of
+ * MORTON_ORDER_TILE_SIZE consecutive points, each with its bounding box. The grid points are
+ * grouped by subspace (level vector). As the supports of the basis functions of a subspace are
+ * disjoint, the grid points of a subspace whose support intersects the bounding box of a tile
+ * can be enumerated directly from the index ranges per dimension, without looking at the
+ * others. Hence mult and multTranspose only evaluate (tile, grid point) pairs that overlap,
+ * instead of all N * M pairs of the streaming kernels. This pays off for low-dimensional data,
+ * where the tiles are small boxes.
+ */
+class OperationMultiEvalMortonOrder : public base::OperationMultipleEval {
+ public:
+  OperationMultiEvalMortonOrder(base::Grid& grid, base::DataMatrix& dataset);
+
+  ~OperationMultiEvalMortonOrder() override;
+
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
+  void multTranspose(sgpp::base::DataVector& source, sgpp::base::DataVector& result) override;
+
+  void prepare() override;
+
+  double getDuration() override;
+
+  /**
+   * @return number of (tile, grid point) pairs with intersecting supports, i.e., the work
+   *         done by mult and multTranspose in units of MORTON_ORDER_TILE_SIZE evaluations
+   */
+  size_t getOverlapCount();
+
+ protected:
+  /// grid points of one level vector
+  struct Subspace {
+    /// level per dimension
+    std::vector<base::HashGridPoint::level_type> level;
+    /// stride of (index - 1) / 2 in the linearized index of a grid point
+    std::vector<size_t> stride;
+    /// true if all grid points of the subspace exist, then gridIndexDense is used
+    bool isFull;
+    /// grid point sequence numbers by linearized index, for full subspaces
+    std::vector<size_t> gridIndexDense;
+    /// grid point sequence numbers by linearized index, for incomplete subspaces
+    std::unordered_map<size_t, size_t> gridIndexSparse;
+  };
+
+  base::GridStorage* storage;
+  size_t dims;
+  bool isModified;
+
+  /// number of data points
+  size_t dataSize;
+  /// sorted position -> original position of the data points
+  std::vector<size_t> permutation;
+  /// sorted dataset, transposed (dims x dataSize)
+  std::vector<double> sortedData;
+  /// bounding boxes of the tiles (tileCount x dims each)
+  std::vector<double> tileLower;
+  std::vector<double> tileUpper;
+  size_t tileCount;
+
+  std::vector<Subspace> subspaces;
+
+  /// Timer object to handle time measurements
+  sgpp::base::SGppStopwatch myTimer_;
+  double duration;
+
+  void sortDataset(base::DataMatrix& dataset);
+
+  void recalculateSubspaces();
+
+  /**
+   * Calls visitor(gridIndex) for all existing grid points of the subspace whose supports
+   * intersect the bounding box of the tile. scratch has to hold 3 * dims entries.
+   */
+  template <typename Visitor>
+  void forEachOverlap(const Subspace& subspace, size_t tile, size_t* scratch,
+                      Visitor visitor) const;
+
+  /**
+   * Multiplies the values of the basis function of grid point gridIndex at the points
+   * [begin, end) of the sorted dataset onto values.
+   */
+  void evalTile(size_t gridIndex, size_t begin, size_t end, double* values) const;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
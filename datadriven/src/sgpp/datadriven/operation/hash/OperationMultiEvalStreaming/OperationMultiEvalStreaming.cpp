@@ -5,17 +5,78 @@
 
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
 
+#include <sgpp/base/tools/Tracing.hpp>
+
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
 namespace datadriven {
 
+// kernel variants, each one is defined by the *_multImpl.cpp and *_multTransposeImpl.cpp files
+// compiled for the respective instruction set
+template <>
+void OperationMultiEvalStreaming::multImpl<base::InstructionSet::GENERIC>(
+    base::DataMatrix* level, base::DataMatrix* index, base::DataMatrix* dataset,
+    base::DataVector& alpha, base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data);
+template <>
+void OperationMultiEvalStreaming::multTransposeImpl<base::InstructionSet::GENERIC>(
+    base::DataMatrix* level, base::DataMatrix* index, base::DataMatrix* dataset,
+    base::DataVector& source, base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data);
+
+template <>
+void OperationMultiEvalStreaming::multImpl<base::InstructionSet::SSE3>(
+    base::DataMatrix* level, base::DataMatrix* index, base::DataMatrix* dataset,
+    base::DataVector& alpha, base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data);
+template <>
+void OperationMultiEvalStreaming::multTransposeImpl<base::InstructionSet::SSE3>(
+    base::DataMatrix* level, base::DataMatrix* index, base::DataMatrix* dataset,
+    base::DataVector& source, base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data);
+
+template <>
+void OperationMultiEvalStreaming::multImpl<base::InstructionSet::AVX>(
+    base::DataMatrix* level, base::DataMatrix* index, base::DataMatrix* dataset,
+    base::DataVector& alpha, base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data);
+template <>
+void OperationMultiEvalStreaming::multTransposeImpl<base::InstructionSet::AVX>(
+    base::DataMatrix* level, base::DataMatrix* index, base::DataMatrix* dataset,
+    base::DataVector& source, base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data);
+
+template <>
+void OperationMultiEvalStreaming::multImpl<base::InstructionSet::AVX2>(
+    base::DataMatrix* level, base::DataMatrix* index, base::DataMatrix* dataset,
+    base::DataVector& alpha, base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data);
+template <>
+void OperationMultiEvalStreaming::multTransposeImpl<base::InstructionSet::AVX2>(
+    base::DataMatrix* level, base::DataMatrix* index, base::DataMatrix* dataset,
+    base::DataVector& source, base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data);
+
+template <>
+void OperationMultiEvalStreaming::multImpl<base::InstructionSet::AVX512>(
+    base::DataMatrix* level, base::DataMatrix* index, base::DataMatrix* dataset,
+    base::DataVector& alpha, base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data);
+template <>
+void OperationMultiEvalStreaming::multTransposeImpl<base::InstructionSet::AVX512>(
+    base::DataMatrix* level, base::DataMatrix* index, base::DataMatrix* dataset,
+    base::DataVector& source, base::DataVector& result, const size_t start_index_grid,
+    const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data);
+
 OperationMultiEvalStreaming::OperationMultiEvalStreaming(base::Grid& grid,
                                                          base::DataMatrix& dataset)
     : OperationMultipleEval(grid, dataset),
       preparedDataset(dataset),
       myTimer_(sgpp::base::SGppStopwatch()),
-      duration(-1.0) {
+      duration(-1.0),
+      instructionSet(base::CPUFeatures::getKernelInstructionSet()) {
+  this->selectKernels();
   this->storage = &grid.getStorage();
   this->padDataset(this->preparedDataset);
   this->preparedDataset.transpose();
@@ -77,21 +138,37 @@ void OperationMultiEvalStreaming::getOpenMPPartitionSegment(size_t start, size_t
   getPartitionSegment(start, end, threadCount, myThreadNum, segmentStart, segmentEnd, blocksize);
 }
 
+void OperationMultiEvalStreaming::countKernelOperations() {
+#ifdef SGPP_TRACING
+  // 5 flops per data point, grid point, and dimension (level * x - index, 1 - |.|, max, product)
+  // and one per pair for the accumulation; each operand is streamed at least once
+  const uint64_t dataPoints = this->preparedDataset.getNcols();
+  const uint64_t gridPoints = this->storage->getSize();
+  const uint64_t dim = this->preparedDataset.getNrows();
+  SGPP_TRACE_COUNT(Flops, dataPoints * gridPoints * (5 * dim + 1));
+  SGPP_TRACE_COUNT(BytesStreamed,
+                   sizeof(double) * (dataPoints * dim + 2 * gridPoints * dim + dataPoints +
+                                     gridPoints));
+#endif
+}
+
 size_t OperationMultiEvalStreaming::getChunkGridPoints() {
   // not used by the MIC-implementation
   return 12;
 }
 size_t OperationMultiEvalStreaming::getChunkDataPoints() {
-#if defined(__MIC__) || defined(__AVX512F__)
-  return STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH;
-#else
-  return 24;  // must be divisible by 24
-#endif
+  if (this->instructionSet == base::InstructionSet::AVX512) {
+    return STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH;
+  } else {
+    return 24;  // must be divisible by 24
+  }
 }
 
 void OperationMultiEvalStreaming::mult(sgpp::base::DataVector& alpha,
                                        sgpp::base::DataVector& result) {
+  SGPP_TRACE_SCOPE("OperationMultiEvalStreaming::mult");
   this->myTimer_.start();
+  this->countKernelOperations();
 
   size_t originalSize = result.getSize();
 
@@ -106,8 +183,8 @@ void OperationMultiEvalStreaming::mult(sgpp::base::DataVector& alpha,
     getOpenMPPartitionSegment(0, this->preparedDataset.getNcols(), &start, &end,
                               getChunkDataPoints());
 
-    this->multImpl(level_, index_, &this->preparedDataset, alpha, result, 0, alpha.getSize(), start,
-                   end);
+    (this->*multKernel)(level_, index_, &this->preparedDataset, alpha, result, 0, alpha.getSize(),
+                        start, end);
   }
   result.resize(originalSize);
   this->duration = this->myTimer_.stop();
@@ -115,7 +192,9 @@ void OperationMultiEvalStreaming::mult(sgpp::base::DataVector& alpha,
 
 void OperationMultiEvalStreaming::multTranspose(sgpp::base::DataVector& source,
                                                 sgpp::base::DataVector& result) {
+  SGPP_TRACE_SCOPE("OperationMultiEvalStreaming::multTranspose");
   this->myTimer_.start();
+  this->countKernelOperations();
 
   size_t originalSize = source.getSize();
 
@@ -135,8 +214,8 @@ void OperationMultiEvalStreaming::multTranspose(sgpp::base::DataVector& source,
 
     getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
 
-    this->multTransposeImpl(this->level_, this->index_, &this->preparedDataset, source, result,
-                            start, end, 0, this->preparedDataset.getNcols());
+    (this->*multTransposeKernel)(this->level_, this->index_, &this->preparedDataset, source,
+                                 result, start, end, 0, this->preparedDataset.getNcols());
   }
   source.resize(originalSize);
   this->duration = this->myTimer_.stop();
@@ -178,6 +257,67 @@ size_t OperationMultiEvalStreaming::padDataset(sgpp::base::DataMatrix& dataset)
 
 double OperationMultiEvalStreaming::getDuration() { return this->duration; }
 
+template <base::InstructionSet isa>
+bool OperationMultiEvalStreaming::usesKernels() const {
+  return this->multKernel == &OperationMultiEvalStreaming::multImpl<isa> &&
+         this->multTransposeKernel == &OperationMultiEvalStreaming::multTransposeImpl<isa>;
+}
+
+base::InstructionSet OperationMultiEvalStreaming::getInstructionSet() {
+#ifdef SGPP_KERNEL_DISPATCH
+  // determined from the installed kernels instead of the requested instruction set
+  if (usesKernels<base::InstructionSet::AVX512>()) {
+    return base::InstructionSet::AVX512;
+  } else if (usesKernels<base::InstructionSet::AVX2>()) {
+    return base::InstructionSet::AVX2;
+  } else if (usesKernels<base::InstructionSet::AVX>()) {
+    return base::InstructionSet::AVX;
+  } else if (usesKernels<base::InstructionSet::SSE3>()) {
+    return base::InstructionSet::SSE3;
+  }
+  return base::InstructionSet::GENERIC;
+#else
+  return SGPP_COMPILED_INSTRUCTION_SET;
+#endif
+}
+
+void OperationMultiEvalStreaming::selectKernels() {
+#ifdef SGPP_KERNEL_DISPATCH
+  switch (this->instructionSet) {
+    case base::InstructionSet::AVX512:
+      this->multKernel = &OperationMultiEvalStreaming::multImpl<base::InstructionSet::AVX512>;
+      this->multTransposeKernel =
+          &OperationMultiEvalStreaming::multTransposeImpl<base::InstructionSet::AVX512>;
+      break;
+    case base::InstructionSet::AVX2:
+      this->multKernel = &OperationMultiEvalStreaming::multImpl<base::InstructionSet::AVX2>;
+      this->multTransposeKernel =
+          &OperationMultiEvalStreaming::multTransposeImpl<base::InstructionSet::AVX2>;
+      break;
+    case base::InstructionSet::AVX:
+      this->multKernel = &OperationMultiEvalStreaming::multImpl<base::InstructionSet::AVX>;
+      this->multTransposeKernel =
+          &OperationMultiEvalStreaming::multTransposeImpl<base::InstructionSet::AVX>;
+      break;
+    case base::InstructionSet::SSE3:
+      this->multKernel = &OperationMultiEvalStreaming::multImpl<base::InstructionSet::SSE3>;
+      this->multTransposeKernel =
+          &OperationMultiEvalStreaming::multTransposeImpl<base::InstructionSet::SSE3>;
+      break;
+    case base::InstructionSet::GENERIC:
+      this->multKernel = &OperationMultiEvalStreaming::multImpl<base::InstructionSet::GENERIC>;
+      this->multTransposeKernel =
+          &OperationMultiEvalStreaming::multTransposeImpl<base::InstructionSet::GENERIC>;
+      break;
+  }
+#else
+  // only the variant selected by ARCH is compiled
+  this->multKernel = &OperationMultiEvalStreaming::multImpl<SGPP_COMPILED_INSTRUCTION_SET>;
+  this->multTransposeKernel =
+      &OperationMultiEvalStreaming::multTransposeImpl<SGPP_COMPILED_INSTRUCTION_SET>;
+#endif
+}
+
 void OperationMultiEvalStreaming::prepare() { this->recalculateLevelAndIndex(); }
 }  // namespace datadriven
 }  // namespace sgpp
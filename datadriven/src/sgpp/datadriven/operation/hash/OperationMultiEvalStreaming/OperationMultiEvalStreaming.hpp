@@ -11,6 +11,7 @@
 
 #include <sgpp/base/exception/operation_exception.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
 #include <sgpp/base/tools/SGppStopwatch.hpp>
 #include <sgpp/globaldef.hpp>
 
@@ -36,6 +37,19 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   double duration;
 
+  /// instruction set of the kernel variant in use, see base::CPUFeatures
+  base::InstructionSet instructionSet;
+
+  typedef void (OperationMultiEvalStreaming::*MultKernel)(
+      sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
+      sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
+      sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
+      const size_t start_index_data, const size_t end_index_data);
+
+  /// kernel variants of instructionSet
+  MultKernel multKernel;
+  MultKernel multTransposeKernel;
+
  public:
   OperationMultiEvalStreaming(base::Grid& grid, base::DataMatrix& dataset);
 
@@ -53,21 +67,42 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   double getDuration() override;
 
+  /**
+   * @return instruction set of the kernel variant used by mult and multTranspose
+   */
+  base::InstructionSet getInstructionSet();
+
  private:
+  /**
+   * @return whether the kernel variants for the instruction set isa are installed
+   */
+  template <base::InstructionSet isa>
+  bool usesKernels() const;
+
   void getPartitionSegment(size_t start, size_t end, size_t segmentCount, size_t segmentNumber,
                            size_t* segmentStart, size_t* segmentEnd, size_t blockSize);
 
   size_t padDataset(sgpp::base::DataMatrix& dataset);
 
+  /// counts the flops and the streamed bytes of one kernel call (see base::Tracer)
+  void countKernelOperations();
+
   void getOpenMPPartitionSegment(size_t start, size_t end, size_t* segmentStart, size_t* segmentEnd,
                                  size_t blocksize);
 
+  /**
+   * Kernel variants, the specialization for an instruction set is defined by
+   * OperationMultiEvalStreaming_multImpl.cpp compiled for this instruction set
+   * (SGPP_COMPILED_INSTRUCTION_SET).
+   */
+  template <base::InstructionSet isa>
   void multImpl(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
                 sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
                 sgpp::base::DataVector& result, const size_t start_index_grid,
                 const size_t end_index_grid, const size_t start_index_data,
                 const size_t end_index_data);
 
+  template <base::InstructionSet isa>
   void multTransposeImpl(sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index,
                          sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
                          sgpp::base::DataVector& result, const size_t start_index_grid,
@@ -75,6 +110,8 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
                          const size_t end_index_data);
 
   void recalculateLevelAndIndex();
+
+  void selectKernels();
 };
 
 }  // namespace datadriven
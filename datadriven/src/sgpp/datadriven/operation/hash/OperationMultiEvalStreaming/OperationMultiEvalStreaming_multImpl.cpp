@@ -25,7 +25,8 @@ namespace sgpp {
 namespace datadriven {
 
 #if defined(__SSE3__) && !defined(__AVX__) && !defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
+template <>
+void OperationMultiEvalStreaming::multImpl<SGPP_COMPILED_INSTRUCTION_SET>(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
@@ -148,7 +149,8 @@ void OperationMultiEvalStreaming::multImpl(
 #endif
 
 #if defined(__SSE3__) && defined(__AVX__) && !defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
+template <>
+void OperationMultiEvalStreaming::multImpl<SGPP_COMPILED_INSTRUCTION_SET>(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
@@ -278,7 +280,8 @@ void OperationMultiEvalStreaming::multImpl(
 #endif
 
 #if defined(__MIC__) || defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
+template <>
+void OperationMultiEvalStreaming::multImpl<SGPP_COMPILED_INSTRUCTION_SET>(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
@@ -574,7 +577,8 @@ void OperationMultiEvalStreaming::multImpl(
 #endif
 
 #if !defined(__SSE3__) && !defined(__AVX__) && !defined(__MIC__) && !defined(__AVX512F__)
-void OperationMultiEvalStreaming::multImpl(
+template <>
+void OperationMultiEvalStreaming::multImpl<SGPP_COMPILED_INSTRUCTION_SET>(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
@@ -586,7 +590,10 @@ void OperationMultiEvalStreaming::multImpl(
   size_t result_size = result.getSize();
   size_t dims = dataset->getNrows();
 
+// with kernel dispatch, the generic variant is always built as a fallback
+#ifndef SGPP_KERNEL_DISPATCH
 #warning "warning: using fallback implementation for OperationMultiEvalStreaming mult kernel"
+#endif
 
   for (size_t c = start_index_data; c < end_index_data;
        c += std::min<size_t>(getChunkDataPoints(), (end_index_data - c))) {
@@ -23,7 +23,8 @@
 namespace sgpp {
 namespace datadriven {
 
-void OperationMultiEvalStreaming::multTransposeImpl(
+template <>
+void OperationMultiEvalStreaming::multTransposeImpl<SGPP_COMPILED_INSTRUCTION_SET>(
     sgpp::base::DataMatrix* level, sgpp::base::DataMatrix* index, sgpp::base::DataMatrix* dataset,
     sgpp::base::DataVector& source, sgpp::base::DataVector& result, const size_t start_index_grid,
     const size_t end_index_grid, const size_t start_index_data, const size_t end_index_data) {
@@ -481,8 +482,11 @@ void OperationMultiEvalStreaming::multTransposeImpl(
 #endif
 
 #if (!defined(__SSE3__) && !defined(__AVX__)) && !defined(__MIC__) && !defined(__AVX512F__)
+// with kernel dispatch, the generic variant is always built as a fallback
+#ifndef SGPP_KERNEL_DISPATCH
 #warning \
     "warning: using fallback implementation for OperationMultiEvalStreaming multTranspose kernel"
+#endif
 
   for (size_t k = start_index_grid; k < end_index_grid;
        k += std::min<size_t>(getChunkGridPoints(), (end_index_grid - k))) {
@@ -5,17 +5,52 @@
 
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBSpline/OperationMultiEvalStreamingBSpline.hpp>
 
+#include <sgpp/base/grid/type/BsplineGrid.hpp>
+#include <sgpp/base/grid/type/ModBsplineGrid.hpp>
+#include <sgpp/base/operation/hash/common/basis/UniformBsplineKernel.hpp>
+
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
 namespace datadriven {
 
+namespace {
+/**
+ * Multiplies the values of the uniform B-spline of degree p at scale * data + offset onto support.
+ * The kernel is branch-free, so the loop over the block is vectorized.
+ */
+template <size_t p>
+void multiplyUniformBSplineBlock(const double* data, double scale, double offset,
+                                 size_t blockSize, double* support) {
+#pragma omp simd
+  for (size_t c = 0; c < blockSize; c++) {
+    support[c] *= base::UniformBsplineKernel<p>::evalSimd(data[c] * scale + offset);
+  }
+}
+}  // namespace
+
 OperationMultiEvalStreamingBSpline::OperationMultiEvalStreamingBSpline(base::Grid& grid,
                                                                        base::DataMatrix& dataset)
     : OperationMultipleEval(grid, dataset),
       preparedDataset(dataset),
       myTimer_(sgpp::base::SGppStopwatch()),
       duration(-1.0) {
+  if (grid.getType() == base::GridType::Bspline) {
+    this->degree = dynamic_cast<base::BsplineGrid&>(grid).getDegree();
+    this->isModified = false;
+  } else if (grid.getType() == base::GridType::ModBspline) {
+    this->degree = dynamic_cast<base::ModBsplineGrid&>(grid).getDegree();
+    this->isModified = true;
+  } else {
+    throw base::operation_exception(
+        "OperationMultiEvalStreamingBSpline: only Bspline and ModBspline grids are supported");
+  }
+
+  this->bsplineBasis = base::BsplineBasis<unsigned int, unsigned int>(this->degree);
+  this->modBsplineBasis = base::BsplineModifiedBasis<unsigned int, unsigned int>(this->degree);
+  // even degrees are replaced by the next lower odd degree by the basis
+  this->degree = this->bsplineBasis.getDegree();
+
   this->storage = &grid.getStorage();
 
   this->padDataset(this->preparedDataset);
@@ -105,8 +140,12 @@ void OperationMultiEvalStreamingBSpline::mult(sgpp::base::DataVector& alpha,
     getOpenMPPartitionSegment(0, this->preparedDataset.getNcols(), &start, &end,
                               getChunkDataPoints());
 
-    this->multImpl(level_, index_, &this->preparedDataset, alpha, result, 0, alpha.getSize(), start,
-                   end);
+    if (this->useCubicKernels()) {
+      this->multImpl(level_, index_, &this->preparedDataset, alpha, result, 0, alpha.getSize(),
+                     start, end);
+    } else {
+      this->multImplGeneric(&this->preparedDataset, alpha, result, 0, alpha.getSize(), start, end);
+    }
   }
   result.resize(originalSize);
   this->duration = this->myTimer_.stop();
@@ -134,8 +173,13 @@ void OperationMultiEvalStreamingBSpline::multTranspose(sgpp::base::DataVector& s
 
     getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
 
-    this->multTransposeImpl(this->level_, this->index_, &this->preparedDataset, source, result,
-                            start, end, 0, this->preparedDataset.getNcols());
+    if (this->useCubicKernels()) {
+      this->multTransposeImpl(this->level_, this->index_, &this->preparedDataset, source, result,
+                              start, end, 0, this->preparedDataset.getNcols());
+    } else {
+      this->multTransposeImplGeneric(&this->preparedDataset, source, result, start, end, 0,
+                                     this->preparedDataset.getNcols());
+    }
   }
   source.resize(originalSize);
   this->duration = this->myTimer_.stop();
@@ -152,6 +196,80 @@ void OperationMultiEvalStreamingBSpline::recalculateLevelAndIndex() {
       new sgpp::base::DataMatrix(this->storage->getSize(), this->storage->getDimension());
 
   this->storage->getLevelIndexArraysForEval(*(this->level_), *(this->index_));
+
+  // precompute the affine map x -> scale * x + offset into the parameter space of the uniform or
+  // modified B-spline, such that the kernels don't have to branch on level and index
+  const size_t gridSize = this->storage->getSize();
+  const size_t dims = this->storage->getDimension();
+  const double shift = static_cast<double>(this->degree + 1) / 2.0;
+
+  this->kind.assign(gridSize * dims, KIND_UNIFORM);
+  this->scale.assign(gridSize * dims, 0.0);
+  this->offset.assign(gridSize * dims, 0.0);
+
+  for (size_t m = 0; m < gridSize; m++) {
+    for (size_t d = 0; d < dims; d++) {
+      const size_t k = m * dims + d;
+      const double hInv = this->level_->get(m, d);
+      const double i = this->index_->get(m, d);
+
+      if (!this->isModified) {
+        this->scale[k] = hInv;
+        this->offset[k] = shift - i;
+      } else if (hInv == 2.0) {
+        this->kind[k] = KIND_ONE;
+      } else if (i == 1.0) {
+        this->kind[k] = KIND_MODIFIED;
+        this->scale[k] = hInv;
+      } else if (i == hInv - 1.0) {
+        // mirror the situation at x = 0.5
+        this->kind[k] = KIND_MODIFIED;
+        this->scale[k] = -hInv;
+        this->offset[k] = hInv;
+      } else {
+        this->scale[k] = hInv;
+        this->offset[k] = shift - i;
+      }
+    }
+  }
+}
+
+bool OperationMultiEvalStreamingBSpline::useCubicKernels() const {
+  return !this->isModified && (this->degree == 3);
+}
+
+void OperationMultiEvalStreamingBSpline::evalBlock(size_t gridIndex, size_t d, const double* data,
+                                                   size_t blockSize, double* support) const {
+  const size_t k = gridIndex * this->storage->getDimension() + d;
+  const double s = this->scale[k];
+  const double o = this->offset[k];
+
+  if (this->kind[k] == KIND_ONE) {
+    return;
+  } else if (this->kind[k] == KIND_MODIFIED) {
+    for (size_t c = 0; c < blockSize; c++) {
+      support[c] *= this->modBsplineBasis.modifiedBSpline(data[c] * s + o, this->degree);
+    }
+  } else {
+    switch (this->degree) {
+      case 1:
+        multiplyUniformBSplineBlock<1>(data, s, o, blockSize, support);
+        break;
+      case 3:
+        multiplyUniformBSplineBlock<3>(data, s, o, blockSize, support);
+        break;
+      case 5:
+        multiplyUniformBSplineBlock<5>(data, s, o, blockSize, support);
+        break;
+      case 7:
+        multiplyUniformBSplineBlock<7>(data, s, o, blockSize, support);
+        break;
+      default:
+        for (size_t c = 0; c < blockSize; c++) {
+          support[c] *= this->bsplineBasis.uniformBSpline(data[c] * s + o, this->degree);
+        }
+    }
+  }
 }
 
 size_t OperationMultiEvalStreamingBSpline::padDataset(sgpp::base::DataMatrix& dataset) {
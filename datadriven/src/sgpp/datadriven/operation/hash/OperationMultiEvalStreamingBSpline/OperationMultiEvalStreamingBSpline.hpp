@@ -1,21 +1,44 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
 #pragma once
 
 #include <omp.h>
 
 #include <sgpp/base/exception/operation_exception.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineModifiedBasis.hpp>
 #include <sgpp/base/tools/SGppStopwatch.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <vector>
+
 #ifndef STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH
 //#define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 24
 #define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 96
 #endif
 
+#ifndef STREAMING_BSPLINE_BLOCK_SIZE
+// number of data points processed at once by the generic kernels
+#define STREAMING_BSPLINE_BLOCK_SIZE 64
+#endif
+
 namespace sgpp {
 namespace datadriven {
 
+/**
+ * Streaming multi-evaluation for B-spline and modified B-spline grids.
+ *
+ * The dataset is padded and stored transposed, so that the data points of a
+ * block are contiguous per dimension. Cubic B-splines on B-spline grids use
+ * the hand-vectorized AVX kernels (if available), every other degree and the
+ * modified B-spline grids use the generic blocked kernels, which are written
+ * to be auto-vectorized over the data points.
+ */
 class OperationMultiEvalStreamingBSpline : public base::OperationMultipleEval {
  protected:
   sgpp::base::DataMatrix preparedDataset;
@@ -30,7 +53,32 @@ class OperationMultiEvalStreamingBSpline : public base::OperationMultipleEval {
 
   double duration;
 
+  /// degree of the B-splines
+  size_t degree;
+  /// true for modified B-spline grids
+  bool isModified;
+  /// used for the uniform B-spline evaluations
+  base::BsplineBasis<unsigned int, unsigned int> bsplineBasis;
+  /// used for the modified B-spline evaluations at the boundary
+  base::BsplineModifiedBasis<unsigned int, unsigned int> modBsplineBasis;
+
+  /// type of the 1d basis function per grid point and dimension
+  std::vector<int> kind;
+  /// affine transformation of the data point into the B-spline's parameter space
+  std::vector<double> scale;
+  std::vector<double> offset;
+
  public:
+  /// type of the 1d basis functions
+  enum BasisKind {
+    /// uniform B-spline
+    KIND_UNIFORM = 0,
+    /// constant one (modified B-spline grids, level 1)
+    KIND_ONE = 1,
+    /// modified B-spline at the boundary (left or mirrored right)
+    KIND_MODIFIED = 2
+  };
+
   OperationMultiEvalStreamingBSpline(base::Grid& grid, base::DataMatrix& dataset);
 
   ~OperationMultiEvalStreamingBSpline() override;
@@ -68,6 +116,28 @@ class OperationMultiEvalStreamingBSpline : public base::OperationMultipleEval {
                          const size_t end_index_grid, const size_t start_index_data,
                          const size_t end_index_data);
 
+  void multImplGeneric(sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
+                       sgpp::base::DataVector& result, const size_t start_index_grid,
+                       const size_t end_index_grid, const size_t start_index_data,
+                       const size_t end_index_data);
+
+  void multTransposeImplGeneric(sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
+                                sgpp::base::DataVector& result, const size_t start_index_grid,
+                                const size_t end_index_grid, const size_t start_index_data,
+                                const size_t end_index_data);
+
+  /**
+   * @return true if the hand-vectorized kernels for cubic B-splines can be used
+   */
+  bool useCubicKernels() const;
+
+  /**
+   * Evaluates the 1d basis function of grid point gridIndex in dimension d for a block of
+   * data points and multiplies the values onto support.
+   */
+  void evalBlock(size_t gridIndex, size_t d, const double* data, size_t blockSize,
+                 double* support) const;
+
   void recalculateLevelAndIndex();
 };
 }  // namespace datadriven
@@ -6,6 +6,8 @@
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingBSpline/OperationMultiEvalStreamingBSpline.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+
 #if defined(__SSE3__) && !defined(__AVX__)
 #include <pmmintrin.h>
 #endif
@@ -55,8 +57,8 @@ void OperationMultiEvalStreamingBSpline::multImpl(
         __m256d evals_0;
         __m256d evals_1;
 
-        __m256d ptrData_0 = _mm256_load_pd(&ptrData[(d * result_size) + c]);
-        __m256d ptrData_1 = _mm256_load_pd(&ptrData[(d * result_size) + c + 4]);
+        __m256d ptrData_0 = _mm256_loadu_pd(&ptrData[(d * result_size) + c]);
+        __m256d ptrData_1 = _mm256_loadu_pd(&ptrData[(d * result_size) + c + 4]);
 
         __m256d x_0 = _mm256_fmsub_pd(ptrData_0, levels, indexs);
         __m256d x_1 = _mm256_fmsub_pd(ptrData_1, levels, indexs);
@@ -173,14 +175,14 @@ void OperationMultiEvalStreamingBSpline::multImpl(
         support_0 = _mm256_mul_pd(support_0, evals_0);
         support_1 = _mm256_mul_pd(support_1, evals_1);
       }
-      __m256d result_0 = _mm256_load_pd(&ptrResult[c]);
-      __m256d result_1 = _mm256_load_pd(&ptrResult[c + 4]);
+      __m256d result_0 = _mm256_loadu_pd(&ptrResult[c]);
+      __m256d result_1 = _mm256_loadu_pd(&ptrResult[c + 4]);
 
       result_0 = _mm256_add_pd(result_0, support_0);
       result_1 = _mm256_add_pd(result_1, support_1);
 
-      _mm256_store_pd(&ptrResult[c], result_0);
-      _mm256_store_pd(&ptrResult[c + 4], result_1);
+      _mm256_storeu_pd(&ptrResult[c], result_0);
+      _mm256_storeu_pd(&ptrResult[c + 4], result_1);
     }
   }
 
@@ -201,7 +203,7 @@ void OperationMultiEvalStreamingBSpline::multImpl(
 
         __m256d eval;
         __m256d result;
-        __m256d ptrDatas = _mm256_load_pd(&ptrData[(d * result_size) + c]);
+        __m256d ptrDatas = _mm256_loadu_pd(&ptrData[(d * result_size) + c]);
 
         __m256d x = _mm256_sub_pd(_mm256_mul_pd(ptrDatas, levels), indexs);
         x = _mm256_add_pd(x, two);
@@ -263,9 +265,9 @@ void OperationMultiEvalStreamingBSpline::multImpl(
 
         support = _mm256_mul_pd(support, eval);  // 32
       }
-      __m256d results = _mm256_load_pd(&ptrResult[c]);
+      __m256d results = _mm256_loadu_pd(&ptrResult[c]);
       results = _mm256_add_pd(results, support);
-      _mm256_store_pd(&ptrResult[c], results);
+      _mm256_storeu_pd(&ptrResult[c], results);
     }
   }
 
@@ -301,6 +303,54 @@ void OperationMultiEvalStreamingBSpline::multImpl(
 
 #endif
 }
+
+void OperationMultiEvalStreamingBSpline::multImplGeneric(
+    sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+    const size_t start_index_grid, const size_t end_index_grid, const size_t start_index_data,
+    const size_t end_index_data) {
+  const double* ptrAlpha = alpha.getPointer();
+  const double* ptrData = dataset->getPointer();
+  double* ptrResult = result.getPointer();
+  const size_t dataSize = dataset->getNcols();
+  const size_t dims = dataset->getNrows();
+
+  double support[STREAMING_BSPLINE_BLOCK_SIZE];
+
+  for (size_t c = start_index_data; c < end_index_data; c += STREAMING_BSPLINE_BLOCK_SIZE) {
+    const size_t blockSize =
+        std::min<size_t>(STREAMING_BSPLINE_BLOCK_SIZE, end_index_data - c);
+
+    for (size_t m = start_index_grid; m < end_index_grid; m++) {
+      if (ptrAlpha[m] == 0.0) {
+        continue;
+      }
+
+      for (size_t j = 0; j < blockSize; j++) {
+        support[j] = ptrAlpha[m];
+      }
+
+      bool anyNonZero = true;
+
+      for (size_t d = 0; (d < dims) && anyNonZero; d++) {
+        this->evalBlock(m, d, &ptrData[d * dataSize + c], blockSize, support);
+
+        // the B-splines have local support, skip the remaining dimensions if the block is
+        // outside of the support
+        anyNonZero = false;
+
+        for (size_t j = 0; j < blockSize; j++) {
+          anyNonZero |= (support[j] != 0.0);
+        }
+      }
+
+      if (anyNonZero) {
+        for (size_t j = 0; j < blockSize; j++) {
+          ptrResult[c + j] += support[j];
+        }
+      }
+    }
+  }
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
-
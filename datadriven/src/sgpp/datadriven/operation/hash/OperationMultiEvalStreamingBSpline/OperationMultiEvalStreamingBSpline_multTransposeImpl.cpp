@@ -7,6 +7,8 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+
 #if defined(__SSE3__) && !defined(__AVX__)
 #include <pmmintrin.h>
 #endif
@@ -39,8 +41,8 @@ void OperationMultiEvalStreamingBSpline::multTransposeImpl(
   for (size_t k = start_index_grid; k < end_index_grid; k++) {
     for (size_t i = start_index_data; i < end_index_data; i = i + 8) {
       // double support = ptrSource[i];
-      __m256d support_0 = _mm256_load_pd(&ptrSource[i]);
-      __m256d support_1 = _mm256_load_pd(&ptrSource[i + 4]);
+      __m256d support_0 = _mm256_loadu_pd(&ptrSource[i]);
+      __m256d support_1 = _mm256_loadu_pd(&ptrSource[i + 4]);
 
       __m256d zero = _mm256_set1_pd(0.0);
       __m256d one = _mm256_set1_pd(1.0);
@@ -55,8 +57,8 @@ void OperationMultiEvalStreamingBSpline::multTransposeImpl(
         __m256d evals_0;
         __m256d evals_1;
 
-        __m256d ptrData_0 = _mm256_load_pd(&ptrData[(d * sourceSize) + i]);
-        __m256d ptrData_1 = _mm256_load_pd(&ptrData[(d * sourceSize) + i + 4]);
+        __m256d ptrData_0 = _mm256_loadu_pd(&ptrData[(d * sourceSize) + i]);
+        __m256d ptrData_1 = _mm256_loadu_pd(&ptrData[(d * sourceSize) + i + 4]);
 
         __m256d x_0 = _mm256_fmsub_pd(ptrData_0, levels, indexs);
         __m256d x_1 = _mm256_fmsub_pd(ptrData_1, levels, indexs);
@@ -184,7 +186,7 @@ void OperationMultiEvalStreamingBSpline::multTransposeImpl(
 
       double support_temp[4];
 
-      _mm256_store_pd(&support_temp[0], support_0);
+      _mm256_storeu_pd(&support_temp[0], support_0);
 
       ptrResult[k] += support_temp[0];
     }
@@ -195,7 +197,7 @@ void OperationMultiEvalStreamingBSpline::multTransposeImpl(
   for (size_t k = start_index_grid; k < end_index_grid; k++) {
     for (size_t i = start_index_data; i < end_index_data; i = i + 4) {
       // double support = ptrSource[i];
-      __m256d support = _mm256_load_pd(&ptrSource[i]);
+      __m256d support = _mm256_loadu_pd(&ptrSource[i]);
 
       __m256d zero = _mm256_set1_pd(0.0);
       __m256d one = _mm256_set1_pd(1.0);
@@ -207,7 +209,7 @@ void OperationMultiEvalStreamingBSpline::multTransposeImpl(
         __m256d levels = _mm256_broadcast_sd(&ptrLevel[(k * dims) + d]);
         __m256d indexs = _mm256_broadcast_sd(&ptrIndex[(k * dims) + d]);
 
-        __m256d ptrDatas = _mm256_load_pd(&ptrData[(d * sourceSize) + i]);
+        __m256d ptrDatas = _mm256_loadu_pd(&ptrData[(d * sourceSize) + i]);
 
         __m256d x = _mm256_sub_pd(_mm256_mul_pd(ptrDatas, levels), indexs);
         x = _mm256_add_pd(x, two);
@@ -274,7 +276,7 @@ void OperationMultiEvalStreamingBSpline::multTransposeImpl(
 
       double support_temp[4];
 
-      _mm256_store_pd(&support_temp[0], support);
+      _mm256_storeu_pd(&support_temp[0], support);
 
       ptrResult[k] += support_temp[0];
     }
@@ -312,6 +314,52 @@ void OperationMultiEvalStreamingBSpline::multTransposeImpl(
 
 #endif
 }
+
+void OperationMultiEvalStreamingBSpline::multTransposeImplGeneric(
+    sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
+    sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
+    const size_t start_index_data, const size_t end_index_data) {
+  const double* ptrSource = source.getPointer();
+  const double* ptrData = dataset->getPointer();
+  double* ptrResult = result.getPointer();
+  const size_t dataSize = dataset->getNcols();
+  const size_t dims = dataset->getNrows();
+
+  double support[STREAMING_BSPLINE_BLOCK_SIZE];
+
+  for (size_t m = start_index_grid; m < end_index_grid; m++) {
+    double sum = 0.0;
+
+    for (size_t c = start_index_data; c < end_index_data; c += STREAMING_BSPLINE_BLOCK_SIZE) {
+      const size_t blockSize =
+          std::min<size_t>(STREAMING_BSPLINE_BLOCK_SIZE, end_index_data - c);
+
+      for (size_t j = 0; j < blockSize; j++) {
+        support[j] = ptrSource[c + j];
+      }
+
+      bool anyNonZero = true;
+
+      for (size_t d = 0; (d < dims) && anyNonZero; d++) {
+        this->evalBlock(m, d, &ptrData[d * dataSize + c], blockSize, support);
+
+        anyNonZero = false;
+
+        for (size_t j = 0; j < blockSize; j++) {
+          anyNonZero |= (support[j] != 0.0);
+        }
+      }
+
+      if (anyNonZero) {
+        for (size_t j = 0; j < blockSize; j++) {
+          sum += support[j];
+        }
+      }
+    }
+
+    ptrResult[m] += sum;
+  }
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
-
@@ -0,0 +1,271 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingPoly/OperationMultiEvalStreamingPoly.hpp>
+
+#include <sgpp/base/grid/type/ModPolyGrid.hpp>
+#include <sgpp/base/grid/type/PolyGrid.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace sgpp {
+namespace datadriven {
+
+OperationMultiEvalStreamingPoly::OperationMultiEvalStreamingPoly(base::Grid& grid,
+                                                                 base::DataMatrix& dataset)
+    : OperationMultipleEval(grid, dataset),
+      preparedDataset(dataset),
+      myTimer_(sgpp::base::SGppStopwatch()),
+      duration(-1.0) {
+  if (grid.getType() == base::GridType::Poly) {
+    this->degree = dynamic_cast<base::PolyGrid&>(grid).getDegree();
+    this->isModified = false;
+  } else if (grid.getType() == base::GridType::ModPoly) {
+    this->degree = dynamic_cast<base::ModPolyGrid&>(grid).getDegree();
+    this->isModified = true;
+  } else {
+    throw base::operation_exception(
+        "OperationMultiEvalStreamingPoly: only Poly and ModPoly grids are supported");
+  }
+
+  this->storage = &grid.getStorage();
+
+  this->padDataset(this->preparedDataset);
+  this->preparedDataset.transpose();
+
+  // create the kernel specific data structures for the current grid
+  this->prepare();
+}
+
+OperationMultiEvalStreamingPoly::~OperationMultiEvalStreamingPoly() {}
+
+void OperationMultiEvalStreamingPoly::getPartitionSegment(size_t start, size_t end,
+                                                          size_t segmentCount,
+                                                          size_t segmentNumber,
+                                                          size_t* segmentStart, size_t* segmentEnd,
+                                                          size_t blockSize) {
+  size_t totalSize = end - start;
+
+  // check for valid input
+  if (blockSize == 0) {
+    throw sgpp::base::operation_exception("blockSize must not be zero!");
+  }
+
+  if (totalSize % blockSize != 0) {
+    throw sgpp::base::operation_exception(
+        "totalSize must be divisible by blockSize without remainder, but it is not!");
+  }
+
+  // do all further calculations with complete blocks
+  size_t blockCount = totalSize / blockSize;
+
+  size_t blockSegmentSize = blockCount / segmentCount;
+  size_t remainder = blockCount - blockSegmentSize * segmentCount;
+  size_t blockSegmentOffset = 0;
+
+  if (segmentNumber < remainder) {
+    blockSegmentSize++;
+    blockSegmentOffset = blockSegmentSize * segmentNumber;
+  } else {
+    blockSegmentOffset =
+        remainder * (blockSegmentSize + 1) + (segmentNumber - remainder) * blockSegmentSize;
+  }
+
+  *segmentStart = start + blockSegmentOffset * blockSize;
+  *segmentEnd = *segmentStart + blockSegmentSize * blockSize;
+}
+
+void OperationMultiEvalStreamingPoly::getOpenMPPartitionSegment(size_t start, size_t end,
+                                                                size_t* segmentStart,
+                                                                size_t* segmentEnd,
+                                                                size_t blocksize) {
+  size_t threadCount = omp_get_num_threads();
+  size_t myThreadNum = omp_get_thread_num();
+  getPartitionSegment(start, end, threadCount, myThreadNum, segmentStart, segmentEnd, blocksize);
+}
+
+size_t OperationMultiEvalStreamingPoly::getChunkGridPoints() { return 12; }
+
+size_t OperationMultiEvalStreamingPoly::getChunkDataPoints() {
+  return 8;  // must be divisible by 8
+}
+
+void OperationMultiEvalStreamingPoly::mult(sgpp::base::DataVector& alpha,
+                                           sgpp::base::DataVector& result) {
+  this->myTimer_.start();
+
+  size_t originalSize = result.getSize();
+
+  result.resize(this->preparedDataset.getNcols());
+
+  result.setAll(0.0);
+
+#pragma omp parallel
+  {
+    size_t start;
+    size_t end;
+
+    getOpenMPPartitionSegment(0, this->preparedDataset.getNcols(), &start, &end,
+                              getChunkDataPoints());
+
+    this->multImpl(&this->preparedDataset, alpha, result, 0, alpha.getSize(), start, end);
+  }
+  result.resize(originalSize);
+  this->duration = this->myTimer_.stop();
+}
+
+void OperationMultiEvalStreamingPoly::multTranspose(sgpp::base::DataVector& source,
+                                                    sgpp::base::DataVector& result) {
+  this->myTimer_.start();
+
+  size_t originalSize = source.getSize();
+
+  source.resize(this->preparedDataset.getNcols());
+
+  // set padding area to zero
+  for (size_t i = originalSize; i < this->preparedDataset.getNcols(); i++) {
+    source[i] = 0.0;
+  }
+
+  result.setAll(0.0);
+
+#pragma omp parallel
+  {
+    size_t start;
+    size_t end;
+
+    getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
+
+    this->multTransposeImpl(&this->preparedDataset, source, result, start, end, 0,
+                            this->preparedDataset.getNcols());
+  }
+  source.resize(originalSize);
+  this->duration = this->myTimer_.stop();
+}
+
+void OperationMultiEvalStreamingPoly::setPolyFactors(size_t k, size_t level, size_t index) {
+  // same traversal as in base::PolyBasis::evalBasis, but the roots are stored as linear factors
+  // (x - root) / (base - root) = a * x + b instead of evaluating them directly
+  const int idxtable[4] = {1, 2, -2, -1};
+  const size_t deg = std::min<size_t>(this->degree, level + 1);
+  const double base = static_cast<double>(index);
+  int64_t root = static_cast<int64_t>(index) + 1;
+  size_t id = index;
+  size_t f = k * this->degree;
+
+  double denominator = base - static_cast<double>(root);
+  this->factorA[f] = 1.0 / denominator;
+  this->factorB[f] = -static_cast<double>(root) / denominator;
+  f++;
+  root -= 2;
+
+  for (size_t j = 2; j < static_cast<size_t>(1) << deg; j *= 2) {
+    denominator = base - static_cast<double>(root);
+    this->factorA[f] = 1.0 / denominator;
+    this->factorB[f] = -static_cast<double>(root) / denominator;
+    f++;
+    root += idxtable[id & 3] * static_cast<int64_t>(j);
+    id >>= 1;
+  }
+}
+
+void OperationMultiEvalStreamingPoly::recalculateFactors() {
+  const size_t gridSize = this->storage->getSize();
+  const size_t dims = this->storage->getDimension();
+
+  // unused factors are a * x + b = 1
+  this->hInv.assign(gridSize * dims, 0.0);
+  this->lower.assign(gridSize * dims, 0.0);
+  this->upper.assign(gridSize * dims, 0.0);
+  this->factorA.assign(gridSize * dims * this->degree, 0.0);
+  this->factorB.assign(gridSize * dims * this->degree, 1.0);
+
+  for (size_t m = 0; m < gridSize; m++) {
+    base::GridPoint& point = this->storage->getPoint(m);
+
+    for (size_t d = 0; d < dims; d++) {
+      const size_t k = m * dims + d;
+      const size_t level = point.getLevel(d);
+      const size_t index = point.getIndex(d);
+      const size_t levelHInv = static_cast<size_t>(1) << level;
+
+      this->hInv[k] = static_cast<double>(levelHInv);
+      this->lower[k] = static_cast<double>(index) - 1.0;
+      this->upper[k] = static_cast<double>(index) + 1.0;
+
+      if (!this->isModified) {
+        this->setPolyFactors(k, level, index);
+      } else if (level == 1) {
+        // constant one on the whole domain
+        this->lower[k] = std::numeric_limits<double>::lowest();
+        this->upper[k] = std::numeric_limits<double>::max();
+      } else if (index == 1) {
+        // left modified basis function: 2 - x
+        this->factorA[k * this->degree] = -1.0;
+        this->factorB[k * this->degree] = 2.0;
+      } else if (index == levelHInv - 1) {
+        // right modified basis function: x - index + 1
+        this->factorA[k * this->degree] = 1.0;
+        this->factorB[k * this->degree] = 1.0 - static_cast<double>(index);
+      } else {
+        this->setPolyFactors(k, level, index);
+      }
+    }
+  }
+}
+
+void OperationMultiEvalStreamingPoly::evalBlock(size_t gridIndex, size_t d, const double* data,
+                                                size_t blockSize, double* support) const {
+  const size_t k = gridIndex * this->storage->getDimension() + d;
+  const double h = this->hInv[k];
+  const double lo = this->lower[k];
+  const double hi = this->upper[k];
+  const double* a = &this->factorA[k * this->degree];
+  const double* b = &this->factorB[k * this->degree];
+  const size_t deg = this->degree;
+
+#pragma omp simd
+  for (size_t c = 0; c < blockSize; c++) {
+    const double x = data[c] * h;
+    double value = 1.0;
+
+    for (size_t j = 0; j < deg; j++) {
+      value *= a[j] * x + b[j];
+    }
+
+    support[c] *= ((x >= lo) && (x <= hi)) ? value : 0.0;
+  }
+}
+
+size_t OperationMultiEvalStreamingPoly::padDataset(sgpp::base::DataMatrix& dataset) {
+  size_t vecWidth = this->getChunkDataPoints();
+
+  // Assure that data has a even number of instances -> padding might be needed
+  size_t remainder = dataset.getNrows() % vecWidth;
+  size_t loopCount = vecWidth - remainder;
+
+  if (loopCount != vecWidth) {
+    sgpp::base::DataVector lastRow(dataset.getNcols());
+    size_t oldSize = dataset.getNrows();
+    dataset.getRow(dataset.getNrows() - 1, lastRow);
+    dataset.resize(dataset.getNrows() + loopCount);
+
+    for (size_t i = 0; i < loopCount; i++) {
+      dataset.setRow(oldSize + i, lastRow);
+    }
+  }
+
+  return dataset.getNrows();
+}
+
+double OperationMultiEvalStreamingPoly::getDuration() { return this->duration; }
+
+void OperationMultiEvalStreamingPoly::prepare() { this->recalculateFactors(); }
+}  // namespace datadriven
+}  // namespace sgpp
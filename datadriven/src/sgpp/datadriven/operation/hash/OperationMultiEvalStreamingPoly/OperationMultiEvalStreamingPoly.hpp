@@ -0,0 +1,113 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <omp.h>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+#ifndef STREAMING_POLY_BLOCK_SIZE
+// number of data points processed at once by the kernels
+#define STREAMING_POLY_BLOCK_SIZE 64
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Streaming multi-evaluation for polynomial and modified polynomial grids.
+ *
+ * In prepare() the Lagrange polynomial of every grid point and dimension is
+ * decomposed into (at most degree) linear factors a * x + b in the scaled
+ * coordinate x = 2^l * p, together with its support interval. Unused factors
+ * are padded with a = 0, b = 1, which makes the kernels branch-free with a
+ * fixed trip count. The kernels then stream over blocks of the transposed,
+ * padded dataset and are written to be auto-vectorized over the data points.
+ */
+class OperationMultiEvalStreamingPoly : public base::OperationMultipleEval {
+ protected:
+  sgpp::base::DataMatrix preparedDataset;
+  /// Timer object to handle time measurements
+  sgpp::base::SGppStopwatch myTimer_;
+
+  base::GridStorage* storage;
+
+  double duration;
+
+  /// maximum degree of the polynomials
+  size_t degree;
+  /// true for modified polynomial grids
+  bool isModified;
+
+  /// 2^l per grid point and dimension
+  std::vector<double> hInv;
+  /// lower bound of the support in the scaled coordinate
+  std::vector<double> lower;
+  /// upper bound of the support in the scaled coordinate
+  std::vector<double> upper;
+  /// linear factors per grid point and dimension, degree entries each
+  std::vector<double> factorA;
+  std::vector<double> factorB;
+
+ public:
+  OperationMultiEvalStreamingPoly(base::Grid& grid, base::DataMatrix& dataset);
+
+  ~OperationMultiEvalStreamingPoly() override;
+
+  size_t getChunkGridPoints();
+
+  size_t getChunkDataPoints();
+
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
+  void multTranspose(sgpp::base::DataVector& source, sgpp::base::DataVector& result) override;
+
+  void prepare() override;
+
+  double getDuration() override;
+
+ private:
+  void getPartitionSegment(size_t start, size_t end, size_t segmentCount, size_t segmentNumber,
+                           size_t* segmentStart, size_t* segmentEnd, size_t blockSize);
+
+  size_t padDataset(sgpp::base::DataMatrix& dataset);
+
+  void getOpenMPPartitionSegment(size_t start, size_t end, size_t* segmentStart, size_t* segmentEnd,
+                                 size_t blocksize);
+
+  void multImpl(sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
+                sgpp::base::DataVector& result, const size_t start_index_grid,
+                const size_t end_index_grid, const size_t start_index_data,
+                const size_t end_index_data);
+
+  void multTransposeImpl(sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
+                         sgpp::base::DataVector& result, const size_t start_index_grid,
+                         const size_t end_index_grid, const size_t start_index_data,
+                         const size_t end_index_data);
+
+  /**
+   * Evaluates the 1d basis function of grid point gridIndex in dimension d for a block of
+   * data points and multiplies the values onto support.
+   */
+  void evalBlock(size_t gridIndex, size_t d, const double* data, size_t blockSize,
+                 double* support) const;
+
+  /**
+   * Stores the linear factors of the (unmodified) polynomial basis function (level, index)
+   * at position k of the factor arrays.
+   */
+  void setPolyFactors(size_t k, size_t level, size_t index);
+
+  void recalculateFactors();
+};
+}  // namespace datadriven
+}  // namespace sgpp
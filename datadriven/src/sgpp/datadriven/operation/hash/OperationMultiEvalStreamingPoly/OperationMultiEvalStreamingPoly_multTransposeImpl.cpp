@@ -0,0 +1,62 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingPoly/OperationMultiEvalStreamingPoly.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+
+namespace sgpp {
+namespace datadriven {
+
+void OperationMultiEvalStreamingPoly::multTransposeImpl(
+    sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
+    sgpp::base::DataVector& result, const size_t start_index_grid, const size_t end_index_grid,
+    const size_t start_index_data, const size_t end_index_data) {
+  const double* ptrSource = source.getPointer();
+  const double* ptrData = dataset->getPointer();
+  double* ptrResult = result.getPointer();
+  const size_t dataSize = dataset->getNcols();
+  const size_t dims = dataset->getNrows();
+
+  double support[STREAMING_POLY_BLOCK_SIZE];
+
+  for (size_t m = start_index_grid; m < end_index_grid; m++) {
+    double sum = 0.0;
+
+    for (size_t c = start_index_data; c < end_index_data; c += STREAMING_POLY_BLOCK_SIZE) {
+      const size_t blockSize =
+          std::min<size_t>(STREAMING_POLY_BLOCK_SIZE, end_index_data - c);
+
+      for (size_t j = 0; j < blockSize; j++) {
+        support[j] = ptrSource[c + j];
+      }
+
+      bool anyNonZero = true;
+
+      for (size_t d = 0; (d < dims) && anyNonZero; d++) {
+        this->evalBlock(m, d, &ptrData[d * dataSize + c], blockSize, support);
+
+        anyNonZero = false;
+
+        for (size_t j = 0; j < blockSize; j++) {
+          anyNonZero |= (support[j] != 0.0);
+        }
+      }
+
+      if (anyNonZero) {
+        for (size_t j = 0; j < blockSize; j++) {
+          sum += support[j];
+        }
+      }
+    }
+
+    ptrResult[m] += sum;
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
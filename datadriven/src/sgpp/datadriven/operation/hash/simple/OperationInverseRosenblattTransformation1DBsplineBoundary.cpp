@@ -208,12 +208,11 @@ void OperationInverseRosenblattTransformation1DBsplineBoundary::init(
   }
 
   // compute CDF
-  double tmp_sum;
+  double tmp_sum = 0.0;
   unsigned int i = 0;
 
   for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    tmp_sum = 0.0;
-    for (unsigned int j = 0; j < i; ++j) tmp_sum += patch_areas[j];
+    if (i > 0) tmp_sum += patch_areas[i - 1];
     ++i;
     it1->second = tmp_sum / sum;
   }
@@ -264,22 +263,32 @@ double OperationInverseRosenblattTransformation1DBsplineBoundary::sample(
   return it1->second + (gaussQuadSum * scaling) / sum;
 }
 
-double
-OperationInverseRosenblattTransformation1DBsplineBoundary::doTransformation1D(
-    base::DataVector* alpha1d, double coord1d) {
+void OperationInverseRosenblattTransformation1DBsplineBoundary::doTransformation1D(
+    base::DataVector* alpha1d, const base::DataVector& coords1d, base::DataVector& results1d) {
+  // the CDF does not depend on the coordinates
   init(alpha1d);
-  // std::cout << "PFs size after exit: " << patch_functions.size() <<
-  // std::endl;
-  std::function<double(const base::DataVector&)> optFunc =
-      [this, coord1d, alpha1d](const base::DataVector& x) -> double {
-    double F_x = sample(alpha1d, x[0]);
-    return (F_x - coord1d) * (F_x - coord1d);
-  };
   base::Printer::getInstance().disableStatusPrinting();
-  base::WrapperScalarFunction f(1, optFunc);
-  optimization::optimizer::NelderMead nelderMead(f);
-  nelderMead.optimize();
-  return nelderMead.getOptimalPoint()[0];
+  results1d.resize(coords1d.getSize());
+
+  for (size_t k = 0; k < coords1d.getSize(); k++) {
+    const double coord1d = coords1d[k];
+    std::function<double(const base::DataVector&)> optFunc =
+        [this, coord1d, alpha1d](const base::DataVector& x) -> double {
+      double F_x = sample(alpha1d, x[0]);
+      return (F_x - coord1d) * (F_x - coord1d);
+    };
+    base::WrapperScalarFunction f(1, optFunc);
+    optimization::optimizer::NelderMead nelderMead(f);
+    nelderMead.optimize();
+    results1d[k] = nelderMead.getOptimalPoint()[0];
+  }
+}
+
+double OperationInverseRosenblattTransformation1DBsplineBoundary::doTransformation1D(
+    base::DataVector* alpha1d, double coord1d) {
+  base::DataVector results1d(1);
+  doTransformation1D(alpha1d, base::DataVector(1, coord1d), results1d);
+  return results1d[0];
 }
 }  // namespace datadriven
 }  // namespace sgpp
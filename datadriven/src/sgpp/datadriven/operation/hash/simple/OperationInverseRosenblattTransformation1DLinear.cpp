@@ -28,8 +28,8 @@ OperationInverseRosenblattTransformation1DLinear::OperationInverseRosenblattTran
 OperationInverseRosenblattTransformation1DLinear::
     ~OperationInverseRosenblattTransformation1DLinear() {}
 
-double OperationInverseRosenblattTransformation1DLinear::doTransformation1D(
-    base::DataVector* alpha1d, double coord1d) {
+void OperationInverseRosenblattTransformation1DLinear::doTransformation1D(
+    base::DataVector* alpha1d, const base::DataVector& coords1d, base::DataVector& results1d) {
   /***************** STEP 1. Compute CDF  ********************/
   // compute PDF, sort by coordinates
   std::multimap<double, double> coord_pdf, coord_cdf;
@@ -78,16 +78,18 @@ double OperationInverseRosenblattTransformation1DLinear::doTransformation1D(
   }
 
   // compute CDF
-  double tmp_sum;
+  double tmp_sum = 0.0;
   unsigned int i = 0;
+  std::vector<double> cdf_coords, cdf_values;
+  cdf_coords.reserve(coord_cdf.size());
+  cdf_values.reserve(coord_cdf.size());
 
   for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    tmp_sum = 0.0;
-
-    for (unsigned int j = 0; j <= i; ++j) tmp_sum += tmp[j];
-
+    tmp_sum += tmp[i];
     ++i;
     (*it1).second = tmp_sum / sum;
+    cdf_coords.push_back(it1->first);
+    cdf_values.push_back(it1->second);
   }
 
   tmp.clear();
@@ -95,23 +97,31 @@ double OperationInverseRosenblattTransformation1DLinear::doTransformation1D(
   /***************** STEP 1. Done  ********************/
 
   /***************** STEP 2. Sampling  ********************/
-  double y, x1, x2, y1, y2;
-
-  // find cdf interval
-  for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    if ((*it1).second >= coord1d) break;
+  double x1, x2, y1, y2;
+  results1d.resize(coords1d.getSize());
+
+  for (size_t k = 0; k < coords1d.getSize(); k++) {
+    // find cdf interval (clamped to the first and the last interval)
+    size_t j =
+        std::lower_bound(cdf_values.begin(), cdf_values.end(), coords1d[k]) - cdf_values.begin();
+    j = std::min(std::max(j, static_cast<size_t>(1)), cdf_values.size() - 1);
+
+    x2 = cdf_coords[j];
+    y2 = cdf_values[j];
+    x1 = cdf_coords[j - 1];
+    y1 = cdf_values[j - 1];
+    // find x (linear interpolation): (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
+    results1d[k] = (x2 - x1) / (y2 - y1) * (coords1d[k] - y1) + x1;
   }
 
-  x2 = (*it1).first;
-  y2 = (*it1).second;
-  --it1;
-  x1 = (*it1).first;
-  y1 = (*it1).second;
-  // find x (linear interpolation): (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
-  y = (x2 - x1) / (y2 - y1) * (coord1d - y1) + x1;
-
   /***************** STEP 2. Done  ********************/
-  return y;
+}
+
+double OperationInverseRosenblattTransformation1DLinear::doTransformation1D(
+    base::DataVector* alpha1d, double coord1d) {
+  base::DataVector results1d(1);
+  doTransformation1D(alpha1d, base::DataVector(1, coord1d), results1d);
+  return results1d[0];
 }
 
 }  // namespace datadriven
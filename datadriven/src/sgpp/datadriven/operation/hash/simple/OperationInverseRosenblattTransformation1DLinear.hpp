@@ -29,6 +29,15 @@ class OperationInverseRosenblattTransformation1DLinear : public OperationTransfo
    * @return
    */
   double doTransformation1D(base::DataVector* alpha1d, double coord1d);
+
+  /**
+   * Inverse Rosenblatt Transformation 1D of multiple coordinates, the CDF is computed only once
+   * @param alpha1d
+   * @param coords1d
+   * @param[out] results1d
+   */
+  void doTransformation1D(base::DataVector* alpha1d, const base::DataVector& coords1d,
+                          base::DataVector& results1d);
 };
 
 }  // namespace datadriven
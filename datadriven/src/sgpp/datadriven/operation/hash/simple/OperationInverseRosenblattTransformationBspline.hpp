@@ -46,12 +46,6 @@ class OperationInverseRosenblattTransformationBspline
 
  protected:
   base::Grid* grid;
-  void doTransformation_start_dimX(base::Grid* g_in, base::DataVector* a_in, size_t dim_start,
-                                   base::DataVector* cdfs1d, base::DataVector* coords1d);
-  void doTransformation_in_next_dim(base::Grid* g_in, base::DataVector* a_in, size_t op_dim,
-                                    base::DataVector* cdfs1d, base::DataVector* coords1d,
-                                    size_t& curr_dim);
-  double doTransformation1D(base::Grid* grid1d, base::DataVector* alpha1d, double coord1d);
 };
 }  // namespace datadriven
 }  // namespace sgpp
@@ -8,6 +8,7 @@
 
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformation.hpp>
+#include <sgpp/datadriven/operation/hash/simple/RosenblattTransformationBatch.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -46,12 +47,12 @@ class OperationInverseRosenblattTransformationLinear
 
  protected:
   base::Grid* grid;
-  void doTransformation_start_dimX(base::Grid* g_in, base::DataVector* a_in, size_t dim_start,
-                                   base::DataVector* cdfs1d, base::DataVector* coords1d);
-  void doTransformation_in_next_dim(base::Grid* g_in, base::DataVector* a_in, size_t op_dim,
-                                    base::DataVector* cdfs1d, base::DataVector* coords1d,
-                                    size_t& curr_dim);
-  double doTransformation1D(base::Grid* grid1d, base::DataVector* alpha1d, double coord1d);
+  /**
+   * @return batched transformation using doTransformation1D
+   */
+  RosenblattTransformationBatch createBatch();
+  void doTransformation1D(base::Grid* grid1d, base::DataVector* alpha1d,
+                          const base::DataVector& coords1d, base::DataVector& results1d);
 };
 }  // namespace datadriven
 }  // namespace sgpp
@@ -34,10 +34,9 @@ OperationRosenblattTransformation1DBspline::OperationRosenblattTransformation1DB
 
 OperationRosenblattTransformation1DBspline::~OperationRosenblattTransformation1DBspline() {}
 
-double OperationRosenblattTransformation1DBspline::doTransformation1D(base::DataVector* alpha1d,
-                                                                     double coord1d) {
-  if (coord1d == 0.0)
-    return 0.0;
+void OperationRosenblattTransformation1DBspline::doTransformation1D(
+    base::DataVector* alpha1d, const base::DataVector& coords1d, base::DataVector& results1d) {
+  results1d.resize(coords1d.getSize());
   /***************** STEP 1. Compute CDF  ********************/
 
   // compute PDF, sort by coordinates
@@ -220,15 +219,17 @@ double OperationRosenblattTransformation1DBspline::doTransformation1D(base::Data
       is_negative_patch.push_back(false);
     }
   }
-  if (sum == 0) return 0;
+  if (sum == 0) {
+    results1d.setAll(0.0);
+    return;
+  }
 
   // compute CDF
-  double tmp_sum;
+  double tmp_sum = 0.0;
   unsigned int i = 0;
 
   for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    tmp_sum = 0.0;
-    for (unsigned int j = 0; j < i; ++j) tmp_sum += patch_areas[j];
+    if (i > 0) tmp_sum += patch_areas[i - 1];
     ++i;
     it1->second = tmp_sum / sum;
   }
@@ -236,57 +237,53 @@ double OperationRosenblattTransformation1DBspline::doTransformation1D(base::Data
   /***************** STEP 1. Done  ********************/
 
   /***************** STEP 2. Sampling  ********************/
+  auto sample = [&](double coord1d) -> double {
+    // find cdf interval
+    size_t patch_nr = 0;
+    int negative_patch_counter = 0;
+    for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
+      if (it1->first == coord1d)
+        return it1->second;
+      else if (it1->first >= coord1d)
+        break;
+      if (is_negative_patch[patch_nr]) {
+        ++negative_patch_counter;
+      }
+      ++patch_nr;
+    }
+    --patch_nr;
+    --negative_patch_counter;
 
-  // std::cout << "Areas: " << std::endl;
-  // for (size_t i = 0; i < patch_areas.size(); i++) {
-    // std::cout << patch_areas[i] << std::endl;
-  // }
-  // std::cout << "Size areas: " << patch_areas.size() << std::endl;
-  // std::cout << "Size cdf: " << coord_cdf.size() << std::endl;
-  // std::cout << "coord cdf: " << std::endl;
-  // for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    // std::cout << it1->first << ":" << it1->second << std::endl;
-  // }
-
-  // find cdf interval
-  size_t patch_nr = 0;
-  int negative_patch_counter = 0;
-  for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    if (it1->first == coord1d)
-      return it1->second;
-    else if (it1->first >= coord1d)
-      break;
+    --it1;
+    double gaussQuadSum = 0.;
+    double left = it1->first;
+    double scaling = coord1d - left;
     if (is_negative_patch[patch_nr]) {
-      // std::cout << "patch " << patch_nr << "is negative" << std::endl;
-      ++negative_patch_counter;
+      for (size_t c = 0; c < quadOrder; c++) {
+        coord[0] = left + scaling * gauss_coordinates[c];
+        gaussQuadSum += weights[c] * patch_functions[negative_patch_counter](coord[0]);
+      }
+    } else {
+      for (size_t c = 0; c < quadOrder; c++) {
+        coord[0] = left + scaling * gauss_coordinates[c];
+        gaussQuadSum += weights[c] * opEval->eval(*alpha1d, coord);
+      }
     }
-    ++patch_nr;
-  }
-  --patch_nr;
-  --negative_patch_counter;
+    return it1->second + (gaussQuadSum * scaling) / sum;
+  };
 
-  // std::cout << "patch_nr: " << patch_nr << std::endl;
-  // std::cout << "patch_func size: " << patch_functions.size() << std::endl;
-  --it1;
-  double gaussQuadSum = 0.;
-  double left = it1->first;
-  double scaling = coord1d - left;
-  if (is_negative_patch[patch_nr]) {
-    // std::cout << "is negative" << std::endl;
-    for (size_t c = 0; c < quadOrder; c++) {
-      coord[0] = left + scaling * gauss_coordinates[c];
-      gaussQuadSum += weights[c] * patch_functions[negative_patch_counter](coord[0]);
-    }
-  } else {
-    // std::cout << "is not negative" << std::endl;
-    for (size_t c = 0; c < quadOrder; c++) {
-      coord[0] = left + scaling * gauss_coordinates[c];
-      gaussQuadSum += weights[c] * opEval->eval(*alpha1d, coord);
-    }
+  for (size_t k = 0; k < coords1d.getSize(); k++) {
+    results1d[k] = (coords1d[k] == 0.0) ? 0.0 : sample(coords1d[k]);
   }
-
   /***************** STEP 2. Done  ********************/
-  return it1->second + (gaussQuadSum * scaling) / sum;
-}  // end of compute_1D_cdf()
+}
+
+double OperationRosenblattTransformation1DBspline::doTransformation1D(
+    base::DataVector* alpha1d, double coord1d) {
+  if (coord1d == 0.0) return 0.0;
+  base::DataVector results1d(1);
+  doTransformation1D(alpha1d, base::DataVector(1, coord1d), results1d);
+  return results1d[0];
+}
 }  // namespace datadriven
 }  // namespace sgpp
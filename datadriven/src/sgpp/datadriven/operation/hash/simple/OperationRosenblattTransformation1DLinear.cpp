@@ -30,8 +30,8 @@ OperationRosenblattTransformation1DLinear::OperationRosenblattTransformation1DLi
 
 OperationRosenblattTransformation1DLinear::~OperationRosenblattTransformation1DLinear() {}
 
-double OperationRosenblattTransformation1DLinear::doTransformation1D(base::DataVector* alpha1d,
-                                                                     double coord1d) {
+void OperationRosenblattTransformation1DLinear::doTransformation1D(
+    base::DataVector* alpha1d, const base::DataVector& coords1d, base::DataVector& results1d) {
   /***************** STEP 1. Compute CDF  ********************/
 
   // compute PDF, sort by coordinates
@@ -81,16 +81,18 @@ double OperationRosenblattTransformation1DLinear::doTransformation1D(base::DataV
   }
 
   // compute CDF
-  double tmp_sum;
+  double tmp_sum = 0.0;
   unsigned int i = 0;
+  std::vector<double> cdf_coords, cdf_values;
+  cdf_coords.reserve(coord_cdf.size());
+  cdf_values.reserve(coord_cdf.size());
 
   for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    tmp_sum = 0.0;
-
-    for (unsigned int j = 0; j <= i; ++j) tmp_sum += tmp[j];
-
+    tmp_sum += tmp[i];
     ++i;
     (*it1).second = tmp_sum / sum;
+    cdf_coords.push_back(it1->first);
+    cdf_values.push_back(it1->second);
   }
 
   tmp.clear();
@@ -98,23 +100,31 @@ double OperationRosenblattTransformation1DLinear::doTransformation1D(base::DataV
   /***************** STEP 1. Done  ********************/
 
   /***************** STEP 2. Sampling  ********************/
-  double y, x1, x2, y1, y2;
-
-  // find cdf interval
-  for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    if ((*it1).first >= coord1d) break;
+  double x1, x2, y1, y2;
+  results1d.resize(coords1d.getSize());
+
+  for (size_t k = 0; k < coords1d.getSize(); k++) {
+    // find cdf interval (clamped to the first and the last interval)
+    size_t j =
+        std::lower_bound(cdf_coords.begin(), cdf_coords.end(), coords1d[k]) - cdf_coords.begin();
+    j = std::min(std::max(j, static_cast<size_t>(1)), cdf_coords.size() - 1);
+
+    x2 = cdf_coords[j];
+    y2 = cdf_values[j];
+    x1 = cdf_coords[j - 1];
+    y1 = cdf_values[j - 1];
+    // find x (linear interpolation): (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
+    results1d[k] = (y2 - y1) / (x2 - x1) * (coords1d[k] - x1) + y1;
   }
 
-  x2 = (*it1).first;
-  y2 = (*it1).second;
-  --it1;
-  x1 = (*it1).first;
-  y1 = (*it1).second;
-  // find x (linear interpolation): (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
-  y = (y2 - y1) / (x2 - x1) * (coord1d - x1) + y1;
-
   /***************** STEP 2. Done  ********************/
-  return y;
-}  // end of compute_1D_cdf()
+}
+
+double OperationRosenblattTransformation1DLinear::doTransformation1D(
+    base::DataVector* alpha1d, double coord1d) {
+  base::DataVector results1d(1);
+  doTransformation1D(alpha1d, base::DataVector(1, coord1d), results1d);
+  return results1d[0];
+}
 }  // namespace datadriven
 }  // namespace sgpp
@@ -47,12 +47,6 @@ class OperationRosenblattTransformationBsplineClenshawCurtis
 
  protected:
   base::Grid* grid;
-  void doTransformation_start_dimX(base::Grid* g_in, base::DataVector* a_in, size_t dim_start,
-                                   base::DataVector* coords1d, base::DataVector* cdfs1d);
-  void doTransformation_in_next_dim(base::Grid* g_in, base::DataVector* a_in, size_t dim_x,
-                                    base::DataVector* coords1d, base::DataVector* cdfs1d,
-                                    size_t& curr_dim);
-  virtual double doTransformation1D(base::Grid* grid1d, base::DataVector* alpha1d, double coord1d);
 };
 
 }  // namespace datadriven
@@ -3,29 +3,20 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#include <sgpp/datadriven/operation/hash/simple/OperationRosenblattTransformationLinear.hpp>
-#include <sgpp/datadriven/operation/hash/simple/OperationDensityConditional.hpp>
-#include <sgpp/datadriven/operation/hash/simple/OperationDensityMargTo1D.hpp>
-#include <sgpp/datadriven/operation/hash/simple/OperationDensitySampling1D.hpp>
-#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
-#include <sgpp/base/exception/operation_exception.hpp>
-#include <sgpp/base/operation/hash/OperationEval.hpp>
-#include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationRosenblattTransformationLinear.hpp>
+#include <sgpp/datadriven/operation/hash/simple/RosenblattTransformationBatch.hpp>
 
 #include <sgpp/globaldef.hpp>
 
-#include <map>
-#include <cstdlib>
-#include <fstream>
+#include <algorithm>
 #include <iostream>
-#include <vector>
+#include <map>
+#include <memory>
 #include <utility>
-#include <algorithm>
-
-#ifdef _OPENMP
-#include <omp.h>
-#endif
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -33,163 +24,30 @@ namespace datadriven {
 void OperationRosenblattTransformationLinear::doTransformation(base::DataVector* alpha,
                                                                base::DataMatrix* points,
                                                                base::DataMatrix* pointscdf) {
-  size_t num_dims = this->grid->getDimension();
-
-  // 1. marginalize to all possible start dimensions
-  std::vector<base::Grid*> grids1d(num_dims);
-  std::vector<base::DataVector*> alphas1d(num_dims);
-  std::unique_ptr<OperationDensityMargTo1D> marg1d(
-      op_factory::createOperationDensityMargTo1D(*this->grid));
-  for (size_t idim = 0; idim < num_dims; idim++) {
-    marg1d->margToDimX(alpha, grids1d[idim], alphas1d[idim], idim);
-  }
-
-  // 2. compute the start dimension for each sample
-  size_t num_samples = pointscdf->getNrows();
-  std::vector<size_t> startindices(num_samples);
-  // change the starting dimension when the bucket_size is arrived
-  // this distributes the error in the projection uniformly to all
-  // dimensions and make it therefore stable
-  size_t dim_start = 0;
-  size_t bucket_size = num_samples / num_dims + 1;
-  for (size_t i = 0; i < num_samples; i++) {
-    if (((i + 1) % bucket_size) == 0 && (i + 1) < pointscdf->getNrows()) {
-      ++dim_start;
-    }
-    startindices[i] = dim_start;
-  }
-
-// 3. for every sample do...
-#pragma omp parallel
-  {
-#pragma omp for schedule(dynamic)
-    for (size_t i = 0; i < points->getNrows(); i++) {
-      // transform the point in the current dimension
-      size_t idim = startindices[i];
-      double y = doTransformation1D(grids1d[idim], alphas1d[idim], points->get(i, idim));
-      // and write it to the output
-      pointscdf->set(i, idim, y);
-
-      // prepare the next dimensions -> read samples
-      base::DataVector cdfs1d(num_dims);
-      base::DataVector coords1d(num_dims);
-
-      points->getRow(i, coords1d);
-      pointscdf->getRow(i, cdfs1d);
-      doTransformation_start_dimX(this->grid, alpha, idim, &coords1d, &cdfs1d);
-      pointscdf->setRow(i, cdfs1d);
-    }
-  }
-
-  // cleanup
-  for (size_t idim = 0; idim < num_dims; idim++) {
-    delete grids1d[idim];
-    delete alphas1d[idim];
-  }
+  createBatch().doTransformation(alpha, points, pointscdf);
 }
 
 void OperationRosenblattTransformationLinear::doTransformation(base::DataVector* alpha,
                                                                base::DataMatrix* points,
                                                                base::DataMatrix* pointscdf,
                                                                size_t dim_start) {
-  // 1. marginalize to dim_start
-  base::Grid* g1d = nullptr;
-  base::DataVector* a1d = nullptr;
-  std::unique_ptr<OperationDensityMargTo1D> marg1d(
-      op_factory::createOperationDensityMargTo1D(*this->grid));
-  marg1d->margToDimX(alpha, g1d, a1d, dim_start);
-
-#pragma omp parallel
-  {
-#pragma omp for schedule(dynamic)
-
-    for (size_t i = 0; i < points->getNrows(); i++) {
-      base::DataVector coords1d(points->getNcols());
-      base::DataVector cdfs1d(points->getNcols());
-      // 2. 1D transformation on dim_start
-      double y = doTransformation1D(g1d, a1d, points->get(i, dim_start));
-      pointscdf->set(i, dim_start, y);
-      // 3. for every missing dimension do...
-      points->getRow(i, coords1d);
-      pointscdf->getRow(i, cdfs1d);
-      doTransformation_start_dimX(this->grid, alpha, dim_start, &coords1d, &cdfs1d);
-      pointscdf->setRow(i, cdfs1d);
-    }
-  }
-
-  delete g1d;
-  delete a1d;
+  createBatch().doTransformation(alpha, points, pointscdf, dim_start);
 }
 
-void OperationRosenblattTransformationLinear::doTransformation_start_dimX(
-    base::Grid* g_in, base::DataVector* a_in, size_t dim_start, base::DataVector* coords1d,
-    base::DataVector* cdfs1d) {
-  size_t dims = coords1d->getSize();  // total dimensions
-
-  if ((dims > 1) && (dim_start <= dims - 1)) {
-    size_t curr_dim = dim_start;
-    doTransformation_in_next_dim(g_in, a_in, dim_start, coords1d, cdfs1d, curr_dim);
-  } else if (dims == 1) {
-    throw base::operation_exception("Error: # of dimensions = 1. No operation needed!");
-  } else {
-    throw base::operation_exception("Error: dimension out of range. Operation aborted!");
-  }
-
-  return;
-}
-
-void OperationRosenblattTransformationLinear::doTransformation_in_next_dim(
-    base::Grid* g_in, base::DataVector* a_in, size_t op_dim, base::DataVector* coords1d,
-    base::DataVector* cdfs1d, size_t& curr_dim) {
-  size_t dims = coords1d->getSize();  // total dimensions
-  // unsigned int op_dim = curr_dim + 1;  // (curr_dim < dim_x) ? 0 : (unsigned int) dim_x; //
-  // actual dim to be operated on
-
-  /* Step 1: do conditional in current dim */
-  base::Grid* g_out = nullptr;
-  base::DataVector* a_out = new base::DataVector(1);
-  op_factory::createOperationDensityConditional(*g_in)->doConditional(
-      *a_in, g_out, *a_out, static_cast<unsigned int>(op_dim), coords1d->get(curr_dim));
-
-  // move on to next dim
-  curr_dim = (curr_dim + 1) % dims;
-  op_dim = (op_dim + 1) % g_out->getDimension();
-
-  /* Step 2: draw a sample in next dim */
-  double y = 0;
-
-  if (g_out->getDimension() > 1) {
-    // Marginalize to next dimension
-    base::Grid* g1d = nullptr;
-    base::DataVector* a1d = nullptr;
-    op_factory::createOperationDensityMargTo1D(*g_out)->margToDimX(a_out, g1d, a1d, op_dim);
-
-    // Draw a sample in next dimension
-    y = doTransformation1D(g1d, a1d, coords1d->get(curr_dim));
-    delete g1d;
-    delete a1d;
-
-  } else {
-    // skip Marginalize, directly draw a sample in next dimension
-    y = doTransformation1D(g_out, a_out, coords1d->get(curr_dim));
-  }
-
-  /* Step 3: copy sample to output */
-  cdfs1d->set(curr_dim, y);
-
-  /* Step 4: sample in next dimension */
-  if (g_out->getDimension() > 1)
-    doTransformation_in_next_dim(g_out, a_out, op_dim, coords1d, cdfs1d, curr_dim);
-
-  delete g_out;
-  delete a_out;
-
-  return;
+RosenblattTransformationBatch OperationRosenblattTransformationLinear::createBatch() {
+  return RosenblattTransformationBatch(
+      this->grid,
+      [this](base::Grid* grid1d, base::DataVector* alpha1d, const base::DataVector& coords1d,
+             base::DataVector& results1d) {
+        doTransformation1D(grid1d, alpha1d, coords1d, results1d);
+      },
+      false);
 }
 
-double OperationRosenblattTransformationLinear::doTransformation1D(base::Grid* grid1d,
-                                                                   base::DataVector* alpha1d,
-                                                                   double coord1d) {
+void OperationRosenblattTransformationLinear::doTransformation1D(base::Grid* grid1d,
+                                                                 base::DataVector* alpha1d,
+                                                                 const base::DataVector& coords1d,
+                                                                 base::DataVector& results1d) {
   /***************** STEP 1. Compute CDF  ********************/
   // compute PDF, sort by coordinates
   std::multimap<double, double> coord_pdf, coord_cdf;
@@ -257,16 +115,18 @@ double OperationRosenblattTransformationLinear::doTransformation1D(base::Grid* g
   }
 
   // compute CDF
-  double tmp_sum;
+  double tmp_sum = 0.0;
   unsigned int i = 0;
+  std::vector<double> cdf_coords, cdf_values;
+  cdf_coords.reserve(coord_cdf.size());
+  cdf_values.reserve(coord_cdf.size());
 
   for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    tmp_sum = 0.0;
-
-    for (unsigned int j = 0; j <= i; ++j) tmp_sum += tmp[j];
-
+    tmp_sum += tmp[i];
     ++i;
     (*it1).second = tmp_sum / sum;
+    cdf_coords.push_back(it1->first);
+    cdf_values.push_back(it1->second);
   }
 
   tmp.clear();
@@ -274,23 +134,25 @@ double OperationRosenblattTransformationLinear::doTransformation1D(base::Grid* g
   /***************** STEP 1. Done  ********************/
 
   /***************** STEP 2. Sampling  ********************/
-  double y, x1, x2, y1, y2;
-
-  // find cdf interval
-  for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    if ((*it1).first >= coord1d) break;
+  double x1, x2, y1, y2;
+  results1d.resize(coords1d.getSize());
+
+  for (size_t k = 0; k < coords1d.getSize(); k++) {
+    // find cdf interval (clamped to the first and the last interval)
+    size_t j =
+        std::lower_bound(cdf_coords.begin(), cdf_coords.end(), coords1d[k]) - cdf_coords.begin();
+    j = std::min(std::max(j, static_cast<size_t>(1)), cdf_coords.size() - 1);
+
+    x2 = cdf_coords[j];
+    y2 = cdf_values[j];
+    x1 = cdf_coords[j - 1];
+    y1 = cdf_values[j - 1];
+    // find x (linear interpolation): (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
+    results1d[k] = (y2 - y1) / (x2 - x1) * (coords1d[k] - x1) + y1;
   }
 
-  x2 = (*it1).first;
-  y2 = (*it1).second;
-  --it1;
-  x1 = (*it1).first;
-  y1 = (*it1).second;
-  // find x (linear interpolation): (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
-  y = (y2 - y1) / (x2 - x1) * (coord1d - x1) + y1;
-
   /***************** STEP 2. Done  ********************/
-  return y;
-}  // end of compute_1D_cdf()
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
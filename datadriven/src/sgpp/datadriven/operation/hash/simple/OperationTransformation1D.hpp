@@ -6,6 +6,7 @@
 #ifndef OPERATIONTRANSFORMATION1D_HPP
 #define OPERATIONTRANSFORMATION1D_HPP
 
+#include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -30,6 +31,22 @@ class OperationTransformation1D {
    * @return
    */
   virtual double doTransformation1D(base::DataVector* alpha1d, double coord1d) = 0;
+
+  /**
+   * Transform 1d for multiple coordinates. Implementations should compute the
+   * 1d CDF only once for all coordinates.
+   * @param alpha1d
+   * @param coords1d
+   * @param[out] results1d
+   */
+  virtual void doTransformation1D(base::DataVector* alpha1d, const base::DataVector& coords1d,
+                                  base::DataVector& results1d) {
+    results1d.resize(coords1d.getSize());
+
+    for (size_t i = 0; i < coords1d.getSize(); i++) {
+      results1d[i] = doTransformation1D(alpha1d, coords1d[i]);
+    }
+  }
 };
 
 }  // namespace datadriven
@@ -0,0 +1,227 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationDensityConditional.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationDensityMargTo1D.hpp>
+#include <sgpp/datadriven/operation/hash/simple/RosenblattTransformationBatch.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+RosenblattTransformationBatch::RosenblattTransformationBatch(
+    base::Grid* grid, const Transformation1D& transformation1D, bool conditionOnOutput)
+    : grid(grid),
+      transformation1D(transformation1D),
+      conditionOnOutput(conditionOnOutput),
+      input(nullptr),
+      output(nullptr) {}
+
+RosenblattTransformationBatch::RosenblattTransformationBatch(base::Grid* grid, bool inverse)
+    : RosenblattTransformationBatch(
+          grid,
+          [inverse](base::Grid* grid1d, base::DataVector* alpha1d,
+                    const base::DataVector& coords1d, base::DataVector& results1d) {
+            std::unique_ptr<OperationTransformation1D> op(
+                inverse ? op_factory::createOperationInverseRosenblattTransformation1D(*grid1d)
+                        : op_factory::createOperationRosenblattTransformation1D(*grid1d));
+            op->doTransformation1D(alpha1d, coords1d, results1d);
+          },
+          inverse) {}
+
+void RosenblattTransformationBatch::doTransformation(base::DataVector* alpha,
+                                                     base::DataMatrix* input,
+                                                     base::DataMatrix* output) {
+  size_t num_dims = grid->getDimension();
+  size_t num_samples = output->getNrows();
+  std::vector<std::vector<size_t>> samplesPerStartDim(num_dims);
+
+  // change the starting dimension when the bucket_size is arrived
+  // this distributes the error in the projection uniformly to all
+  // dimensions and make it therefore stable
+  size_t dim_start = 0;
+  size_t bucket_size = num_samples / num_dims + 1;
+
+  for (size_t i = 0; i < num_samples; i++) {
+    if (((i + 1) % bucket_size) == 0 && (i + 1) < num_samples) {
+      ++dim_start;
+    }
+
+    samplesPerStartDim[dim_start].push_back(i);
+  }
+
+  this->input = input;
+  this->output = output;
+  transformSamples(alpha, samplesPerStartDim);
+}
+
+void RosenblattTransformationBatch::doTransformation(base::DataVector* alpha,
+                                                     base::DataMatrix* input,
+                                                     base::DataMatrix* output, size_t dim_start) {
+  std::vector<std::vector<size_t>> samplesPerStartDim(dim_start + 1);
+
+  for (size_t i = 0; i < output->getNrows(); i++) {
+    samplesPerStartDim[dim_start].push_back(i);
+  }
+
+  this->input = input;
+  this->output = output;
+  transformSamples(alpha, samplesPerStartDim);
+}
+
+void RosenblattTransformationBatch::transformSamples(
+    base::DataVector* alpha, const std::vector<std::vector<size_t>>& samplesPerStartDim) {
+  size_t dims = grid->getDimension();
+
+  if (dims == 1) {
+    throw base::operation_exception("Error: # of dimensions = 1. No operation needed!");
+  } else if (samplesPerStartDim.size() > dims) {
+    throw base::operation_exception("Error: dimension out of range. Operation aborted!");
+  }
+
+  std::unique_ptr<OperationDensityMargTo1D> marg1d(
+      op_factory::createOperationDensityMargTo1D(*grid));
+  std::vector<std::vector<size_t>> groups;
+  std::vector<size_t> groupStartDims;
+
+#ifdef _OPENMP
+  size_t num_threads = static_cast<size_t>(omp_get_max_threads());
+#else
+  size_t num_threads = 1;
+#endif
+
+  for (size_t dim_start = 0; dim_start < samplesPerStartDim.size(); dim_start++) {
+    const std::vector<size_t>& samples = samplesPerStartDim[dim_start];
+
+    if (samples.empty()) {
+      continue;
+    }
+
+    // 1. marginalize to dim_start once for all samples starting there
+    base::Grid* g1d = nullptr;
+    base::DataVector* a1d = nullptr;
+    marg1d->margToDimX(alpha, g1d, a1d, dim_start);
+    std::unique_ptr<base::Grid> g1dPtr(g1d);
+    std::unique_ptr<base::DataVector> a1dPtr(a1d);
+
+    // 2. 1D transformation on dim_start, one chunk of samples per thread
+    size_t num_chunks = std::min(num_threads, samples.size());
+
+#pragma omp parallel for schedule(static)
+    for (size_t c = 0; c < num_chunks; c++) {
+      std::vector<size_t> chunk(samples.begin() + c * samples.size() / num_chunks,
+                                samples.begin() + (c + 1) * samples.size() / num_chunks);
+      transform1D(g1d, a1d, dim_start, chunk);
+    }
+
+    splitIntoGroups(dim_start, samples, groups);
+    groupStartDims.resize(groups.size(), dim_start);
+  }
+
+  // 3. for every group of samples do...
+#pragma omp parallel for schedule(dynamic)
+  for (size_t g = 0; g < groups.size(); g++) {
+    transformGroup(grid, alpha, groupStartDims[g], groupStartDims[g], groups[g]);
+  }
+}
+
+void RosenblattTransformationBatch::transformGroup(base::Grid* g_in, base::DataVector* a_in,
+                                                   size_t op_dim, size_t curr_dim,
+                                                   const std::vector<size_t>& samples) {
+  size_t dims = grid->getDimension();  // total dimensions
+
+  /* Step 1: do conditional in current dim */
+  base::Grid* g_out = nullptr;
+  std::unique_ptr<base::DataVector> a_out(new base::DataVector(1));
+  std::unique_ptr<OperationDensityConditional> conditional(
+      op_factory::createOperationDensityConditional(*g_in));
+  conditional->doConditional(*a_in, g_out, *a_out, static_cast<unsigned int>(op_dim),
+                             getConditioningValue(samples[0], curr_dim));
+  std::unique_ptr<base::Grid> g_outPtr(g_out);
+
+  // move on to next dim
+  curr_dim = (curr_dim + 1) % dims;
+  op_dim = (op_dim + 1) % g_out->getDimension();
+
+  /* Step 2: transform the samples in next dim */
+  if (g_out->getDimension() > 1) {
+    // Marginalize to next dimension
+    base::Grid* g1d = nullptr;
+    base::DataVector* a1d = nullptr;
+    std::unique_ptr<OperationDensityMargTo1D> marg1d(
+        op_factory::createOperationDensityMargTo1D(*g_out));
+    marg1d->margToDimX(a_out.get(), g1d, a1d, op_dim);
+    std::unique_ptr<base::Grid> g1dPtr(g1d);
+    std::unique_ptr<base::DataVector> a1dPtr(a1d);
+
+    transform1D(g1d, a1d, curr_dim, samples);
+
+    /* Step 3: transform the samples in next dimension, grouped by their values */
+    std::vector<std::vector<size_t>> groups;
+    splitIntoGroups(curr_dim, samples, groups);
+
+    for (const std::vector<size_t>& group : groups) {
+      transformGroup(g_out, a_out.get(), op_dim, curr_dim, group);
+    }
+  } else {
+    // skip Marginalize, directly transform the samples in next dimension
+    transform1D(g_out, a_out.get(), curr_dim, samples);
+  }
+}
+
+void RosenblattTransformationBatch::transform1D(base::Grid* grid1d, base::DataVector* alpha1d,
+                                                size_t dim, const std::vector<size_t>& samples) {
+  base::DataVector coords1d(samples.size());
+  base::DataVector results1d(samples.size());
+
+  for (size_t k = 0; k < samples.size(); k++) {
+    coords1d[k] = input->get(samples[k], dim);
+  }
+
+  transformation1D(grid1d, alpha1d, coords1d, results1d);
+
+  for (size_t k = 0; k < samples.size(); k++) {
+    output->set(samples[k], dim, results1d[k]);
+  }
+}
+
+void RosenblattTransformationBatch::splitIntoGroups(
+    size_t dim, const std::vector<size_t>& samples,
+    std::vector<std::vector<size_t>>& groups) const {
+  std::vector<std::pair<double, size_t>> values(samples.size());
+
+  for (size_t k = 0; k < samples.size(); k++) {
+    values[k] = std::make_pair(getConditioningValue(samples[k], dim), samples[k]);
+  }
+
+  std::sort(values.begin(), values.end());
+
+  for (size_t k = 0; k < values.size(); k++) {
+    if ((k == 0) || (values[k].first != values[k - 1].first)) {
+      groups.emplace_back();
+    }
+
+    groups.back().push_back(values[k].second);
+  }
+}
+
+double RosenblattTransformationBatch::getConditioningValue(size_t sample, size_t dim) const {
+  return conditionOnOutput ? output->get(sample, dim) : input->get(sample, dim);
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,118 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <functional>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Batched (inverse) Rosenblatt transformation of sparse grid densities.
+ *
+ * The transformation of a sample conditions the density successively on the coordinates of the
+ * sample, starting in some dimension, and transforms the next coordinate with the 1d marginal of
+ * the conditioned density. Instead of doing this for every sample separately, the samples are
+ * processed in groups that share all values conditioned on so far: the density is conditioned
+ * and marginalized only once per group, and all samples of the group are transformed with a
+ * single 1d CDF. The marginal of the start dimension is shared by all samples starting there.
+ * The groups are processed in parallel.
+ *
+ * The result for every sample is the same as if it had been transformed on its own.
+ */
+class RosenblattTransformationBatch {
+ public:
+  /**
+   * Transforms the coordinates coords1d of multiple samples w.r.t. the 1d density given by
+   * grid1d and alpha1d and writes the results to results1d.
+   */
+  typedef std::function<void(base::Grid* grid1d, base::DataVector* alpha1d,
+                             const base::DataVector& coords1d, base::DataVector& results1d)>
+      Transformation1D;
+
+  /**
+   * @param grid              grid of the density
+   * @param transformation1D  batched 1d transformation
+   * @param conditionOnOutput whether the density is conditioned on the transformed coordinates
+   *                          (inverse transformation) or on the input coordinates
+   */
+  RosenblattTransformationBatch(base::Grid* grid, const Transformation1D& transformation1D,
+                                bool conditionOnOutput);
+
+  /**
+   * Uses the 1d (inverse) Rosenblatt transformation of the operation factory.
+   *
+   * @param grid    grid of the density
+   * @param inverse whether the inverse Rosenblatt transformation is computed
+   */
+  RosenblattTransformationBatch(base::Grid* grid, bool inverse);
+
+  /**
+   * Transformation with mixed starting dimensions, the samples are divided into
+   * consecutive buckets of equal size with increasing starting dimension
+   *
+   * @param alpha Coefficient vector for current grid
+   * @param input Input DataMatrix (rows: # of samples, columns: # of dims)
+   * @param output Output DataMatrix (rows: # of samples, columns: # of dims)
+   */
+  void doTransformation(base::DataVector* alpha, base::DataMatrix* input,
+                        base::DataMatrix* output);
+
+  /**
+   * Transformation with fixed starting dimension
+   *
+   * @param alpha Coefficient vector for current grid
+   * @param input Input DataMatrix (rows: # of samples, columns: # of dims)
+   * @param output Output DataMatrix (rows: # of samples, columns: # of dims)
+   * @param dim_start Starting dimension
+   */
+  void doTransformation(base::DataVector* alpha, base::DataMatrix* input,
+                        base::DataMatrix* output, size_t dim_start);
+
+ protected:
+  base::Grid* grid;
+  Transformation1D transformation1D;
+  bool conditionOnOutput;
+  base::DataMatrix* input;
+  base::DataMatrix* output;
+
+  /**
+   * Transforms the samples, samplesPerStartDim[t] contains the samples starting in dimension t.
+   */
+  void transformSamples(base::DataVector* alpha,
+                        const std::vector<std::vector<size_t>>& samplesPerStartDim);
+
+  /**
+   * Conditions the density on the common value of the samples in dimension curr_dim and
+   * transforms the samples in the next dimensions.
+   */
+  void transformGroup(base::Grid* g_in, base::DataVector* a_in, size_t op_dim, size_t curr_dim,
+                      const std::vector<size_t>& samples);
+
+  /**
+   * Transforms the coordinates of the samples in dimension dim with the given 1d density.
+   */
+  void transform1D(base::Grid* grid1d, base::DataVector* alpha1d, size_t dim,
+                   const std::vector<size_t>& samples);
+
+  /**
+   * Splits the samples into groups with equal values to condition on in dimension dim.
+   */
+  void splitIntoGroups(size_t dim, const std::vector<size_t>& samples,
+                       std::vector<std::vector<size_t>>& groups) const;
+
+  double getConditioningValue(size_t sample, size_t dim) const;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
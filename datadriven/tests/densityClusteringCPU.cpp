@@ -0,0 +1,223 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationClusteringCPU.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationCreateGraphBruteForceCPU.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationCreateGraphKDTreeCPU.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationDensityCPU.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationPruneGraphCPU.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/globaldef.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename T>
+std::vector<T> readClusteringResult(const std::string& fileName) {
+  std::vector<T> values;
+  std::ifstream in("datadriven/datasets/clustering_test_data/" + fileName);
+  if (!in) {
+    BOOST_THROW_EXCEPTION(std::runtime_error(fileName + " is missing!"));
+  }
+  T value;
+  while (in >> value) values.push_back(value);
+  return values;
+}
+
+sgpp::base::DataMatrix readClusteringDataset() {
+  sgpp::datadriven::Dataset data = sgpp::datadriven::ARFFTools::readARFFFromFile(
+      "datadriven/datasets/clustering_test_data/clustering_testdataset_dim2.arff", false);
+  return data.getData();
+}
+
+std::unique_ptr<sgpp::base::Grid> createClusteringGrid() {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(11);
+  return grid;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestClusteringCPU)
+
+BOOST_AUTO_TEST_CASE(DensityMultiplicationCPU) {
+  std::vector<double> mult_optimal_result =
+      readClusteringResult<double>("mult_erg_dim2_depth11.txt");
+  std::unique_ptr<sgpp::base::Grid> grid = createClusteringGrid();
+  size_t gridsize = grid->getSize();
+
+  sgpp::base::DataVector alpha(gridsize, 1.0);
+  sgpp::base::DataVector result(gridsize);
+  sgpp::datadriven::DensityCPU::OperationDensityCPU mult_operation(*grid, 0.001);
+  mult_operation.mult(alpha, result);
+  BOOST_REQUIRE_EQUAL(mult_optimal_result.size(), gridsize);
+  for (size_t i = 0; i < gridsize; ++i) {
+    BOOST_CHECK_CLOSE(mult_optimal_result[i], result[i], 0.001);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DensityRHSCPU) {
+  std::vector<double> rhs_optimal_result =
+      readClusteringResult<double>("rhs_erg_dim2_depth11.txt");
+  std::unique_ptr<sgpp::base::Grid> grid = createClusteringGrid();
+  sgpp::base::DataMatrix dataset = readClusteringDataset();
+  size_t gridsize = grid->getSize();
+
+  sgpp::base::DataVector b(gridsize);
+  sgpp::datadriven::DensityCPU::OperationDensityCPU mult_operation(*grid, 0.001);
+  mult_operation.generateb(dataset, b);
+  BOOST_REQUIRE_EQUAL(rhs_optimal_result.size(), gridsize);
+  for (size_t i = 0; i < gridsize; ++i) {
+    BOOST_CHECK_CLOSE(rhs_optimal_result[i], b[i], 0.001);
+  }
+
+  // the rhs of a chunk of grid points equals the corresponding part of the full rhs
+  sgpp::base::DataVector b_chunk(100);
+  mult_operation.generateb(dataset, b_chunk, 50, 100);
+  for (size_t i = 0; i < 100; ++i) {
+    BOOST_CHECK_CLOSE(b[50 + i], b_chunk[i], 1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DensityAlphaSolverCPU) {
+  std::vector<double> alpha_optimal_result =
+      readClusteringResult<double>("alpha_erg_dim2_depth11.txt");
+  std::vector<double> rhs = readClusteringResult<double>("rhs_erg_dim2_depth11.txt");
+  std::unique_ptr<sgpp::base::Grid> grid = createClusteringGrid();
+  size_t gridsize = grid->getSize();
+
+  sgpp::base::DataVector b(gridsize);
+  std::copy(rhs.begin(), rhs.end(), b.begin());
+  sgpp::datadriven::DensityCPU::OperationDensityCPU mult_operation(*grid, 0.001);
+  sgpp::solver::ConjugateGradients solver(100, 0.001);
+  sgpp::base::DataVector alpha(gridsize, 1.0);
+  solver.solve(mult_operation, alpha, b, false, false);
+  double max = alpha.max();
+  double min = alpha.min();
+  alpha.mult(1.0 / (max - min));
+
+  // the surpluses are normalized to a range of one; both implementations stop CG at a relative
+  // residual of 1e-3, so entries below about 1e-6 are dominated by the solver error and do not
+  // agree to 1 % (observed deviations are up to 5e-9), they are compared absolutely with 1e-7
+  for (size_t i = 0; i < gridsize; ++i) {
+    BOOST_CHECK_SMALL(alpha_optimal_result[i] - alpha[i],
+                      0.01 * std::abs(alpha_optimal_result[i]) + 1e-7);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(KNNGraphBruteForceCPU) {
+  std::vector<int> graph_optimal_result = readClusteringResult<int>("graph_erg_dim2_depth11.txt");
+  sgpp::base::DataMatrix dataset = readClusteringDataset();
+  size_t k = 8;
+
+  sgpp::datadriven::DensityCPU::OperationCreateGraphBruteForceCPU operation_graph(dataset, k);
+  std::vector<int> graph(dataset.getNrows() * k);
+  operation_graph.create_graph(graph);
+  BOOST_REQUIRE_EQUAL(graph_optimal_result.size(), graph.size());
+  for (size_t i = 0; i < graph.size(); ++i) {
+    BOOST_CHECK_EQUAL(graph_optimal_result[i], graph[i]);
+  }
+
+  // chunks of the graph match the full graph
+  std::vector<int> chunk(100 * k);
+  operation_graph.create_graph(chunk, 1000, 100);
+  for (size_t i = 0; i < chunk.size(); ++i) {
+    BOOST_CHECK_EQUAL(graph[1000 * k + i], chunk[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(KNNGraphKDTreeCPU) {
+  std::vector<int> graph_optimal_result = readClusteringResult<int>("graph_erg_dim2_depth11.txt");
+  sgpp::base::DataMatrix dataset = readClusteringDataset();
+  size_t k = 8;
+
+  sgpp::datadriven::DensityCPU::OperationCreateGraphKDTreeCPU operation_graph(dataset, k);
+  std::vector<int> graph(dataset.getNrows() * k);
+  operation_graph.create_graph(graph);
+  BOOST_REQUIRE_EQUAL(graph_optimal_result.size(), graph.size());
+
+  // the neighbors are ordered by distance, so only the neighbor sets are compared
+  for (size_t node = 0; node < dataset.getNrows(); ++node) {
+    std::vector<int> expected(graph_optimal_result.begin() + node * k,
+                              graph_optimal_result.begin() + (node + 1) * k);
+    std::vector<int> actual(graph.begin() + node * k, graph.begin() + (node + 1) * k);
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    BOOST_CHECK(expected == actual);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(KNNPruneGraphCPU) {
+  std::vector<int> graph = readClusteringResult<int>("graph_erg_dim2_depth11.txt");
+  std::vector<int> graph_optimal_result =
+      readClusteringResult<int>("graph_pruned_erg_dim2_depth11.txt");
+  std::vector<double> alpha_values = readClusteringResult<double>("alpha_erg_dim2_depth11.txt");
+  std::unique_ptr<sgpp::base::Grid> grid = createClusteringGrid();
+  sgpp::base::DataMatrix dataset = readClusteringDataset();
+
+  sgpp::base::DataVector alpha(grid->getSize());
+  std::copy(alpha_values.begin(), alpha_values.end(), alpha.begin());
+  sgpp::datadriven::DensityCPU::OperationPruneGraphCPU operation_prune(*grid, alpha, dataset,
+                                                                       0.2, 8);
+  operation_prune.prune_graph(graph);
+  BOOST_REQUIRE_EQUAL(graph_optimal_result.size(), graph.size());
+  for (size_t i = 0; i < graph.size(); ++i) {
+    BOOST_CHECK_EQUAL(graph_optimal_result[i], graph[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(KNNClusterSearchCPU) {
+  std::vector<int> graph = readClusteringResult<int>("graph_pruned_erg_dim2_depth11.txt");
+  std::vector<size_t> optimal_cluster_assignement =
+      readClusteringResult<size_t>("cluster_erg.txt");
+
+  std::vector<size_t> cluster_assignement =
+      sgpp::datadriven::DensityCPU::OperationCreateGraphCPU::find_clusters(graph, 8);
+  BOOST_REQUIRE_EQUAL(optimal_cluster_assignement.size(), cluster_assignement.size());
+
+  // both assignements describe the same partition if the relabeling is a bijection
+  std::map<size_t, size_t> forward;
+  std::map<size_t, size_t> backward;
+  for (size_t i = 0; i < cluster_assignement.size(); ++i) {
+    size_t expected = optimal_cluster_assignement[i];
+    size_t actual = cluster_assignement[i];
+    BOOST_CHECK_EQUAL(expected == 0, actual == 0);
+    if (forward.count(expected) == 0) forward[expected] = actual;
+    if (backward.count(actual) == 0) backward[actual] = expected;
+    BOOST_CHECK_EQUAL(forward[expected], actual);
+    BOOST_CHECK_EQUAL(backward[actual], expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ClusteringPipelineCPU) {
+  std::vector<size_t> optimal_cluster_assignement =
+      readClusteringResult<size_t>("cluster_erg.txt");
+  std::unique_ptr<sgpp::base::Grid> grid = createClusteringGrid();
+  sgpp::base::DataMatrix dataset = readClusteringDataset();
+
+  sgpp::datadriven::ClusteringCPU::OperationClusteringCPU operation_clustering(true);
+  std::vector<size_t> clusters =
+      operation_clustering.calculate_clusters(*grid, dataset, 0.001, 8, 0.2);
+  BOOST_REQUIRE_EQUAL(clusters.size(), dataset.getNrows());
+  size_t expectedClusters =
+      *std::max_element(optimal_cluster_assignement.begin(), optimal_cluster_assignement.end());
+  size_t foundClusters = *std::max_element(clusters.begin(), clusters.end());
+  BOOST_CHECK_EQUAL(expectedClusters, foundClusters);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
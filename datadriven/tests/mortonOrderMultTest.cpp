@@ -0,0 +1,157 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalMortonOrder/OperationMultiEvalMortonOrder.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "test_datadrivenCommon.hpp"
+
+namespace TestMortonOrderMultFixture {
+struct FilesNamesAndErrorFixture {
+  FilesNamesAndErrorFixture() {}
+  ~FilesNamesAndErrorFixture() {}
+
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDouble = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-22)};
+
+  // the transposed results are sums over the whole dataset and summed up in a different order
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDoubleTranspose = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-16)};
+
+  uint32_t level = 5;
+};
+}  // namespace TestMortonOrderMultFixture
+
+BOOST_FIXTURE_TEST_SUITE(TestMortonOrderMult,
+                         TestMortonOrderMultFixture::FilesNamesAndErrorFixture)
+
+BOOST_AUTO_TEST_CASE(Linear) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::MORTONORDER,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::Linear, level, configuration);
+}
+
+BOOST_AUTO_TEST_CASE(LinearTranspose) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::MORTONORDER,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  compareDatasetsTranspose(fileNamesErrorDoubleTranspose, sgpp::base::GridType::Linear, level,
+                           configuration);
+}
+
+BOOST_AUTO_TEST_CASE(ModLinear) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::MORTONORDER,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::ModLinear, level, configuration);
+}
+
+BOOST_AUTO_TEST_CASE(ModLinearTranspose) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::MORTONORDER,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  compareDatasetsTranspose(fileNamesErrorDoubleTranspose, sgpp::base::GridType::ModLinear, level,
+                           configuration);
+}
+
+BOOST_AUTO_TEST_CASE(ModLinearBoundaryPoints) {
+  // binary features: all points of a tile lie on the boundary of the domain in some dimensions,
+  // where the modified boundary functions do not vanish
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::MORTONORDER,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+  const size_t dim = 3;
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createModLinearGrid(dim));
+  grid->getGenerator().regular(4);
+  const size_t gridSize = grid->getSize();
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::bernoulli_distribution binary(0.5);
+
+  sgpp::base::DataVector alpha(gridSize);
+
+  for (size_t j = 0; j < gridSize; j++) {
+    alpha[j] = uniform(generator);
+  }
+
+  // (a) mixed dataset with binary features in the first and last dimension
+  // (b) single tile with x_0 = 1 and x_2 = 0 for all points
+  for (bool singleTile : {false, true}) {
+    const size_t dataSize = singleTile ? MORTON_ORDER_TILE_SIZE : 1000;
+    sgpp::base::DataMatrix data(dataSize, dim);
+
+    for (size_t i = 0; i < dataSize; i++) {
+      data.set(i, 0, (singleTile || binary(generator)) ? 1.0 : 0.0);
+      data.set(i, 1, singleTile ? 0.3 + 0.02 * uniform(generator) : uniform(generator));
+      data.set(i, 2, (!singleTile && binary(generator)) ? 1.0 : 0.0);
+    }
+
+    std::unique_ptr<sgpp::base::OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEval(*grid, data, configuration));
+    std::unique_ptr<sgpp::base::OperationMultipleEval> opReference(
+        sgpp::op_factory::createOperationMultipleEval(*grid, data));
+
+    sgpp::base::DataVector result(dataSize);
+    sgpp::base::DataVector resultReference(dataSize);
+    op->mult(alpha, result);
+    opReference->mult(alpha, resultReference);
+
+    for (size_t i = 0; i < dataSize; i++) {
+      BOOST_CHECK_CLOSE(result[i], resultReference[i], 1e-10);
+    }
+
+    sgpp::base::DataVector source(dataSize, 1.0);
+    sgpp::base::DataVector resultTranspose(gridSize);
+    sgpp::base::DataVector resultTransposeReference(gridSize);
+    op->multTranspose(source, resultTranspose);
+    opReference->multTranspose(source, resultTransposeReference);
+
+    for (size_t j = 0; j < gridSize; j++) {
+      BOOST_CHECK_CLOSE(resultTranspose[j], resultTransposeReference[j], 1e-10);
+    }
+
+    if (singleTile) {
+      // the basis functions are non-negative and the data is not aligned with the grid in the
+      // inner dimension, so exactly the grid points which do not vanish on the tile overlap it
+      size_t nonZero = 0;
+
+      for (size_t j = 0; j < gridSize; j++) {
+        nonZero += (resultTransposeReference[j] > 0.0) ? 1 : 0;
+      }
+
+      size_t overlaps =
+          dynamic_cast<sgpp::datadriven::OperationMultiEvalMortonOrder&>(*op).getOverlapCount();
+      BOOST_CHECK_EQUAL(overlaps, nonZero);
+      BOOST_CHECK_LT(overlaps, gridSize);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
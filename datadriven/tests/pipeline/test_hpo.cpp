@@ -142,6 +142,55 @@ BOOST_AUTO_TEST_CASE(upperLevelTest) {
   BOOST_CHECK_LE(res2, 0.3);
 }
 
+BOOST_AUTO_TEST_CASE(parallelTrialsTest) {
+  // same as upperLevelTest, but trials are trained concurrently on two miners and bayesian
+  // optimization proposes batches of two points
+  std::string path("datadriven/tests/pipeline/config_hpoParallel.json");
+  sgpp::datadriven::DataMiningConfigParser parser(path);
+  sgpp::datadriven::LeastSquaresRegressionMinerFactory minfac{};
+
+  sgpp::datadriven::BoHyperparameterOptimizer bohpo(minfac.buildMiner(path),
+                                                    new FitterFactoryTester(), parser);
+  bohpo.addTrialMiner(minfac.buildMiner(path));
+  sgpp::datadriven::HarmonicaHyperparameterOptimizer harmhpo(minfac.buildMiner(path),
+                                                             new FitterFactoryTester(), parser);
+  harmhpo.addTrialMiner(minfac.buildMiner(path));
+  double res1 = bohpo.run(false);
+  double res2 = harmhpo.run(false);
+  BOOST_CHECK_LE(res1, 0.3);
+  BOOST_CHECK_LE(res2, 0.3);
+}
+
+BOOST_AUTO_TEST_CASE(proposeBatchGP) {
+  // constant liar batches have to consist of distinct points
+  std::vector<BOConfig> initialConfigs{};
+  std::mt19937 generator(42);
+
+  std::vector<int> discOptions = {2, 3};
+  std::vector<int> catOptions = {2, 3};
+  size_t nCont = 2;
+  BOConfig prototype{&discOptions, &catOptions, nCont};
+
+  std::vector<double> scores = {0, 42, 21, 30, 5};
+  initialConfigs.reserve(scores.size());
+  for (size_t i = 0; i < scores.size(); i++) {
+    initialConfigs.emplace_back(prototype);
+    initialConfigs[i].randomize(generator);
+    initialConfigs[i].setScore(scores[i]);
+  }
+  sgpp::datadriven::BayesianOptimization bo(initialConfigs);
+
+  std::vector<BOConfig> batch = bo.proposeBatch(prototype, 3);
+  BOOST_CHECK_EQUAL(batch.size(), 3);
+
+  DataVector scales(prototype.getNPar() + 1, 1);
+  for (size_t i = 0; i < batch.size(); i++) {
+    for (size_t k = 0; k < i; k++) {
+      BOOST_CHECK_GT(batch[i].getScaledDistance(batch[k], scales), 1e-10);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(harmonicaConfigs) {
   // tests the bit management, especially setParameters and addConstraint by comparing to a vector
   // of all possible bit configurations
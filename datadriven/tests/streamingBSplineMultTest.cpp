@@ -0,0 +1,86 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "test_datadrivenCommon.hpp"
+
+namespace TestStreamingBSplineMultFixture {
+struct FilesNamesAndErrorFixture {
+  FilesNamesAndErrorFixture() {}
+  ~FilesNamesAndErrorFixture() {}
+
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDouble = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-16)};
+
+  uint32_t level = 4;
+
+  // B-spline degrees (even degrees are reduced to the next lower odd one)
+  std::vector<size_t> degrees = {1, 3, 5, 7};
+};
+}  // namespace TestStreamingBSplineMultFixture
+
+BOOST_FIXTURE_TEST_SUITE(TestStreamingBSplineMult,
+                         TestStreamingBSplineMultFixture::FilesNamesAndErrorFixture)
+
+BOOST_AUTO_TEST_CASE(Bspline) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  for (size_t degree : degrees) {
+    compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::Bspline, level, configuration,
+                    degree);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BsplineTranspose) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  for (size_t degree : degrees) {
+    compareDatasetsTranspose(fileNamesErrorDouble, sgpp::base::GridType::Bspline, level,
+                             configuration, degree);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ModBspline) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  for (size_t degree : degrees) {
+    compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::ModBspline, level, configuration,
+                    degree);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ModBsplineTranspose) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  for (size_t degree : degrees) {
+    compareDatasetsTranspose(fileNamesErrorDouble, sgpp::base::GridType::ModBspline, level,
+                             configuration, degree);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -4,23 +4,28 @@
 // sgpp.sparsegrids.org
 
 #ifdef ZLIB
-#ifdef __AVX__
+#if defined(__AVX__) || defined(SGPP_KERNEL_DISPATCH)
 
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/CPUFeatures.hpp>
 #include <sgpp/base/tools/ConfigurationParameters.hpp>
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <zlib.h>
 
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <string>
 #include <tuple>
@@ -55,6 +60,41 @@ BOOST_AUTO_TEST_CASE(Simple) {
                   configuration);
 }
 
+#if defined(SGPP_KERNEL_DISPATCH) && !defined(_WIN32)
+BOOST_AUTO_TEST_CASE(InstructionSets) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  // run every kernel variant the host supports
+  for (sgpp::base::InstructionSet instructionSet :
+       {sgpp::base::InstructionSet::GENERIC, sgpp::base::InstructionSet::SSE3,
+        sgpp::base::InstructionSet::AVX, sgpp::base::InstructionSet::AVX2,
+        sgpp::base::InstructionSet::AVX512}) {
+    if (!sgpp::base::CPUFeatures::isSupported(instructionSet)) {
+      continue;
+    }
+
+    BOOST_TEST_MESSAGE("instruction set: " << sgpp::base::CPUFeatures::toString(instructionSet));
+    setenv("SGPP_INSTRUCTION_SET", sgpp::base::CPUFeatures::toString(instructionSet).c_str(), 1);
+
+    // the operation has to run the variant that was asked for
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+    grid->getGenerator().regular(2);
+    sgpp::base::DataMatrix dataset(1, 2, 0.5);
+    std::unique_ptr<sgpp::base::OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset, configuration));
+    auto streamingOp = dynamic_cast<sgpp::datadriven::OperationMultiEvalStreaming*>(op.get());
+    BOOST_REQUIRE(streamingOp != nullptr);
+    BOOST_CHECK(streamingOp->getInstructionSet() == instructionSet);
+
+    compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::Linear, level, configuration);
+  }
+
+  unsetenv("SGPP_INSTRUCTION_SET");
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
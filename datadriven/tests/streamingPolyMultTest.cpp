@@ -0,0 +1,86 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "test_datadrivenCommon.hpp"
+
+namespace TestStreamingPolyMultFixture {
+struct FilesNamesAndErrorFixture {
+  FilesNamesAndErrorFixture() {}
+  ~FilesNamesAndErrorFixture() {}
+
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDouble = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-16)};
+
+  uint32_t level = 4;
+
+  // polynomial degrees (the basis requires at least degree 2)
+  std::vector<size_t> degrees = {2, 3, 5, 7};
+};
+}  // namespace TestStreamingPolyMultFixture
+
+BOOST_FIXTURE_TEST_SUITE(TestStreamingPolyMult,
+                         TestStreamingPolyMultFixture::FilesNamesAndErrorFixture)
+
+BOOST_AUTO_TEST_CASE(Poly) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  for (size_t degree : degrees) {
+    compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::Poly, level, configuration,
+                    degree);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PolyTranspose) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  for (size_t degree : degrees) {
+    compareDatasetsTranspose(fileNamesErrorDouble, sgpp::base::GridType::Poly, level,
+                             configuration, degree);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ModPoly) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  for (size_t degree : degrees) {
+    compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::ModPoly, level, configuration,
+                    degree);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ModPolyTranspose) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  for (size_t degree : degrees) {
+    compareDatasetsTranspose(fileNamesErrorDouble, sgpp::base::GridType::ModPoly, level,
+                             configuration, degree);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
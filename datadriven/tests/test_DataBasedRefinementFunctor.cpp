@@ -0,0 +1,133 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/datadriven/functors/classification/DataBasedRefinementFunctor.hpp>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::datadriven::DataBasedRefinementFunctor;
+
+namespace {
+
+void checkSameH(DataBasedRefinementFunctor& func1, DataBasedRefinementFunctor& func2) {
+  BOOST_REQUIRE_EQUAL(func1.getNumGrids(), func2.getNumGrids());
+  for (size_t k = 0; k < func1.getNumGrids(); k++) {
+    DataMatrix& h1 = func1.getHk(k);
+    DataMatrix& h2 = func2.getHk(k);
+    BOOST_REQUIRE_EQUAL(h1.getNrows(), h2.getNrows());
+    BOOST_REQUIRE_EQUAL(h1.getNcols(), h2.getNcols());
+    for (size_t i = 0; i < h1.getSize(); i++) {
+      BOOST_CHECK_EQUAL(h1[i], h2[i]);
+    }
+  }
+}
+
+void checkSameScores(DataBasedRefinementFunctor& func1, DataBasedRefinementFunctor& func2,
+                     std::vector<Grid*>& grids) {
+  checkSameH(func1, func2);
+  for (size_t k = 0; k < grids.size(); k++) {
+    func1.setGridIndex(k);
+    func2.setGridIndex(k);
+    sgpp::base::GridStorage& storage = grids[k]->getStorage();
+    for (size_t j = 0; j < storage.getSize(); j++) {
+      BOOST_CHECK_EQUAL(func1(storage, j), func2(storage, j));
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestDataBasedRefinementFunctor)
+
+BOOST_AUTO_TEST_CASE(testIncrementalUpdate) {
+  const size_t dim = 2;
+  const size_t numClasses = 3;
+  const size_t numData = 500;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> coordDist(0.0, 1.0);
+  std::uniform_real_distribution<double> alphaDist(0.0, 1.0);
+
+  DataMatrix data(numData, dim);
+  DataVector targets(numData);
+  for (size_t i = 0; i < numData; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      data.set(i, d, coordDist(generator));
+    }
+    targets[i] = static_cast<double>(i % numClasses);
+  }
+
+  std::vector<std::unique_ptr<Grid>> gridsOwner;
+  std::vector<DataVector> alphasOwner;
+  for (size_t k = 0; k < numClasses; k++) {
+    gridsOwner.emplace_back(Grid::createLinearGrid(dim));
+    gridsOwner.back()->getGenerator().regular(3);
+    alphasOwner.emplace_back(gridsOwner.back()->getSize());
+    for (size_t j = 0; j < alphasOwner.back().getSize(); j++) {
+      alphasOwner.back()[j] = alphaDist(generator);
+    }
+  }
+  std::vector<Grid*> grids;
+  std::vector<DataVector*> alphas;
+  for (size_t k = 0; k < numClasses; k++) {
+    grids.push_back(gridsOwner[k].get());
+    alphas.push_back(&alphasOwner[k]);
+  }
+  std::vector<double> priors(numClasses, 1.0);
+
+  DataBasedRefinementFunctor incremental(grids, alphas, priors, &data, &targets, 3);
+
+  // refine the first grid, set surpluses for the new points and change an old surplus
+  size_t oldSize = grids[0]->getSize();
+  sgpp::base::SurplusRefinementFunctor surplusFunc(*alphas[0], 2);
+  grids[0]->getGenerator().refine(surplusFunc);
+  BOOST_REQUIRE_GT(grids[0]->getSize(), oldSize);
+  alphas[0]->resizeZero(grids[0]->getSize());
+  for (size_t j = oldSize; j < grids[0]->getSize(); j++) {
+    (*alphas[0])[j] = alphaDist(generator);
+  }
+  (*alphas[0])[1] += 0.5;
+  incremental.updateH();
+
+  DataBasedRefinementFunctor reference(grids, alphas, priors, &data, &targets, 3);
+  checkSameScores(incremental, reference, grids);
+
+  // changing all surpluses falls back to a full evaluation
+  for (size_t j = 0; j < alphas[1]->getSize(); j++) {
+    (*alphas[1])[j] *= 2.0;
+  }
+  incremental.updateH();
+  DataBasedRefinementFunctor reference2(grids, alphas, priors, &data, &targets, 3);
+  checkSameScores(incremental, reference2, grids);
+
+  // changed priors only require H to be rebuilt from the cached evaluations
+  priors[2] = 0.25;
+  incremental.setPriors(priors);
+  incremental.updateH();
+  DataBasedRefinementFunctor reference3(grids, alphas, priors, &data, &targets, 3);
+  checkSameH(incremental, reference3);
+
+  // replaced data is evaluated from scratch, even if it is stored at the same address
+  for (size_t i = 0; i < numData; i++) {
+    data.set(i, 0, 1.0 - data.get(i, 0));
+  }
+  incremental.setData(&data, &targets);
+  incremental.updateH();
+  DataBasedRefinementFunctor reference4(grids, alphas, priors, &data, &targets, 3);
+  checkSameH(incremental, reference4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
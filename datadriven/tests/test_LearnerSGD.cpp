@@ -0,0 +1,164 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/application/LearnerSGD.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::datadriven::LearnerSGD;
+
+namespace {
+
+/**
+ * Gives access to the (non-averaged) surpluses of the learner.
+ */
+class LearnerSGDSurpluses : public LearnerSGD {
+ public:
+  using LearnerSGD::LearnerSGD;
+
+  const DataVector& getSurpluses() const { return alpha; }
+};
+
+void createDataset(DataMatrix& data, DataVector& labels) {
+  const size_t numData = 10;
+  data.resize(numData, 2);
+  labels.resize(numData);
+  for (size_t i = 0; i < numData; i++) {
+    double x0 = 0.05 + 0.09 * static_cast<double>(i);
+    double x1 = 0.5 + 0.4 * std::sin(3.0 * static_cast<double>(i));
+    data.set(i, 0, x0);
+    data.set(i, 1, x1);
+    labels[i] = (x0 + x1 > 1.0) ? 1.0 : -1.0;
+  }
+}
+
+/**
+ * Plain reimplementation of the learner's steps for lambda = 0 (the learning rate is constant).
+ */
+DataVector referenceSurpluses(DataMatrix& data, DataVector& labels, size_t level,
+                              size_t miniBatchSize, size_t passes, double gamma, bool useAdam) {
+  const double beta1 = 0.25;
+  const double beta2 = 0.95;
+  const double epsilon = 1e-8;
+  size_t dim = data.getNcols();
+  size_t numData = data.getNrows();
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(level);
+  size_t gridSize = grid->getSize();
+  DataVector alpha(gridSize, 0.0);
+  DataVector m(gridSize, 0.0);
+  DataVector v(gridSize, 0.0);
+  size_t step = 0;
+
+  for (size_t pass = 0; pass < passes; pass++) {
+    for (size_t start = 0; start < numData; start += miniBatchSize) {
+      size_t size = std::min(miniBatchSize, numData - start);
+      DataMatrix batch(size, dim);
+      DataVector residuals(size);
+      DataVector row(dim);
+      for (size_t i = 0; i < size; i++) {
+        data.getRow(start + i, row);
+        batch.setRow(i, row);
+      }
+      std::unique_ptr<sgpp::base::OperationMultipleEval> op(
+          sgpp::op_factory::createOperationMultipleEval(*grid, batch));
+      op->mult(alpha, residuals);
+      for (size_t i = 0; i < size; i++) {
+        residuals[i] = (residuals[i] - labels[start + i]) / static_cast<double>(size);
+      }
+      DataVector gradient(gridSize);
+      op->multTranspose(residuals, gradient);
+      step++;
+
+      for (size_t k = 0; k < gridSize; k++) {
+        if (useAdam) {
+          m[k] = beta1 * m[k] + (1.0 - beta1) * gradient[k];
+          v[k] = beta2 * v[k] + (1.0 - beta2) * gradient[k] * gradient[k];
+          double mHat = m[k] / (1.0 - std::pow(beta1, static_cast<double>(step)));
+          double vHat = v[k] / (1.0 - std::pow(beta2, static_cast<double>(step)));
+          alpha[k] -= gamma * mHat / (std::sqrt(vHat) + epsilon);
+        } else {
+          alpha[k] -= gamma * gradient[k];
+        }
+      }
+    }
+  }
+  return alpha;
+}
+
+void checkLearner(size_t miniBatchSize, size_t passes, bool useAdam) {
+  const size_t level = 2;
+  const double gamma = 0.1;
+  DataMatrix data;
+  DataVector labels;
+  createDataset(data, labels);
+
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.type_ = sgpp::base::GridType::Linear;
+  gridConfig.level_ = static_cast<int>(level);
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+  adaptivityConfig.numRefinements_ = 0;
+
+  // validation data is used, so that no buffer of processed points is filled
+  LearnerSGDSurpluses learner(gridConfig, adaptivityConfig, data, labels, data, labels, &data,
+                              &labels, 0.0, gamma, data.getNrows(), true);
+  learner.setMiniBatchSize(miniBatchSize);
+  learner.setUseAdam(useAdam);
+  learner.initialize();
+  learner.train(passes, "", "", 0, 0.0, 0, 0);
+
+  DataVector reference =
+      referenceSurpluses(data, labels, level, miniBatchSize, passes, gamma, useAdam);
+  const DataVector& alpha = learner.getSurpluses();
+  BOOST_REQUIRE_EQUAL(alpha.getSize(), reference.getSize());
+  for (size_t k = 0; k < alpha.getSize(); k++) {
+    BOOST_CHECK_SMALL(alpha[k] - reference[k], 1e-12);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestLearnerSGD)
+
+BOOST_AUTO_TEST_CASE(testMiniBatch) {
+  // classical SGD, a size that does not divide the number of points and the full batch
+  checkLearner(1, 2, false);
+  checkLearner(4, 3, false);
+  checkLearner(10, 2, false);
+}
+
+BOOST_AUTO_TEST_CASE(testAdam) {
+  checkLearner(1, 2, true);
+  checkLearner(4, 3, true);
+  checkLearner(10, 2, true);
+}
+
+BOOST_AUTO_TEST_CASE(testInvalidMiniBatchSize) {
+  DataMatrix data;
+  DataVector labels;
+  createDataset(data, labels);
+  sgpp::base::RegularGridConfiguration gridConfig;
+  sgpp::base::AdaptivityConfiguration adaptivityConfig;
+  LearnerSGD learner(gridConfig, adaptivityConfig, data, labels, data, labels, &data, &labels,
+                     0.0, 0.1, data.getNrows(), true);
+  BOOST_CHECK_THROW(learner.setMiniBatchSize(0), sgpp::base::application_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,123 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef USE_MPI
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/LoadAwareScheduler.hpp>
+
+using sgpp::base::algorithm_exception;
+using sgpp::datadriven::AssignTaskResult;
+using sgpp::datadriven::LoadAwareScheduler;
+
+namespace {
+
+/**
+ * Scheduler with a fixed number of ranks and classes, so it can be tested without MPI and without
+ * a learner.
+ */
+class FixedSizeLoadAwareScheduler : public LoadAwareScheduler {
+ public:
+  FixedSizeLoadAwareScheduler(size_t numRanks, size_t numClasses)
+      : LoadAwareScheduler(10, 2), numRanks(numRanks), numClasses(numClasses) {}
+
+  using LoadAwareScheduler::allWorkersSaturated;
+
+  int assignBatch(size_t batchOffset) {
+    AssignTaskResult result;
+    assignTaskVariableTaskSize(sgpp::datadriven::TRAIN_FROM_BATCH, result);
+    BOOST_CHECK_EQUAL(result.taskSize, static_cast<size_t>(10));
+    onBatchAssigned(result.workerID, batchOffset, result.taskSize);
+    return result.workerID;
+  }
+
+  void mergeBatch(size_t batchOffset, size_t remoteGridVersion, size_t localGridVersion) {
+    for (size_t c = 0; c < numClasses; c++) {
+      onMergeRequestIncoming(batchOffset + 10, 10, remoteGridVersion, localGridVersion);
+    }
+  }
+
+ protected:
+  size_t getNumRanks() const override { return numRanks; }
+  size_t getNumClasses() const override { return numClasses; }
+
+  size_t numRanks;
+  size_t numClasses;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestLoadAwareScheduler)
+
+BOOST_AUTO_TEST_CASE(testAssignment) {
+  // master and three workers
+  FixedSizeLoadAwareScheduler scheduler(4, 2);
+
+  // round robin as long as all workers have the same load
+  BOOST_CHECK_EQUAL(scheduler.assignBatch(0), 1);
+  BOOST_CHECK_EQUAL(scheduler.assignBatch(10), 2);
+  BOOST_CHECK_EQUAL(scheduler.assignBatch(20), 3);
+  BOOST_CHECK_EQUAL(scheduler.assignBatch(30), 1);
+  BOOST_CHECK(!scheduler.allWorkersSaturated());
+
+  // the batch of worker 2 is only finished after the merge requests of all classes
+  scheduler.onMergeRequestIncoming(20, 10, 0, 0);
+  BOOST_CHECK_EQUAL(scheduler.assignBatch(40), 2);
+  scheduler.onMergeRequestIncoming(20, 10, 0, 0);
+
+  // worker 1 has two outstanding batches, workers 2 and 3 one each
+  BOOST_CHECK_EQUAL(scheduler.assignBatch(50), 3);
+  BOOST_CHECK_EQUAL(scheduler.assignBatch(60), 2);
+  BOOST_CHECK(scheduler.allWorkersSaturated());
+
+  // system matrix updates go to the least loaded worker as well
+  scheduler.mergeBatch(20, 0, 0);
+  BOOST_CHECK(!scheduler.allWorkersSaturated());
+  AssignTaskResult result;
+  scheduler.assignTaskStaticTaskSize(sgpp::datadriven::RECOMPUTE_SYSTEM_MATRIX_DECOMPOSITION,
+                                     result);
+  BOOST_CHECK_EQUAL(result.workerID, 3);
+
+  // unknown batches and too old grid versions are rejected
+  BOOST_CHECK_THROW(scheduler.onMergeRequestIncoming(15, 10, 0, 0), algorithm_exception);
+  BOOST_CHECK_THROW(scheduler.onMergeRequestIncoming(10, 10, 0, 2), algorithm_exception);
+}
+
+BOOST_AUTO_TEST_CASE(testRefinementCycles) {
+  FixedSizeLoadAwareScheduler scheduler(3, 2);
+  BOOST_CHECK(scheduler.isReadyForRefinement());
+
+  scheduler.assignBatch(0);
+  scheduler.assignBatch(10);
+  scheduler.mergeBatch(0, 0, 0);
+
+  // the batch at offset 10 was trained on the grid before the refinement
+  scheduler.onRefinementStarted();
+  BOOST_CHECK(!scheduler.isReadyForRefinement());
+  scheduler.assignBatch(20);
+  scheduler.mergeBatch(10, 0, 1);
+  BOOST_CHECK(scheduler.isReadyForRefinement());
+
+  scheduler.onRefinementStarted();
+  BOOST_CHECK(!scheduler.isReadyForRefinement());
+  BOOST_CHECK_THROW(scheduler.onRefinementStarted(), algorithm_exception);
+  scheduler.mergeBatch(20, 1, 2);
+  BOOST_CHECK(scheduler.isReadyForRefinement());
+}
+
+BOOST_AUTO_TEST_CASE(testNoWorkers) {
+  FixedSizeLoadAwareScheduler scheduler(1, 2);
+  AssignTaskResult result;
+  BOOST_CHECK_THROW(
+      scheduler.assignTaskStaticTaskSize(sgpp::datadriven::TRAIN_FROM_BATCH, result),
+      algorithm_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
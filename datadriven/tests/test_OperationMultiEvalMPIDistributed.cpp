@@ -0,0 +1,120 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef USE_MPI
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalMPI/OperationMultiEvalMPIDistributed.hpp>
+
+#include <cmath>
+#include <memory>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::OperationMultipleEval;
+using sgpp::datadriven::OperationMultiEvalMPIDistributed;
+using sgpp::datadriven::OperationMultipleEvalConfiguration;
+
+#ifndef USE_SCALAPACK
+// with ScaLAPACK, MPI is initialized by the fixture of the BLACS tests
+struct FixtureMPI {
+  FixtureMPI() {
+    int initialized;
+    MPI_Initialized(&initialized);
+    if (!initialized) {
+      MPI_Init(nullptr, nullptr);
+    }
+  }
+
+  ~FixtureMPI() {
+    int finalized;
+    MPI_Finalized(&finalized);
+    if (!finalized) {
+      MPI_Finalize();
+    }
+  }
+};
+
+BOOST_GLOBAL_FIXTURE(FixtureMPI);
+#endif
+
+BOOST_AUTO_TEST_SUITE(TestOperationMultiEvalMPIDistributed)
+
+BOOST_AUTO_TEST_CASE(testMultAndMultTranspose) {
+  const size_t dim = 3;
+  const size_t numData = 37;
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(3);
+  const size_t gridSize = grid->getSize();
+
+  DataMatrix dataset(numData, dim);
+  for (size_t i = 0; i < numData; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(i, d, std::fmod(0.37 * static_cast<double>((i + 1) * (d + 2)), 1.0));
+    }
+  }
+
+  DataVector alpha(gridSize);
+  for (size_t j = 0; j < gridSize; j++) {
+    alpha[j] = static_cast<double>(j % 7) - 3.0;
+  }
+  DataVector source(numData);
+  for (size_t i = 0; i < numData; i++) {
+    source[i] = 0.5 + static_cast<double>(i % 5);
+  }
+
+  std::unique_ptr<OperationMultipleEval> reference(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+  DataVector referenceResult(numData);
+  DataVector referenceResultTranspose(gridSize);
+  reference->mult(alpha, referenceResult);
+  reference->multTranspose(source, referenceResultTranspose);
+
+  // only the input vectors of rank 0 may be used
+  if (rank != 0) {
+    alpha.mult(-2.0);
+    source.setAll(1.0);
+  }
+
+  for (bool overlapCommunication : {false, true}) {
+    OperationMultiEvalMPIDistributed op(*grid, dataset, OperationMultipleEvalConfiguration(),
+                                        overlapCommunication);
+
+    // the shards partition the dataset
+    unsigned long shardSize = static_cast<unsigned long>(op.getShardEnd() - op.getShardStart());
+    unsigned long totalSize = 0;
+    MPI_Allreduce(&shardSize, &totalSize, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    BOOST_CHECK_EQUAL(totalSize, numData);
+
+    DataVector result(numData);
+    op.mult(alpha, result);
+    BOOST_REQUIRE_EQUAL(result.getSize(), numData);
+    for (size_t i = 0; i < numData; i++) {
+      BOOST_CHECK_CLOSE(result[i], referenceResult[i], 1e-12);
+    }
+
+    DataVector resultTranspose(gridSize);
+    op.multTranspose(source, resultTranspose);
+    BOOST_REQUIRE_EQUAL(resultTranspose.getSize(), gridSize);
+    for (size_t j = 0; j < gridSize; j++) {
+      BOOST_CHECK_CLOSE(resultTranspose[j], referenceResultTranspose[j], 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -18,6 +18,7 @@
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/optimization/operation/OptimizationOpFactory.hpp>
 
+#include <memory>
 #include <vector>
 #include <random>
 #include <iostream>
@@ -506,6 +507,98 @@ BOOST_AUTO_TEST_CASE(testRosenblattModBsplineClenshawCurtisDD) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testRosenblattBatch) {
+  size_t numDims = 3;
+  size_t numSamples = 40;
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.emplace_back(Grid::createLinearGrid(numDims));
+  grids.emplace_back(Grid::createPolyGrid(numDims, 3));
+  grids.emplace_back(Grid::createModPolyGrid(numDims, 3));
+  grids.emplace_back(Grid::createPolyBoundaryGrid(numDims, 3));
+  grids.emplace_back(Grid::createBsplineGrid(numDims, 3));
+  grids.emplace_back(Grid::createModBsplineClenshawCurtisGrid(numDims, 3));
+
+  // every second sample shares the first coordinates with its predecessor
+  DataMatrix u_vars(numSamples, numDims);
+  randu(u_vars);
+  for (size_t isample = 1; isample < numSamples; isample += 2) {
+    u_vars.set(isample, 0, u_vars.get(isample - 1, 0));
+    u_vars.set(isample, 1, u_vars.get(isample - 1, 1));
+  }
+
+  // start dimensions of the transformation with mixed starting dimensions
+  std::vector<size_t> mixedStartDims(numSamples);
+  size_t bucketSize = numSamples / numDims + 1;
+  for (size_t isample = 0, dim_start = 0; isample < numSamples; isample++) {
+    if (((isample + 1) % bucketSize) == 0 && (isample + 1) < numSamples) {
+      ++dim_start;
+    }
+    mixedStartDims[isample] = dim_start;
+  }
+
+  // the batched transformations give the same results as transforming every sample on its own
+  DataMatrix sample(1, numDims);
+  DataMatrix sampleResult(1, numDims);
+  DataVector row(numDims);
+  for (auto& grid : grids) {
+    DataVector alpha;
+    hierarchize(grid.get(), 3, alpha, &parabola);
+    std::unique_ptr<sgpp::datadriven::OperationRosenblattTransformation> opRos(
+        sgpp::op_factory::createOperationRosenblattTransformation(*grid));
+    std::unique_ptr<sgpp::datadriven::OperationInverseRosenblattTransformation> opInvRos(
+        sgpp::op_factory::createOperationInverseRosenblattTransformation(*grid));
+
+    // fixed starting dimensions and mixed ones (numDims)
+    for (size_t dim_start = 0; dim_start <= numDims; dim_start++) {
+      BOOST_TEST_MESSAGE("grid type " << static_cast<int>(grid->getType()) << ", start "
+                                      << dim_start);
+      DataMatrix x_vars(numSamples, numDims);
+      DataMatrix u_result(numSamples, numDims);
+
+      if (dim_start < numDims) {
+        opInvRos->doTransformation(&alpha, &u_vars, &x_vars, dim_start);
+        opRos->doTransformation(&alpha, &x_vars, &u_result, dim_start);
+      } else {
+        opInvRos->doTransformation(&alpha, &u_vars, &x_vars);
+        opRos->doTransformation(&alpha, &x_vars, &u_result);
+      }
+
+      for (size_t isample = 0; isample < numSamples; isample++) {
+        size_t sampleStart = (dim_start < numDims) ? dim_start : mixedStartDims[isample];
+
+        u_vars.getRow(isample, row);
+        sample.setRow(0, row);
+        opInvRos->doTransformation(&alpha, &sample, &sampleResult, sampleStart);
+        for (size_t idim = 0; idim < numDims; idim++) {
+          BOOST_CHECK_EQUAL(sampleResult.get(0, idim), x_vars.get(isample, idim));
+        }
+
+        x_vars.getRow(isample, row);
+        sample.setRow(0, row);
+        opRos->doTransformation(&alpha, &sample, &sampleResult, sampleStart);
+        for (size_t idim = 0; idim < numDims; idim++) {
+          BOOST_CHECK_EQUAL(sampleResult.get(0, idim), u_result.get(isample, idim));
+        }
+      }
+    }
+  }
+
+  // same for the batched 1D transformation
+  std::unique_ptr<Grid> grid1d(Grid::createPolyGrid(1, 3));
+  DataVector alpha1d;
+  hierarchize(grid1d.get(), 4, alpha1d, &parabola);
+  std::unique_ptr<sgpp::datadriven::OperationTransformation1D> opRos1d(
+      sgpp::op_factory::createOperationRosenblattTransformation1D(*grid1d));
+  DataVector coords1d(numSamples);
+  DataVector cdfs1d;
+  u_vars.getColumn(0, coords1d);
+  opRos1d->doTransformation1D(&alpha1d, coords1d, cdfs1d);
+  BOOST_CHECK_EQUAL(cdfs1d.getSize(), numSamples);
+  for (size_t isample = 0; isample < numSamples; isample++) {
+    BOOST_CHECK_EQUAL(cdfs1d[isample], opRos1d->doTransformation1D(&alpha1d, coords1d[isample]));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testRosenblattKDE1D) {
   size_t numDims = 1;
   std::uint32_t numSamples = 100;
@@ -8,6 +8,7 @@
 #include "test_datadrivenCommon.hpp"
 
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalScalapack/OperationMultipleEvalDistributed.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
@@ -193,17 +194,31 @@ double compareVectors(sgpp::base::DataVector& results, sgpp::base::DataVector& r
 
 void compareDatasets(const std::vector<std::tuple<std::string, double>>& fileNamesError,
                      sgpp::base::GridType gridType, size_t level,
-                     sgpp::datadriven::OperationMultipleEvalConfiguration configuration) {
+                     sgpp::datadriven::OperationMultipleEvalConfiguration configuration,
+                     size_t degree) {
   for (std::tuple<std::string, double> fileNameError : fileNamesError) {
-    double mse = compareToReference(gridType, std::get<0>(fileNameError), level, configuration);
+    double mse =
+        compareToReference(gridType, std::get<0>(fileNameError), level, configuration, degree);
     BOOST_CHECK(mse < std::get<1>(fileNameError));
     std::cout << "expected error: " << std::get<1>(fileNameError) << ", observed error:" << mse
               << std::endl;
   }
 }
 
+sgpp::base::OperationMultipleEval* createReferenceEval(sgpp::base::Grid& grid,
+                                                      sgpp::base::DataMatrix& dataset) {
+  // the B-spline grids only provide the naive multi-evaluation
+  if (grid.getType() == sgpp::base::GridType::Bspline ||
+      grid.getType() == sgpp::base::GridType::ModBspline) {
+    return sgpp::op_factory::createOperationMultipleEvalNaive(grid, dataset);
+  }
+
+  return sgpp::op_factory::createOperationMultipleEval(grid, dataset);
+}
+
 double compareToReference(sgpp::base::GridType gridType, const std::string& fileName, size_t level,
-                          sgpp::datadriven::OperationMultipleEvalConfiguration configuration) {
+                          sgpp::datadriven::OperationMultipleEvalConfiguration configuration,
+                          size_t degree) {
   sgpp::base::AdaptivityConfiguration adaptivityConfig;
   adaptivityConfig.maxLevelType_ = false;
   adaptivityConfig.numRefinementPoints_ = 80;
@@ -226,6 +241,14 @@ double compareToReference(sgpp::base::GridType gridType, const std::string& file
     grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(dim));
   } else if (gridType == sgpp::base::GridType::ModLinear) {
     grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModLinearGrid(dim));
+  } else if (gridType == sgpp::base::GridType::Bspline) {
+    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineGrid(dim, degree));
+  } else if (gridType == sgpp::base::GridType::ModBspline) {
+    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModBsplineGrid(dim, degree));
+  } else if (gridType == sgpp::base::GridType::Poly) {
+    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createPolyGrid(dim, degree));
+  } else if (gridType == sgpp::base::GridType::ModPoly) {
+    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModPolyGrid(dim, degree));
   }
 
   sgpp::base::GridStorage& gridStorage = grid->getStorage();
@@ -252,8 +275,8 @@ double compareToReference(sgpp::base::GridType gridType, const std::string& file
 
   eval->mult(alpha, dataSizeVectorResult);
 
-  auto evalCompare = std::shared_ptr<sgpp::base::OperationMultipleEval>(
-      sgpp::op_factory::createOperationMultipleEval(*grid, trainingData));
+  auto evalCompare =
+      std::shared_ptr<sgpp::base::OperationMultipleEval>(createReferenceEval(*grid, trainingData));
 
   sgpp::base::DataVector dataSizeVectorResultCompare(dataset.getNumberInstances());
 
@@ -267,10 +290,11 @@ double compareToReference(sgpp::base::GridType gridType, const std::string& file
 
 void compareDatasetsTranspose(const std::vector<std::tuple<std::string, double>>& fileNamesError,
                               sgpp::base::GridType gridType, size_t level,
-                              sgpp::datadriven::OperationMultipleEvalConfiguration configuration) {
+                              sgpp::datadriven::OperationMultipleEvalConfiguration configuration,
+                              size_t degree) {
   for (std::tuple<std::string, double> fileNameError : fileNamesError) {
-    double mse =
-        compareToReferenceTranspose(gridType, std::get<0>(fileNameError), level, configuration);
+    double mse = compareToReferenceTranspose(gridType, std::get<0>(fileNameError), level,
+                                             configuration, degree);
     BOOST_CHECK(mse < std::get<1>(fileNameError));
     std::cout << "expected error: " << std::get<1>(fileNameError) << ", observed error:" << mse
               << " (transposed)" << std::endl;
@@ -279,7 +303,7 @@ void compareDatasetsTranspose(const std::vector<std::tuple<std::string, double>>
 
 double compareToReferenceTranspose(
     sgpp::base::GridType gridType, const std::string& fileName, size_t level,
-    sgpp::datadriven::OperationMultipleEvalConfiguration configuration) {
+    sgpp::datadriven::OperationMultipleEvalConfiguration configuration, size_t degree) {
   sgpp::base::AdaptivityConfiguration adaptivityConfig;
   adaptivityConfig.maxLevelType_ = false;
   adaptivityConfig.numRefinementPoints_ = 80;
@@ -302,6 +326,14 @@ double compareToReferenceTranspose(
     grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(dim));
   } else if (gridType == sgpp::base::GridType::ModLinear) {
     grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModLinearGrid(dim));
+  } else if (gridType == sgpp::base::GridType::Bspline) {
+    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createBsplineGrid(dim, degree));
+  } else if (gridType == sgpp::base::GridType::ModBspline) {
+    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModBsplineGrid(dim, degree));
+  } else if (gridType == sgpp::base::GridType::Poly) {
+    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createPolyGrid(dim, degree));
+  } else if (gridType == sgpp::base::GridType::ModPoly) {
+    grid = std::shared_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModPolyGrid(dim, degree));
   }
 
   sgpp::base::GridStorage& gridStorage = grid->getStorage();
@@ -329,8 +361,8 @@ double compareToReferenceTranspose(
 
   eval->multTranspose(dataSizeVector, alphaResult);
 
-  auto evalCompare = std::shared_ptr<sgpp::base::OperationMultipleEval>(
-      sgpp::op_factory::createOperationMultipleEval(*grid, trainingData));
+  auto evalCompare =
+      std::shared_ptr<sgpp::base::OperationMultipleEval>(createReferenceEval(*grid, trainingData));
 
   sgpp::base::DataVector alphaResultCompare(gridStorage.getSize());
 
@@ -19,6 +19,7 @@ void omp_set_num_threads(int num_threads);
 
 // ScalarFunction is declared as a shared_ptr in base.i
 // Therefore all its subclasses need to be declared as such too.
+%shared_ptr(sgpp::optimization::CachedScalarFunction)
 %shared_ptr(sgpp::optimization::test_problems::TestScalarFunction)
 %shared_ptr(sgpp::optimization::test_problems::TestVectorFunction)
 %shared_ptr(sgpp::optimization::test_problems::UnconstrainedTestProblem)
@@ -356,6 +357,7 @@ void omp_set_num_threads(int num_threads);
 // includes
 %include "optimization/src/sgpp/optimization/fuzzy/FuzzyInterval.hpp"
 
+%include "optimization/src/sgpp/optimization/function/scalar/CachedScalarFunction.hpp"
 %include "optimization/src/sgpp/optimization/function/scalar/ResponseSurface.hpp"
 %include "optimization/src/sgpp/optimization/function/scalar/SplineResponseSurface.hpp"
 %include "optimization/src/sgpp/optimization/function/vector/ResponseSurfaceVector.hpp"
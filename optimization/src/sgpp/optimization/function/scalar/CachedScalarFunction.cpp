@@ -0,0 +1,371 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/tools/Printer.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/optimization/function/scalar/CachedScalarFunction.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+
+CachedScalarFunction::CachedScalarFunction(base::ScalarFunction& f,
+                                           const std::string& cacheFilename,
+                                           bool parallelBatchEvaluation)
+    : ScalarFunction(f.getNumberOfParameters()),
+      f(&f),
+      cache(std::make_shared<Cache>()),
+      parallelBatchEvaluation(parallelBatchEvaluation) {
+  if (!cacheFilename.empty()) {
+    loadCache(cacheFilename);
+  }
+}
+
+CachedScalarFunction::CachedScalarFunction(std::unique_ptr<base::ScalarFunction>&& f,
+                                           std::shared_ptr<Cache> cache,
+                                           bool parallelBatchEvaluation)
+    : ScalarFunction(f->getNumberOfParameters()),
+      f(f.get()),
+      ownedF(std::move(f)),
+      cache(cache),
+      parallelBatchEvaluation(parallelBatchEvaluation) {}
+
+CachedScalarFunction::~CachedScalarFunction() {}
+
+double CachedScalarFunction::eval(const base::DataVector& x) {
+  const std::vector<double> key(x);
+
+  cache->mutex.lock();
+  auto it = cache->values.find(key);
+
+  if (it != cache->values.end()) {
+    const double fx = it->second;
+    cache->numberOfCacheHits++;
+    cache->mutex.unlock();
+    return fx;
+  }
+
+  cache->mutex.unlock();
+  return evalAndStore(*f, x, key);
+}
+
+void CachedScalarFunction::eval(const base::DataMatrix& x, base::DataVector& value) {
+  const size_t N = x.getNrows();
+  value.resize(N);
+
+  // look up the cached points and collect the distinct points that have to be evaluated
+  std::vector<std::vector<double>> keys(N, std::vector<double>(d));
+  std::vector<size_t> pointsToEvaluate;
+  std::vector<size_t> duplicatePoints;
+  std::map<std::vector<double>, size_t> pointIndices;
+
+  cache->mutex.lock();
+
+  for (size_t k = 0; k < N; k++) {
+    x.getRow(k, keys[k]);
+    auto it = cache->values.find(keys[k]);
+
+    if (it != cache->values.end()) {
+      value[k] = it->second;
+      cache->numberOfCacheHits++;
+    } else if (pointIndices.insert(std::make_pair(keys[k], k)).second) {
+      pointsToEvaluate.push_back(k);
+    } else {
+      duplicatePoints.push_back(k);
+    }
+  }
+
+  cache->numberOfPendingEvaluations = pointsToEvaluate.size();
+  cache->mutex.unlock();
+
+  if (pointsToEvaluate.empty()) {
+    return;
+  }
+
+  const size_t numberOfPointsToEvaluate = pointsToEvaluate.size();
+  base::Printer::getInstance().printStatusBegin("Evaluating " +
+                                                std::to_string(numberOfPointsToEvaluate) +
+                                                " points...");
+  base::SGppStopwatch stopwatch;
+  stopwatch.start();
+
+  // clone the function for every additional thread before entering the parallel region,
+  // functions that cannot be cloned (e.g., implemented in Python) are evaluated serially
+  size_t numberOfThreads = 1;
+  std::vector<std::unique_ptr<base::ScalarFunction>> clones;
+#ifdef _OPENMP
+
+  if (parallelBatchEvaluation) {
+    numberOfThreads = std::min(static_cast<size_t>(omp_get_max_threads()),
+                               numberOfPointsToEvaluate);
+  }
+
+  if (numberOfThreads > 1) {
+    try {
+      clones.resize(numberOfThreads - 1);
+
+      for (std::unique_ptr<base::ScalarFunction>& clone : clones) {
+        f->clone(clone);
+
+        if (clone == nullptr) {
+          throw std::runtime_error("CachedScalarFunction: clone failed");
+        }
+      }
+    } catch (...) {
+      clones.clear();
+      numberOfThreads = 1;
+    }
+  }
+
+#endif /* _OPENMP */
+
+  // exceptions must not leave the parallel region, the first one is rethrown afterwards
+  std::exception_ptr exception;
+  std::atomic<bool> failed(false);
+
+#pragma omp parallel num_threads(static_cast<int>(numberOfThreads)) if (numberOfThreads > 1) \
+    shared(x, value, keys, pointsToEvaluate, clones, exception, failed)
+  {
+    base::DataVector xk(d);
+    base::ScalarFunction* curFPtr = f;
+#ifdef _OPENMP
+    const size_t threadIndex = static_cast<size_t>(omp_get_thread_num());
+
+    if (threadIndex > 0) {
+      curFPtr = clones[threadIndex - 1].get();
+    }
+
+#endif /* _OPENMP */
+
+    // evaluations may take very different amounts of time
+#pragma omp for schedule(dynamic, 1)
+
+    for (size_t j = 0; j < numberOfPointsToEvaluate; j++) {
+      if (failed) {
+        continue;
+      }
+
+      try {
+        const size_t k = pointsToEvaluate[j];
+        x.getRow(k, xk);
+        value[k] = evalAndStore(*curFPtr, xk, keys[k]);
+
+        cache->mutex.lock();
+        const size_t numberOfFinishedEvaluations =
+            numberOfPointsToEvaluate - cache->numberOfPendingEvaluations;
+        cache->mutex.unlock();
+
+        char str[10];
+        snprintf(str, sizeof(str), "%.1f%%",
+                 static_cast<double>(numberOfFinishedEvaluations) /
+                     static_cast<double>(numberOfPointsToEvaluate) * 100.0);
+        base::Printer::getInstance().printStatusUpdate(
+            std::string(str) + " (" + std::to_string(numberOfFinishedEvaluations) + " of " +
+            std::to_string(numberOfPointsToEvaluate) + " points)");
+      } catch (...) {
+#pragma omp critical(CachedScalarFunctionException)
+        {
+          if (!failed) {
+            exception = std::current_exception();
+            failed = true;
+          }
+        }
+      }
+    }
+  }
+
+  if (failed) {
+    cache->mutex.lock();
+    cache->numberOfPendingEvaluations = 0;
+    cache->mutex.unlock();
+    base::Printer::getInstance().printStatusEnd();
+    std::rethrow_exception(exception);
+  }
+
+  const double elapsedTime = stopwatch.stop();
+
+  for (size_t k : duplicatePoints) {
+    value[k] = value[pointIndices[keys[k]]];
+  }
+
+  cache->mutex.lock();
+  cache->numberOfCacheHits += duplicatePoints.size();
+  cache->numberOfBatchEvaluations += numberOfPointsToEvaluate;
+  cache->batchTime += elapsedTime;
+  cache->mutex.unlock();
+
+  base::Printer::getInstance().printStatusEnd();
+}
+
+void CachedScalarFunction::clone(std::unique_ptr<base::ScalarFunction>& clone) const {
+  std::unique_ptr<base::ScalarFunction> fClone;
+  f->clone(fClone);
+  clone = std::unique_ptr<base::ScalarFunction>(
+      new CachedScalarFunction(std::move(fClone), cache, parallelBatchEvaluation));
+}
+
+void CachedScalarFunction::setParallelBatchEvaluation(bool parallelBatchEvaluation) {
+  this->parallelBatchEvaluation = parallelBatchEvaluation;
+}
+
+bool CachedScalarFunction::isParallelBatchEvaluation() const { return parallelBatchEvaluation; }
+
+bool CachedScalarFunction::isCached(const base::DataVector& x) const {
+  cache->mutex.lock();
+  const bool result = (cache->values.find(x) != cache->values.end());
+  cache->mutex.unlock();
+  return result;
+}
+
+size_t CachedScalarFunction::getNumberOfCachedPoints() const {
+  cache->mutex.lock();
+  const size_t result = cache->values.size();
+  cache->mutex.unlock();
+  return result;
+}
+
+size_t CachedScalarFunction::getNumberOfEvaluations() const {
+  cache->mutex.lock();
+  const size_t result = cache->numberOfEvaluations;
+  cache->mutex.unlock();
+  return result;
+}
+
+size_t CachedScalarFunction::getNumberOfCacheHits() const {
+  cache->mutex.lock();
+  const size_t result = cache->numberOfCacheHits;
+  cache->mutex.unlock();
+  return result;
+}
+
+size_t CachedScalarFunction::getNumberOfPendingEvaluations() const {
+  cache->mutex.lock();
+  const size_t result = cache->numberOfPendingEvaluations;
+  cache->mutex.unlock();
+  return result;
+}
+
+double CachedScalarFunction::getEvaluationTime() const {
+  cache->mutex.lock();
+  const double result = cache->evaluationTime;
+  cache->mutex.unlock();
+  return result;
+}
+
+double CachedScalarFunction::getThroughput() const {
+  cache->mutex.lock();
+  const double result =
+      ((cache->batchTime > 0.0)
+           ? static_cast<double>(cache->numberOfBatchEvaluations) / cache->batchTime
+           : 0.0);
+  cache->mutex.unlock();
+  return result;
+}
+
+void CachedScalarFunction::resetCounters() {
+  cache->mutex.lock();
+  cache->numberOfEvaluations = 0;
+  cache->numberOfCacheHits = 0;
+  cache->evaluationTime = 0.0;
+  cache->numberOfBatchEvaluations = 0;
+  cache->batchTime = 0.0;
+  cache->mutex.unlock();
+}
+
+void CachedScalarFunction::loadCache(const std::string& cacheFilename) {
+  std::ifstream inputFile(cacheFilename);
+  std::string line;
+  std::vector<double> key(d);
+
+  while (std::getline(inputFile, line)) {
+    if (line.empty()) {
+      continue;
+    }
+
+    // strtod parses the hexadecimal floating-point numbers written by evalAndStore
+    const char* begin = line.c_str();
+    char* end;
+
+    for (size_t t = 0; t < d; t++) {
+      key[t] = std::strtod(begin, &end);
+
+      if (end == begin) {
+        throw base::file_exception(
+            "CachedScalarFunction: cache file does not match the dimension of the function");
+      }
+
+      begin = end;
+    }
+
+    const double fx = std::strtod(begin, &end);
+
+    if (end == begin) {
+      throw base::file_exception(
+          "CachedScalarFunction: cache file does not match the dimension of the function");
+    }
+
+    cache->values[key] = fx;
+  }
+
+  cache->file.open(cacheFilename, std::ios::app);
+
+  if (!cache->file.is_open()) {
+    throw base::file_exception("CachedScalarFunction: could not open cache file");
+  }
+}
+
+double CachedScalarFunction::evalAndStore(base::ScalarFunction& g, const base::DataVector& x,
+                                          const std::vector<double>& key) {
+  base::SGppStopwatch stopwatch;
+  stopwatch.start();
+  const double fx = g.eval(x);
+  const double elapsedTime = stopwatch.stop();
+
+  cache->mutex.lock();
+  cache->values[key] = fx;
+  cache->numberOfEvaluations++;
+  cache->evaluationTime += elapsedTime;
+
+  if (cache->numberOfPendingEvaluations > 0) {
+    cache->numberOfPendingEvaluations--;
+  }
+
+  if (cache->file.is_open()) {
+    std::ostringstream entry;
+    char str[32];
+
+    for (size_t t = 0; t < d; t++) {
+      snprintf(str, sizeof(str), "%a ", key[t]);
+      entry << str;
+    }
+
+    snprintf(str, sizeof(str), "%a\n", fx);
+    entry << str;
+    // flush after every value, the values are expensive and should survive crashes
+    cache->file << entry.str() << std::flush;
+  }
+
+  cache->mutex.unlock();
+  return fx;
+}
+
+}  // namespace optimization
+}  // namespace sgpp
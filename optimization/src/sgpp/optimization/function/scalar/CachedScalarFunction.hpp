@@ -0,0 +1,209 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/function/scalar/ScalarFunction.hpp>
+#include <sgpp/base/tools/MutexType.hpp>
+
+#include <cstddef>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+
+/**
+ * Evaluation service for expensive black-box functions (e.g., simulations) used to construct
+ * surrogates. The values of the wrapped function are memoised by the exact coordinates of the
+ * evaluation points, such that every point is evaluated at most once, even across refinements
+ * and rebuilds of the surrogate. Optionally, the values are appended to a cache file, which is
+ * read again on construction, such that the cache survives process restarts.
+ *
+ * Batches of points (eval() with a matrix) can be evaluated in parallel with OpenMP
+ * (see setParallelBatchEvaluation()), where every thread evaluates a clone of the wrapped
+ * function. This is disabled by default, as the wrapped function has to support clone() and
+ * concurrent evaluations of its clones, which is not the case for functions implemented in Python.
+ * The clones of a CachedScalarFunction share the cache and the counters with the original
+ * object, hence it can also be passed to parallel grid generators
+ * (e.g., IterativeGridGeneratorRitterNovak).
+ *
+ * The cache file contains one line per evaluated point with the coordinates and the
+ * function value as hexadecimal floating-point numbers, i.e., without loss of precision.
+ */
+class CachedScalarFunction : public base::ScalarFunction {
+ public:
+  /**
+   * Constructor.
+   * Do not destruct the wrapped function before this object and its clones.
+   *
+   * @param f                         function to be evaluated
+   * @param cacheFilename             file to read cached values from and to append new values to
+   *                                  (empty string for an in-memory cache only)
+   * @param parallelBatchEvaluation   whether batches are evaluated in parallel
+   *                                  (see setParallelBatchEvaluation())
+   */
+  explicit CachedScalarFunction(base::ScalarFunction& f, const std::string& cacheFilename = "",
+                                bool parallelBatchEvaluation = false);
+
+  /**
+   * Destructor.
+   */
+  ~CachedScalarFunction() override;
+
+  /**
+   * Return the cached value if \f$\vec{x}\f$ has been evaluated before,
+   * otherwise evaluate the wrapped function and cache the value.
+   * This method is thread-safe if called on different clones.
+   *
+   * @param x     evaluation point \f$\vec{x} \in [0, 1]^d\f$
+   * @return      \f$f(\vec{x})\f$
+   */
+  double eval(const base::DataVector& x) override;
+
+  /**
+   * Evaluate a batch of points. The points that are not cached yet (duplicates are evaluated
+   * only once) are evaluated in parallel with dynamic scheduling if enabled, otherwise serially.
+   * Exceptions thrown by the wrapped function are passed on after all threads have finished.
+   *
+   * @param      x      matrix \f$\vec{x} \in [0, 1]^{N \times d}\f$
+   *                    of evaluation points (row-wise)
+   * @param[out] value  \f$(f(\vec{x}_k))_k\f$
+   *                    where \f$\vec{x}_k\f$ is the \f$k\f$-th row of \f$x\f$
+   */
+  void eval(const base::DataMatrix& x, base::DataVector& value) override;
+
+  /**
+   * @param[out] clone pointer to cloned object (sharing the cache with this object)
+   */
+  void clone(std::unique_ptr<base::ScalarFunction>& clone) const override;
+
+  /**
+   * Enable or disable the parallel evaluation of batches. If enabled and more than one OpenMP
+   * thread is available, every additional thread evaluates a clone of the wrapped function.
+   * If the wrapped function cannot be cloned, the batch is evaluated serially.
+   * Do not enable this for functions implemented in Python.
+   *
+   * @param parallelBatchEvaluation   whether batches are evaluated in parallel
+   */
+  void setParallelBatchEvaluation(bool parallelBatchEvaluation);
+
+  /**
+   * @return whether batches are evaluated in parallel
+   */
+  bool isParallelBatchEvaluation() const;
+
+  /**
+   * @param x     point \f$\vec{x} \in [0, 1]^d\f$
+   * @return      whether \f$f(\vec{x})\f$ is cached
+   */
+  bool isCached(const base::DataVector& x) const;
+
+  /**
+   * @return number of cached points
+   */
+  size_t getNumberOfCachedPoints() const;
+
+  /**
+   * @return number of evaluations of the wrapped function
+   */
+  size_t getNumberOfEvaluations() const;
+
+  /**
+   * @return number of evaluations that have been answered from the cache
+   */
+  size_t getNumberOfCacheHits() const;
+
+  /**
+   * @return number of evaluations of the current batch that have not finished yet
+   *         (can be queried from another thread to monitor the progress)
+   */
+  size_t getNumberOfPendingEvaluations() const;
+
+  /**
+   * @return total time spent in the wrapped function in seconds (summed up over all threads)
+   */
+  double getEvaluationTime() const;
+
+  /**
+   * @return number of evaluations of the wrapped function per second of wall-clock time
+   *         of all batch evaluations so far (zero if no batch has been evaluated)
+   */
+  double getThroughput() const;
+
+  /**
+   * Reset the counters (the cached values are kept).
+   */
+  void resetCounters();
+
+ protected:
+  /// cached values and counters, shared by all clones
+  struct Cache {
+    /// function values keyed by the coordinates of the points
+    std::map<std::vector<double>, double> values;
+    /// file to which new values are appended (not open if there is no cache file)
+    std::ofstream file;
+    /// number of evaluations of the wrapped function
+    size_t numberOfEvaluations = 0;
+    /// number of cache hits
+    size_t numberOfCacheHits = 0;
+    /// number of pending evaluations of the current batch
+    size_t numberOfPendingEvaluations = 0;
+    /// time spent in the wrapped function
+    double evaluationTime = 0.0;
+    /// number of evaluations of the wrapped function during batch evaluations
+    size_t numberOfBatchEvaluations = 0;
+    /// wall-clock time of batch evaluations
+    double batchTime = 0.0;
+    /// mutex protecting the values, the file and the counters
+    mutable base::MutexType mutex;
+  };
+
+  /**
+   * Constructor for clones.
+   *
+   * @param f                         clone of the wrapped function (owned by the new object)
+   * @param cache                     cache shared with the original object
+   * @param parallelBatchEvaluation   whether batches are evaluated in parallel
+   */
+  CachedScalarFunction(std::unique_ptr<base::ScalarFunction>&& f, std::shared_ptr<Cache> cache,
+                       bool parallelBatchEvaluation);
+
+  /**
+   * Read the values from the cache file (if it exists) and open it for appending.
+   *
+   * @param cacheFilename   cache file
+   */
+  void loadCache(const std::string& cacheFilename);
+
+  /**
+   * Evaluate the wrapped function (or a clone of it), measure the time and store the value.
+   *
+   * @param g     function to be evaluated
+   * @param x     evaluation point
+   * @param key   coordinates of the evaluation point
+   * @return      \f$f(\vec{x})\f$
+   */
+  double evalAndStore(base::ScalarFunction& g, const base::DataVector& x,
+                      const std::vector<double>& key);
+
+  /// wrapped function
+  base::ScalarFunction* f;
+  /// wrapped function if owned by this object (for clones)
+  std::unique_ptr<base::ScalarFunction> ownedF;
+  /// cache (shared with all clones)
+  std::shared_ptr<Cache> cache;
+  /// whether batches are evaluated in parallel
+  bool parallelBatchEvaluation;
+};
+
+}  // namespace optimization
+}  // namespace sgpp
@@ -88,7 +88,8 @@ void SplineResponseSurface::ritterNovak(size_t maxNumGridPoints, double gamma, s
                                         bool verbose) {
   // this uses the default values for Ritter Novaks initial Level, max level, powerMethod
   sgpp::optimization::IterativeGridGeneratorRitterNovak gridGen(
-      *objectiveFunc, *grid, maxNumGridPoints, gamma, static_cast<base::level_t>(initialLevel));
+      *cachedObjectiveFunc, *grid, maxNumGridPoints, gamma,
+      static_cast<base::level_t>(initialLevel));
   if (!gridGen.generate()) {
     std::cout << "Grid generation failed, exiting.\n";
   }
@@ -178,18 +179,24 @@ sgpp::base::DataVector SplineResponseSurface::optimize() {
 
 // ----------------- auxiliary routines -----------
 
+void SplineResponseSurface::initializeObjectiveFunctionCache() {
+  cachedObjectiveFunc = std::dynamic_pointer_cast<CachedScalarFunction>(objectiveFunc);
+  if (cachedObjectiveFunc == nullptr) {
+    cachedObjectiveFunc = std::make_shared<CachedScalarFunction>(*objectiveFunc);
+  }
+}
+
 void SplineResponseSurface::calculateInterpolationCoefficients() {
   sgpp::base::GridStorage& gridStorage = grid->getStorage();
-  functionValues.resizeZero(gridStorage.getSize());
+  sgpp::base::DataMatrix points(gridStorage.getSize(), numDim);
   for (size_t i = 0; i < gridStorage.getSize(); i++) {
-    // sgpp::base::DataVector p(gridStorage.getDimension(), 0.0);
-    // for (size_t d = 0; d < gridStorage.getDimension(); d++) {
-    //   p[d] = gridStorage.getPointCoordinate(i, d);
-    // }
     sgpp::base::DataVector p = gridStorage.getPointCoordinates(i);
     transformPoint(p, unitLBounds, unitUBounds, lb, ub);
-    functionValues[i] = objectiveFunc->eval(p);
+    points.setRow(i, p);
   }
+  // only the points that have not been evaluated before are evaluated (in parallel if enabled
+  // for the cache, see CachedScalarFunction::setParallelBatchEvaluation)
+  cachedObjectiveFunc->eval(points, functionValues);
 
   if ((gridType == sgpp::base::GridType::PolyBoundary) ||
       (gridType == sgpp::base::GridType::ModPoly)) {
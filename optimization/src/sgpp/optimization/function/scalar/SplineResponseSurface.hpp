@@ -33,6 +33,7 @@
 #include <sgpp/base/tools/sle/solver/GaussianElimination.hpp>
 #include <sgpp/base/tools/sle/solver/SLESolver.hpp>
 #include <sgpp/base/tools/sle/system/HierarchisationSLE.hpp>
+#include <sgpp/optimization/function/scalar/CachedScalarFunction.hpp>
 #include <sgpp/optimization/function/scalar/ResponseSurface.hpp>
 #include <sgpp/optimization/gridgen/IterativeGridGeneratorRitterNovak.hpp>
 #include <sgpp/optimization/optimizer/unconstrained/AdaptiveGradientDescent.hpp>
@@ -71,6 +72,7 @@ class SplineResponseSurface : public ResponseSurface {
         gridType(gridType)
         // degree(degree) 
         {
+    initializeObjectiveFunctionCache();
     this->lb = lb;
     this->ub = ub;
     // dummy values for mean and variance
@@ -161,6 +163,7 @@ class SplineResponseSurface : public ResponseSurface {
         objectiveFunc(objectiveFunc),
         // degree(degree),
         grid(grid) {
+    initializeObjectiveFunctionCache();
     this->lb = lb;
     this->ub = ub;
     // dummy values for mean and variance
@@ -420,6 +423,13 @@ class SplineResponseSurface : public ResponseSurface {
    */
   size_t getSize() { return grid->getSize(); }
 
+  /**
+   * @return the evaluation cache of the objective function, which contains its values in the
+   *         grid points and counters for the number of evaluations (null if this response surface
+   *         has been constructed without objective function)
+   */
+  std::shared_ptr<CachedScalarFunction> getObjectiveFunctionCache() { return cachedObjectiveFunc; }
+
   /**
    * @return the lower bounds of the domain
    */
@@ -433,6 +443,8 @@ class SplineResponseSurface : public ResponseSurface {
  private:
   // objective function
   std::shared_ptr<sgpp::base::ScalarFunction> objectiveFunc;
+  // objective function with memoised values, evaluates new grid points as one batch
+  std::shared_ptr<CachedScalarFunction> cachedObjectiveFunc;
   // type of grid/basis
   sgpp::base::GridType gridType;
   // degree of the basis
@@ -459,6 +471,12 @@ class SplineResponseSurface : public ResponseSurface {
   sgpp::base::DataVector unitLBounds;
   sgpp::base::DataVector unitUBounds;
 
+  /**
+   * wraps the objective function in a cache (unless it already is a CachedScalarFunction), such
+   * that grid points are not evaluated again when refining or rebuilding the response surface
+   */
+  void initializeObjectiveFunctionCache();
+
   /**
    * calculates the interpolation coefficients on a given grid
    */
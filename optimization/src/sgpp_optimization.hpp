@@ -120,6 +120,7 @@
 #include <sgpp/optimization/tools/FileIO.hpp>
 #include <sgpp/optimization/tools/Math.hpp>
 
+#include <sgpp/optimization/function/scalar/CachedScalarFunction.hpp>
 #include <sgpp/optimization/function/scalar/ResponseSurface.hpp>
 #include <sgpp/optimization/function/scalar/SplineResponseSurface.hpp>
 #include <sgpp/optimization/function/vector/ResponseSurfaceVector.hpp>
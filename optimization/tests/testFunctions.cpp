@@ -17,8 +17,12 @@
 #include <sgpp/base/function/vector/WrapperVectorFunctionHessian.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/RandomNumberGenerator.hpp>
+#include <sgpp/optimization/function/scalar/CachedScalarFunction.hpp>
 
+#include <cstdio>
 #include <limits>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "CheckEqualFunction.hpp"
@@ -41,6 +45,7 @@ using sgpp::base::WrapperScalarFunctionHessian;
 using sgpp::base::WrapperVectorFunction;
 using sgpp::base::WrapperVectorFunctionGradient;
 using sgpp::base::WrapperVectorFunctionHessian;
+using sgpp::optimization::CachedScalarFunction;
 
 class ScalarTestFunction : public ScalarFunction {
  public:
@@ -55,6 +60,33 @@ class ScalarTestFunction : public ScalarFunction {
   }
 };
 
+// like Python functions, which do not implement clone()
+class UncloneableScalarTestFunction : public ScalarTestFunction {
+ public:
+  explicit UncloneableScalarTestFunction(size_t d) : ScalarTestFunction(d) {}
+
+  void clone(std::unique_ptr<ScalarFunction>& clone) const override {
+    throw std::runtime_error("clone is not implemented");
+  }
+};
+
+class ThrowingScalarTestFunction : public ScalarTestFunction {
+ public:
+  explicit ThrowingScalarTestFunction(size_t d) : ScalarTestFunction(d) {}
+
+  double eval(const DataVector& x) override {
+    if (x[0] > 0.5) {
+      throw std::runtime_error("evaluation failed");
+    }
+
+    return x.sum();
+  }
+
+  void clone(std::unique_ptr<ScalarFunction>& clone) const override {
+    clone = std::unique_ptr<ScalarFunction>(new ThrowingScalarTestFunction(*this));
+  }
+};
+
 class ScalarTestGradient : public ScalarFunctionGradient {
  public:
   explicit ScalarTestGradient(size_t d) : ScalarFunctionGradient(d) {}
@@ -332,6 +364,108 @@ BOOST_AUTO_TEST_CASE(TestWrapperScalarFunction) {
   checkEqualFunction(f1, *f2Clone);
 }
 
+BOOST_AUTO_TEST_CASE(TestCachedScalarFunction) {
+  // Test sgpp::optimization::CachedScalarFunction.
+  const size_t d = 3;
+  const size_t N = 20;
+  const size_t numberOfDuplicates = 5;
+  const std::string cacheFilename = "testCachedScalarFunction.cache";
+  std::remove(cacheFilename.c_str());
+  ScalarTestFunction f(d);
+
+  {
+    CachedScalarFunction cachedF(f);
+    checkEqualFunction(f, cachedF);
+  }
+
+  RandomNumberGenerator::getInstance().setSeed(1);
+
+  // the last rows are duplicates of the first rows
+  DataMatrix x(N + numberOfDuplicates, d);
+  DataVector xk(d);
+
+  for (size_t k = 0; k < N + numberOfDuplicates; k++) {
+    if (k < N) {
+      RandomNumberGenerator::getInstance().getUniformRV(xk);
+    } else {
+      x.getRow(k - N, xk);
+    }
+
+    x.setRow(k, xk);
+  }
+
+  DataVector fx(N + numberOfDuplicates);
+
+  {
+    CachedScalarFunction cachedF(f, cacheFilename);
+    cachedF.eval(x, fx);
+
+    for (size_t k = 0; k < N + numberOfDuplicates; k++) {
+      x.getRow(k, xk);
+      BOOST_CHECK_EQUAL(fx[k], f.eval(xk));
+      BOOST_CHECK(cachedF.isCached(xk));
+    }
+
+    BOOST_CHECK_EQUAL(cachedF.getNumberOfEvaluations(), N);
+    BOOST_CHECK_EQUAL(cachedF.getNumberOfCacheHits(), numberOfDuplicates);
+    BOOST_CHECK_EQUAL(cachedF.getNumberOfPendingEvaluations(), 0U);
+    BOOST_CHECK_GE(cachedF.getEvaluationTime(), 0.0);
+    BOOST_CHECK_GE(cachedF.getThroughput(), 0.0);
+
+    // clones share the cache
+    std::unique_ptr<ScalarFunction> cachedFClone;
+    cachedF.clone(cachedFClone);
+    x.getRow(0, xk);
+    BOOST_CHECK_EQUAL(cachedFClone->eval(xk), fx[0]);
+    BOOST_CHECK_EQUAL(cachedF.getNumberOfEvaluations(), N);
+    BOOST_CHECK_EQUAL(cachedF.getNumberOfCacheHits(), numberOfDuplicates + 1);
+  }
+
+  {
+    // the values are read exactly from the cache file
+    CachedScalarFunction cachedF(f, cacheFilename);
+    BOOST_CHECK_EQUAL(cachedF.getNumberOfCachedPoints(), N);
+    DataVector fx2;
+    cachedF.eval(x, fx2);
+    BOOST_CHECK_EQUAL(cachedF.getNumberOfEvaluations(), 0U);
+
+    for (size_t k = 0; k < N + numberOfDuplicates; k++) {
+      BOOST_CHECK_EQUAL(fx2[k], fx[k]);
+    }
+  }
+
+  std::remove(cacheFilename.c_str());
+
+  {
+    // parallel batch evaluation, falls back to serial evaluation if the function cannot be cloned
+    UncloneableScalarTestFunction uncloneableF(d);
+
+    for (ScalarFunction* g : std::vector<ScalarFunction*>{&f, &uncloneableF}) {
+      CachedScalarFunction cachedF(*g, "", true);
+      BOOST_CHECK(cachedF.isParallelBatchEvaluation());
+      DataVector fx2;
+      cachedF.eval(x, fx2);
+      BOOST_CHECK_EQUAL(cachedF.getNumberOfEvaluations(), N);
+
+      for (size_t k = 0; k < N + numberOfDuplicates; k++) {
+        BOOST_CHECK_EQUAL(fx2[k], fx[k]);
+      }
+    }
+  }
+
+  {
+    // exceptions of the wrapped function are passed on after the parallel evaluation
+    ThrowingScalarTestFunction throwingF(d);
+    CachedScalarFunction cachedF(throwingF, "", true);
+    DataVector fx2;
+    BOOST_CHECK_THROW(cachedF.eval(x, fx2), std::runtime_error);
+    BOOST_CHECK_EQUAL(cachedF.getNumberOfPendingEvaluations(), 0U);
+
+    cachedF.setParallelBatchEvaluation(false);
+    BOOST_CHECK_THROW(cachedF.eval(x, fx2), std::runtime_error);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(TestWrapperScalarFunctionGradient) {
   // Test sgpp::optimization::TestWrapperScalarFunctionGradient.
   const size_t d = 3;
@@ -0,0 +1,71 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationHierarchisation.hpp>
+#include <sgpp/base/tools/Benchmark.hpp>
+#include <sgpp/pde/algorithm/HeatEquationParabolicPDESolverSystem.hpp>
+#include <sgpp/solver/ode/CrankNicolson.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+#include <string>
+
+using sgpp::base::BenchmarkState;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+
+namespace {
+
+/// macro benchmark: Crank-Nicolson time stepping of the heat equation with Dirichlet boundaries
+void benchmarkHeatEquationCrankNicolson(BenchmarkState& state) {
+  const size_t dim = static_cast<size_t>(state.range(0));
+  const size_t numberOfTimesteps = 10;
+  const double timestepSize = 0.001;
+  std::unique_ptr<Grid> grid(Grid::createLinearBoundaryGrid(dim));
+  grid->getGenerator().regular(static_cast<size_t>(state.range(1)));
+  sgpp::base::GridStorage& storage = grid->getStorage();
+
+  DataVector initialAlpha(grid->getSize());
+
+  for (size_t i = 0; i < storage.getSize(); i++) {
+    initialAlpha[i] = 1.0;
+
+    for (size_t t = 0; t < dim; t++) {
+      initialAlpha[i] *= std::sin(M_PI * storage.getPointCoordinate(i, t)) + 0.5;
+    }
+  }
+
+  std::unique_ptr<sgpp::base::OperationHierarchisation>(
+      sgpp::op_factory::createOperationHierarchisation(*grid))
+      ->doHierarchisation(initialAlpha);
+  size_t iterations = 0;
+
+  while (state.keepRunning()) {
+    DataVector alpha(initialAlpha);
+    sgpp::pde::HeatEquationParabolicPDESolverSystem system(*grid, alpha, 1.0, timestepSize,
+                                                           "CrNic");
+    sgpp::solver::CrankNicolson crankNicolson(numberOfTimesteps, timestepSize);
+    sgpp::solver::ConjugateGradients cg(1000, 1e-8);
+    crankNicolson.solve(cg, system, true, false);
+    iterations = crankNicolson.getNumberIterations();
+  }
+
+  state.setItemsProcessed(numberOfTimesteps * state.getMaxIterations());
+  state.setLabel("N=" + std::to_string(grid->getSize()) +
+                 " cgIterations=" + std::to_string(iterations));
+}
+
+}  // namespace
+
+SGPP_BENCHMARK(benchmarkHeatEquationCrankNicolson)
+    ->argNames({"dim", "level"})
+    ->args({2, 6})
+    ->args({3, 5});
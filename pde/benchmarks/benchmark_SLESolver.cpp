@@ -0,0 +1,112 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/tools/Benchmark.hpp>
+#include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/pde/operation/hash/OperationMultilevelPreconditionerLinear.hpp>
+#include <sgpp/solver/sle/BiCGStab.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+#include <string>
+
+using sgpp::base::BenchmarkState;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+
+namespace {
+
+enum class SLESolverType { CG, BiCGStab, PCG };
+
+void benchmarkLaplaceSLESolver(BenchmarkState& state, SLESolverType solverType) {
+  const double epsilon = 1e-8;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(static_cast<size_t>(state.range(0))));
+  grid->getGenerator().regular(static_cast<size_t>(state.range(1)));
+  const size_t gridSize = grid->getSize();
+
+  std::unique_ptr<sgpp::base::OperationMatrix> opLaplace(
+      sgpp::op_factory::createOperationLaplace(*grid));
+  sgpp::pde::OperationMultilevelPreconditionerLinear preconditioner(&grid->getStorage());
+  std::unique_ptr<sgpp::solver::SLESolver> solver;
+
+  if (solverType == SLESolverType::CG) {
+    solver.reset(new sgpp::solver::ConjugateGradients(10000, epsilon));
+  } else if (solverType == SLESolverType::BiCGStab) {
+    solver.reset(new sgpp::solver::BiCGStab(10000, epsilon));
+  } else {
+    solver.reset(new sgpp::solver::PreconditionedConjugateGradients(10000, epsilon,
+                                                                    preconditioner));
+  }
+
+  DataVector b(gridSize);
+
+  for (size_t i = 0; i < gridSize; i++) {
+    b[i] = std::sin(static_cast<double>(i));
+  }
+
+  DataVector alpha(gridSize);
+
+  while (state.keepRunning()) {
+    alpha.setAll(0.0);
+    solver->solve(*opLaplace, alpha, b, false, false);
+  }
+
+  state.setItemsProcessed(solver->getNumberIterations() * state.getMaxIterations());
+  state.setLabel("N=" + std::to_string(gridSize) +
+                 " iterations=" + std::to_string(solver->getNumberIterations()));
+}
+
+void benchmarkOperationMatrix(BenchmarkState& state, const std::string& operation) {
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(static_cast<size_t>(state.range(0))));
+  grid->getGenerator().regular(static_cast<size_t>(state.range(1)));
+  const size_t gridSize = grid->getSize();
+  std::unique_ptr<sgpp::base::OperationMatrix> op(
+      (operation == "laplace") ? sgpp::op_factory::createOperationLaplace(*grid)
+                               : sgpp::op_factory::createOperationLTwoDotProduct(*grid));
+  DataVector alpha(gridSize);
+  DataVector result(gridSize);
+
+  for (size_t i = 0; i < gridSize; i++) {
+    alpha[i] = std::sin(static_cast<double>(i));
+  }
+
+  while (state.keepRunning()) {
+    op->mult(alpha, result);
+  }
+
+  state.setItemsProcessed(gridSize * state.getMaxIterations());
+  state.setLabel("N=" + std::to_string(gridSize));
+}
+
+}  // namespace
+
+SGPP_BENCHMARK_CAPTURE(benchmarkLaplaceSLESolver, cg, SLESolverType::CG)
+    ->argNames({"dim", "level"})
+    ->args({2, 8})
+    ->args({4, 6});
+SGPP_BENCHMARK_CAPTURE(benchmarkLaplaceSLESolver, bicgstab, SLESolverType::BiCGStab)
+    ->argNames({"dim", "level"})
+    ->args({2, 8})
+    ->args({4, 6});
+SGPP_BENCHMARK_CAPTURE(benchmarkLaplaceSLESolver, pcgMultilevel, SLESolverType::PCG)
+    ->argNames({"dim", "level"})
+    ->args({2, 8})
+    ->args({4, 6});
+
+SGPP_BENCHMARK_CAPTURE(benchmarkOperationMatrix, laplace, "laplace")
+    ->argNames({"dim", "level"})
+    ->args({2, 10})
+    ->args({5, 6});
+SGPP_BENCHMARK_CAPTURE(benchmarkOperationMatrix, ltwodotproduct, "ltwodotproduct")
+    ->argNames({"dim", "level"})
+    ->args({2, 10})
+    ->args({5, 6});
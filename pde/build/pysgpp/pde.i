@@ -18,6 +18,7 @@
 %shared_ptr(sgpp::pde::OperationLaplacePrewavelet)
 %shared_ptr(sgpp::pde::OperationLaplaceLinearStretched)
 %shared_ptr(sgpp::pde::OperationLaplaceLinearStretchedBoundary)
+%shared_ptr(sgpp::pde::OperationMultilevelPreconditionerLinear)
 
 // The Good, i.e. without any modifications
 %include "solver/src/sgpp/solver/operation/hash/OperationParabolicPDESolverSystem.hpp"
@@ -38,6 +39,7 @@
 %include "pde/src/sgpp/pde/operation/hash/OperationParabolicPDESolverSystemFreeBoundaries.hpp"
 %include "pde/src/sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitPeriodic.hpp"
 %include "pde/src/sgpp/pde/operation/hash/OperationMatrixLTwoDotPeriodic.hpp"
+%include "pde/src/sgpp/pde/operation/hash/OperationMultilevelPreconditionerLinear.hpp"
 
 %apply std::string *INPUT { std::string& istr };
 
@@ -5,6 +5,9 @@
 
 #include <sgpp/pde/algorithm/HeatEquationParabolicPDESolverSystem.hpp>
 #include <sgpp/base/exception/algorithm_exception.hpp>
+
+#include <sgpp/pde/algorithm/StdUpDown.hpp>
+#include <sgpp/pde/algorithm/UpDownOneOpDim.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -39,6 +42,9 @@ HeatEquationParabolicPDESolverSystem::HeatEquationParabolicPDESolverSystem(
   this->OpLaplaceInner = op_factory::createOperationLaplace(*this->InnerGrid);
   this->OpMassInner = sgpp::op_factory::createOperationLTwoDotProduct(*this->InnerGrid);
 
+  // the heat equation has constant operators and constant Dirichlet boundary values
+  this->assembleRHSOnInnerGrid = true;
+
   // right hand side if System
   this->rhs = new sgpp::base::DataVector(1);
 }
@@ -65,48 +71,42 @@ HeatEquationParabolicPDESolverSystem::~HeatEquationParabolicPDESolverSystem() {
 
 void HeatEquationParabolicPDESolverSystem::applyMassMatrixComplete(sgpp::base::DataVector& alpha,
                                                                    sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  sgpp::base::DataVector temp(alpha.getSize());
-
   // Apply the mass matrix
-  this->OpMassBound->mult(alpha, temp);
-
-  result.add(temp);
+  this->OpMassBound->mult(alpha, result);
 }
 
 void HeatEquationParabolicPDESolverSystem::applyLOperatorComplete(sgpp::base::DataVector& alpha,
                                                                   sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  sgpp::base::DataVector temp(alpha.getSize());
-
   // Apply the laplace Operator rate
-  this->OpLaplaceBound->mult(alpha, temp);
-  result.axpy((-1.0) * this->a, temp);
+  this->OpLaplaceBound->mult(alpha, result);
+  result.mult((-1.0) * this->a);
 }
 
 void HeatEquationParabolicPDESolverSystem::applyMassMatrixInner(sgpp::base::DataVector& alpha,
                                                                 sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  sgpp::base::DataVector temp(alpha.getSize());
-
   // Apply the mass matrix
-  this->OpMassInner->mult(alpha, temp);
-
-  result.add(temp);
+  this->OpMassInner->mult(alpha, result);
 }
 
 void HeatEquationParabolicPDESolverSystem::applyLOperatorInner(sgpp::base::DataVector& alpha,
                                                                sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  sgpp::base::DataVector temp(alpha.getSize());
-
   // Apply the laplace Operator rate
-  this->OpLaplaceInner->mult(alpha, temp);
-  result.axpy((-1.0) * this->a, temp);
+  this->OpLaplaceInner->mult(alpha, result);
+  result.mult((-1.0) * this->a);
+}
+
+void HeatEquationParabolicPDESolverSystem::applyMassMatrixAndLOperatorInner(
+    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, double lOperatorFactor) {
+  UpDownOneOpDim* laplaceInner = dynamic_cast<UpDownOneOpDim*>(this->OpLaplaceInner);
+
+  // the up/down mass matrix is fused into the up/down traversal of the Laplace operator,
+  // whose up/down operations in the non-special dimensions are the same L2 dot products
+  if ((laplaceInner != nullptr) && (dynamic_cast<StdUpDown*>(this->OpMassInner) != nullptr)) {
+    laplaceInner->multWithMassMatrix(alpha, result, (-1.0) * this->a * lOperatorFactor);
+  } else {
+    OperationParabolicPDESolverSystemDirichlet::applyMassMatrixAndLOperatorInner(alpha, result,
+                                                                                 lOperatorFactor);
+  }
 }
 
 void HeatEquationParabolicPDESolverSystem::finishTimestep() {
@@ -48,6 +48,9 @@ HeatEquationParabolicPDESolverSystemParallelOMP::HeatEquationParabolicPDESolverS
   this->OpLaplaceInner = op_factory::createOperationLaplace(*this->InnerGrid);
   this->OpMassInner = sgpp::op_factory::createOperationLTwoDotProduct(*this->InnerGrid);
 
+  // the heat equation has constant operators and constant Dirichlet boundary values
+  this->assembleRHSOnInnerGrid = true;
+
   // right hand side if System
   this->rhs = nullptr;
 }
@@ -183,6 +186,20 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorInner(
   result.axpy((-1.0) * this->a, temp);
 }
 
+void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixAndLOperatorInner(
+    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, double lOperatorFactor) {
+  UpDownOneOpDim* laplaceInner = dynamic_cast<UpDownOneOpDim*>(this->OpLaplaceInner);
+
+  // the up/down mass matrix is fused into the up/down traversal of the Laplace operator,
+  // whose up/down operations in the non-special dimensions are the same L2 dot products
+  if ((laplaceInner != nullptr) && (dynamic_cast<StdUpDown*>(this->OpMassInner) != nullptr)) {
+    laplaceInner->multWithMassMatrix(alpha, result, (-1.0) * this->a * lOperatorFactor);
+  } else {
+    OperationParabolicPDESolverSystemDirichlet::applyMassMatrixAndLOperatorInner(alpha, result,
+                                                                                 lOperatorFactor);
+  }
+}
+
 void HeatEquationParabolicPDESolverSystemParallelOMP::finishTimestep() {
   // Replace the inner coefficients on the boundary grid
   this->GridConverter->updateBoundaryCoefs(*this->alpha_complete, *this->alpha_inner);
@@ -199,45 +216,9 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::mult(sgpp::base::DataVecto
   if (this->tOperationMode == "ExEul") {
     applyMassMatrixInner(alpha, result);
   } else if (this->tOperationMode == "ImEul") {
-    sgpp::base::DataVector temp(result.getSize());
-    sgpp::base::DataVector temp2(result.getSize());
-
-#pragma omp parallel shared(alpha, result, temp, temp2)
-    {
-#pragma omp single nowait
-      {
-#pragma omp task shared(alpha, temp)
-        { applyMassMatrixInner(alpha, temp); }
-
-#pragma omp task shared(alpha, temp2)
-        { applyLOperatorInner(alpha, temp2); }
-
-#pragma omp taskwait
-      }
-    }
-
-    result.add(temp);
-    result.axpy((-1.0) * this->TimestepSize, temp2);
+    applyMassMatrixAndLOperatorInner(alpha, result, (-1.0) * this->TimestepSize);
   } else if (this->tOperationMode == "CrNic") {
-    sgpp::base::DataVector temp(result.getSize());
-    sgpp::base::DataVector temp2(result.getSize());
-
-#pragma omp parallel shared(alpha, result, temp, temp2)
-    {
-#pragma omp single nowait
-      {
-#pragma omp task shared(alpha, temp)
-        { applyMassMatrixInner(alpha, temp); }
-
-#pragma omp task shared(alpha, temp2)
-        { applyLOperatorInner(alpha, temp2); }
-
-#pragma omp taskwait
-      }
-    }
-
-    result.add(temp);
-    result.axpy((-0.5) * this->TimestepSize, temp2);
+    applyMassMatrixAndLOperatorInner(alpha, result, (-0.5) * this->TimestepSize);
   } else {
     throw sgpp::base::algorithm_exception(
         " HeatEquationParabolicPDESolverSystemParallelOMP::mult : An unknown operation mode was "
@@ -246,6 +227,14 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::mult(sgpp::base::DataVecto
 }
 
 sgpp::base::DataVector* HeatEquationParabolicPDESolverSystemParallelOMP::generateRHS() {
+  if (this->assembleRHSOnInnerGrid) {
+    sgpp::base::DataVector* rhsInner = generateRHSInner();
+
+    if (rhsInner != nullptr) {
+      return rhsInner;
+    }
+  }
+
   sgpp::base::DataVector rhs_complete(this->alpha_complete->getSize());
 
   if (this->tOperationMode == "ExEul") {
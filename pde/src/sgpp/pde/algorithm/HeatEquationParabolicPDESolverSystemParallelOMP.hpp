@@ -43,6 +43,13 @@ class HeatEquationParabolicPDESolverSystemParallelOMP
 
   void applyLOperatorInner(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  /**
+   * applies the mass matrix and the Laplace operator in one traversal of the inner grid
+   * (falls back to separate applications if the operators don't support this)
+   */
+  void applyMassMatrixAndLOperatorInner(sgpp::base::DataVector& alpha,
+                                        sgpp::base::DataVector& result, double lOperatorFactor);
+
  public:
   /**
    * Std-Constructor
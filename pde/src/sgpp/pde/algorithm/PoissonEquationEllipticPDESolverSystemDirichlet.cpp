@@ -6,6 +6,7 @@
 #include <sgpp/pde/algorithm/PoissonEquationEllipticPDESolverSystemDirichlet.hpp>
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/pde/operation/hash/OperationMultilevelPreconditionerLinear.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -34,5 +35,14 @@ void PoissonEquationEllipticPDESolverSystemDirichlet::applyLOperatorComplete(
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
   Laplace_Complete->mult(alpha, result);
 }
+
+sgpp::base::OperationMatrix*
+PoissonEquationEllipticPDESolverSystemDirichlet::createPreconditioner() {
+  if (this->InnerGrid->getType() == sgpp::base::GridType::Linear) {
+    return new OperationMultilevelPreconditionerLinear(&this->InnerGrid->getStorage());
+  }
+
+  return nullptr;
+}
 }  // namespace pde
 }  // namespace sgpp
@@ -43,6 +43,14 @@ class PoissonEquationEllipticPDESolverSystemDirichlet
    * Destructor
    */
   virtual ~PoissonEquationEllipticPDESolverSystemDirichlet();
+
+  /**
+   * creates a multilevel preconditioner for the Laplacian on the inner grid
+   * (OperationMultilevelPreconditionerLinear) if the inner grid is a linear grid
+   *
+   * @return preconditioner, nullptr for other grid types
+   */
+  sgpp::base::OperationMatrix* createPreconditioner() override;
 };
 }  // namespace pde
 }  // namespace sgpp
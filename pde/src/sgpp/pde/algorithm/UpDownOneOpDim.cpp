@@ -77,6 +77,22 @@ void UpDownOneOpDim::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
   }
 }
 
+void UpDownOneOpDim::multWithMassMatrix(sgpp::base::DataVector& alpha,
+                                        sgpp::base::DataVector& result, double operatorFactor) {
+  sgpp::base::DataVector massResult(result.getSize());
+  sgpp::base::DataVector beta(result.getSize());
+  result.setAll(0.0);
+
+#pragma omp parallel
+  {
+#pragma omp single nowait
+    { this->updownWithMass(alpha, massResult, beta, this->numAlgoDims_ - 1); }
+  }
+
+  result.add(massResult);
+  result.axpy(operatorFactor, beta);
+}
+
 void UpDownOneOpDim::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                             size_t dim, size_t op_dim) {
   size_t curNumAlgoDims = this->numAlgoDims_;
@@ -170,5 +186,109 @@ void UpDownOneOpDim::specialOP(sgpp::base::DataVector& alpha, sgpp::base::DataVe
     result.add(temp);
   }
 }
+
+void UpDownOneOpDim::updownWithMass(sgpp::base::DataVector& alpha,
+                                    sgpp::base::DataVector& massResult,
+                                    sgpp::base::DataVector& result, size_t dim) {
+  size_t curNumAlgoDims = this->numAlgoDims_;
+  size_t curMaxParallelDims = this->maxParallelDims_;
+  double coef = (this->coefs != nullptr) ? this->coefs->get(dim) : 1.0;
+
+  // Unidirectional scheme
+  if (dim > 0) {
+    // Reordering ups and downs
+    sgpp::base::DataVector temp(alpha.getSize());
+    sgpp::base::DataVector mass_temp(alpha.getSize());
+    sgpp::base::DataVector result_temp(alpha.getSize());
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, massResult, \
+                                                                        result)
+    {  // NOLINT(whitespace/braces)
+      up(alpha, temp, this->algoDims[dim]);
+      updownWithMass(temp, massResult, result, dim - 1);
+    }
+
+// Same from the other direction, the mass part is reused by the special operation:
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, mass_temp, \
+                                                                        result_temp)
+    updownWithMass(alpha, mass_temp, result_temp, dim - 1);
+
+#pragma omp taskwait
+
+    sgpp::base::DataVector mass_down(alpha.getSize());
+    sgpp::base::DataVector result_down(alpha.getSize());
+    sgpp::base::DataVector special_result(alpha.getSize());
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(mass_temp, mass_down)
+    down(mass_temp, mass_down, this->algoDims[dim]);
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(result_temp, result_down)
+    down(result_temp, result_down, this->algoDims[dim]);
+
+    if (coef != 0.0) {
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, mass_temp, \
+                                                                        special_result)
+      specialOPWithMass(alpha, mass_temp, special_result, dim);
+    }
+
+#pragma omp taskwait
+
+    massResult.add(mass_down);
+    result.add(result_down);
+
+    if (coef != 0.0) {
+      result.axpy(coef, special_result);
+    }
+  } else {
+    // Terminates dimension recursion
+    sgpp::base::DataVector temp(alpha.getSize());
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, massResult)
+    up(alpha, massResult, this->algoDims[dim]);
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
+    down(alpha, temp, this->algoDims[dim]);
+
+    if (coef != 0.0) {
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
+      specialOPWithMass(alpha, alpha, result, dim);
+    }
+
+#pragma omp taskwait
+
+    massResult.add(temp);
+
+    if (coef != 1.0) {
+      result.mult(coef);
+    }
+  }
+}
+
+void UpDownOneOpDim::specialOPWithMass(sgpp::base::DataVector& alpha,
+                                       sgpp::base::DataVector& lowerMassResult,
+                                       sgpp::base::DataVector& result, size_t dim) {
+  size_t curNumAlgoDims = this->numAlgoDims_;
+  size_t curMaxParallelDims = this->maxParallelDims_;
+  sgpp::base::DataVector temp(alpha.getSize());
+  sgpp::base::DataVector temp_two(alpha.getSize());
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
+  {
+    if (dim > 0) {
+      // only the mass part in the lower dimensions (there is no special dimension below dim)
+      upOpDim(alpha, temp, this->algoDims[dim]);
+      updown(temp, result, dim - 1, this->numAlgoDims_);
+    } else {
+      upOpDim(alpha, result, this->algoDims[dim]);
+    }
+  }
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(lowerMassResult, temp_two)
+  downOpDim(lowerMassResult, temp_two, this->algoDims[dim]);
+
+#pragma omp taskwait
+
+  result.add(temp_two);
+}
 }  // namespace pde
 }  // namespace sgpp
@@ -74,6 +74,25 @@ class UpDownOneOpDim : public sgpp::base::OperationMatrix {
   void multParallelBuildingBlock(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                                  size_t operationDim);
 
+  /**
+   * Applies the mass matrix and this operator in one traversal, i.e.
+   * result = M * alpha + operatorFactor * A * alpha, where A is the operator implemented
+   * by mult and M is the mass matrix given by the up/down operations in all dimensions
+   * (the L2 dot product of the basis functions).
+   *
+   * Instead of one up/down traversal for M and one for every special dimension of A, the
+   * recursion carries the mass and the operator contributions together and reuses the mass
+   * contribution of the lower dimensions for the special operation of the current dimension.
+   * This roughly halves the number of 1D sweeps (and temporaries) compared to applying M and A
+   * separately, e.g., in the systems of implicit time stepping schemes.
+   *
+   * @param alpha vector of coefficients
+   * @param result vector to store the results in
+   * @param operatorFactor factor of the operator A
+   */
+  void multWithMassMatrix(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                          double operatorFactor);
+
  protected:
   typedef sgpp::base::GridStorage::grid_iterator grid_iterator;
 
@@ -110,6 +129,34 @@ class UpDownOneOpDim : public sgpp::base::OperationMatrix {
   virtual void specialOP(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim,
                          size_t op_dim);
 
+  /**
+   * Recursive procedure for multWithMassMatrix, parallel version using OpenMP 3.
+   * Computes the mass matrix and the sum of the (weighted) operators with special dimensions
+   * up to dim, both restricted to the dimensions up to dim.
+   *
+   * @param alpha vector of coefficients
+   * @param massResult vector to store the result of the mass matrix in
+   * @param result vector to store the result of the operator in
+   * @param dim the current dimension
+   */
+  void updownWithMass(sgpp::base::DataVector& alpha, sgpp::base::DataVector& massResult,
+                      sgpp::base::DataVector& result, size_t dim);
+
+  /**
+   * Special operation in dimension dim for multWithMassMatrix, i.e., the same as
+   * specialOP(alpha, result, dim, dim), but the mass matrix restricted to the dimensions
+   * below dim has already been applied to alpha (lowerMassResult) and is reused.
+   *
+   * @param alpha vector of coefficients
+   * @param lowerMassResult mass matrix of the dimensions below dim applied to alpha
+   * (alpha itself if dim == 0)
+   * @param result vector to store the results in
+   * @param dim the dimension in that the special operation is applied
+   */
+  virtual void specialOPWithMass(sgpp::base::DataVector& alpha,
+                                 sgpp::base::DataVector& lowerMassResult,
+                                 sgpp::base::DataVector& result, size_t dim);
+
   /**
    * std 1D up operation
    *
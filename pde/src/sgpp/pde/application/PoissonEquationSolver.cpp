@@ -6,6 +6,7 @@
 #include <sgpp/pde/application/PoissonEquationSolver.hpp>
 #include <sgpp/pde/algorithm/PoissonEquationEllipticPDESolverSystemDirichlet.hpp>
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/tools/SGppStopwatch.hpp>
@@ -24,6 +25,7 @@ namespace pde {
 PoissonEquationSolver::PoissonEquationSolver() : EllipticPDESolver() {
   this->bGridConstructed = false;
   this->myScreen = nullptr;
+  this->useMultilevelPreconditioner = true;
 }
 
 PoissonEquationSolver::~PoissonEquationSolver() {
@@ -53,9 +55,18 @@ void PoissonEquationSolver::solvePDE(base::DataVector& alpha, base::DataVector&
   double dTimeSolver = 0.0;
 
   base::SGppStopwatch* myStopwatch = new base::SGppStopwatch();
-  solver::ConjugateGradients* myCG = new solver::ConjugateGradients(maxCGIterations, epsilonCG);
   PoissonEquationEllipticPDESolverSystemDirichlet* mySystem =
       new PoissonEquationEllipticPDESolverSystemDirichlet(*(this->myGrid), rhs);
+  base::OperationMatrix* myPreconditioner =
+      this->useMultilevelPreconditioner ? mySystem->createPreconditioner() : nullptr;
+  solver::ConjugateGradients* myCG;
+
+  if (myPreconditioner != nullptr) {
+    myCG = new solver::PreconditionedConjugateGradients(maxCGIterations, epsilonCG,
+                                                        *myPreconditioner);
+  } else {
+    myCG = new solver::ConjugateGradients(maxCGIterations, epsilonCG);
+  }
 
   std::cout << "Gridpoints (complete grid): " << mySystem->getNumGridPointsComplete() << std::endl;
   std::cout << "Gridpoints (inner grid): " << mySystem->getNumGridPointsInner() << std::endl
@@ -90,16 +101,23 @@ void PoissonEquationSolver::solvePDE(base::DataVector& alpha, base::DataVector&
   std::cout << "------------------------------------" << std::endl;
   std::cout << "Time for creating CG coeffs: " << dTimeAlpha << std::endl;
   std::cout << "Time for creating RHS: " << dTimeRHS << std::endl;
-  std::cout << "Time for solving: " << dTimeSolver << std::endl << std::endl;
+  std::cout << "Time for solving: " << dTimeSolver << " (" << myCG->getNumberIterations()
+            << " iterations)" << std::endl
+            << std::endl;
   std::cout << "Time: " << dTimeAlpha + dTimeRHS + dTimeSolver << std::endl
             << std::endl
             << std::endl;
 
   delete myCG;
+  delete myPreconditioner;
   delete mySystem;  // alpha_solver and rhs_solve are allocated and freed here!!
   delete myStopwatch;
 }
 
+void PoissonEquationSolver::setMultilevelPreconditioning(bool useMultilevelPreconditioner) {
+  this->useMultilevelPreconditioner = useMultilevelPreconditioner;
+}
+
 void PoissonEquationSolver::initGridWithSmoothHeat(base::DataVector& alpha, double mu,
                                                    double sigma, double factor) {
   if (this->bGridConstructed) {
@@ -39,6 +39,8 @@ class PoissonEquationSolver : public EllipticPDESolver {
  private:
   /// screen object used in this solver
   sgpp::base::ScreenOutput* myScreen;
+  /// use the multilevel preconditioner (if available for the grid type)
+  bool useMultilevelPreconditioner;
 
  public:
   /**
@@ -56,6 +58,15 @@ class PoissonEquationSolver : public EllipticPDESolver {
   void solvePDE(sgpp::base::DataVector& alpha, sgpp::base::DataVector& rhs, size_t maxCGIterations,
                 double epsilonCG, bool verbose = false);
 
+  /**
+   * Enables or disables the multilevel preconditioner (OperationMultilevelPreconditionerLinear),
+   * which leads to iteration counts that are (almost) independent of the level.
+   * It is enabled by default.
+   *
+   * @param useMultilevelPreconditioner whether the preconditioner should be used
+   */
+  void setMultilevelPreconditioning(bool useMultilevelPreconditioner);
+
   /**
    * Inits the grid with a smooth heat distribution (based on
    * a std-normal distribution) on its boundaries
@@ -24,5 +24,9 @@ size_t OperationEllipticPDESolverSystem::getNumGridPointsComplete() {
 size_t OperationEllipticPDESolverSystem::getNumGridPointsInner() {
   return this->numGridpointsInner;
 }
+
+sgpp::base::OperationMatrix* OperationEllipticPDESolverSystem::createPreconditioner() {
+  return nullptr;
+}
 }  // namespace pde
 }  // namespace sgpp
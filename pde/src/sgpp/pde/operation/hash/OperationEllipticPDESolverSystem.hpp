@@ -66,6 +66,15 @@ class OperationEllipticPDESolverSystem : public sgpp::base::OperationMatrix {
    */
   virtual sgpp::base::DataVector* generateRHS() = 0;
 
+  /**
+   * creates a preconditioner for the system, e.g. to be used with
+   * sgpp::solver::PreconditionedConjugateGradients.
+   * Note: object has to be freed after use.
+   *
+   * @return preconditioner for the system matrix, nullptr if no preconditioner is available
+   */
+  virtual sgpp::base::OperationMatrix* createPreconditioner();
+
   /**
    * Returns the number of grid points for the complete grid
    *
@@ -41,6 +41,13 @@ void OperationLaplaceLinear::specialOP(sgpp::base::DataVector& alpha,
   }
 }
 
+void OperationLaplaceLinear::specialOPWithMass(sgpp::base::DataVector& alpha,
+                                               sgpp::base::DataVector& lowerMassResult,
+                                               sgpp::base::DataVector& result, size_t dim) {
+  // The up-part is empty, thus only the down-part is applied to the reused mass part
+  downOpDim(lowerMassResult, result, this->algoDims[dim]);
+}
+
 void OperationLaplaceLinear::up(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                                 size_t dim) {
   PhiPhiUpBBLinear func(this->storage);
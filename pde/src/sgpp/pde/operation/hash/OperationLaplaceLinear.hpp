@@ -43,6 +43,10 @@ class OperationLaplaceLinear : public UpDownOneOpDim {
   virtual void specialOP(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim,
                          size_t gradient_dim);
 
+  virtual void specialOPWithMass(sgpp::base::DataVector& alpha,
+                                 sgpp::base::DataVector& lowerMassResult,
+                                 sgpp::base::DataVector& result, size_t dim);
+
   virtual void up(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
 
   virtual void down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
@@ -37,6 +37,13 @@ void OperationLaplaceLinearStretched::specialOP(sgpp::base::DataVector& alpha,
   }
 }
 
+void OperationLaplaceLinearStretched::specialOPWithMass(
+    sgpp::base::DataVector& alpha, sgpp::base::DataVector& lowerMassResult,
+    sgpp::base::DataVector& result, size_t dim) {
+  // The up-part is empty, thus only the down-part is applied to the reused mass part
+  downOpDim(lowerMassResult, result, this->algoDims[dim]);
+}
+
 void OperationLaplaceLinearStretched::up(sgpp::base::DataVector& alpha,
                                          sgpp::base::DataVector& result, size_t dim) {
   PhiPhiUpBBLinearStretched func(this->storage);
@@ -0,0 +1,127 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/operation/hash/OperationMultilevelPreconditionerLinear.hpp>
+
+#include <sgpp/base/algorithm/sweep.hpp>
+#include <sgpp/base/grid/common/BoundingBox.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_sweep/ConvertPrewaveletToLinear.hpp>
+#include <sgpp/base/operation/hash/common/algorithm_sweep/ConvertPrewaveletToLinearTransposed.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+OperationMultilevelPreconditionerLinear::OperationMultilevelPreconditionerLinear(
+    sgpp::base::GridStorage* storage, double laplaceFactor, double massFactor)
+    : storage(storage), diagonal(storage->getSize()) {
+  const size_t dim = storage->getDimension();
+  sgpp::base::BoundingBox* boundingBox = storage->getBoundingBox();
+  std::vector<double> stiffness(dim);
+  std::vector<double> mass(dim);
+
+  for (size_t i = 0; i < storage->getSize(); i++) {
+    sgpp::base::GridPoint& point = storage->getPoint(i);
+
+    for (size_t d = 0; d < dim; d++) {
+      sgpp::base::level_t level;
+      sgpp::base::index_t index;
+      point.get(d, level, index);
+      getPrewaveletNorms(level, index, stiffness[d], mass[d]);
+
+      const double width = boundingBox->getIntervalWidth(d);
+      stiffness[d] /= width;
+      mass[d] *= width;
+    }
+
+    // a(psi, psi) = sum_d (psi_d', psi_d') prod_{t != d} (psi_t, psi_t)
+    double massProduct = 1.0;
+    double laplace = 0.0;
+
+    for (size_t d = 0; d < dim; d++) {
+      laplace = laplace * mass[d] + massProduct * stiffness[d];
+      massProduct *= mass[d];
+    }
+
+    diagonal[i] = laplaceFactor * laplace + massFactor * massProduct;
+  }
+}
+
+OperationMultilevelPreconditionerLinear::~OperationMultilevelPreconditionerLinear() {}
+
+void OperationMultilevelPreconditionerLinear::mult(sgpp::base::DataVector& alpha,
+                                                   sgpp::base::DataVector& result) {
+  const size_t dim = storage->getDimension();
+  result.copyFrom(alpha);
+
+  // P^T = P_0^T ... P_{d-1}^T, as ConvertPrewaveletToLinear sweeps dimension 0 first
+  sgpp::base::ConvertPrewaveletToLinearTransposed funcTransposed(*storage);
+  sgpp::base::sweep<sgpp::base::ConvertPrewaveletToLinearTransposed> sTransposed(funcTransposed,
+                                                                                 *storage);
+
+  for (size_t d = dim; d-- > 0;) {
+    sTransposed.sweep1D(result, result, d);
+  }
+
+  result.componentwise_div(diagonal);
+
+  sgpp::base::ConvertPrewaveletToLinear func(*storage);
+  sgpp::base::sweep<sgpp::base::ConvertPrewaveletToLinear> s(func, *storage);
+
+  for (size_t d = 0; d < dim; d++) {
+    s.sweep1D(result, result, d);
+  }
+}
+
+const sgpp::base::DataVector& OperationMultilevelPreconditionerLinear::getDiagonal() const {
+  return diagonal;
+}
+
+void OperationMultilevelPreconditionerLinear::getPrewaveletNorms(sgpp::base::level_t level,
+                                                                 sgpp::base::index_t index,
+                                                                 double& stiffness,
+                                                                 double& mass) {
+  // prewavelet stamps w.r.t. the nodal hat functions of its level (see PrewaveletBasis)
+  static const double levelOneStamp[] = {1.0};
+  static const double borderStamp[] = {0.9, -0.6, 0.1};
+  static const double normalStamp[] = {0.1, -0.6, 1.0, -0.6, 0.1};
+
+  const double* stamp;
+  size_t stampSize;
+
+  if (level == 1) {
+    stamp = levelOneStamp;
+    stampSize = 1;
+  } else if ((index == 1) || (index == (static_cast<sgpp::base::index_t>(1) << level) - 1)) {
+    stamp = borderStamp;
+    stampSize = 3;
+  } else {
+    stamp = normalStamp;
+    stampSize = 5;
+  }
+
+  // nodal hat functions of width h: (phi_k', phi_k') = 2/h, (phi_k', phi_{k+1}') = -1/h,
+  // (phi_k, phi_k) = 2h/3, (phi_k, phi_{k+1}) = h/6
+  double sumOfSquares = 0.0;
+  double sumOfNeighborProducts = 0.0;
+
+  for (size_t k = 0; k < stampSize; k++) {
+    sumOfSquares += stamp[k] * stamp[k];
+
+    if (k + 1 < stampSize) {
+      sumOfNeighborProducts += stamp[k] * stamp[k + 1];
+    }
+  }
+
+  const double h = 1.0 / static_cast<double>(static_cast<sgpp::base::index_t>(1) << level);
+  stiffness = (2.0 * sumOfSquares - 2.0 * sumOfNeighborProducts) / h;
+  mass = (4.0 * sumOfSquares + 2.0 * sumOfNeighborProducts) * h / 6.0;
+}
+
+}  // namespace pde
+}  // namespace sgpp
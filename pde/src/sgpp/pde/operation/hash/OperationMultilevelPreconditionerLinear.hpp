@@ -0,0 +1,87 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Multilevel (BPX-type additive Schwarz) preconditioner for the system
+ * \f$(\mu M + \lambda L)\vec{\alpha} = \vec{b}\f$ on linear grids without boundaries,
+ * where \f$M\f$ is the mass matrix and \f$L\f$ the Laplacian in the hierarchical linear basis.
+ *
+ * The level subspaces of the sparse grid are decoupled by switching to the prewavelet basis,
+ * in which the (diagonally scaled) system is uniformly well-conditioned, independent of
+ * the level (Griebel, Oswald: Tensor product type subspace splittings and multilevel
+ * iterative methods for anisotropic problems). With the conversion \f$P\f$ from prewavelet to
+ * hierarchical linear coefficients (ConvertPrewaveletToLinear), the preconditioner is
+ * \f[
+ * C = P D^{-1} P^T,
+ * \f]
+ * where \f$D\f$ is the diagonal of \f$\mu M + \lambda L\f$ in the prewavelet basis, which is
+ * known analytically. Applying \f$C\f$ requires two 1D sweeps per dimension, i.e., less than
+ * one application of the Laplacian. Use it with solver::PreconditionedConjugateGradients
+ * to obtain level-independent iteration counts.
+ *
+ * The grid must not be changed after the construction (create a new object after refinement).
+ */
+class OperationMultilevelPreconditionerLinear : public sgpp::base::OperationMatrix {
+ public:
+  /**
+   * Constructor
+   *
+   * @param storage the grid's sgpp::base::GridStorage object
+   * @param laplaceFactor factor \f$\lambda\f$ of the Laplacian
+   * @param massFactor factor \f$\mu\f$ of the mass matrix
+   */
+  explicit OperationMultilevelPreconditionerLinear(sgpp::base::GridStorage* storage,
+                                                   double laplaceFactor = 1.0,
+                                                   double massFactor = 0.0);
+
+  /**
+   * Destructor
+   */
+  ~OperationMultilevelPreconditionerLinear() override;
+
+  /**
+   * Applies the preconditioner to a residual.
+   *
+   * @param alpha residual (in the hierarchical linear basis)
+   * @param result preconditioned residual
+   */
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
+  /**
+   * @return diagonal of the system in the prewavelet basis
+   */
+  const sgpp::base::DataVector& getDiagonal() const;
+
+ protected:
+  /// the grid's sgpp::base::GridStorage object
+  sgpp::base::GridStorage* storage;
+  /// diagonal of the system in the prewavelet basis
+  sgpp::base::DataVector diagonal;
+
+  /**
+   * Calculates the 1D scalar products of a prewavelet with itself on the unit interval.
+   *
+   * @param level level of the prewavelet
+   * @param index index of the prewavelet
+   * @param[out] stiffness \f$\int \psi_{l,i}'(x)^2 \,\mathrm{d}x\f$
+   * @param[out] mass \f$\int \psi_{l,i}(x)^2 \,\mathrm{d}x\f$
+   */
+  static void getPrewaveletNorms(sgpp::base::level_t level, sgpp::base::index_t index,
+                                 double& stiffness, double& mass);
+};
+
+}  // namespace pde
+}  // namespace sgpp
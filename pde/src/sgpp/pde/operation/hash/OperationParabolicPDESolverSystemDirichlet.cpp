@@ -14,9 +14,13 @@ namespace pde {
 OperationParabolicPDESolverSystemDirichlet::OperationParabolicPDESolverSystemDirichlet() {
   this->numSumGridpointsInner = 0;
   this->numSumGridpointsComplete = 0;
+  this->assembleRHSOnInnerGrid = false;
+  this->boundaryContributionInner = nullptr;
 }
 
-OperationParabolicPDESolverSystemDirichlet::~OperationParabolicPDESolverSystemDirichlet() {}
+OperationParabolicPDESolverSystemDirichlet::~OperationParabolicPDESolverSystemDirichlet() {
+  delete this->boundaryContributionInner;
+}
 
 void OperationParabolicPDESolverSystemDirichlet::mult(sgpp::base::DataVector& alpha,
                                                       sgpp::base::DataVector& result) {
@@ -25,49 +29,9 @@ void OperationParabolicPDESolverSystemDirichlet::mult(sgpp::base::DataVector& al
   if (this->tOperationMode == "ExEul") {
     applyMassMatrixInner(alpha, result);
   } else if (this->tOperationMode == "ImEul") {
-    result.setAll(0.0);
-
-    sgpp::base::DataVector temp(result.getSize());
-    sgpp::base::DataVector temp2(result.getSize());
-
-#pragma omp parallel shared(alpha, result, temp, temp2)
-    {
-#pragma omp single nowait
-      {
-#pragma omp task shared(alpha, temp)
-        { applyMassMatrixInner(alpha, temp); }
-
-#pragma omp task shared(alpha, temp2)
-        { applyLOperatorInner(alpha, temp2); }
-
-#pragma omp taskwait
-      }
-    }
-
-    result.add(temp);
-    result.axpy((-1.0) * this->TimestepSize, temp2);
+    applyMassMatrixAndLOperatorInner(alpha, result, (-1.0) * this->TimestepSize);
   } else if (this->tOperationMode == "CrNic") {
-    result.setAll(0.0);
-
-    sgpp::base::DataVector temp(result.getSize());
-    sgpp::base::DataVector temp2(result.getSize());
-
-#pragma omp parallel shared(alpha, result, temp, temp2)
-    {
-#pragma omp single nowait
-      {
-#pragma omp task shared(alpha, temp)
-        { applyMassMatrixInner(alpha, temp); }
-
-#pragma omp task shared(alpha, temp2)
-        { applyLOperatorInner(alpha, temp2); }
-
-#pragma omp taskwait
-      }
-    }
-
-    result.add(temp);
-    result.axpy((-0.5) * this->TimestepSize, temp2);
+    applyMassMatrixAndLOperatorInner(alpha, result, (-0.5) * this->TimestepSize);
   } else if (this->tOperationMode == "AdBas" || this->tOperationMode == "AdBasC") {
     result.setAll(0.0);
 
@@ -102,7 +66,87 @@ void OperationParabolicPDESolverSystemDirichlet::mult(sgpp::base::DataVector& al
   }
 }
 
+void OperationParabolicPDESolverSystemDirichlet::applyMassMatrixAndLOperatorInner(
+    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, double lOperatorFactor) {
+  result.setAll(0.0);
+
+  sgpp::base::DataVector temp(result.getSize());
+  sgpp::base::DataVector temp2(result.getSize());
+
+#pragma omp parallel shared(alpha, result, temp, temp2)
+  {
+#pragma omp single nowait
+    {
+#pragma omp task shared(alpha, temp)
+      { applyMassMatrixInner(alpha, temp); }
+
+#pragma omp task shared(alpha, temp2)
+      { applyLOperatorInner(alpha, temp2); }
+
+#pragma omp taskwait
+    }
+  }
+
+  result.add(temp);
+  result.axpy(lOperatorFactor, temp2);
+}
+
+sgpp::base::DataVector* OperationParabolicPDESolverSystemDirichlet::generateRHSInner() {
+  double lOperatorFactor;
+
+  if (this->tOperationMode == "ExEul") {
+    lOperatorFactor = this->TimestepSize;
+  } else if (this->tOperationMode == "ImEul") {
+    lOperatorFactor = 0.0;
+  } else if (this->tOperationMode == "CrNic") {
+    lOperatorFactor = (0.5) * this->TimestepSize;
+  } else {
+    return nullptr;
+  }
+
+  this->GridConverter->calcInnerCoefs(*this->alpha_complete, *this->alpha_inner);
+
+  // the boundary coefficients only have to be applied once (or after a change of the grid)
+  if ((this->boundaryContributionInner == nullptr) ||
+      (this->boundaryContributionInner->getSize() != this->alpha_inner->getSize())) {
+    sgpp::base::DataVector alpha_bound(*this->alpha_complete);
+    sgpp::base::DataVector result_complete(this->alpha_complete->getSize());
+
+    this->BoundaryUpdate->setInnerPointsToZero(alpha_bound);
+    applyLOperatorComplete(alpha_bound, result_complete);
+
+    delete this->boundaryContributionInner;
+    this->boundaryContributionInner = new sgpp::base::DataVector(this->alpha_inner->getSize());
+    this->GridConverter->calcInnerCoefs(result_complete, *this->boundaryContributionInner);
+  }
+
+  this->startTimestep();
+
+  if ((this->rhs == nullptr) || (this->rhs->getSize() != this->alpha_inner->getSize())) {
+    delete this->rhs;
+    this->rhs = new sgpp::base::DataVector(this->alpha_inner->getSize());
+  }
+
+  if (lOperatorFactor == 0.0) {
+    applyMassMatrixInner(*this->alpha_inner, *this->rhs);
+  } else {
+    applyMassMatrixAndLOperatorInner(*this->alpha_inner, *this->rhs, lOperatorFactor);
+  }
+
+  this->rhs->axpy(this->TimestepSize, *this->boundaryContributionInner);
+
+  return this->rhs;
+}
+
 sgpp::base::DataVector* OperationParabolicPDESolverSystemDirichlet::generateRHS() {
+  if (this->assembleRHSOnInnerGrid) {
+    sgpp::base::DataVector* rhsInner = generateRHSInner();
+
+    if (rhsInner != nullptr) {
+      return rhsInner;
+    }
+  }
+
   sgpp::base::DataVector rhs_complete(this->alpha_complete->getSize());
 
   if (this->tOperationMode == "ExEul") {
@@ -433,11 +477,12 @@ sgpp::base::DataVector* OperationParabolicPDESolverSystemDirichlet::generateRHS(
 
   rhs_complete.sub(result_complete);
 
-  if (this->rhs != nullptr) {
+  // reuse the right hand side of the previous time step if the grid has not changed
+  if ((this->rhs == nullptr) || (this->rhs->getSize() != this->alpha_inner->getSize())) {
     delete this->rhs;
+    this->rhs = new sgpp::base::DataVector(this->alpha_inner->getSize());
   }
 
-  this->rhs = new sgpp::base::DataVector(this->alpha_inner->getSize());
   this->GridConverter->calcInnerCoefs(rhs_complete, *this->rhs);
 
   return this->rhs;
@@ -45,6 +45,14 @@ class OperationParabolicPDESolverSystemDirichlet
   sgpp::base::DirichletGridConverter* GridConverter;
   /// Pointer to the inner grid object
   sgpp::base::Grid* InnerGrid;
+  /**
+   * set to true by systems whose operators and Dirichlet boundary values don't change in time,
+   * then the right hand side of the one-step schemes is assembled on the inner grid only
+   * (see generateRHSInner)
+   */
+  bool assembleRHSOnInnerGrid;
+  /// L-Operator applied to the boundary coefficients, restricted to the inner points
+  sgpp::base::DataVector* boundaryContributionInner;
 
   /**
    * applies the PDE's mass matrix, on complete grid - with boundaries
@@ -82,6 +90,32 @@ class OperationParabolicPDESolverSystemDirichlet
   virtual void applyLOperatorInner(sgpp::base::DataVector& alpha,
                                    sgpp::base::DataVector& result) = 0;
 
+  /**
+   * applies the PDE's mass matrix and system matrix at once, on inner grid only, i.e.
+   * result = mass matrix * alpha + lOperatorFactor * system matrix * alpha.
+   * By default, both are applied separately. Systems whose operators support it
+   * may override this with a single fused traversal of the grid.
+   *
+   * @param alpha the coefficients of the sparse grid's ansatzfunctions
+   * @param result reference to the sgpp::base::DataVector into which the result is written
+   * @param lOperatorFactor factor of the system matrix (e.g., -TimestepSize for implicit Euler)
+   */
+  virtual void applyMassMatrixAndLOperatorInner(sgpp::base::DataVector& alpha,
+                                                sgpp::base::DataVector& result,
+                                                double lOperatorFactor);
+
+  /**
+   * generates the right hand side of the system for the modes ExEul, ImEul and CrNic without
+   * any operation on the complete grid. Splitting the coefficients into inner and boundary
+   * coefficients, the contributions of the boundary coefficients to the explicit and implicit
+   * parts differ by TimestepSize times the L-Operator applied to the boundary coefficients only.
+   * As the boundary coefficients are constant, this is computed once on the complete grid,
+   * the rest is done with the inner grid's operators.
+   *
+   * @return returns the rhs, nullptr if the operation mode is not supported
+   */
+  sgpp::base::DataVector* generateRHSInner();
+
  public:
   /**
    * Constructor
@@ -19,6 +19,7 @@
 #include <sgpp/pde/operation/hash/OperationParabolicPDESolverSystemFreeBoundaries.hpp>
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitPeriodic.hpp>
 #include <sgpp/pde/operation/hash/OperationMatrixLTwoDotPeriodic.hpp>
+#include <sgpp/pde/operation/hash/OperationMultilevelPreconditionerLinear.hpp>
 
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 
@@ -0,0 +1,78 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp_base.hpp>
+#include <sgpp/pde/algorithm/HeatEquationParabolicPDESolverSystem.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+#include <string>
+
+namespace sgpp {
+namespace pde {
+
+namespace {
+
+/// assembles the right hand side on the complete grid, as done for general systems
+class HeatEquationParabolicPDESolverSystemComplete : public HeatEquationParabolicPDESolverSystem {
+ public:
+  HeatEquationParabolicPDESolverSystemComplete(sgpp::base::Grid& SparseGrid,
+                                               sgpp::base::DataVector& alpha, double a,
+                                               double TimestepSize, std::string OperationMode)
+      : HeatEquationParabolicPDESolverSystem(SparseGrid, alpha, a, TimestepSize, OperationMode) {
+    this->assembleRHSOnInnerGrid = false;
+  }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(testHeatEquationParabolicPDESolverSystem)
+
+BOOST_AUTO_TEST_CASE(testGenerateRHSInner) {
+  // the inner grid assembly must match the assembly on the complete grid
+  // for non-zero boundary values
+  const size_t d = 3;
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearBoundaryGrid(d));
+  grid->getGenerator().regular(3);
+  sgpp::base::GridStorage& storage = grid->getStorage();
+  sgpp::base::DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < storage.getSize(); i++) {
+    alpha[i] = 1.0;
+
+    for (size_t t = 0; t < d; t++) {
+      const double x = storage.getPointCoordinate(i, t);
+      alpha[i] *= 1.0 + x + std::sin(3.0 * x);
+    }
+  }
+
+  for (std::string mode : {"ExEul", "ImEul", "CrNic"}) {
+    sgpp::base::DataVector alphaInner(alpha);
+    sgpp::base::DataVector alphaComplete(alpha);
+    HeatEquationParabolicPDESolverSystem systemInner(*grid, alphaInner, 0.5, 0.01, mode);
+    HeatEquationParabolicPDESolverSystemComplete systemComplete(*grid, alphaComplete, 0.5, 0.01,
+                                                                mode);
+
+    // twice, such that the stored boundary contribution is used
+    for (size_t k = 0; k < 2; k++) {
+      sgpp::base::DataVector rhsInner(*systemInner.generateRHS());
+      sgpp::base::DataVector rhsComplete(*systemComplete.generateRHS());
+
+      BOOST_REQUIRE_EQUAL(rhsInner.getSize(), rhsComplete.getSize());
+
+      for (size_t i = 0; i < rhsInner.getSize(); i++) {
+        BOOST_CHECK_SMALL(rhsInner[i] - rhsComplete[i], 1e-12);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace pde
+}  // namespace sgpp
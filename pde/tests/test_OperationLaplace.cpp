@@ -9,8 +9,14 @@
 
 #include <sgpp_base.hpp>
 #include <sgpp_pde.hpp>
+#include <sgpp/pde/algorithm/UpDownOneOpDim.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
 namespace sgpp {
 namespace pde {
   /*
@@ -398,6 +404,56 @@ namespace pde {
     }
   }
 
+  BOOST_AUTO_TEST_CASE(testOperationLaplaceWithMassMatrix) {
+    // the fused traversal has to match applying the mass matrix and the Laplace operator
+    // separately, also for Laplace operators with coefficients
+    const size_t d = 4;
+    const size_t l = 4;
+    const double operatorFactor = -0.37;
+    sgpp::base::DataVector coef(d);
+
+    for (size_t k = 0; k < d; k++) {
+      coef[k] = 0.5 * static_cast<double>(k);
+    }
+
+    std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+    grids.emplace_back(sgpp::base::Grid::createLinearGrid(d));
+    grids.emplace_back(sgpp::base::Grid::createLinearBoundaryGrid(d));
+
+    for (auto& grid : grids) {
+      grid->getGenerator().regular(l);
+      const size_t n = grid->getSize();
+      sgpp::base::DataVector alpha(n);
+
+      for (size_t i = 0; i < n; i++) {
+        alpha[i] = std::sin(static_cast<double>(i));
+      }
+
+      std::unique_ptr<sgpp::base::OperationMatrix> opMass(
+          sgpp::op_factory::createOperationLTwoDotProduct(*grid));
+      sgpp::base::DataVector resultMass(n);
+      opMass->mult(alpha, resultMass);
+
+      for (bool withCoef : {false, true}) {
+        std::unique_ptr<sgpp::base::OperationMatrix> opLaplace(
+            withCoef ? sgpp::op_factory::createOperationLaplace(*grid, coef)
+                     : sgpp::op_factory::createOperationLaplace(*grid));
+        sgpp::base::DataVector resultSeparate(resultMass);
+        sgpp::base::DataVector resultLaplace(n);
+        sgpp::base::DataVector resultFused(n);
+
+        opLaplace->mult(alpha, resultLaplace);
+        resultSeparate.axpy(operatorFactor, resultLaplace);
+        dynamic_cast<UpDownOneOpDim*>(opLaplace.get())
+            ->multWithMassMatrix(alpha, resultFused, operatorFactor);
+
+        for (size_t i = 0; i < n; i++) {
+          BOOST_CHECK_SMALL(resultFused[i] - resultSeparate[i], 1e-12);
+        }
+      }
+    }
+  }
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace pde
 }  // namespace sgpp
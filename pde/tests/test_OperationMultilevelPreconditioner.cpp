@@ -0,0 +1,100 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp_base.hpp>
+#include <sgpp_pde.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/pde/operation/hash/OperationMultilevelPreconditionerLinear.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+
+namespace sgpp {
+namespace pde {
+
+BOOST_AUTO_TEST_SUITE(testOperationMultilevelPreconditioner)
+
+BOOST_AUTO_TEST_CASE(testSymmetry) {
+  // the preconditioner has to be symmetric, also on adaptive grids
+  const size_t d = 3;
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(d));
+  grid->getGenerator().regular(4);
+
+  sgpp::base::DataVector refinementIndicator(grid->getSize(), 0.0);
+  refinementIndicator[grid->getSize() / 3] = 1.0;
+  refinementIndicator[grid->getSize() - 1] = 1.0;
+  sgpp::base::SurplusRefinementFunctor functor(refinementIndicator, 2);
+  grid->getGenerator().refine(functor);
+
+  const size_t n = grid->getSize();
+  sgpp::base::DataVector x(n);
+  sgpp::base::DataVector y(n);
+
+  for (size_t i = 0; i < n; i++) {
+    x[i] = std::sin(static_cast<double>(i));
+    y[i] = std::cos(static_cast<double>(3 * i));
+  }
+
+  OperationMultilevelPreconditionerLinear preconditioner(&grid->getStorage(), 1.0, 0.5);
+  sgpp::base::DataVector cx(n);
+  sgpp::base::DataVector cy(n);
+  preconditioner.mult(x, cx);
+  preconditioner.mult(y, cy);
+
+  BOOST_CHECK_CLOSE(cx.dotProduct(y), x.dotProduct(cy), 1e-10);
+  BOOST_CHECK_GT(cx.dotProduct(x), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(testIterationCounts) {
+  // the preconditioned iteration counts must not grow like the unpreconditioned ones
+  const size_t d = 2;
+  const double epsilon = 1e-8;
+  size_t iterationsCoarse = 0;
+
+  for (size_t l : {5, 8}) {
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(d));
+    grid->getGenerator().regular(l);
+    const size_t n = grid->getSize();
+
+    std::unique_ptr<sgpp::base::OperationMatrix> opLaplace(
+        sgpp::op_factory::createOperationLaplace(*grid));
+    OperationMultilevelPreconditionerLinear preconditioner(&grid->getStorage());
+
+    sgpp::base::DataVector b(n);
+
+    for (size_t i = 0; i < n; i++) {
+      b[i] = std::sin(static_cast<double>(i));
+    }
+
+    sgpp::base::DataVector alphaCG(n);
+    sgpp::base::DataVector alphaPCG(n);
+    sgpp::solver::ConjugateGradients cg(10000, epsilon);
+    sgpp::solver::PreconditionedConjugateGradients pcg(10000, epsilon, preconditioner);
+    cg.solve(*opLaplace, alphaCG, b);
+    pcg.solve(*opLaplace, alphaPCG, b);
+
+    for (size_t i = 0; i < n; i++) {
+      BOOST_CHECK_SMALL(alphaPCG[i] - alphaCG[i], 1e-5);
+    }
+
+    if (l == 5) {
+      iterationsCoarse = pcg.getNumberIterations();
+    } else {
+      BOOST_CHECK_LT(2 * pcg.getNumberIterations(), cg.getNumberIterations());
+      BOOST_CHECK_LE(pcg.getNumberIterations(), iterationsCoarse + 15);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace pde
+}  // namespace sgpp
@@ -7,6 +7,8 @@
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/tools/MonteCarloEstimator.hpp>
 #include <sgpp/globaldef.hpp>
 #include <sgpp/quadrature/Random.hpp>
 #include <sgpp/quadrature/sampling/HaltonSampleGenerator.hpp>
@@ -16,6 +18,7 @@
 
 #include <cmath>
 #include <iostream>
+#include <random>
 #include <vector>
 
 namespace sgpp {
@@ -24,7 +27,12 @@ namespace quadrature {
 OperationQuadratureMCAdvanced::OperationQuadratureMCAdvanced(sgpp::base::Grid& grid,
                                                              size_t numberOfSamples,
                                                              std::uint64_t seed)
-    : grid(&grid), numberOfSamples(numberOfSamples), seed(seed) {
+    : grid(&grid),
+      numberOfSamples(numberOfSamples),
+      seed(seed),
+      nextBlock(0),
+      standardError(0.0),
+      numberOfUsedSamples(0) {
   dimensions = grid.getDimension();
   myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed);
 }
@@ -32,7 +40,13 @@ OperationQuadratureMCAdvanced::OperationQuadratureMCAdvanced(sgpp::base::Grid& g
 OperationQuadratureMCAdvanced::OperationQuadratureMCAdvanced(size_t dimensions,
                                                              size_t numberOfSamples,
                                                              std::uint64_t seed)
-    : grid(nullptr), numberOfSamples(numberOfSamples), dimensions(dimensions), seed(seed) {
+    : grid(nullptr),
+      numberOfSamples(numberOfSamples),
+      dimensions(dimensions),
+      seed(seed),
+      nextBlock(0),
+      standardError(0.0),
+      numberOfUsedSamples(0) {
   myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed);
 }
 
@@ -48,6 +62,7 @@ void OperationQuadratureMCAdvanced::useNaiveMonteCarlo() {
   }
 
   myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed);
+  nextBlock = 0;
 }
 
 void OperationQuadratureMCAdvanced::useStratifiedMonteCarlo(
@@ -86,6 +101,55 @@ double OperationQuadratureMCAdvanced::doQuadrature(sgpp::base::DataVector& alpha
   return res.sum() / static_cast<double>(numberOfSamples);
 }
 
+double OperationQuadratureMCAdvanced::doQuadratureStreaming(sgpp::base::DataVector& alpha,
+                                                            double targetError,
+                                                            size_t blockSize) {
+  const bool independentBlocks =
+      (dynamic_cast<sgpp::quadrature::NaiveSampleGenerator*>(myGenerator) != nullptr);
+
+  // the standard error of dependent samples (quasi-MC, Latin hypercube, strata) is not
+  // estimated correctly, so it must not be used as stopping criterion
+  if (!independentBlocks && targetError > 0.0) {
+    throw sgpp::base::application_exception(
+        "OperationQuadratureMCAdvanced::doQuadratureStreaming: early stopping is only "
+        "supported for naive Monte Carlo");
+  }
+
+  size_t firstBlock = 0;
+
+  if (independentBlocks) {
+    firstBlock = nextBlock;
+    nextBlock += (numberOfSamples + blockSize - 1) / blockSize;
+  }
+
+  sgpp::base::MonteCarloEstimator estimator = sgpp::base::MonteCarloEstimator::estimate(
+      dimensions, numberOfSamples, blockSize, targetError,
+      [&](size_t block, sgpp::base::DataMatrix& points, sgpp::base::DataVector& values) {
+        if (independentBlocks) {
+          std::mt19937_64 rng =
+              sgpp::base::MonteCarloEstimator::createBlockGenerator(seed, firstBlock + block);
+          std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+          for (size_t i = 0; i < points.getNrows(); i++) {
+            for (size_t d = 0; d < dimensions; d++) {
+              points.set(i, d, distribution(rng));
+            }
+          }
+        } else {
+#pragma omp critical(OperationQuadratureMCAdvancedGenerator)
+          myGenerator->getSamples(points);
+        }
+
+        std::unique_ptr<sgpp::base::OperationMultipleEval>(
+            sgpp::op_factory::createOperationMultipleEval(*grid, points))
+            ->mult(alpha, values);
+      });
+
+  standardError = estimator.getStandardError();
+  numberOfUsedSamples = estimator.getNumberOfSamples();
+  return estimator.getMean();
+}
+
 double OperationQuadratureMCAdvanced::doQuadratureFunc(FUNC func, void* clientdata) {
   // double* p = new double[dimensions];
 
@@ -64,6 +64,36 @@ class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
    */
   virtual double doQuadrature(sgpp::base::DataVector& alpha);
 
+  /**
+   * @brief Quadrature using advanced MC in @f$\Omega=[0,1]^d@f$, streaming the samples.
+   * The samples are drawn and evaluated in blocks by all threads and reduced with
+   * compensated summation (see base::MonteCarloEstimator), so the memory does not depend on
+   * numberOfSamples. For naive MC, every block has its own random number generator. The other
+   * sample generators produce dependent samples, so the blocks are drawn one after another
+   * from the generator, while the evaluation is still parallel. Every call continues the
+   * sample sequence of the previous one.
+   *
+   * The standard error is estimated under the assumption of independent samples, which only
+   * holds for naive MC. Hence, early stopping is only supported for naive MC.
+   *
+   * @param alpha       Coefficient vector for current grid
+   * @param targetError Stop as soon as the estimated standard error is at most targetError
+   *                    (zero to use all samples, has to be zero unless naive MC is used)
+   * @param blockSize   Number of samples per block
+   */
+  double doQuadratureStreaming(sgpp::base::DataVector& alpha, double targetError = 0.0,
+                               size_t blockSize = 1024);
+
+  /**
+   * @return estimated standard error of the last call of doQuadratureStreaming
+   */
+  double getStandardError() const { return standardError; }
+
+  /**
+   * @return number of samples used by the last call of doQuadratureStreaming
+   */
+  size_t getNumberOfUsedSamples() const { return numberOfUsedSamples; }
+
   /**
    * @brief Quadrature of an arbitrary function using
    * advanced MC in @f$\Omega=[0,1]^d@f$.
@@ -135,9 +165,16 @@ class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
 
   // seed for the sample generator
   std::uint64_t seed;
+  // number of the first block generator of the next streaming quadrature with naive MC
+  size_t nextBlock;
 
   // SampleGenerator Instance
   sgpp::quadrature::SampleGenerator* myGenerator;
+
+  // estimated standard error of the last streaming quadrature
+  double standardError;
+  // number of samples of the last streaming quadrature
+  size_t numberOfUsedSamples;
 };
 
 }  // namespace quadrature
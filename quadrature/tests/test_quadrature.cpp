@@ -26,6 +26,7 @@ std::string normalize_test_case_name(const_string name) {
 #endif
 
 #include <sgpp_base.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
 #include <sgpp_quadrature.hpp>
@@ -116,6 +117,19 @@ void testOperationQuadratureMCAdvanced(Grid& grid, DataVector& alpha,
 
   double resMC = opQuad->doQuadrature(alpha);
   BOOST_CHECK_CLOSE(resMC, analyticResult, tol * 1e2);
+
+  double resStreaming = opQuad->doQuadratureStreaming(alpha);
+  BOOST_CHECK_EQUAL(opQuad->getNumberOfUsedSamples(), numSamples);
+  BOOST_CHECK_CLOSE(resStreaming, analyticResult, tol * 1e2);
+
+  if (samplerType == sgpp::quadrature::SamplerTypes::Naive) {
+    // the next call uses new samples
+    BOOST_CHECK_NE(opQuad->doQuadratureStreaming(alpha), resStreaming);
+  } else {
+    // the standard error of dependent samples is no valid stopping criterion
+    BOOST_CHECK_THROW(opQuad->doQuadratureStreaming(alpha, 1e-3),
+                      sgpp::base::application_exception);
+  }
 }
 
 BOOST_AUTO_TEST_CASE(testOperationMCAdvanced) {
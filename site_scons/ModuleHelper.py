@@ -43,8 +43,10 @@ class Module(object):
             "which is currently not enabled. Please enable it by setting SG_{}=1.".format(
                 module[4:].upper()))
 
-  def scanSource(self, sourceFolder="src"):
+  def scanSource(self, sourceFolder="src", kernelFiles=[]):
     """Scan the given directory for source and header files.
+    The source files in kernelFiles are compiled once per instruction set
+    if KERNEL_DISPATCH is enabled (see sgpp::base::CPUFeatures).
     """
     # the sourceFolder is relative to the current directory
     # ==> make absolute path
@@ -71,7 +73,10 @@ class Module(object):
           if fileName in self.excludeFiles: continue
           cpp = os.path.join(currentFolder, fileName)
           self.cpps.append(cpp)
-          self.objs.append(env.SharedObject(cpp))
+          if (fileName in kernelFiles) and env.get("KERNEL_DISPATCH_FLAGS"):
+            self.objs.extend(self.compileKernelVariants(cpp))
+          else:
+            self.objs.append(env.SharedObject(cpp))
 
           # process cuda source files if cuda is enabled
         if env["USE_CUDA"]:
@@ -92,6 +97,16 @@ class Module(object):
       headerSourceList.append(hpp)
       headerDestList.append(hpp)
 
+  def compileKernelVariants(self, cpp):
+    """Compile a kernel source file once for each instruction set in KERNEL_DISPATCH_FLAGS.
+    """
+    objs = []
+    for instructionSet, flags in sorted(env["KERNEL_DISPATCH_FLAGS"].items()):
+      target = os.path.splitext(cpp)[0] + "_" + instructionSet
+      objs.append(env.SharedObject(target=target, source=cpp,
+                                   CPPFLAGS=env["CPPFLAGS"] + flags))
+    return objs
+
   def buildLibrary(self):
     """Build the module.
     """
@@ -261,6 +276,47 @@ class Module(object):
       testRun = env.BoostTest(self.boostTestExecutable + "_run", self.boostTestExecutable)
       boostTestRunTargetList.append(testRun)
 
+  def buildBenchmarks(self, benchmarkFolder="benchmarks"):
+    """Compile the benchmarks (see sgpp::base::Benchmark).
+    The benchmarks are only built if the "benchmarks" target is given.
+    """
+    # set libraries
+    benchmarkEnv = env.Clone()
+    benchmarkEnv.AppendUnique(LIBS=[self.libname] +
+                                   self.moduleDependencies + self.additionalDependencies)
+
+    benchmarkObjs = []
+
+    # for each benchmark
+    for currentFolder, subdirNames, fileNames in os.walk(benchmarkFolder, topdown=True):
+      for fileName in fnmatch.filter(fileNames, "*.cpp"):
+        # source file
+        cpp = os.path.join(currentFolder, fileName)
+        self.cpps.append(cpp)
+        benchmarkObjs.append(benchmarkEnv.SharedObject(cpp))
+      for fileName in fnmatch.filter(fileNames, "*.hpp"):
+        # header file
+        hpp = os.path.join(currentFolder, fileName)
+        self.hpps.append(hpp)
+
+    # only build benchmark executable if there are any benchmarks
+    if len(benchmarkObjs) > 0:
+      self.benchmarkExecutable = \
+          os.path.join(benchmarkFolder, "benchmark_{}".format(moduleName)) + \
+          (".exe" if env["PLATFORM"] == "win32" else "")
+      benchmark = benchmarkEnv.Program(self.benchmarkExecutable, benchmarkObjs)
+      benchmarkEnv.Depends(benchmark, self.libInstall)
+      benchmarkTargetList.append(benchmark)
+
+      # run the benchmarks and write the results to benchmark_<module>.json
+      # (only if the "benchmarks" target is given)
+      benchmarkRun = env.BenchmarkRun(
+          os.path.join(benchmarkFolder, "benchmark_{}.json".format(moduleName)),
+          self.benchmarkExecutable)
+      # timings are never up-to-date
+      env.AlwaysBuild(benchmarkRun)
+      benchmarkRunTargetList.append(benchmarkRun)
+
   def checkStyle(self):
     """Run the style checks.
     """
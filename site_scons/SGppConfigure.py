@@ -62,6 +62,13 @@ def doConfigure(env, moduleFolders, languageWrapperFolders):
                              "Available configurations are:",
                              "gnu, clang, intel, openmpi, mpich, intel.mpi")
 
+  configureKernelDispatch(config)
+
+  if config.env["USE_TRACING"]:
+    # compile the instrumentation of sgpp::base::Tracer (SGPP_TRACE_SCOPE/SGPP_TRACE_COUNT)
+    config.env["CPPDEFINES"]["SGPP_TRACING"] = "1"
+    Helper.printInfo("Tracing of operations and solvers enabled (see sgpp::base::Tracer).")
+
   if config.env["COMPILER"] in ("openmpi", "mpich", "intel.mpi"):
     config.env["CPPDEFINES"]["USE_MPI"] = "1"
     config.env["USE_MPI"] = True # tells scons to build MPI related examples and operations
@@ -645,6 +652,28 @@ def configureIntelCompiler(config):
     Helper.printErrorAndExit("You must specify a valid ARCH value for intel.",
                              "Available configurations are: sse3, sse4.2, avx, avx2, avx512, mic")
 
+def configureKernelDispatch(config):
+  # flags of the kernel variants, each one also switches off the higher instruction sets
+  # that might be enabled by ARCH, as the flags are appended to the global ones
+  config.env["KERNEL_DISPATCH_FLAGS"] = {}
+
+  if not config.env["KERNEL_DISPATCH"]:
+    return
+
+  if config.env["COMPILER"] not in ("gnu", "clang", "openmpi", "mpich"):
+    Helper.printErrorAndExit("KERNEL_DISPATCH is only supported for gnu and clang.")
+
+  config.env["KERNEL_DISPATCH_FLAGS"] = {
+    "generic": ["-mno-sse3"],
+    "sse3": ["-mno-avx", "-msse3"],
+    "avx": ["-mno-avx512f", "-mno-avx2", "-mno-fma", "-mno-fma4", "-mavx"],
+    "avx2": ["-mno-avx512f", "-mavx2", "-mfma"],
+    "avx512": ["-mavx512f", "-mavx512cd", "-mfma"],
+  }
+  config.env["CPPDEFINES"]["SGPP_KERNEL_DISPATCH"] = "1"
+  Helper.printInfo("Kernel dispatch enabled, the streaming kernels are compiled for: " +
+                   ", ".join(sorted(config.env["KERNEL_DISPATCH_FLAGS"].keys())))
+
 def detectGSL(config):
   if "GSL_INCLUDE_PATH" in config.env:
     config.env.AppendUnique(CPPPATH=[config.env["GSL_INCLUDE_PATH"]])
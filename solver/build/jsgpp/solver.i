@@ -12,6 +12,7 @@
 %include "solver/src/sgpp/solver/ODESolver.hpp"
 %feature("director") ConjugateGradients;
 %include "solver/src/sgpp/solver/sle/ConjugateGradients.hpp"
+%include "solver/src/sgpp/solver/sle/PreconditionedConjugateGradients.hpp"
 %include "solver/src/sgpp/solver/sle/BiCGStab.hpp"
 %include "solver/src/sgpp/solver/ode/Euler.hpp"
 %include "solver/src/sgpp/solver/ode/CrankNicolson.hpp"
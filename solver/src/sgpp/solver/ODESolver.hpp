@@ -12,6 +12,7 @@
 
 #include <sgpp/solver/SGSolver.hpp>
 #include <sgpp/solver/SLESolver.hpp>
+#include <sgpp/solver/ode/SolutionExtrapolation.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -46,6 +47,37 @@ class ODESolver : public SGSolver {
   virtual void solve(SLESolver& LinearSystemSolver,
                      sgpp::solver::OperationParabolicPDESolverSystem& System,
                      bool bIdentifyLastStep = false, bool verbose = false) = 0;
+
+  /**
+   * Sets the polynomial degree of the extrapolation of the previous time steps' solutions
+   * that is used as start vector for the linear system solver (default: 2).
+   *
+   * @param order polynomial degree (0: start with the previous solution)
+   */
+  void setSolutionExtrapolationOrder(size_t order) { solutionExtrapolation.setOrder(order); }
+
+ protected:
+  /// extrapolation of the previous solutions for the start vectors of the linear system solver
+  SolutionExtrapolation solutionExtrapolation;
+
+  /**
+   * Solves the linear system of one time step, starting with the extrapolated solution
+   * of the previous time steps.
+   *
+   * @param LinearSystemSolver linear system solver
+   * @param System system of the current time step
+   * @param rhs right hand side of the current time step
+   * @param time time at the beginning of the time step
+   * @param timestepSize size of the time step
+   */
+  void solveTimestep(SLESolver& LinearSystemSolver,
+                     sgpp::solver::OperationParabolicPDESolverSystem& System,
+                     sgpp::base::DataVector& rhs, double time, double timestepSize) {
+    sgpp::base::DataVector& alpha = *System.getGridCoefficientsForCG();
+    solutionExtrapolation.extrapolate(alpha, time, timestepSize);
+    LinearSystemSolver.solve(System, alpha, rhs, true, false, -1.0);
+    solutionExtrapolation.store(alpha, time + timestepSize);
+  }
 };
 
 }  // namespace solver
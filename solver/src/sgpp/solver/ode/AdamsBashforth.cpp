@@ -41,7 +41,8 @@ void AdamsBashforth::solve(SLESolver& LinearSystemSolver,
     rhs = System.generateRHS();
 
     // solve the system of the current timestep
-    LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+    solveTimestep(LinearSystemSolver, System, *rhs, static_cast<double>(i) * this->myEpsilon,
+                  this->myEpsilon);
 
     allIter += LinearSystemSolver.getNumberIterations();
 
@@ -0,0 +1,133 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/ode/SolutionExtrapolation.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+SolutionExtrapolation::SolutionExtrapolation(size_t order)
+    : order(order), solutions(order + 2), times(order + 2, 0.0), numberOfSolutions(0) {}
+
+SolutionExtrapolation::~SolutionExtrapolation() {}
+
+void SolutionExtrapolation::setOrder(size_t order) {
+  this->order = order;
+  solutions.resize(order + 2);
+  times.resize(order + 2);
+  reset();
+}
+
+size_t SolutionExtrapolation::getOrder() const { return order; }
+
+void SolutionExtrapolation::extrapolate(sgpp::base::DataVector& alpha, double time,
+                                        double timestepSize) {
+  if (order == 0) {
+    return;
+  }
+
+  const size_t current = findTime(time);
+
+  // the stored solutions are only valid if the current solution has not been modified
+  if ((current == numberOfSolutions) || (solutions[current].getSize() != alpha.getSize()) ||
+      (solutions[current] != alpha)) {
+    reset();
+    store(alpha, time);
+    return;
+  }
+
+  // interpolation points: current solution and the stored solutions closest to the new time
+  const double newTime = time + timestepSize;
+  std::vector<size_t> nodes(1, current);
+
+  while (nodes.size() < std::min(order + 1, numberOfSolutions)) {
+    size_t closest = numberOfSolutions;
+
+    for (size_t j = 0; j < numberOfSolutions; j++) {
+      if ((std::find(nodes.begin(), nodes.end(), j) == nodes.end()) &&
+          ((closest == numberOfSolutions) ||
+           (std::abs(times[j] - newTime) < std::abs(times[closest] - newTime)))) {
+        closest = j;
+      }
+    }
+
+    nodes.push_back(closest);
+  }
+
+  if (nodes.size() == 1) {
+    return;
+  }
+
+  // Lagrange extrapolation, alpha already contains the current solution
+  for (size_t j = 0; j < nodes.size(); j++) {
+    double weight = 1.0;
+
+    for (size_t k = 0; k < nodes.size(); k++) {
+      if (k != j) {
+        weight *= (newTime - times[nodes[k]]) / (times[nodes[j]] - times[nodes[k]]);
+      }
+    }
+
+    if (j == 0) {
+      alpha.mult(weight);
+    } else {
+      alpha.axpy(weight, solutions[nodes[j]]);
+    }
+  }
+}
+
+void SolutionExtrapolation::store(const sgpp::base::DataVector& alpha, double time) {
+  if (order == 0) {
+    return;
+  }
+
+  if ((numberOfSolutions > 0) && (solutions[0].getSize() != alpha.getSize())) {
+    reset();
+  }
+
+  size_t index = findTime(time);
+
+  if (index == numberOfSolutions) {
+    if (numberOfSolutions < solutions.size()) {
+      numberOfSolutions++;
+    } else {
+      // replace the solution farthest away in time
+      index = 0;
+
+      for (size_t j = 1; j < numberOfSolutions; j++) {
+        if (std::abs(times[j] - time) > std::abs(times[index] - time)) {
+          index = j;
+        }
+      }
+    }
+  }
+
+  // copy assignment reuses the memory of the buffer if the size is unchanged
+  solutions[index] = alpha;
+  times[index] = time;
+}
+
+void SolutionExtrapolation::reset() { numberOfSolutions = 0; }
+
+size_t SolutionExtrapolation::findTime(double time) const {
+  const double tolerance = 1e-10 * std::max(1.0, std::abs(time));
+
+  for (size_t j = 0; j < numberOfSolutions; j++) {
+    if (std::abs(times[j] - time) <= tolerance) {
+      return j;
+    }
+  }
+
+  return numberOfSolutions;
+}
+
+}  // namespace solver
+}  // namespace sgpp
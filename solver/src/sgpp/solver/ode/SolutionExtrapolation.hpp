@@ -0,0 +1,100 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Stores the solutions of the last time steps of an ODE solver and extrapolates them
+ * polynomially (Lagrange interpolation in time) to obtain the start vector for the iterative
+ * solution of the next time step. As the SLE solvers stop relative to the residuum of the
+ * zero vector, a better start vector directly saves iterations.
+ *
+ * The stored solutions are only used if the start vector of a time step equals the stored
+ * solution at the current time, i.e., the history is discarded automatically if the grid has
+ * been coarsened or refined in between or a time step has been rejected with changed
+ * coefficients. Solutions of rejected time steps (e.g., predictor steps of a step size
+ * control) are kept, as they are good interpolation points for the repeated step.
+ *
+ * The buffers are allocated once, such that no memory is allocated in the time stepping loop
+ * (as long as the grid does not change).
+ */
+class SolutionExtrapolation {
+ public:
+  /**
+   * Constructor
+   *
+   * @param order polynomial degree of the extrapolation (0: previous solution, i.e.,
+   *              no extrapolation, 1: linear, 2: quadratic, ...)
+   */
+  explicit SolutionExtrapolation(size_t order = 2);
+
+  /**
+   * Destructor
+   */
+  ~SolutionExtrapolation();
+
+  /**
+   * @param order polynomial degree of the extrapolation (discards the stored solutions)
+   */
+  void setOrder(size_t order);
+
+  /**
+   * @return polynomial degree of the extrapolation
+   */
+  size_t getOrder() const;
+
+  /**
+   * Overwrites the solution at the current time with the extrapolated solution at the next
+   * time, if enough stored solutions are available.
+   *
+   * @param alpha solution at time \f$t\f$ (input), start vector for time
+   *              \f$t + \tau\f$ (output)
+   * @param time current time \f$t\f$
+   * @param timestepSize time step size \f$\tau\f$
+   */
+  void extrapolate(sgpp::base::DataVector& alpha, double time, double timestepSize);
+
+  /**
+   * Stores a solution (replacing the stored solution at the same time, if any).
+   *
+   * @param alpha solution
+   * @param time time of the solution
+   */
+  void store(const sgpp::base::DataVector& alpha, double time);
+
+  /**
+   * Discards all stored solutions.
+   */
+  void reset();
+
+ protected:
+  /// polynomial degree of the extrapolation
+  size_t order;
+  /// stored solutions (the first numberOfSolutions entries are valid)
+  std::vector<sgpp::base::DataVector> solutions;
+  /// times of the stored solutions
+  std::vector<double> times;
+  /// number of stored solutions
+  size_t numberOfSolutions;
+
+  /**
+   * @param time time
+   * @return index of the stored solution at the given time or numberOfSolutions if there is none
+   */
+  size_t findTime(double time) const;
+};
+
+}  // namespace solver
+}  // namespace sgpp
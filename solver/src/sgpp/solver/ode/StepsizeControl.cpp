@@ -21,7 +21,7 @@ namespace solver {
 
 StepsizeControl::StepsizeControl(size_t imax, double timestepSize, double eps, double sc,
                                  sgpp::base::ScreenOutput* screen, double gamma)
-    : ODESolver(imax, timestepSize), myScreen(screen), _gamma(gamma) {
+    : ODESolver(imax, timestepSize), myScreen(screen), _gamma(gamma), currentTime(0.0) {
   this->residuum = 0.0;
   this->myEps = eps;
   this->mySC = sc;
@@ -125,6 +125,7 @@ void StepsizeControl::solve(SLESolver& LinearSystemSolver,
 
     YkImEul.resize(System.getGridCoefficients()->getSize());
 
+    this->currentTime = time;
     predictor(LinearSystemSolver, System, tmp_timestepsize, YkAdBas, YkImEul, rhs);
 
     corrector(LinearSystemSolver, System, tmp_timestepsize, YkImEul, rhs);
@@ -63,6 +63,9 @@ class StepsizeControl : public ODESolver {
   /// damping factor
   double _gamma;
 
+  /// time at the beginning of the current time step
+  double currentTime;
+
  public:
   /**
    * Std-Constructer
@@ -57,7 +57,7 @@ void StepsizeControlEJ::corrector(SLESolver& LinearSystemSolver,
   rhs = System.generateRHS();
 
   // solve the system of the current timestep
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  solveTimestep(LinearSystemSolver, System, *rhs, this->currentTime, tmp_timestepsize);
 
   System.finishTimestep();
   dv.resize(System.getGridCoefficients()->getSize());
@@ -43,7 +43,7 @@ void StepsizeControlH::predictor(SLESolver& LinearSystemSolver,
   rhs = System.generateRHS();
 
   // solve the system of the current timesteps
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  solveTimestep(LinearSystemSolver, System, *rhs, this->currentTime, tmp_timestepsize);
 
   System.finishTimestep();
 
@@ -64,12 +64,13 @@ void StepsizeControlH::corrector(SLESolver& LinearSystemSolver,
   rhs = System.generateRHS();
 
   // solve the system of the current timesteps
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  solveTimestep(LinearSystemSolver, System, *rhs, this->currentTime, tmp_timestepsize / 2.0);
   System.finishTimestep();
 
   rhs = System.generateRHS();
 
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  solveTimestep(LinearSystemSolver, System, *rhs, this->currentTime + tmp_timestepsize / 2.0,
+                tmp_timestepsize / 2.0);
   System.finishTimestep();
 
   dv.resize(System.getGridCoefficients()->getSize());
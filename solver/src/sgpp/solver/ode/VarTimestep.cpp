@@ -47,7 +47,7 @@ void VarTimestep::predictor(SLESolver& LinearSystemSolver,
   rhs = System.generateRHS();
 
   // solve the system of the current timestep
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  solveTimestep(LinearSystemSolver, System, *rhs, this->currentTime, tmp_timestepsize);
 
   System.finishTimestep();
 
@@ -68,7 +68,7 @@ void VarTimestep::corrector(SLESolver& LinearSystemSolver,
   rhs = System.generateRHS();
 
   // solve the system of the current timestep
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  solveTimestep(LinearSystemSolver, System, *rhs, this->currentTime, tmp_timestepsize);
 
   System.finishTimestep();
 
@@ -4,6 +4,7 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/solver/sle/BiCGStab.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <cmath>
@@ -17,6 +18,7 @@ BiCGStab::~BiCGStab() {}
 
 void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
                      sgpp::base::DataVector& b, bool reuse, bool verbose, double max_threshold) {
+  SGPP_TRACE_SCOPE("BiCGStab::solve");
   this->nIterations = 1;
   double epsilonSqd = this->myEpsilon * this->myEpsilon;
 
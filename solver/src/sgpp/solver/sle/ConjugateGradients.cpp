@@ -7,6 +7,7 @@
 #include <mpi.h>
 #endif
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -22,6 +23,7 @@ ConjugateGradients::~ConjugateGradients() {}
 void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
                                sgpp::base::DataVector& alpha, sgpp::base::DataVector& b, bool reuse,
                                bool verbose, double max_threshold) {
+  SGPP_TRACE_SCOPE("ConjugateGradients::solve");
   this->starting();
 
   if (verbose == true) {
@@ -138,6 +140,7 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
     d.add(r);
 
     this->nIterations++;
+    SGPP_TRACE_COUNT(CGIterations, 1);
   }
 
   this->residuum = delta_new;
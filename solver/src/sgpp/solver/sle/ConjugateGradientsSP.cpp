@@ -7,6 +7,7 @@
 #include <mpi.h>
 #endif
 #include <sgpp/solver/sle/ConjugateGradientsSP.hpp>
+#include <sgpp/base/tools/Tracing.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -21,6 +22,7 @@ ConjugateGradientsSP::~ConjugateGradientsSP() {}
 void ConjugateGradientsSP::solve(sgpp::base::OperationMatrixSP& SystemMatrix,
                                  sgpp::base::DataVectorSP& alpha, sgpp::base::DataVectorSP& b,
                                  bool reuse, bool verbose, float max_threshold) {
+  SGPP_TRACE_SCOPE("ConjugateGradientsSP::solve");
   if (verbose == true) {
     std::cout << "Starting Conjugated Gradients" << std::endl;
   }
@@ -115,6 +117,7 @@ void ConjugateGradientsSP::solve(sgpp::base::OperationMatrixSP& SystemMatrix,
     d.add(r);
 
     this->nIterations++;
+    SGPP_TRACE_COUNT(CGIterations, 1);
   }
 
   this->residuum = delta_new;
@@ -0,0 +1,56 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Conjugate gradients with a symmetric positive definite preconditioner \f$C \approx A^{-1}\f$,
+ * e.g., pde::OperationMultilevelPreconditionerLinear.
+ * The stopping criterion is the same as in ConjugateGradients, i.e., the iteration stops if the
+ * squared Euclidean norm of the (unpreconditioned) residual has been reduced by
+ * \f$\varepsilon^2\f$, hence the results are comparable.
+ */
+class PreconditionedConjugateGradients : public ConjugateGradients {
+ public:
+  /**
+   * Constructor
+   *
+   * @param imax number of maximum executed iterations
+   * @param epsilon the final error in the iterative solver
+   * @param preconditioner preconditioner (applied with mult())
+   */
+  PreconditionedConjugateGradients(size_t imax, double epsilon,
+                                   sgpp::base::OperationMatrix& preconditioner);
+
+  /**
+   * Destructor
+   */
+  ~PreconditionedConjugateGradients() override;
+
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
+             double max_threshold = -1.0) override;
+
+  /**
+   * @param preconditioner new preconditioner
+   */
+  void setPreconditioner(sgpp::base::OperationMatrix& preconditioner);
+
+ protected:
+  /// preconditioner
+  sgpp::base::OperationMatrix* preconditioner;
+};
+
+}  // namespace solver
+}  // namespace sgpp
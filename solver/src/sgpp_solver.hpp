@@ -7,9 +7,11 @@
 #define SOLVER_HPP
 
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PreconditionedConjugateGradients.hpp>
 #include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/solver/ode/Euler.hpp>
 #include <sgpp/solver/ode/CrankNicolson.hpp>
+#include <sgpp/solver/ode/SolutionExtrapolation.hpp>
 #include <sgpp/solver/ode/AdamsBashforth.hpp>
 #include <sgpp/solver/ode/VarTimestep.hpp>
 #include <sgpp/solver/ode/StepsizeControl.hpp>
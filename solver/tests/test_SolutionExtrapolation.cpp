@@ -0,0 +1,103 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/solver/ode/SolutionExtrapolation.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+
+using sgpp::base::DataVector;
+using sgpp::solver::SolutionExtrapolation;
+
+namespace {
+
+DataVector quadraticSolution(double t) {
+  DataVector alpha(3);
+  alpha[0] = 1.0 + 2.0 * t - 3.0 * t * t;
+  alpha[1] = std::sin(1.0) * t * t;
+  alpha[2] = -0.5 * t;
+  return alpha;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestSolutionExtrapolation)
+
+BOOST_AUTO_TEST_CASE(testQuadraticExtrapolation) {
+  // quadratic extrapolation is exact for solutions which are quadratic in time
+  const double tau = 0.1;
+  SolutionExtrapolation extrapolation(2);
+
+  for (size_t i = 0; i < 3; i++) {
+    extrapolation.store(quadraticSolution(static_cast<double>(i) * tau),
+                        static_cast<double>(i) * tau);
+  }
+
+  DataVector alpha = quadraticSolution(2.0 * tau);
+  extrapolation.extrapolate(alpha, 2.0 * tau, tau);
+  DataVector expected = quadraticSolution(3.0 * tau);
+
+  for (size_t j = 0; j < alpha.getSize(); j++) {
+    BOOST_CHECK_SMALL(alpha[j] - expected[j], 1e-12);
+  }
+
+  // non-uniform time steps (e.g., halved step sizes of a step size control)
+  extrapolation.store(expected, 3.0 * tau);
+  alpha = expected;
+  extrapolation.extrapolate(alpha, 3.0 * tau, 0.5 * tau);
+  expected = quadraticSolution(3.5 * tau);
+
+  for (size_t j = 0; j < alpha.getSize(); j++) {
+    BOOST_CHECK_SMALL(alpha[j] - expected[j], 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testInvalidHistory) {
+  // the history has to be discarded if the current solution has been modified
+  const double tau = 0.1;
+  SolutionExtrapolation extrapolation(2);
+
+  for (size_t i = 0; i < 3; i++) {
+    extrapolation.store(quadraticSolution(static_cast<double>(i) * tau),
+                        static_cast<double>(i) * tau);
+  }
+
+  DataVector alpha = quadraticSolution(2.0 * tau);
+  alpha[1] += 1.0;
+  const DataVector modified(alpha);
+  extrapolation.extrapolate(alpha, 2.0 * tau, tau);
+
+  for (size_t j = 0; j < alpha.getSize(); j++) {
+    BOOST_CHECK_EQUAL(alpha[j], modified[j]);
+  }
+
+  // a changed number of grid points invalidates the history, too
+  DataVector refined(4, 1.0);
+  extrapolation.extrapolate(refined, 2.0 * tau, tau);
+
+  for (size_t j = 0; j < refined.getSize(); j++) {
+    BOOST_CHECK_EQUAL(refined[j], 1.0);
+  }
+
+  // order 0 never changes the start vector
+  extrapolation.setOrder(0);
+  extrapolation.store(quadraticSolution(0.0), 0.0);
+  alpha = quadraticSolution(tau);
+  extrapolation.store(alpha, tau);
+  extrapolation.extrapolate(alpha, tau, tau);
+  const DataVector previous = quadraticSolution(tau);
+
+  for (size_t j = 0; j < alpha.getSize(); j++) {
+    BOOST_CHECK_EQUAL(alpha[j], previous[j]);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,82 @@
+#!/usr/bin/env python
+# Copyright (C) 2008-today The SG++ project
+# This file is part of the SG++ project. For conditions of distribution and
+# use, please see the copyright notice provided with SG++ or at
+# sgpp.sparsegrids.org
+
+from __future__ import print_function
+import argparse
+import json
+import sys
+
+
+
+def loadResults(path, metric):
+  """Load the benchmark results of a JSON file (written with --benchmark_out) as dictionary
+  mapping the benchmark names to the times. Repeated runs are summarized by their median
+  (or by the minimum if no aggregates are available)."""
+  with open(path, "r") as f: data = json.load(f)
+
+  iterations = {}
+  medians = {}
+
+  for benchmark in data["benchmarks"]:
+    name = benchmark.get("run_name", benchmark["name"])
+
+    if benchmark.get("run_type", "iteration") == "aggregate":
+      if benchmark.get("aggregate_name") == "median":
+        medians[name] = benchmark[metric]
+    else:
+      iterations[name] = min(iterations.get(name, float("inf")), benchmark[metric])
+
+  iterations.update(medians)
+  return iterations
+
+
+
+def main():
+  parser = argparse.ArgumentParser(description="Compares two benchmark results "
+                                   "(JSON files written by --benchmark_out) and reports "
+                                   "regressions.")
+  parser.add_argument("--threshold", type=float, default=0.1,
+                      help="Relative slowdown which is reported as regression (default: 0.1).")
+  parser.add_argument("--metric", choices=["real_time", "cpu_time"], default="real_time",
+                      help="Compared time (default: real_time).")
+  parser.add_argument("baseline", metavar="BASELINE", help="Results of the baseline")
+  parser.add_argument("current", metavar="CURRENT", help="Current results")
+  args = parser.parse_args()
+
+  baseline = loadResults(args.baseline, args.metric)
+  current = loadResults(args.current, args.metric)
+  regressions = []
+
+  print("{:<60} {:>14} {:>14} {:>8}".format("Benchmark", "Baseline [ns]", "Current [ns]",
+                                            "Change"))
+
+  for name in sorted(set(baseline) & set(current)):
+    change = (current[name] - baseline[name]) / baseline[name] if baseline[name] > 0 else 0.0
+    marker = ""
+
+    if change > args.threshold:
+      regressions.append(name)
+      marker = "  REGRESSION"
+
+    print("{:<60} {:>14.0f} {:>14.0f} {:>+7.1f}%{}".format(
+        name, baseline[name], current[name], 100.0 * change, marker))
+
+  for name in sorted(set(baseline) - set(current)):
+    print("{:<60} only in baseline".format(name))
+
+  for name in sorted(set(current) - set(baseline)):
+    print("{:<60} only in current results".format(name))
+
+  if len(regressions) > 0:
+    print("{} benchmark(s) slower than the baseline by more than {:.0f}%.".format(
+        len(regressions), 100.0 * args.threshold), file=sys.stderr)
+
+  sys.exit(0 if len(regressions) == 0 else 1)
+
+
+
+if __name__ == "__main__":
+  main()